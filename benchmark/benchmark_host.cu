@@ -0,0 +1,402 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include "heongpu_client.h"
+#include "harness/benchmark_harness.h"
+
+#include <cmath>
+#include <random>
+#include <sstream>
+
+// Host-side benchmarks. None of the cases below touch the GPU, so this
+// binary can be run on CI machines without a CUDA device to track the cost of
+// parameter generation and of the host-resident objects of the client library
+// (context loading, encoder tables, plaintext/ciphertext serialization and
+// stream compression). The GPU side of key serialization and the
+// bootstrapping precompute need a device and are measured by benchmark_suite.
+//
+// Examples:
+//   host_benchmark --filter='^host/ntt_tables' --N=16384,32768 --primes=8,16
+//   host_benchmark --filter='^host/client_' --N=32768 --primes=16
+//   host_benchmark --json=host.json
+
+using heongpu_bench::Options;
+using heongpu_bench::Params;
+using heongpu_bench::Runner;
+using heongpu_bench::time_host_ms;
+
+namespace
+{
+    std::vector<int> prime_bit_sizes(int prime_count)
+    {
+        std::vector<int> bit_sizes(prime_count, 40);
+        bit_sizes[0] = 50;
+        return bit_sizes;
+    }
+
+    // Writes a CKKS context in the layout of HEContext<Scheme::CKKS>::save, so
+    // the client objects can be built without generating a context on a
+    // device.
+    std::string ckks_context_stream(size_t N, int prime_count)
+    {
+        std::vector<int> bit_sizes = prime_bit_sizes(prime_count);
+        std::vector<Modulus64> primes =
+            heongpu::generate_primes(N, bit_sizes);
+
+        heongpu::sec_level_type sec_level = heongpu::sec_level_type::none;
+        heongpu::keyswitching_type keyswitching =
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I;
+        heongpu::limb_type key_limb_type = heongpu::limb_type::LIMB64;
+        int n = static_cast<int>(N);
+        int n_power = static_cast<int>(std::log2(N));
+        int P_size = 1;
+        int Q_size = prime_count - P_size;
+        int total_bit_count = 0;
+        for (int bit_size : bit_sizes)
+        {
+            total_bit_count += bit_size;
+        }
+
+        std::vector<int> Q_bit_sizes(bit_sizes.begin(),
+                                     bit_sizes.begin() + Q_size);
+        std::vector<int> P_bit_sizes(bit_sizes.begin() + Q_size,
+                                     bit_sizes.end());
+        std::vector<Data64> base_q;
+        for (int i = 0; i < Q_size; i++)
+        {
+            base_q.push_back(primes[i].value);
+        }
+
+        auto write_vector = [](std::ostream& os, const auto& input)
+        {
+            uint32_t count = input.size();
+            os.write((char*) &count, sizeof(count));
+            os.write((char*) input.data(), sizeof(input[0]) * count);
+        };
+
+        std::stringstream ss;
+        heongpu::serialformat::write_header(ss, heongpu::scheme_type::ckks);
+        ss.write((char*) &sec_level, sizeof(sec_level));
+        ss.write((char*) &keyswitching, sizeof(keyswitching));
+        ss.write((char*) &key_limb_type, sizeof(key_limb_type));
+        ss.write((char*) &n, sizeof(n));
+        ss.write((char*) &n_power, sizeof(n_power));
+        ss.write((char*) &Q_size, sizeof(Q_size)); // coeff_modulus
+        ss.write((char*) &total_bit_count, sizeof(total_bit_count));
+        ss.write((char*) &prime_count, sizeof(prime_count));
+        ss.write((char*) &Q_size, sizeof(Q_size));
+        ss.write((char*) &P_size, sizeof(P_size));
+        write_vector(ss, primes);
+        write_vector(ss, base_q);
+        write_vector(ss, bit_sizes);
+        write_vector(ss, Q_bit_sizes);
+        write_vector(ss, P_bit_sizes);
+        return ss.str();
+    }
+
+    // Writes a secret key in the layout of Secretkey<Scheme::CKKS>::save. The
+    // coefficients are random residues; only the sizes matter for timing.
+    std::string
+    ckks_secret_key_stream(size_t N,
+                           const std::vector<heongpu::client::Modulus>& primes)
+    {
+        heongpu::scheme_type scheme = heongpu::scheme_type::ckks;
+        int ring_size = static_cast<int>(N);
+        int coeff_modulus_count = static_cast<int>(primes.size());
+        int n_power = static_cast<int>(std::log2(N));
+        int hamming_weight = 0;
+        bool in_ntt_domain = true;
+        bool generated = true;
+        heongpu::client::storage_tag storage =
+            heongpu::client::storage_tag::HOST;
+
+        std::mt19937_64 gen(42);
+        std::vector<Data64> data(N * primes.size());
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            data[i] = gen() % primes[i / N].value;
+        }
+        uint32_t memory_size = data.size();
+
+        std::stringstream ss;
+        ss.write((char*) &scheme, sizeof(scheme));
+        ss.write((char*) &ring_size, sizeof(ring_size));
+        ss.write((char*) &coeff_modulus_count, sizeof(coeff_modulus_count));
+        ss.write((char*) &n_power, sizeof(n_power));
+        ss.write((char*) &hamming_weight, sizeof(hamming_weight));
+        ss.write((char*) &in_ntt_domain, sizeof(in_ntt_domain));
+        ss.write((char*) &generated, sizeof(generated));
+        ss.write((char*) &storage, sizeof(storage));
+        ss.write((char*) &memory_size, sizeof(memory_size));
+        ss.write((char*) data.data(), sizeof(Data64) * memory_size);
+        return ss.str();
+    }
+
+    void register_parameter_generation(Runner& runner)
+    {
+        const Options& options = runner.options();
+        for (const auto& n_str :
+             options.sweep("N", {"4096", "8192", "16384", "32768", "65536"}))
+        {
+            size_t N = std::stoull(n_str);
+            int n_power = static_cast<int>(std::log2(N));
+            for (const auto& prime_str :
+                 options.sweep("primes", {"4", "16", "32"}))
+            {
+                int prime_count = std::stoi(prime_str);
+                Params params = {{"N", n_str}, {"primes", prime_str}};
+
+                runner.add("host/generate_primes", params,
+                           [=]()
+                           {
+                               return time_host_ms(
+                                   [&]()
+                                   {
+                                       heongpu::generate_primes(
+                                           N, prime_bit_sizes(prime_count));
+                                   });
+                           });
+
+                runner.add(
+                    "host/ntt_tables", params,
+                    [=]()
+                    {
+                        std::vector<Modulus64> primes = heongpu::generate_primes(
+                            N, prime_bit_sizes(prime_count));
+                        return time_host_ms(
+                            [&]()
+                            {
+                                std::vector<Data64> psi =
+                                    heongpu::generate_primitive_root_of_unity(
+                                        N, primes);
+                                heongpu::generate_ntt_table(psi, primes,
+                                                            n_power);
+                                heongpu::generate_intt_table(psi, primes,
+                                                             n_power);
+                                heongpu::generate_n_inverse(N, primes);
+                            });
+                    });
+
+                runner.add(
+                    "host/rns_constants", params,
+                    [=]()
+                    {
+                        std::vector<Modulus64> primes = heongpu::generate_primes(
+                            N, prime_bit_sizes(prime_count));
+                        int P_size = 1;
+                        int Q_size = prime_count - P_size;
+                        return time_host_ms(
+                            [&]()
+                            {
+                                heongpu::calculate_last_q_modinv(
+                                    primes, prime_count, P_size);
+                                std::vector<Data64> half =
+                                    heongpu::calculate_half(primes, P_size);
+                                heongpu::calculate_half_mod(primes, half,
+                                                            prime_count, P_size);
+                                heongpu::calculate_factor(primes, Q_size,
+                                                          P_size);
+                                heongpu::calculate_Mi(primes, Q_size);
+                                heongpu::calculate_Mi_inv(primes, Q_size);
+                                heongpu::calculate_upper_half_threshold(
+                                    primes, Q_size);
+                            });
+                    });
+            }
+
+            runner.run();
+            runner.clear();
+        }
+    }
+
+    // Host-resident objects of the client library: a client context, a
+    // ciphertext encrypted on the CPU and their serialized streams.
+    struct ClientFixture
+    {
+        ClientFixture(size_t N, int prime_count)
+        {
+            context_stream = ckks_context_stream(N, prime_count);
+            std::stringstream context_ss(context_stream);
+            context.load(context_ss);
+
+            std::stringstream key_ss(
+                ckks_secret_key_stream(N, context.primes()));
+            secret_key.load(key_ss);
+
+            encoder = std::make_unique<heongpu::client::Encoder>(context);
+            encryptor = std::make_unique<heongpu::client::Encryptor>(
+                context, secret_key);
+
+            std::vector<double> message(N / 2, 0.5);
+            encoder->encode(plain, message, std::pow(2.0, 30));
+            encryptor->encrypt(cipher, plain);
+
+            std::stringstream plain_ss;
+            plain.save(plain_ss);
+            plain_stream = plain_ss.str();
+
+            std::stringstream cipher_ss;
+            cipher.save(cipher_ss);
+            cipher_stream = cipher_ss.str();
+
+            cipher_bytes.assign(cipher_stream.begin(), cipher_stream.end());
+            cipher_compressed = heongpu::serializer::compress(cipher_bytes);
+        }
+
+        std::string context_stream;
+        heongpu::client::Context context;
+        heongpu::client::Secretkey secret_key;
+        std::unique_ptr<heongpu::client::Encoder> encoder;
+        std::unique_ptr<heongpu::client::Encryptor> encryptor;
+        heongpu::client::Plaintext plain;
+        heongpu::client::Ciphertext cipher;
+        std::string plain_stream;
+        std::string cipher_stream;
+        std::vector<uint8_t> cipher_bytes;
+        std::vector<uint8_t> cipher_compressed;
+    };
+
+    void register_client_serialization(Runner& runner)
+    {
+        const Options& options = runner.options();
+        const std::vector<std::string> names = {
+            "context_load",   "encoder_tables", "plaintext_save",
+            "plaintext_load", "ciphertext_save", "ciphertext_load",
+            "compress",       "decompress"};
+
+        for (const auto& n_str : options.sweep("N", {"8192", "32768"}))
+        {
+            size_t N = std::stoull(n_str);
+            for (const auto& prime_str : options.sweep("primes", {"4", "16"}))
+            {
+                int prime_count = std::stoi(prime_str);
+                Params params = {{"N", n_str}, {"primes", prime_str}};
+
+                bool any = false;
+                for (const auto& name : names)
+                {
+                    any = any || runner.selected("host/client_" + name, params);
+                }
+                if (!any)
+                    continue;
+
+                auto fixture =
+                    std::make_shared<ClientFixture>(N, prime_count);
+
+                runner.add("host/client_context_load", params,
+                           [=]()
+                           {
+                               return time_host_ms(
+                                   [&]()
+                                   {
+                                       std::stringstream ss(
+                                           fixture->context_stream);
+                                       heongpu::client::Context context;
+                                       context.load(ss);
+                                   });
+                           });
+
+                runner.add("host/client_encoder_tables", params,
+                           [=]()
+                           {
+                               return time_host_ms(
+                                   [&]()
+                                   {
+                                       heongpu::client::Encoder encoder(
+                                           fixture->context);
+                                   });
+                           });
+
+                runner.add("host/client_plaintext_save", params,
+                           [=]()
+                           {
+                               return time_host_ms(
+                                   [&]()
+                                   {
+                                       std::stringstream ss;
+                                       fixture->plain.save(ss);
+                                   });
+                           });
+
+                runner.add("host/client_plaintext_load", params,
+                           [=]()
+                           {
+                               return time_host_ms(
+                                   [&]()
+                                   {
+                                       std::stringstream ss(
+                                           fixture->plain_stream);
+                                       heongpu::client::Plaintext plain;
+                                       plain.load(ss);
+                                   });
+                           });
+
+                runner.add("host/client_ciphertext_save", params,
+                           [=]()
+                           {
+                               return time_host_ms(
+                                   [&]()
+                                   {
+                                       std::stringstream ss;
+                                       fixture->cipher.save(ss);
+                                   });
+                           });
+
+                runner.add("host/client_ciphertext_load", params,
+                           [=]()
+                           {
+                               return time_host_ms(
+                                   [&]()
+                                   {
+                                       std::stringstream ss(
+                                           fixture->cipher_stream);
+                                       heongpu::client::Ciphertext cipher;
+                                       cipher.load(ss);
+                                   });
+                           });
+
+                runner.add("host/client_compress", params,
+                           [=]()
+                           {
+                               return time_host_ms(
+                                   [&]() {
+                                       heongpu::serializer::compress(
+                                           fixture->cipher_bytes);
+                                   });
+                           });
+
+                runner.add("host/client_decompress", params,
+                           [=]()
+                           {
+                               return time_host_ms(
+                                   [&]() {
+                                       heongpu::serializer::decompress(
+                                           fixture->cipher_compressed);
+                                   });
+                           });
+            }
+
+            runner.run();
+            runner.clear();
+        }
+    }
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Options options = Options::parse(argc, argv);
+
+    Runner runner("heongpu_host_suite", options);
+    runner.set_metadata("device", "host");
+
+    register_parameter_generation(runner);
+    register_client_serialization(runner);
+
+    runner.finish();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,739 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include "harness/benchmark_harness.h"
+
+#include <cmath>
+#include <random>
+#include <sstream>
+
+// Parameterised GPU micro-benchmarks for CKKS, BFV and TFHE primitives.
+//
+// Examples:
+//   benchmark_suite --filter='^ckks/(multiply|relinearize)' --N=8192,16384
+//   benchmark_suite --levels=4,8 --ks=I,II --json=results.json
+//   benchmark_suite --list
+
+using heongpu_bench::LazyFixture;
+using heongpu_bench::Options;
+using heongpu_bench::Params;
+using heongpu_bench::Runner;
+using heongpu_bench::time_host_ms;
+
+namespace
+{
+    class DeviceTimer
+    {
+      public:
+        DeviceTimer()
+        {
+            cudaEventCreate(&start_);
+            cudaEventCreate(&stop_);
+        }
+
+        ~DeviceTimer()
+        {
+            cudaEventDestroy(start_);
+            cudaEventDestroy(stop_);
+        }
+
+        template <typename F> double measure(F&& function)
+        {
+            cudaDeviceSynchronize();
+            cudaEventRecord(start_);
+            function();
+            cudaEventRecord(stop_);
+            cudaEventSynchronize(stop_);
+            float time = 0;
+            cudaEventElapsedTime(&time, start_, stop_);
+            return static_cast<double>(time);
+        }
+
+      private:
+        cudaEvent_t start_;
+        cudaEvent_t stop_;
+    };
+
+    heongpu::keyswitching_type parse_ks(const std::string& ks)
+    {
+        if (ks == "I")
+            return heongpu::keyswitching_type::KEYSWITCHING_METHOD_I;
+        if (ks == "II")
+            return heongpu::keyswitching_type::KEYSWITCHING_METHOD_II;
+        throw std::invalid_argument("Keyswitching method must be I or II!");
+    }
+
+    // Bit sizes follow the tables of benchmark_ckks.cu: {first Q prime, other
+    // Q primes, P prime, log2(scale)}.
+    std::vector<int> ckks_bit_sizes(size_t N)
+    {
+        switch (N)
+        {
+            case 4096:
+                return {40, 30, 40, 30};
+            case 8192:
+                return {40, 35, 40, 35};
+            case 16384:
+                return {50, 40, 50, 40};
+            case 32768:
+                return {60, 45, 60, 45};
+            case 65536:
+                return {60, 50, 60, 50};
+            default:
+                throw std::invalid_argument("Unsupported poly modulus degree!");
+        }
+    }
+
+    std::string default_levels(size_t N)
+    {
+        switch (N)
+        {
+            case 4096:
+                return "2";
+            case 8192:
+                return "4";
+            case 16384:
+                return "8";
+            case 32768:
+                return "16";
+            default:
+                return "32";
+        }
+    }
+
+    struct CKKSFixture
+    {
+        static constexpr auto Scheme = heongpu::Scheme::CKKS;
+
+        CKKSFixture(size_t N, int levels, heongpu::keyswitching_type ks)
+            : context(ks, heongpu::sec_level_type::none)
+        {
+            std::vector<int> bit_sizes = ckks_bit_sizes(N);
+            std::vector<int> log_Q(levels + 1, bit_sizes[1]);
+            log_Q[0] = bit_sizes[0];
+            std::vector<int> log_P = {bit_sizes[2]};
+            scale = std::pow(2.0, bit_sizes[3]);
+
+            context.set_poly_modulus_degree(N);
+            context.set_coeff_modulus_bit_sizes(log_Q, log_P);
+            context.generate();
+
+            keygen = std::make_unique<heongpu::HEKeyGenerator<Scheme>>(context);
+            secret_key = std::make_unique<heongpu::Secretkey<Scheme>>(context);
+            keygen->generate_secret_key(*secret_key);
+            public_key = std::make_unique<heongpu::Publickey<Scheme>>(context);
+            keygen->generate_public_key(*public_key, *secret_key);
+            relin_key = std::make_unique<heongpu::Relinkey<Scheme>>(context);
+            keygen->generate_relin_key(*relin_key, *secret_key);
+            std::vector<int> shifts = {1};
+            galois_key =
+                std::make_unique<heongpu::Galoiskey<Scheme>>(context, shifts);
+            keygen->generate_galois_key(*galois_key, *secret_key);
+
+            encoder = std::make_unique<heongpu::HEEncoder<Scheme>>(context);
+            encryptor = std::make_unique<heongpu::HEEncryptor<Scheme>>(
+                context, *public_key);
+            decryptor = std::make_unique<heongpu::HEDecryptor<Scheme>>(
+                context, *secret_key);
+            operators =
+                std::make_unique<heongpu::HEArithmeticOperator<Scheme>>(
+                    context, *encoder);
+
+            message = heongpu::HostVector<double>(N / 2, 1);
+            plain = std::make_unique<heongpu::Plaintext<Scheme>>(context);
+            encoder->encode(*plain, message, scale);
+        }
+
+        heongpu::Ciphertext<Scheme> fresh_ciphertext()
+        {
+            heongpu::Ciphertext<Scheme> cipher(context);
+            encryptor->encrypt(cipher, *plain);
+            return cipher;
+        }
+
+        heongpu::HEContext<Scheme> context;
+        double scale;
+        std::unique_ptr<heongpu::HEKeyGenerator<Scheme>> keygen;
+        std::unique_ptr<heongpu::Secretkey<Scheme>> secret_key;
+        std::unique_ptr<heongpu::Publickey<Scheme>> public_key;
+        std::unique_ptr<heongpu::Relinkey<Scheme>> relin_key;
+        std::unique_ptr<heongpu::Galoiskey<Scheme>> galois_key;
+        std::unique_ptr<heongpu::HEEncoder<Scheme>> encoder;
+        std::unique_ptr<heongpu::HEEncryptor<Scheme>> encryptor;
+        std::unique_ptr<heongpu::HEDecryptor<Scheme>> decryptor;
+        std::unique_ptr<heongpu::HEArithmeticOperator<Scheme>> operators;
+        heongpu::HostVector<double> message;
+        std::unique_ptr<heongpu::Plaintext<Scheme>> plain;
+    };
+
+    struct BFVFixture
+    {
+        static constexpr auto Scheme = heongpu::Scheme::BFV;
+
+        BFVFixture(size_t N, int plain_modulus, heongpu::keyswitching_type ks)
+            : context(ks)
+        {
+            context.set_poly_modulus_degree(N);
+            context.set_coeff_modulus_default_values(1);
+            context.set_plain_modulus(plain_modulus);
+            context.generate();
+
+            keygen = std::make_unique<heongpu::HEKeyGenerator<Scheme>>(context);
+            secret_key = std::make_unique<heongpu::Secretkey<Scheme>>(context);
+            keygen->generate_secret_key(*secret_key);
+            public_key = std::make_unique<heongpu::Publickey<Scheme>>(context);
+            keygen->generate_public_key(*public_key, *secret_key);
+            relin_key = std::make_unique<heongpu::Relinkey<Scheme>>(context);
+            keygen->generate_relin_key(*relin_key, *secret_key);
+            std::vector<int> shifts = {1};
+            galois_key =
+                std::make_unique<heongpu::Galoiskey<Scheme>>(context, shifts);
+            keygen->generate_galois_key(*galois_key, *secret_key);
+
+            encoder = std::make_unique<heongpu::HEEncoder<Scheme>>(context);
+            encryptor = std::make_unique<heongpu::HEEncryptor<Scheme>>(
+                context, *public_key);
+            decryptor = std::make_unique<heongpu::HEDecryptor<Scheme>>(
+                context, *secret_key);
+            operators =
+                std::make_unique<heongpu::HEArithmeticOperator<Scheme>>(
+                    context, *encoder);
+
+            message = heongpu::HostVector<uint64_t>(N, 2);
+            plain = std::make_unique<heongpu::Plaintext<Scheme>>(context);
+            encoder->encode(*plain, message);
+        }
+
+        heongpu::Ciphertext<Scheme> fresh_ciphertext()
+        {
+            heongpu::Ciphertext<Scheme> cipher(context);
+            encryptor->encrypt(cipher, *plain);
+            return cipher;
+        }
+
+        heongpu::HEContext<Scheme> context;
+        std::unique_ptr<heongpu::HEKeyGenerator<Scheme>> keygen;
+        std::unique_ptr<heongpu::Secretkey<Scheme>> secret_key;
+        std::unique_ptr<heongpu::Publickey<Scheme>> public_key;
+        std::unique_ptr<heongpu::Relinkey<Scheme>> relin_key;
+        std::unique_ptr<heongpu::Galoiskey<Scheme>> galois_key;
+        std::unique_ptr<heongpu::HEEncoder<Scheme>> encoder;
+        std::unique_ptr<heongpu::HEEncryptor<Scheme>> encryptor;
+        std::unique_ptr<heongpu::HEDecryptor<Scheme>> decryptor;
+        std::unique_ptr<heongpu::HEArithmeticOperator<Scheme>> operators;
+        heongpu::HostVector<uint64_t> message;
+        std::unique_ptr<heongpu::Plaintext<Scheme>> plain;
+    };
+
+    struct TFHEFixture
+    {
+        static constexpr auto Scheme = heongpu::Scheme::TFHE;
+
+        TFHEFixture()
+        {
+            keygen = std::make_unique<heongpu::HEKeyGenerator<Scheme>>(context);
+            secret_key = std::make_unique<heongpu::Secretkey<Scheme>>(context);
+            keygen->generate_secret_key(*secret_key);
+            boot_key =
+                std::make_unique<heongpu::Bootstrappingkey<Scheme>>(context);
+            keygen->generate_bootstrapping_key(*boot_key, *secret_key);
+            encryptor = std::make_unique<heongpu::HEEncryptor<Scheme>>(
+                context, *secret_key);
+            logic = std::make_unique<heongpu::HELogicOperator<Scheme>>(context);
+        }
+
+        heongpu::HEContext<Scheme> context;
+        std::unique_ptr<heongpu::HEKeyGenerator<Scheme>> keygen;
+        std::unique_ptr<heongpu::Secretkey<Scheme>> secret_key;
+        std::unique_ptr<heongpu::Bootstrappingkey<Scheme>> boot_key;
+        std::unique_ptr<heongpu::HEEncryptor<Scheme>> encryptor;
+        std::unique_ptr<heongpu::HELogicOperator<Scheme>> logic;
+    };
+
+    bool any_selected(const Runner& runner, const std::string& prefix,
+                      const std::vector<std::string>& names,
+                      const Params& params)
+    {
+        for (const auto& name : names)
+        {
+            if (runner.selected(prefix + name, params))
+                return true;
+        }
+        return false;
+    }
+
+    void register_ckks(Runner& runner, DeviceTimer& timer)
+    {
+        const Options& options = runner.options();
+        const std::vector<std::string> names = {
+            "encode",   "encrypt",        "add",        "multiply",
+            "relinearize", "rescale",     "rotate",     "multiply_plain",
+            "decrypt",  "decode",         "relinkey_save",
+            "relinkey_load", "galoiskey_save", "galoiskey_load"};
+
+        for (const auto& n_str :
+             options.sweep("N", {"4096", "8192", "16384", "32768"}))
+        {
+            size_t N = std::stoull(n_str);
+            for (const auto& level_str :
+                 options.sweep("levels", {default_levels(N)}))
+            {
+                int levels = std::stoi(level_str);
+                for (const auto& ks : options.sweep("ks", {"I", "II"}))
+                {
+                    Params params = {{"N", n_str},
+                                     {"levels", level_str},
+                                     {"ks", ks}};
+                    if (!any_selected(runner, "ckks/", names, params))
+                        continue;
+
+                    auto fixture = std::make_shared<LazyFixture<CKKSFixture>>(
+                        [=]() {
+                            return std::make_unique<CKKSFixture>(
+                                N, levels, parse_ks(ks));
+                        });
+
+                    runner.add("ckks/encode", params,
+                               [=, &timer]()
+                               {
+                                   auto& f = fixture->get();
+                                   heongpu::Plaintext<heongpu::Scheme::CKKS>
+                                       plain(f.context);
+                                   return timer.measure(
+                                       [&]()
+                                       {
+                                           f.encoder->encode(plain, f.message,
+                                                             f.scale);
+                                       });
+                               });
+                    runner.add("ckks/encrypt", params,
+                               [=, &timer]()
+                               {
+                                   auto& f = fixture->get();
+                                   heongpu::Ciphertext<heongpu::Scheme::CKKS>
+                                       cipher(f.context);
+                                   return timer.measure(
+                                       [&]()
+                                       { f.encryptor->encrypt(cipher, *f.plain); });
+                               });
+                    runner.add("ckks/add", params,
+                               [=, &timer]()
+                               {
+                                   auto& f = fixture->get();
+                                   auto c1 = f.fresh_ciphertext();
+                                   heongpu::Ciphertext<heongpu::Scheme::CKKS>
+                                       out(f.context);
+                                   return timer.measure(
+                                       [&]() { f.operators->add(c1, c1, out); });
+                               });
+                    runner.add("ckks/multiply", params,
+                               [=, &timer]()
+                               {
+                                   auto& f = fixture->get();
+                                   auto c1 = f.fresh_ciphertext();
+                                   heongpu::Ciphertext<heongpu::Scheme::CKKS>
+                                       out(f.context);
+                                   return timer.measure(
+                                       [&]()
+                                       { f.operators->multiply(c1, c1, out); });
+                               });
+                    runner.add("ckks/relinearize", params,
+                               [=, &timer]()
+                               {
+                                   auto& f = fixture->get();
+                                   auto c1 = f.fresh_ciphertext();
+                                   f.operators->multiply_inplace(c1, c1);
+                                   return timer.measure(
+                                       [&]()
+                                       {
+                                           f.operators->relinearize_inplace(
+                                               c1, *f.relin_key);
+                                       });
+                               });
+                    runner.add("ckks/rescale", params,
+                               [=, &timer]()
+                               {
+                                   auto& f = fixture->get();
+                                   auto c1 = f.fresh_ciphertext();
+                                   f.operators->multiply_inplace(c1, c1);
+                                   f.operators->relinearize_inplace(
+                                       c1, *f.relin_key);
+                                   return timer.measure(
+                                       [&]()
+                                       { f.operators->rescale_inplace(c1); });
+                               });
+                    runner.add("ckks/rotate", params,
+                               [=, &timer]()
+                               {
+                                   auto& f = fixture->get();
+                                   auto c1 = f.fresh_ciphertext();
+                                   heongpu::Ciphertext<heongpu::Scheme::CKKS>
+                                       out(f.context);
+                                   return timer.measure(
+                                       [&]()
+                                       {
+                                           f.operators->rotate_rows(
+                                               c1, out, *f.galois_key, 1);
+                                       });
+                               });
+                    runner.add("ckks/multiply_plain", params,
+                               [=, &timer]()
+                               {
+                                   auto& f = fixture->get();
+                                   auto c1 = f.fresh_ciphertext();
+                                   heongpu::Ciphertext<heongpu::Scheme::CKKS>
+                                       out(f.context);
+                                   return timer.measure(
+                                       [&]()
+                                       {
+                                           f.operators->multiply_plain(
+                                               c1, *f.plain, out);
+                                       });
+                               });
+                    runner.add("ckks/decrypt", params,
+                               [=, &timer]()
+                               {
+                                   auto& f = fixture->get();
+                                   auto c1 = f.fresh_ciphertext();
+                                   heongpu::Plaintext<heongpu::Scheme::CKKS>
+                                       plain(f.context);
+                                   return timer.measure(
+                                       [&]()
+                                       { f.decryptor->decrypt(plain, c1); });
+                               });
+                    runner.add("ckks/decode", params,
+                               [=, &timer]()
+                               {
+                                   auto& f = fixture->get();
+                                   heongpu::HostVector<double> message;
+                                   return timer.measure(
+                                       [&]()
+                                       { f.encoder->decode(message, *f.plain); });
+                               });
+                    // Serialization includes the device to host copy of the
+                    // key, so it is timed on the host clock.
+                    runner.add("ckks/relinkey_save", params,
+                               [=]()
+                               {
+                                   auto& f = fixture->get();
+                                   return time_host_ms(
+                                       [&]()
+                                       {
+                                           std::stringstream ss;
+                                           f.relin_key->save(ss);
+                                       });
+                               });
+                    runner.add("ckks/relinkey_load", params,
+                               [=]()
+                               {
+                                   auto& f = fixture->get();
+                                   std::stringstream ss;
+                                   f.relin_key->save(ss);
+                                   heongpu::Relinkey<heongpu::Scheme::CKKS> key;
+                                   return time_host_ms([&]() { key.load(ss); });
+                               });
+                    runner.add("ckks/galoiskey_save", params,
+                               [=]()
+                               {
+                                   auto& f = fixture->get();
+                                   return time_host_ms(
+                                       [&]()
+                                       {
+                                           std::stringstream ss;
+                                           f.galois_key->save(ss);
+                                       });
+                               });
+                    runner.add("ckks/galoiskey_load", params,
+                               [=]()
+                               {
+                                   auto& f = fixture->get();
+                                   std::stringstream ss;
+                                   f.galois_key->save(ss);
+                                   heongpu::Galoiskey<heongpu::Scheme::CKKS>
+                                       key;
+                                   return time_host_ms([&]() { key.load(ss); });
+                               });
+
+                    runner.run();
+                    runner.clear();
+                }
+            }
+        }
+    }
+
+    // The bootstrapping precompute builds the slot transform matrices on
+    // the host and encodes them on the device. It runs once per operator, so
+    // every sample uses a new operator on a shared context.
+    void register_ckks_bootstrapping(Runner& runner)
+    {
+        const Options& options = runner.options();
+        for (const auto& n_str : options.sweep("N", {"16384", "32768"}))
+        {
+            size_t N = std::stoull(n_str);
+            for (const auto& piece_str : options.sweep("piece", {"2", "3"}))
+            {
+                int piece = std::stoi(piece_str);
+                Params params = {{"N", n_str}, {"piece", piece_str}};
+                if (!runner.selected("ckks/bootstrapping_precompute", params))
+                    continue;
+
+                auto fixture = std::make_shared<LazyFixture<CKKSFixture>>(
+                    [=]()
+                    {
+                        return std::make_unique<CKKSFixture>(
+                            N, 24,
+                            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I);
+                    });
+
+                runner.add(
+                    "ckks/bootstrapping_precompute", params,
+                    [=]()
+                    {
+                        auto& f = fixture->get();
+                        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS>
+                            operators(f.context, *f.encoder);
+                        heongpu::BootstrappingConfig config(piece, piece, 11,
+                                                            true);
+                        return time_host_ms(
+                            [&]()
+                            {
+                                operators.generate_bootstrapping_params(
+                                    f.scale, config);
+                                cudaDeviceSynchronize();
+                            });
+                    });
+
+                runner.run();
+                runner.clear();
+            }
+        }
+    }
+
+    void register_bfv(Runner& runner, DeviceTimer& timer)
+    {
+        const Options& options = runner.options();
+        const std::vector<std::string> names = {
+            "encode",      "encrypt",        "add",
+            "multiply",    "relinearize",    "rotate_rows",
+            "rotate_columns", "multiply_plain", "decrypt"};
+
+        for (const auto& n_str :
+             options.sweep("N", {"4096", "8192", "16384", "32768"}))
+        {
+            size_t N = std::stoull(n_str);
+            int plain_modulus = (N <= 8192) ? 1032193 : 786433;
+            for (const auto& ks : options.sweep("ks", {"I", "II"}))
+            {
+                Params params = {{"N", n_str}, {"ks", ks}};
+                if (!any_selected(runner, "bfv/", names, params))
+                    continue;
+
+                auto fixture = std::make_shared<LazyFixture<BFVFixture>>(
+                    [=]() {
+                        return std::make_unique<BFVFixture>(N, plain_modulus,
+                                                            parse_ks(ks));
+                    });
+
+                runner.add("bfv/encode", params,
+                           [=, &timer]()
+                           {
+                               auto& f = fixture->get();
+                               heongpu::Plaintext<heongpu::Scheme::BFV> plain(
+                                   f.context);
+                               return timer.measure(
+                                   [&]() { f.encoder->encode(plain, f.message); });
+                           });
+                runner.add("bfv/encrypt", params,
+                           [=, &timer]()
+                           {
+                               auto& f = fixture->get();
+                               heongpu::Ciphertext<heongpu::Scheme::BFV> cipher(
+                                   f.context);
+                               return timer.measure(
+                                   [&]()
+                                   { f.encryptor->encrypt(cipher, *f.plain); });
+                           });
+                runner.add("bfv/add", params,
+                           [=, &timer]()
+                           {
+                               auto& f = fixture->get();
+                               auto c1 = f.fresh_ciphertext();
+                               heongpu::Ciphertext<heongpu::Scheme::BFV> out(
+                                   f.context);
+                               return timer.measure(
+                                   [&]() { f.operators->add(c1, c1, out); });
+                           });
+                runner.add("bfv/multiply", params,
+                           [=, &timer]()
+                           {
+                               auto& f = fixture->get();
+                               auto c1 = f.fresh_ciphertext();
+                               heongpu::Ciphertext<heongpu::Scheme::BFV> out(
+                                   f.context);
+                               return timer.measure(
+                                   [&]() { f.operators->multiply(c1, c1, out); });
+                           });
+                runner.add("bfv/relinearize", params,
+                           [=, &timer]()
+                           {
+                               auto& f = fixture->get();
+                               auto c1 = f.fresh_ciphertext();
+                               f.operators->multiply_inplace(c1, c1);
+                               return timer.measure(
+                                   [&]()
+                                   {
+                                       f.operators->relinearize_inplace(
+                                           c1, *f.relin_key);
+                                   });
+                           });
+                runner.add("bfv/rotate_rows", params,
+                           [=, &timer]()
+                           {
+                               auto& f = fixture->get();
+                               auto c1 = f.fresh_ciphertext();
+                               heongpu::Ciphertext<heongpu::Scheme::BFV> out(
+                                   f.context);
+                               return timer.measure(
+                                   [&]()
+                                   {
+                                       f.operators->rotate_rows(
+                                           c1, out, *f.galois_key, 1);
+                                   });
+                           });
+                runner.add("bfv/rotate_columns", params,
+                           [=, &timer]()
+                           {
+                               auto& f = fixture->get();
+                               auto c1 = f.fresh_ciphertext();
+                               heongpu::Ciphertext<heongpu::Scheme::BFV> out(
+                                   f.context);
+                               return timer.measure(
+                                   [&]()
+                                   {
+                                       f.operators->rotate_columns(
+                                           c1, out, *f.galois_key);
+                                   });
+                           });
+                runner.add("bfv/multiply_plain", params,
+                           [=, &timer]()
+                           {
+                               auto& f = fixture->get();
+                               auto c1 = f.fresh_ciphertext();
+                               heongpu::Ciphertext<heongpu::Scheme::BFV> out(
+                                   f.context);
+                               return timer.measure(
+                                   [&]()
+                                   {
+                                       f.operators->multiply_plain(
+                                           c1, *f.plain, out);
+                                   });
+                           });
+                runner.add("bfv/decrypt", params,
+                           [=, &timer]()
+                           {
+                               auto& f = fixture->get();
+                               auto c1 = f.fresh_ciphertext();
+                               heongpu::Plaintext<heongpu::Scheme::BFV> plain(
+                                   f.context);
+                               return timer.measure(
+                                   [&]() { f.decryptor->decrypt(plain, c1); });
+                           });
+
+                runner.run();
+                runner.clear();
+            }
+        }
+    }
+
+    void register_tfhe(Runner& runner, DeviceTimer& timer)
+    {
+        const Options& options = runner.options();
+        const std::vector<std::string> names = {"NAND", "AND", "XOR", "NOT",
+                                                "MUX"};
+        auto fixture = std::make_shared<LazyFixture<TFHEFixture>>(
+            []() { return std::make_unique<TFHEFixture>(); });
+
+        for (const auto& batch_str : options.sweep("batch", {"8", "64"}))
+        {
+            size_t batch = std::stoull(batch_str);
+            Params params = {{"batch", batch_str}};
+            if (!any_selected(runner, "tfhe/", names, params))
+                continue;
+
+            std::mt19937 gen(1234);
+            std::uniform_int_distribution<int> dis(0, 1);
+            std::vector<bool> input1(batch), input2(batch), control(batch);
+            for (size_t i = 0; i < batch; i++)
+            {
+                input1[i] = dis(gen);
+                input2[i] = dis(gen);
+                control[i] = dis(gen);
+            }
+
+            auto gate = [=, &timer](auto&& function)
+            {
+                return [=, &timer]()
+                {
+                    auto& f = fixture->get();
+                    heongpu::Ciphertext<heongpu::Scheme::TFHE> ct1(f.context);
+                    heongpu::Ciphertext<heongpu::Scheme::TFHE> ct2(f.context);
+                    heongpu::Ciphertext<heongpu::Scheme::TFHE> ct3(f.context);
+                    heongpu::Ciphertext<heongpu::Scheme::TFHE> out(f.context);
+                    f.encryptor->encrypt(ct1, input1);
+                    f.encryptor->encrypt(ct2, input2);
+                    f.encryptor->encrypt(ct3, control);
+                    return timer.measure([&]()
+                                         { function(f, ct1, ct2, ct3, out); });
+                };
+            };
+
+            runner.add("tfhe/NAND", params,
+                       gate([](auto& f, auto& a, auto& b, auto&, auto& r)
+                            { f.logic->NAND(a, b, r, *f.boot_key); }));
+            runner.add("tfhe/AND", params,
+                       gate([](auto& f, auto& a, auto& b, auto&, auto& r)
+                            { f.logic->AND(a, b, r, *f.boot_key); }));
+            runner.add("tfhe/XOR", params,
+                       gate([](auto& f, auto& a, auto& b, auto&, auto& r)
+                            { f.logic->XOR(a, b, r, *f.boot_key); }));
+            runner.add("tfhe/NOT", params,
+                       gate([](auto& f, auto& a, auto&, auto&, auto& r)
+                            { f.logic->NOT(a, r); }));
+            runner.add("tfhe/MUX", params,
+                       gate([](auto& f, auto& a, auto& b, auto& c, auto& r)
+                            { f.logic->MUX(a, b, c, r, *f.boot_key); }));
+
+            runner.run();
+            runner.clear();
+        }
+    }
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Options options = Options::parse(argc, argv);
+
+    cudaSetDevice(0);
+    cudaDeviceProp prop;
+    cudaGetDeviceProperties(&prop, 0);
+
+    Runner runner("heongpu_gpu_suite", options);
+    runner.set_metadata("device", prop.name);
+    runner.set_metadata("compute_capability",
+                        std::to_string(prop.major) + "." +
+                            std::to_string(prop.minor));
+
+    DeviceTimer timer;
+    register_ckks(runner, timer);
+    register_ckks_bootstrapping(runner);
+    register_bfv(runner, timer);
+    register_tfhe(runner, timer);
+
+    runner.finish();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+# Copyright 2024-2025 Alişah Özcan
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+# Developer: Alişah Özcan
+
+"""Compare two benchmark JSON reports and flag regressions.
+
+Usage:
+    compare_benchmarks.py baseline.json current.json [--threshold 5]
+                          [--metric median] [--fail-on-missing]
+
+Benchmarks are matched by their id. A benchmark regresses when the selected
+metric of the current run is more than --threshold percent slower than the
+baseline. The script exits with status 1 if any regression is found.
+"""
+
+import argparse
+import json
+import sys
+
+METRICS = ("mean", "median", "p99", "min", "max")
+
+
+def load(path):
+    with open(path, "r", encoding="utf-8") as f:
+        report = json.load(f)
+    if report.get("schema_version") != 1:
+        raise ValueError(f"{path}: unsupported schema_version")
+    return report, {r["id"]: r for r in report["results"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="allowed slowdown in percent (default: 5)")
+    parser.add_argument("--metric", choices=METRICS, default="median",
+                        help="statistic to compare (default: median)")
+    parser.add_argument("--fail-on-missing", action="store_true",
+                        help="treat benchmarks missing from current as failure")
+    args = parser.parse_args()
+
+    base_report, baseline = load(args.baseline)
+    curr_report, current = load(args.current)
+
+    base_device = base_report.get("metadata", {}).get("device")
+    curr_device = curr_report.get("metadata", {}).get("device")
+    if base_device != curr_device:
+        print(f"warning: comparing across devices "
+              f"({base_device} vs {curr_device})")
+
+    regressions = []
+    missing = []
+    width = max([len(i) for i in baseline] + [len(i) for i in current] + [9])
+
+    print(f"{'benchmark':<{width}} {'baseline':>12} {'current':>12} "
+          f"{'change':>9}")
+    for bench_id in sorted(baseline):
+        if bench_id not in current:
+            missing.append(bench_id)
+            continue
+        old = baseline[bench_id][args.metric]
+        new = current[bench_id][args.metric]
+        change = ((new - old) / old * 100.0) if old > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            regressions.append(bench_id)
+            flag = "  REGRESSION"
+        elif change < -args.threshold:
+            flag = "  improved"
+        print(f"{bench_id:<{width}} {old:>10.4f}ms {new:>10.4f}ms "
+              f"{change:>+8.2f}%{flag}")
+
+    added = sorted(set(current) - set(baseline))
+    for bench_id in added:
+        print(f"{bench_id:<{width}} {'-':>12} "
+              f"{current[bench_id][args.metric]:>10.4f}ms {'new':>9}")
+    for bench_id in missing:
+        print(f"{bench_id:<{width}} missing from current run")
+
+    print()
+    print(f"{len(regressions)} regression(s) above {args.threshold}% "
+          f"({args.metric}), {len(missing)} missing, {len(added)} new")
+
+    if regressions or (args.fail_on_missing and missing):
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
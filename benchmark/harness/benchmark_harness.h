@@ -0,0 +1,487 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_BENCHMARK_HARNESS_H
+#define HEONGPU_BENCHMARK_HARNESS_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Small, dependency-free benchmark harness shared by the HEonGPU benchmark
+// targets. It only uses the C++ standard library, so host-only benchmarks can
+// be built and run on machines without a GPU. Device benchmarks measure their
+// iterations themselves (e.g. with CUDA events) and hand the elapsed time back
+// to the harness.
+
+namespace heongpu_bench
+{
+    using Params = std::vector<std::pair<std::string, std::string>>;
+
+    /**
+     * @brief Command line options of a benchmark binary.
+     *
+     * Recognised flags:
+     *   --filter=<regex>     run only benchmarks whose id matches the regex
+     *   --warmup=<n>         untimed iterations before sampling (default 2)
+     *   --iterations=<n>     timed iterations per benchmark (default 10)
+     *   --json=<path>        write machine readable results to <path>
+     *   --list               print benchmark ids without running them
+     *   --<key>=<v1,v2,...>  parameter sweep values, interpreted by the suite
+     */
+    struct Options
+    {
+        std::string filter = ".*";
+        int warmup = 2;
+        int iterations = 10;
+        std::string json_path;
+        bool list_only = false;
+        std::map<std::string, std::vector<std::string>> sweeps;
+
+        static Options parse(int argc, char* argv[])
+        {
+            Options options;
+            for (int i = 1; i < argc; i++)
+            {
+                std::string arg(argv[i]);
+                if (arg == "--list")
+                {
+                    options.list_only = true;
+                    continue;
+                }
+                if (arg == "--help" || arg == "-h")
+                {
+                    print_usage(argv[0]);
+                    std::exit(EXIT_SUCCESS);
+                }
+                if (arg.rfind("--", 0) != 0 ||
+                    arg.find('=') == std::string::npos)
+                {
+                    throw std::invalid_argument("Invalid argument: " + arg);
+                }
+
+                std::string key = arg.substr(2, arg.find('=') - 2);
+                std::string value = arg.substr(arg.find('=') + 1);
+
+                if (key == "filter")
+                {
+                    options.filter = value;
+                }
+                else if (key == "warmup")
+                {
+                    options.warmup = std::stoi(value);
+                }
+                else if (key == "iterations")
+                {
+                    options.iterations = std::stoi(value);
+                }
+                else if (key == "json")
+                {
+                    options.json_path = value;
+                }
+                else
+                {
+                    options.sweeps[key] = split(value, ',');
+                }
+            }
+
+            if (options.warmup < 0 || options.iterations < 1)
+            {
+                throw std::invalid_argument(
+                    "warmup must be >= 0 and iterations must be >= 1!");
+            }
+
+            return options;
+        }
+
+        /**
+         * @brief Returns the sweep values given for key, or the defaults when
+         * the key was not passed on the command line.
+         */
+        std::vector<std::string>
+        sweep(const std::string& key,
+              const std::vector<std::string>& defaults) const
+        {
+            auto it = sweeps.find(key);
+            return (it == sweeps.end()) ? defaults : it->second;
+        }
+
+        static std::vector<std::string> split(const std::string& input,
+                                              char delimiter)
+        {
+            std::vector<std::string> result;
+            std::stringstream ss(input);
+            std::string item;
+            while (std::getline(ss, item, delimiter))
+            {
+                if (!item.empty())
+                {
+                    result.push_back(item);
+                }
+            }
+            return result;
+        }
+
+        static void print_usage(const char* binary)
+        {
+            std::cout
+                << "Usage: " << binary << " [options]\n"
+                << "  --filter=<regex>     run benchmarks whose id matches\n"
+                << "  --warmup=<n>         untimed iterations (default 2)\n"
+                << "  --iterations=<n>     timed iterations (default 10)\n"
+                << "  --json=<path>        write results as JSON\n"
+                << "  --list               list benchmark ids and exit\n"
+                << "  --<key>=<v1,v2,...>  parameter sweep values\n";
+        }
+    };
+
+    /**
+     * @brief Summary statistics over the timed samples of one benchmark. All
+     * values are in milliseconds. p99 uses the nearest-rank method.
+     */
+    struct Statistics
+    {
+        size_t samples = 0;
+        double mean = 0;
+        double median = 0;
+        double p99 = 0;
+        double min = 0;
+        double max = 0;
+        double stddev = 0;
+
+        static Statistics compute(std::vector<double> values)
+        {
+            Statistics stats;
+            if (values.empty())
+            {
+                return stats;
+            }
+
+            std::sort(values.begin(), values.end());
+            size_t count = values.size();
+
+            stats.samples = count;
+            stats.min = values.front();
+            stats.max = values.back();
+
+            double sum = 0;
+            for (double value : values)
+            {
+                sum += value;
+            }
+            stats.mean = sum / count;
+
+            double squared_sum = 0;
+            for (double value : values)
+            {
+                squared_sum += (value - stats.mean) * (value - stats.mean);
+            }
+            stats.stddev =
+                (count > 1) ? std::sqrt(squared_sum / (count - 1)) : 0.0;
+
+            stats.median = (count % 2 == 1)
+                               ? values[count / 2]
+                               : 0.5 * (values[count / 2 - 1] +
+                                        values[count / 2]);
+
+            size_t rank =
+                static_cast<size_t>(std::ceil(0.99 * static_cast<double>(count)));
+            stats.p99 = values[std::max<size_t>(rank, 1) - 1];
+
+            return stats;
+        }
+    };
+
+    struct Result
+    {
+        std::string id;
+        std::string name;
+        Params params;
+        Statistics stats;
+    };
+
+    /**
+     * @brief Builds the stable benchmark id "name[key=value,...]" used for
+     * filtering and for matching results against a baseline.
+     */
+    inline std::string make_id(const std::string& name, const Params& params)
+    {
+        if (params.empty())
+        {
+            return name;
+        }
+
+        std::string id = name + "[";
+        for (size_t i = 0; i < params.size(); i++)
+        {
+            id += params[i].first + "=" + params[i].second;
+            if (i + 1 != params.size())
+            {
+                id += ",";
+            }
+        }
+        return id + "]";
+    }
+
+    /**
+     * @brief Fixture that is only constructed when a benchmark using it is
+     * actually run, so listing or filtering never pays for key generation.
+     */
+    template <typename T> class LazyFixture
+    {
+      public:
+        explicit LazyFixture(std::function<std::unique_ptr<T>()> factory)
+            : factory_(std::move(factory))
+        {
+        }
+
+        T& get()
+        {
+            if (!object_)
+            {
+                object_ = factory_();
+            }
+            return *object_;
+        }
+
+      private:
+        std::function<std::unique_ptr<T>()> factory_;
+        std::unique_ptr<T> object_;
+    };
+
+    /**
+     * @brief Measures a host-side callable with a steady clock.
+     */
+    template <typename F> double time_host_ms(F&& function)
+    {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(stop - start).count();
+    }
+
+    /**
+     * @brief Collects benchmark cases and their results.
+     *
+     * A benchmark body performs one iteration and returns its elapsed time in
+     * milliseconds. Suites usually register all cases of one parameter set,
+     * call run() and then drop the registered cases (and their fixtures)
+     * with clear() before moving on to the next parameter set.
+     */
+    class Runner
+    {
+      public:
+        using Body = std::function<double()>;
+
+        Runner(std::string suite, Options options)
+            : suite_(std::move(suite)), options_(std::move(options)),
+              filter_(options_.filter)
+        {
+        }
+
+        const Options& options() const noexcept { return options_; }
+
+        void set_metadata(const std::string& key, const std::string& value)
+        {
+            metadata_[key] = value;
+        }
+
+        void add(const std::string& name, const Params& params, Body body)
+        {
+            cases_.push_back({name, params, std::move(body)});
+        }
+
+        /**
+         * @brief Returns true when at least one case with the given name
+         * prefix and parameters would be selected by the filter.
+         */
+        bool selected(const std::string& name, const Params& params) const
+        {
+            return std::regex_search(make_id(name, params), filter_);
+        }
+
+        void run()
+        {
+            for (auto& benchmark_case : cases_)
+            {
+                std::string id =
+                    make_id(benchmark_case.name, benchmark_case.params);
+                if (!std::regex_search(id, filter_))
+                {
+                    continue;
+                }
+
+                if (options_.list_only)
+                {
+                    std::cout << id << std::endl;
+                    continue;
+                }
+
+                for (int i = 0; i < options_.warmup; i++)
+                {
+                    benchmark_case.body();
+                }
+
+                std::vector<double> samples;
+                samples.reserve(options_.iterations);
+                for (int i = 0; i < options_.iterations; i++)
+                {
+                    samples.push_back(benchmark_case.body());
+                }
+
+                Result result{id, benchmark_case.name, benchmark_case.params,
+                              Statistics::compute(std::move(samples))};
+                print_result(result);
+                results_.push_back(std::move(result));
+            }
+        }
+
+        void clear() { cases_.clear(); }
+
+        const std::vector<Result>& results() const noexcept
+        {
+            return results_;
+        }
+
+        /**
+         * @brief Writes the JSON report if --json was given.
+         */
+        void finish() const
+        {
+            if (options_.json_path.empty() || options_.list_only)
+            {
+                return;
+            }
+
+            std::ofstream ofs(options_.json_path);
+            if (!ofs)
+            {
+                throw std::runtime_error("Cannot open file for writing: " +
+                                         options_.json_path);
+            }
+            write_json(ofs);
+            std::cout << "Results written to " << options_.json_path
+                      << std::endl;
+        }
+
+        void write_json(std::ostream& os) const
+        {
+            os << std::setprecision(9);
+            os << "{\n";
+            os << "  \"schema_version\": 1,\n";
+            os << "  \"suite\": " << quote(suite_) << ",\n";
+            os << "  \"timestamp\": " << quote(timestamp()) << ",\n";
+            os << "  \"warmup\": " << options_.warmup << ",\n";
+            os << "  \"iterations\": " << options_.iterations << ",\n";
+            os << "  \"metadata\": {";
+            size_t index = 0;
+            for (const auto& entry : metadata_)
+            {
+                os << (index++ ? ", " : "") << quote(entry.first) << ": "
+                   << quote(entry.second);
+            }
+            os << "},\n";
+            os << "  \"results\": [";
+            for (size_t i = 0; i < results_.size(); i++)
+            {
+                const Result& result = results_[i];
+                os << (i ? ",\n" : "\n");
+                os << "    {\"id\": " << quote(result.id)
+                   << ", \"name\": " << quote(result.name) << ", \"params\": {";
+                for (size_t j = 0; j < result.params.size(); j++)
+                {
+                    os << (j ? ", " : "") << quote(result.params[j].first)
+                       << ": " << quote(result.params[j].second);
+                }
+                os << "}, \"unit\": \"ms\""
+                   << ", \"samples\": " << result.stats.samples
+                   << ", \"mean\": " << result.stats.mean
+                   << ", \"median\": " << result.stats.median
+                   << ", \"p99\": " << result.stats.p99
+                   << ", \"min\": " << result.stats.min
+                   << ", \"max\": " << result.stats.max
+                   << ", \"stddev\": " << result.stats.stddev << "}";
+            }
+            os << "\n  ]\n}\n";
+        }
+
+      private:
+        struct Case
+        {
+            std::string name;
+            Params params;
+            Body body;
+        };
+
+        static std::string quote(const std::string& input)
+        {
+            std::string output = "\"";
+            for (char c : input)
+            {
+                switch (c)
+                {
+                    case '"':
+                        output += "\\\"";
+                        break;
+                    case '\\':
+                        output += "\\\\";
+                        break;
+                    case '\n':
+                        output += "\\n";
+                        break;
+                    case '\t':
+                        output += "\\t";
+                        break;
+                    default:
+                        output += c;
+                        break;
+                }
+            }
+            return output + "\"";
+        }
+
+        static std::string timestamp()
+        {
+            std::time_t now = std::time(nullptr);
+            char buffer[32];
+            std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ",
+                          std::gmtime(&now));
+            return std::string(buffer);
+        }
+
+        static void print_result(const Result& result)
+        {
+            std::cout << std::left << std::setw(56) << result.id << std::right
+                      << std::fixed << std::setprecision(4)
+                      << " median: " << std::setw(10) << result.stats.median
+                      << " ms  p99: " << std::setw(10) << result.stats.p99
+                      << " ms  mean: " << std::setw(10) << result.stats.mean
+                      << " ms  (n=" << result.stats.samples << ")"
+                      << std::defaultfloat << std::endl;
+        }
+
+        std::string suite_;
+        Options options_;
+        std::regex filter_;
+        std::map<std::string, std::string> metadata_;
+        std::vector<Case> cases_;
+        std::vector<Result> results_;
+    };
+
+} // namespace heongpu_bench
+#endif // HEONGPU_BENCHMARK_HARNESS_H
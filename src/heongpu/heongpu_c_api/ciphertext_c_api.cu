@@ -43,6 +43,16 @@ static heongpu::HEContext<heongpu::Scheme::CKKS>* get_cpp_context_from_opaque_ct
     }
     return context_c_api_ptr->cpp_context;
 }
+// Stream buffer over caller-owned memory, used to serialize without copies.
+class fixed_buffer_streambuf : public std::streambuf {
+public:
+    fixed_buffer_streambuf(char* data, size_t size) {
+        setp(data, data + size);
+        setg(data, data, data + size);
+    }
+    size_t written() const { return static_cast<size_t>(pptr() - pbase()); }
+};
+
 static heongpu::ExecutionOptions map_c_to_cpp_execution_options_ct(const C_ExecutionOptions* c_options) {
     heongpu::ExecutionOptions cpp_options; // Defaults from C++ struct definition
     if (c_options) {
@@ -238,6 +248,92 @@ HE_CKKS_Ciphertext* HEonGPU_CKKS_Ciphertext_Load(HE_CKKS_Context* context_c_api_
     } catch (...) { delete cpp_ct; delete c_api_ciphertext; return nullptr; }
 }
 
+int HEonGPU_CKKS_Ciphertext_SaveSize(HE_CKKS_Ciphertext* ciphertext, size_t* out_len) {
+    if (!ciphertext || !ciphertext->cpp_ciphertext || !out_len) {
+        if (out_len) *out_len = 0;
+        return -1;
+    }
+    try {
+        *out_len = ciphertext->cpp_ciphertext->serialized_size();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "HEonGPU_CKKS_Ciphertext_SaveSize failed with C++ exception: " << e.what() << std::endl;
+        *out_len = 0;
+        return -3;
+    } catch (...) {
+        *out_len = 0;
+        return -3;
+    }
+}
+
+int HEonGPU_CKKS_Ciphertext_SaveInto(HE_CKKS_Ciphertext* ciphertext,
+                                     unsigned char* buffer,
+                                     size_t buffer_len,
+                                     size_t* out_len) {
+    if (!ciphertext || !ciphertext->cpp_ciphertext || !buffer || !out_len) {
+        if (out_len) *out_len = 0;
+        return -1;
+    }
+    try {
+        size_t required_len = ciphertext->cpp_ciphertext->serialized_size();
+        *out_len = required_len;
+        if (buffer_len < required_len) {
+            return -4; // Buffer too small, out_len holds the required size
+        }
+
+        // Writes straight into the caller's buffer, without an intermediate string.
+        fixed_buffer_streambuf streambuf(reinterpret_cast<char*>(buffer), buffer_len);
+        std::ostream os(&streambuf);
+        ciphertext->cpp_ciphertext->save(os);
+        if (!os) {
+            *out_len = 0;
+            return -3;
+        }
+        *out_len = streambuf.written();
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "HEonGPU_CKKS_Ciphertext_SaveInto failed with C++ exception: " << e.what() << std::endl;
+        *out_len = 0;
+        return -3;
+    } catch (...) {
+        *out_len = 0;
+        return -3;
+    }
+}
+
+int HEonGPU_CKKS_Ciphertext_LoadInto(HE_CKKS_Ciphertext* ciphertext,
+                                     const unsigned char* bytes,
+                                     size_t len,
+                                     const C_ExecutionOptions* options_c) {
+    if (!ciphertext || !ciphertext->cpp_ciphertext || !bytes || len == 0) {
+        return -1;
+    }
+    try {
+        fixed_buffer_streambuf streambuf(const_cast<char*>(reinterpret_cast<const char*>(bytes)), len);
+        std::istream is(&streambuf);
+
+        // Ciphertext::load() refuses populated objects, so load into a temporary and move it into the
+        // handle. The handle is left unchanged if loading fails.
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> loaded;
+        loaded.load(is);
+
+        heongpu::ExecutionOptions cpp_exec_options = map_c_to_cpp_execution_options_ct(options_c);
+        if (cpp_exec_options.storage_ == heongpu::storage_type::DEVICE) {
+            loaded.store_in_device(cpp_exec_options.stream_);
+        } else {
+            loaded.store_in_host(cpp_exec_options.stream_);
+        }
+
+        *ciphertext->cpp_ciphertext = std::move(loaded);
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "HEonGPU_CKKS_Ciphertext_LoadInto failed with C++ exception: " << e.what() << std::endl;
+        return -3;
+    } catch (...) {
+        return -3;
+    }
+}
+
 HE_CKKS_Ciphertext* HEonGPU_CKKS_Ciphertext_Set_Scale(HE_CKKS_Ciphertext* ciphertext, double scale){
     if (!ciphertext || !ciphertext->cpp_ciphertext) {
         std::cerr << "Error: Invalid ciphertext pointer in HEonGPU_CKKS_Ciphertext_Set_Scale." << std::endl;
@@ -35,6 +35,35 @@ int HEonGPU_CKKS_Ciphertext_Save(HE_CKKS_Ciphertext* ciphertext,
                                  unsigned char** out_bytes,
                                  size_t* out_len);
 
+/**
+ * @brief Gets the number of bytes HEonGPU_CKKS_Ciphertext_Save() and HEonGPU_CKKS_Ciphertext_SaveInto()
+ * produce, without serializing the ciphertext.
+ * @return 0 on success, -1 for invalid args, -3 if the ciphertext can not be serialized.
+ */
+int HEonGPU_CKKS_Ciphertext_SaveSize(HE_CKKS_Ciphertext* ciphertext, size_t* out_len);
+
+/**
+ * @brief Serializes the ciphertext into a caller-provided buffer. No memory is allocated.
+ * @param buffer Caller-owned output buffer.
+ * @param buffer_len Size of buffer in bytes.
+ * @param out_len Set to the number of bytes written, or to the required size if the buffer is too small.
+ * @return 0 on success, -1 for invalid args, -3 for serialization fail, -4 if buffer_len is too small.
+ */
+int HEonGPU_CKKS_Ciphertext_SaveInto(HE_CKKS_Ciphertext* ciphertext,
+                                     unsigned char* buffer,
+                                     size_t buffer_len,
+                                     size_t* out_len);
+
+/**
+ * @brief Deserializes bytes into an existing, caller-owned ciphertext handle instead of creating a new one.
+ * Previous contents of the handle are replaced; on failure the handle is left unchanged.
+ * @return 0 on success, -1 for invalid args, -3 for deserialization fail.
+ */
+int HEonGPU_CKKS_Ciphertext_LoadInto(HE_CKKS_Ciphertext* ciphertext,
+                                     const unsigned char* bytes,
+                                     size_t len,
+                                     const C_ExecutionOptions* options);
+
 HE_CKKS_Ciphertext* HEonGPU_CKKS_Ciphertext_Set_Scale(HE_CKKS_Ciphertext* ciphertext, double scale);
 
 // --- CKKS Ciphertext Getters ---
@@ -122,6 +122,45 @@ int HEonGPU_CKKS_Encryptor_Encrypt_To(HE_CKKS_Encryptor* encryptor,
       catch (...) { std::cerr << "Encrypt_To Unknown Error" << std::endl; return -2; }
 }
 
+int HEonGPU_CKKS_Encryptor_Encrypt_Many(HE_CKKS_Encryptor* encryptor,
+                                        HE_CKKS_Ciphertext* const* ct_out_c,
+                                        HE_CKKS_Plaintext* const* pt_in_c,
+                                        size_t count,
+                                        const C_ExecutionOptions* options_c) {
+    if (!encryptor || !encryptor->cpp_encryptor || !ct_out_c || !pt_in_c || count == 0) {
+        std::cerr << "Encrypt_Many: Invalid argument(s).\n"; return -1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (!ct_out_c[i] || !get_cpp_ciphertext_enc(ct_out_c[i]) || !pt_in_c[i] || !get_cpp_plaintext_enc(pt_in_c[i])) {
+            std::cerr << "Encrypt_Many: Invalid argument(s).\n"; return -1;
+        }
+    }
+
+    // The caller's objects are moved into the batch and back, so no ciphertext or plaintext data is copied.
+    std::vector<heongpu::Plaintext<heongpu::Scheme::CKKS>> plaintexts;
+    std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> ciphertexts;
+    plaintexts.reserve(count);
+    ciphertexts.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        plaintexts.push_back(std::move(*(get_cpp_plaintext_enc(pt_in_c[i]))));
+        ciphertexts.push_back(std::move(*(get_cpp_ciphertext_enc(ct_out_c[i]))));
+    }
+    auto move_back = [&]() {
+        for (size_t i = 0; i < count; i++) {
+            *(get_cpp_plaintext_enc(pt_in_c[i])) = std::move(plaintexts[i]);
+            *(get_cpp_ciphertext_enc(ct_out_c[i])) = std::move(ciphertexts[i]);
+        }
+    };
+
+    try {
+        heongpu::ExecutionOptions cpp_options = map_c_to_cpp_execution_options_enc(options_c);
+        encryptor->cpp_encryptor->encrypt(ciphertexts, plaintexts, cpp_options);
+        move_back();
+        return 0; // Success
+    } catch (const std::exception& e) { move_back(); std::cerr << "Encrypt_Many Error: " << e.what() << std::endl; return -2; }
+      catch (...) { move_back(); std::cerr << "Encrypt_Many Unknown Error" << std::endl; return -2; }
+}
+
 HE_CKKS_Ciphertext* HEonGPU_CKKS_Encryptor_Encrypt_New(HE_CKKS_Encryptor* encryptor,
                                                        HE_CKKS_Plaintext* pt_in_c,
                                                        const C_ExecutionOptions* options_c) {
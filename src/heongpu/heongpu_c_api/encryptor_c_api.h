@@ -71,6 +71,22 @@ HE_CKKS_Ciphertext* HEonGPU_CKKS_Encryptor_Encrypt_New(HE_CKKS_Encryptor* encryp
                                                        HE_CKKS_Plaintext* pt_in,
                                                        const C_ExecutionOptions* options);
 
+/**
+ * @brief Encrypts a batch of plaintexts into pre-allocated ciphertexts with one batched encryption,
+ * sampling the randomness of the whole batch at once.
+ * @param encryptor Opaque pointer to the HE_CKKS_Encryptor.
+ * @param ct_out Array of count existing HE_CKKS_Ciphertext objects; element i receives the encryption of pt_in[i].
+ * @param pt_in Array of count HE_CKKS_Plaintext objects to be encrypted.
+ * @param count Number of plaintexts.
+ * @param options Pointer to C_ExecutionOptions (can be NULL for defaults).
+ * @return 0 on success, -1 for invalid args, -2 on failure.
+ */
+int HEonGPU_CKKS_Encryptor_Encrypt_Many(HE_CKKS_Encryptor* encryptor,
+                                        HE_CKKS_Ciphertext* const* ct_out,
+                                        HE_CKKS_Plaintext* const* pt_in,
+                                        size_t count,
+                                        const C_ExecutionOptions* options);
+
 // --- CKKS Encryptor Seed/Offset Management ---
 
 /**
@@ -89,6 +89,37 @@ static heongpu::ExecutionOptions map_c_to_cpp_execution_options_op(const C_Execu
     return cpp_options;
 }
 
+static const void* get_handle_object(const HE_CKKS_Ciphertext* ct) { return ct->cpp_ciphertext; }
+static const void* get_handle_object(const HE_CKKS_Plaintext* pt) { return pt->cpp_plaintext; }
+
+// Validates every handle of a batch before any work is done.
+template <typename T>
+static bool handles_valid(const T* const* handles, size_t count) {
+    if (!handles) return false;
+    for (size_t i = 0; i < count; i++) {
+        if (!handles[i] || !get_handle_object(handles[i])) return false;
+    }
+    return true;
+}
+
+// Runs operation(i) for every element, stopping at the first failure.
+template <typename F>
+static int run_batch(const char* name, size_t count, F&& operation) {
+    size_t i = 0;
+    try {
+        for (; i < count; i++) {
+            operation(i);
+        }
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << name << " failed at element " << i << " with exception: " << e.what() << std::endl;
+        return -3;
+    } catch (...) {
+        std::cerr << name << " failed at element " << i << " with unknown exception." << std::endl;
+        return -3;
+    }
+}
+
 
 extern "C" {
 
@@ -541,6 +572,111 @@ HE_CKKS_Ciphertext* HEonGPU_CKKS_ArithmeticOperator_Conjugate(HE_CKKS_Arithmetic
 }
 
 
+// --- Batched Operations ---
+int HEonGPU_CKKS_ArithmeticOperator_Add_Many(HE_CKKS_ArithmeticOperator* op, const HE_CKKS_Ciphertext* const* ct1_in, const HE_CKKS_Ciphertext* const* ct2_in, HE_CKKS_Ciphertext* const* ct_out, size_t count, const C_ExecutionOptions* options_c) {
+    if (!get_cpp_arith_op(op) || !handles_valid(ct1_in, count) || !handles_valid(ct2_in, count) || !handles_valid(ct_out, count)) {
+        std::cerr << "Add_Many: Invalid argument(s).\n"; return -1;
+    }
+    heongpu::ExecutionOptions cpp_options = map_c_to_cpp_execution_options_op(options_c);
+    return run_batch("Add_Many", count, [&](size_t i) {
+        op->cpp_arith_op->add(*(ct1_in[i]->cpp_ciphertext), *(ct2_in[i]->cpp_ciphertext), *(ct_out[i]->cpp_ciphertext), cpp_options);
+    });
+}
+
+int HEonGPU_CKKS_ArithmeticOperator_Add_Inplace_Many(HE_CKKS_ArithmeticOperator* op, HE_CKKS_Ciphertext* const* ct1_in_out, const HE_CKKS_Ciphertext* const* ct2_in, size_t count, const C_ExecutionOptions* options_c) {
+    if (!get_cpp_arith_op(op) || !handles_valid(ct1_in_out, count) || !handles_valid(ct2_in, count)) {
+        std::cerr << "Add_Inplace_Many: Invalid argument(s).\n"; return -1;
+    }
+    heongpu::ExecutionOptions cpp_options = map_c_to_cpp_execution_options_op(options_c);
+    return run_batch("Add_Inplace_Many", count, [&](size_t i) {
+        op->cpp_arith_op->add_inplace(*(ct1_in_out[i]->cpp_ciphertext), *(ct2_in[i]->cpp_ciphertext), cpp_options);
+    });
+}
+
+int HEonGPU_CKKS_ArithmeticOperator_Sub_Many(HE_CKKS_ArithmeticOperator* op, const HE_CKKS_Ciphertext* const* ct1_in, const HE_CKKS_Ciphertext* const* ct2_in, HE_CKKS_Ciphertext* const* ct_out, size_t count, const C_ExecutionOptions* options_c) {
+    if (!get_cpp_arith_op(op) || !handles_valid(ct1_in, count) || !handles_valid(ct2_in, count) || !handles_valid(ct_out, count)) {
+        std::cerr << "Sub_Many: Invalid argument(s).\n"; return -1;
+    }
+    heongpu::ExecutionOptions cpp_options = map_c_to_cpp_execution_options_op(options_c);
+    return run_batch("Sub_Many", count, [&](size_t i) {
+        op->cpp_arith_op->sub(*(ct1_in[i]->cpp_ciphertext), *(ct2_in[i]->cpp_ciphertext), *(ct_out[i]->cpp_ciphertext), cpp_options);
+    });
+}
+
+int HEonGPU_CKKS_ArithmeticOperator_Multiply_Many(HE_CKKS_ArithmeticOperator* op, const HE_CKKS_Ciphertext* const* ct1_in, const HE_CKKS_Ciphertext* const* ct2_in, HE_CKKS_Ciphertext* const* ct_out, size_t count, const C_ExecutionOptions* options_c) {
+    if (!get_cpp_arith_op(op) || !handles_valid(ct1_in, count) || !handles_valid(ct2_in, count) || !handles_valid(ct_out, count)) {
+        std::cerr << "Multiply_Many: Invalid argument(s).\n"; return -1;
+    }
+    heongpu::ExecutionOptions cpp_options = map_c_to_cpp_execution_options_op(options_c);
+    return run_batch("Multiply_Many", count, [&](size_t i) {
+        op->cpp_arith_op->multiply(*(ct1_in[i]->cpp_ciphertext), *(ct2_in[i]->cpp_ciphertext), *(ct_out[i]->cpp_ciphertext), cpp_options);
+    });
+}
+
+int HEonGPU_CKKS_ArithmeticOperator_Multiply_Inplace_Many(HE_CKKS_ArithmeticOperator* op, HE_CKKS_Ciphertext* const* ct1_in_out, const HE_CKKS_Ciphertext* const* ct2_in, size_t count, const C_ExecutionOptions* options_c) {
+    if (!get_cpp_arith_op(op) || !handles_valid(ct1_in_out, count) || !handles_valid(ct2_in, count)) {
+        std::cerr << "Multiply_Inplace_Many: Invalid argument(s).\n"; return -1;
+    }
+    heongpu::ExecutionOptions cpp_options = map_c_to_cpp_execution_options_op(options_c);
+    return run_batch("Multiply_Inplace_Many", count, [&](size_t i) {
+        op->cpp_arith_op->multiply_inplace(*(ct1_in_out[i]->cpp_ciphertext), *(ct2_in[i]->cpp_ciphertext), cpp_options);
+    });
+}
+
+int HEonGPU_CKKS_ArithmeticOperator_Multiply_Plain_Many(HE_CKKS_ArithmeticOperator* op, const HE_CKKS_Ciphertext* const* ct_in, const HE_CKKS_Plaintext* const* pt_in, HE_CKKS_Ciphertext* const* ct_out, size_t count, const C_ExecutionOptions* options_c) {
+    if (!get_cpp_arith_op(op) || !handles_valid(ct_in, count) || !handles_valid(pt_in, count) || !handles_valid(ct_out, count)) {
+        std::cerr << "Multiply_Plain_Many: Invalid argument(s).\n"; return -1;
+    }
+    heongpu::ExecutionOptions cpp_options = map_c_to_cpp_execution_options_op(options_c);
+    return run_batch("Multiply_Plain_Many", count, [&](size_t i) {
+        op->cpp_arith_op->multiply_plain(*(ct_in[i]->cpp_ciphertext), *(pt_in[i]->cpp_plaintext), *(ct_out[i]->cpp_ciphertext), cpp_options);
+    });
+}
+
+int HEonGPU_CKKS_ArithmeticOperator_Relinearize_Inplace_Many(HE_CKKS_ArithmeticOperator* op, HE_CKKS_Ciphertext* const* ct_in_out, size_t count, HE_CKKS_RelinKey* relin_key_c, const C_ExecutionOptions* options_c) {
+    if (!get_cpp_arith_op(op) || !handles_valid(ct_in_out, count) || !get_cpp_relinkey(relin_key_c)) {
+        std::cerr << "Relinearize_Inplace_Many: Invalid argument(s).\n"; return -1;
+    }
+    heongpu::ExecutionOptions cpp_options = map_c_to_cpp_execution_options_op(options_c);
+    return run_batch("Relinearize_Inplace_Many", count, [&](size_t i) {
+        op->cpp_arith_op->relinearize_inplace(*(ct_in_out[i]->cpp_ciphertext), *(relin_key_c->cpp_relinkey), cpp_options);
+    });
+}
+
+int HEonGPU_CKKS_ArithmeticOperator_Rescale_Inplace_Many(HE_CKKS_ArithmeticOperator* op, HE_CKKS_Ciphertext* const* ct_in_out, size_t count, const C_ExecutionOptions* options_c) {
+    if (!get_cpp_arith_op(op) || !handles_valid(ct_in_out, count)) {
+        std::cerr << "Rescale_Inplace_Many: Invalid argument(s).\n"; return -1;
+    }
+    heongpu::ExecutionOptions cpp_options = map_c_to_cpp_execution_options_op(options_c);
+    return run_batch("Rescale_Inplace_Many", count, [&](size_t i) {
+        // Like Rescale_Inplace, ciphertexts that need no rescale are skipped.
+        if (ct_in_out[i]->cpp_ciphertext->rescale_required()) {
+            op->cpp_arith_op->rescale_inplace(*(ct_in_out[i]->cpp_ciphertext), cpp_options);
+        }
+    });
+}
+
+int HEonGPU_CKKS_ArithmeticOperator_Rotate_Many(HE_CKKS_ArithmeticOperator* op, const HE_CKKS_Ciphertext* const* ct_in, HE_CKKS_Ciphertext* const* ct_out, const int* steps, size_t count, HE_CKKS_GaloisKey* galois_key_c, const C_ExecutionOptions* options_c) {
+    if (!get_cpp_arith_op(op) || !handles_valid(ct_in, count) || !handles_valid(ct_out, count) || !steps || !get_cpp_galoiskey(galois_key_c)) {
+        std::cerr << "Rotate_Many: Invalid argument(s).\n"; return -1;
+    }
+    heongpu::ExecutionOptions cpp_options = map_c_to_cpp_execution_options_op(options_c);
+    return run_batch("Rotate_Many", count, [&](size_t i) {
+        op->cpp_arith_op->rotate_rows(*(ct_in[i]->cpp_ciphertext), *(ct_out[i]->cpp_ciphertext), *(galois_key_c->cpp_galoiskey), steps[i], cpp_options);
+    });
+}
+
+int HEonGPU_CKKS_ArithmeticOperator_Rotate_Inplace_Many(HE_CKKS_ArithmeticOperator* op, HE_CKKS_Ciphertext* const* ct_in_out, const int* steps, size_t count, HE_CKKS_GaloisKey* galois_key_c, const C_ExecutionOptions* options_c) {
+    if (!get_cpp_arith_op(op) || !handles_valid(ct_in_out, count) || !steps || !get_cpp_galoiskey(galois_key_c)) {
+        std::cerr << "Rotate_Inplace_Many: Invalid argument(s).\n"; return -1;
+    }
+    heongpu::ExecutionOptions cpp_options = map_c_to_cpp_execution_options_op(options_c);
+    return run_batch("Rotate_Inplace_Many", count, [&](size_t i) {
+        op->cpp_arith_op->rotate_rows_inplace(*(ct_in_out[i]->cpp_ciphertext), *(galois_key_c->cpp_galoiskey), steps[i], cpp_options);
+    });
+}
+
+
 // --- Bootstrapping ---
 // Note: C++ bootstrap methods return new Ciphertext objects.
 int HEonGPU_CKKS_ArithmeticOperator_GenerateBootstrappingParams(HE_CKKS_ArithmeticOperator* op,
@@ -65,6 +65,23 @@ void HEonGPU_CKKS_ArithmeticOperator_Rotate_Inplace(HE_CKKS_ArithmeticOperator*
 HE_CKKS_Ciphertext* HEonGPU_CKKS_ArithmeticOperator_Rotate(HE_CKKS_ArithmeticOperator* op, const HE_CKKS_Ciphertext* ct_in, HE_CKKS_Ciphertext* ct_out, int steps, HE_CKKS_GaloisKey* galois_key, const C_ExecutionOptions* options);
 HE_CKKS_Ciphertext* HEonGPU_CKKS_ArithmeticOperator_Conjugate(HE_CKKS_ArithmeticOperator* op, const HE_CKKS_Ciphertext* ct_in, HE_CKKS_Ciphertext* ct_out, HE_CKKS_GaloisKey* galois_key, const C_ExecutionOptions* options);
 
+// --- Batched Operations ---
+// Each call processes count independent operations with the same execution options, so callers
+// cross the FFI boundary once per batch. Outputs are caller-owned handles that are reused; nothing
+// is allocated per element. Element i of every array belongs to operation i.
+// Return 0 on success, -1 for invalid args (checked before any work), -3 if an operation fails;
+// the operations before the failing one have completed.
+int HEonGPU_CKKS_ArithmeticOperator_Add_Many(HE_CKKS_ArithmeticOperator* op, const HE_CKKS_Ciphertext* const* ct1_in, const HE_CKKS_Ciphertext* const* ct2_in, HE_CKKS_Ciphertext* const* ct_out, size_t count, const C_ExecutionOptions* options);
+int HEonGPU_CKKS_ArithmeticOperator_Add_Inplace_Many(HE_CKKS_ArithmeticOperator* op, HE_CKKS_Ciphertext* const* ct1_in_out, const HE_CKKS_Ciphertext* const* ct2_in, size_t count, const C_ExecutionOptions* options);
+int HEonGPU_CKKS_ArithmeticOperator_Sub_Many(HE_CKKS_ArithmeticOperator* op, const HE_CKKS_Ciphertext* const* ct1_in, const HE_CKKS_Ciphertext* const* ct2_in, HE_CKKS_Ciphertext* const* ct_out, size_t count, const C_ExecutionOptions* options);
+int HEonGPU_CKKS_ArithmeticOperator_Multiply_Many(HE_CKKS_ArithmeticOperator* op, const HE_CKKS_Ciphertext* const* ct1_in, const HE_CKKS_Ciphertext* const* ct2_in, HE_CKKS_Ciphertext* const* ct_out, size_t count, const C_ExecutionOptions* options);
+int HEonGPU_CKKS_ArithmeticOperator_Multiply_Inplace_Many(HE_CKKS_ArithmeticOperator* op, HE_CKKS_Ciphertext* const* ct1_in_out, const HE_CKKS_Ciphertext* const* ct2_in, size_t count, const C_ExecutionOptions* options);
+int HEonGPU_CKKS_ArithmeticOperator_Multiply_Plain_Many(HE_CKKS_ArithmeticOperator* op, const HE_CKKS_Ciphertext* const* ct_in, const HE_CKKS_Plaintext* const* pt_in, HE_CKKS_Ciphertext* const* ct_out, size_t count, const C_ExecutionOptions* options);
+int HEonGPU_CKKS_ArithmeticOperator_Relinearize_Inplace_Many(HE_CKKS_ArithmeticOperator* op, HE_CKKS_Ciphertext* const* ct_in_out, size_t count, HE_CKKS_RelinKey* relin_key, const C_ExecutionOptions* options);
+int HEonGPU_CKKS_ArithmeticOperator_Rescale_Inplace_Many(HE_CKKS_ArithmeticOperator* op, HE_CKKS_Ciphertext* const* ct_in_out, size_t count, const C_ExecutionOptions* options);
+int HEonGPU_CKKS_ArithmeticOperator_Rotate_Many(HE_CKKS_ArithmeticOperator* op, const HE_CKKS_Ciphertext* const* ct_in, HE_CKKS_Ciphertext* const* ct_out, const int* steps, size_t count, HE_CKKS_GaloisKey* galois_key, const C_ExecutionOptions* options);
+int HEonGPU_CKKS_ArithmeticOperator_Rotate_Inplace_Many(HE_CKKS_ArithmeticOperator* op, HE_CKKS_Ciphertext* const* ct_in_out, const int* steps, size_t count, HE_CKKS_GaloisKey* galois_key, const C_ExecutionOptions* options);
+
 // Bootstrapping
 
 int HEonGPU_CKKS_ArithmeticOperator_GenerateBootstrappingParams(HE_CKKS_ArithmeticOperator* op,
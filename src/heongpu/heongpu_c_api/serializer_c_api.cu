@@ -113,4 +113,66 @@ int HEonGPU_DecompressData(const unsigned char* input_data,
     }
 }
 
+size_t HEonGPU_CompressBound(size_t input_len) {
+    return heongpu::serializer::compress_bound(input_len);
+}
+
+int HEonGPU_CompressDataInto(const unsigned char* input_data,
+                             size_t input_len,
+                             unsigned char* output_data,
+                             size_t output_capacity,
+                             size_t* output_len) {
+    if (!output_len) {
+        return -1; // Invalid arguments
+    }
+    *output_len = 0;
+    if ((!input_data && input_len > 0) || !output_data) {
+        return -1; // Invalid arguments
+    }
+
+    if (input_len == 0) {
+        return 0; // Success, empty input results in empty output
+    }
+
+    try {
+        *output_len = heongpu::serializer::compress(input_data, input_len, output_data, output_capacity);
+        return 0; // Success
+    } catch (const std::length_error&) {
+        return -4; // Output buffer too small
+    } catch (const std::exception& e) {
+        std::cerr << "HEonGPU_CompressDataInto failed with C++ exception: " << e.what() << std::endl;
+        return -3; // Compression failed
+    } catch (...) {
+        std::cerr << "HEonGPU_CompressDataInto failed due to an unknown C++ exception." << std::endl;
+        return -3;
+    }
+}
+
+int HEonGPU_DecompressDataInto(const unsigned char* input_data,
+                               size_t input_len,
+                               unsigned char* output_data,
+                               size_t output_capacity,
+                               size_t* output_len) {
+    if (!output_len) {
+        return -1; // Invalid arguments
+    }
+    *output_len = 0;
+    if (!input_data || input_len == 0 || !output_data) {
+        return -1; // Invalid arguments
+    }
+
+    try {
+        *output_len = heongpu::serializer::decompress(input_data, input_len, output_data, output_capacity);
+        return 0; // Success
+    } catch (const std::length_error&) {
+        return -4; // Output buffer too small
+    } catch (const std::exception& e) {
+        std::cerr << "HEonGPU_DecompressDataInto failed with C++ exception: " << e.what() << std::endl;
+        return -3; // Decompression failed
+    } catch (...) {
+        std::cerr << "HEonGPU_DecompressDataInto failed due to an unknown C++ exception." << std::endl;
+        return -3;
+    }
+}
+
 } // extern "C"
\ No newline at end of file
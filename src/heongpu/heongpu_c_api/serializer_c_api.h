@@ -37,6 +37,43 @@ int HEonGPU_DecompressData(const unsigned char* input_data,
                            unsigned char** output_data,
                            size_t* output_len);
 
+/**
+ * @brief Returns an upper bound of the compressed size of input_len bytes, to size
+ * the output buffer of HEonGPU_CompressDataInto().
+ */
+size_t HEonGPU_CompressBound(size_t input_len);
+
+/**
+ * @brief Compresses a byte array using zlib into a caller-provided buffer. No memory is allocated.
+ * @param input_data Pointer to the input byte array.
+ * @param input_len Length of the input byte array.
+ * @param output_data Caller-owned output buffer.
+ * @param output_capacity Size of output_data in bytes. HEonGPU_CompressBound(input_len) always suffices.
+ * @param output_len Pointer to a size_t that will be set to the number of bytes written.
+ * @return 0 on success, -1 for invalid args, -3 for compression fail, -4 if output_capacity is too small.
+ */
+int HEonGPU_CompressDataInto(const unsigned char* input_data,
+                             size_t input_len,
+                             unsigned char* output_data,
+                             size_t output_capacity,
+                             size_t* output_len);
+
+/**
+ * @brief Decompresses a zlib-compressed byte array into a caller-provided buffer. No memory is allocated.
+ * @param input_data Pointer to the input compressed byte array.
+ * @param input_len Length of the input compressed byte array.
+ * @param output_data Caller-owned output buffer.
+ * @param output_capacity Size of output_data in bytes. For data produced by HEonGPU_CompressDataInto(),
+ * the original input_len suffices; otherwise retry with a larger buffer on -4.
+ * @param output_len Pointer to a size_t that will be set to the number of bytes written.
+ * @return 0 on success, -1 for invalid args, -3 for decompression fail, -4 if output_capacity is too small.
+ */
+int HEonGPU_DecompressDataInto(const unsigned char* input_data,
+                               size_t input_len,
+                               unsigned char* output_data,
+                               size_t output_capacity,
+                               size_t* output_len);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -18,6 +18,7 @@ namespace heongpu
         template <Scheme S> friend class HEOperator;
         template <Scheme S> friend class HEArithmeticOperator;
         template <Scheme S> friend class HELogicOperator;
+        template <Scheme S> friend class HEDatabaseScanner;
 
         template <typename T, typename F>
         friend void input_storage_manager(T& object, F function,
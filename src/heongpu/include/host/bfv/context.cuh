@@ -39,6 +39,7 @@ namespace heongpu
         template <Scheme S> friend class HEOperator;
         template <Scheme S> friend class HEArithmeticOperator;
         template <Scheme S> friend class HELogicOperator;
+        template <Scheme S> friend class HEDatabaseScanner;
 
       public:
         HEContext(const keyswitching_type ks_type,
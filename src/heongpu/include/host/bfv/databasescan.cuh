@@ -0,0 +1,153 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_BFV_DATABASESCAN_H
+#define HEONGPU_BFV_DATABASESCAN_H
+
+#include "ntt.cuh"
+#include "multiplication.cuh"
+
+#include "bfv/context.cuh"
+#include "bfv/plaintext.cuh"
+#include "bfv/ciphertext.cuh"
+
+#include <string>
+
+namespace heongpu
+{
+
+    /**
+     * @brief HEDatabaseScanner multiplies a query, a vector of ciphertexts,
+     * against a plaintext database stored on disk and returns one accumulated
+     * ciphertext per database row:
+     *
+     *     result[r] = sum_c query[c] * database[r][c]
+     *
+     * The database file is written once with save_header and save_row. Every
+     * row holds column_count plaintexts prepared by
+     * HEArithmeticOperator::transform_to_ntt, stored back to back in the byte
+     * layout of Plaintext<Scheme::BFV>::save. The scanner memory-maps the file
+     * and streams it to the GPU in chunks of rows through two pinned HostVector
+     * staging buffers, so that the copy of the next chunk overlaps the
+     * multiply-accumulate of the current one. Only two chunks are resident in
+     * device memory at any time, independent of the database size.
+     */
+    template <> class HEDatabaseScanner<Scheme::BFV>
+    {
+      public:
+        /**
+         * @brief Memory-maps a database file written by save_header and
+         * save_row.
+         *
+         * @param context Reference to the context the database was prepared
+         * with.
+         * @param filename Path of the database file.
+         * @param chunk_row_count Number of rows transferred to the device per
+         * chunk. Two chunks are kept in pinned host memory and two in device
+         * memory.
+         */
+        __host__ HEDatabaseScanner(HEContext<Scheme::BFV>& context,
+                                   const std::string& filename,
+                                   int chunk_row_count = 16);
+
+        ~HEDatabaseScanner();
+
+        HEDatabaseScanner(const HEDatabaseScanner&) = delete;
+        HEDatabaseScanner& operator=(const HEDatabaseScanner&) = delete;
+
+        /**
+         * @brief Writes the database header. It has to be followed by exactly
+         * row_count calls to save_row.
+         *
+         * @param os Output stream of the database file.
+         * @param context Reference to the context used to prepare the rows.
+         * @param row_count Number of rows in the database.
+         * @param column_count Number of plaintexts in each row, which is the
+         * number of query ciphertexts a scan expects.
+         */
+        static __host__ void save_header(std::ostream& os,
+                                         HEContext<Scheme::BFV>& context,
+                                         uint64_t row_count, int column_count);
+
+        /**
+         * @brief Appends one database row. Every plaintext has to be in the NTT
+         * domain, i.e. produced by HEArithmeticOperator::transform_to_ntt.
+         *
+         * @param os Output stream of the database file.
+         * @param column_count Column count passed to save_header.
+         * @param row The column_count plaintexts of the row.
+         */
+        static __host__ void save_row(std::ostream& os, int column_count,
+                                      std::vector<Plaintext<Scheme::BFV>>& row);
+
+        /**
+         * @brief Streams the whole database through the GPU and multiplies it
+         * with the query.
+         *
+         * @param query column_count ciphertexts of size 2. They may be in the
+         * coefficient or in the NTT domain; the results are returned in the
+         * same domain.
+         * @param results Output vector, resized to row_count.
+         * @param options Execution options; results are stored according to
+         * options.storage_.
+         */
+        __host__ void
+        scan(std::vector<Ciphertext<Scheme::BFV>>& query,
+             std::vector<Ciphertext<Scheme::BFV>>& results,
+             const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Returns the number of rows in the database.
+         */
+        inline uint64_t row_count() const noexcept { return row_count_; }
+
+        /**
+         * @brief Returns the number of plaintexts in each row.
+         */
+        inline int column_count() const noexcept { return column_count_; }
+
+      private:
+        __host__ void scan_bfv(std::vector<Ciphertext<Scheme::BFV>>& query,
+                               std::vector<Ciphertext<Scheme::BFV>>& results,
+                               const cudaStream_t stream);
+
+        __host__ void stage_chunk(Data64* staging, uint64_t first_row,
+                                  int chunk_rows);
+
+        static constexpr uint32_t database_magic_ = 0x42444548; // "HEDB"
+
+        static constexpr size_t record_header_size_ =
+            sizeof(scheme_type) + sizeof(int) + sizeof(bool) + sizeof(bool) +
+            sizeof(storage_type) + sizeof(uint32_t);
+
+        static constexpr size_t database_header_size_ =
+            sizeof(uint32_t) + sizeof(scheme_type) + sizeof(int) + sizeof(int) +
+            sizeof(Data64) + sizeof(uint64_t) + sizeof(int);
+
+        scheme_type scheme_;
+        int n;
+        int n_power;
+        int Q_size_;
+
+        std::shared_ptr<DeviceVector<Modulus64>> modulus_;
+        std::shared_ptr<DeviceVector<Root64>> ntt_table_;
+        std::shared_ptr<DeviceVector<Root64>> intt_table_;
+        std::shared_ptr<DeviceVector<Ninverse64>> n_inverse_;
+
+        uint64_t row_count_;
+        int column_count_;
+        int chunk_row_count_;
+        size_t record_size_;
+
+        const unsigned char* mapped_data_ = nullptr;
+        size_t mapped_size_ = 0;
+
+        cudaStream_t copy_stream_;
+        cudaEvent_t copy_done_[2];
+        cudaEvent_t compute_done_[2];
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_BFV_DATABASESCAN_H
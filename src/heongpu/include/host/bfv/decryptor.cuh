@@ -127,6 +127,79 @@ namespace heongpu
                 ciphertext.relinearization_required_;
         }
 
+        /**
+         * @brief Performs partial decryptions of a batch of ciphertexts using
+         * a secret key.
+         *
+         * All ciphertexts must be in the same domain. The second polynomials
+         * of the whole batch are transformed together, the smudging noise is
+         * sampled in one pass and every share is written by a single kernel
+         * launch.
+         *
+         * @param ciphertexts The ciphertexts to be partially decrypted.
+         * @param sk The secret key of the party performing the partial
+         * decryptions.
+         * @param partial_ciphertexts The output vector; element i holds the
+         * partial decryption of ciphertexts[i].
+         */
+        __host__ void multi_party_decrypt_partial(
+            std::vector<Ciphertext<Scheme::BFV>>& ciphertexts,
+            Secretkey<Scheme::BFV>& sk,
+            std::vector<Ciphertext<Scheme::BFV>>& partial_ciphertexts,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            int cipher_count = ciphertexts.size();
+
+            if (cipher_count == 0)
+            {
+                throw std::invalid_argument("No ciphertext to decrypt!");
+            }
+
+            bool domain_check = ciphertexts[0].in_ntt_domain_;
+            for (int i = 1; i < cipher_count; i++)
+            {
+                if (domain_check != ciphertexts[i].in_ntt_domain_)
+                {
+                    throw std::invalid_argument(
+                        "Ciphertext domains should be same!");
+                }
+            }
+
+            input_vector_storage_manager(
+                ciphertexts,
+                [&](std::vector<Ciphertext<Scheme::BFV>>& ciphertexts_)
+                {
+                    input_storage_manager(
+                        sk,
+                        [&](Secretkey<Scheme::BFV>& sk_)
+                        {
+                            partial_decrypt_bfv_batch(ciphertexts_, sk_,
+                                                      partial_ciphertexts,
+                                                      options.stream_);
+                        },
+                        options, false);
+                },
+                options, false);
+
+            for (int i = 0; i < cipher_count; i++)
+            {
+                Ciphertext<Scheme::BFV>& partial = partial_ciphertexts[i];
+
+                partial.scheme_ = scheme_;
+                partial.ring_size_ = n;
+                partial.coeff_modulus_count_ = Q_size_;
+                partial.cipher_size_ = 2;
+                partial.in_ntt_domain_ = ciphertexts[i].in_ntt_domain_;
+                partial.relinearization_required_ =
+                    ciphertexts[i].relinearization_required_;
+
+                if (options.storage_ == storage_type::HOST)
+                {
+                    partial.store_in_host(options.stream_);
+                }
+            }
+        }
+
         /**
          * @brief Fuses partially decrypted ciphertexts into a fully decrypted
          * plaintext.
@@ -183,6 +256,162 @@ namespace heongpu
                 options, false);
         }
 
+        /**
+         * @brief Fuses the partial decryptions of a batch of ciphertexts into
+         * plaintexts with a single kernel launch.
+         *
+         * @param partial_ciphertexts Partial decryptions indexed as
+         * [party][ciphertext], i.e. the outputs of the batched
+         * multi_party_decrypt_partial of every party.
+         * @param plaintexts The output vector; element i holds the fusion of
+         * the i-th partial decryption of every party.
+         */
+        __host__ void multi_party_decrypt_fusion(
+            std::vector<std::vector<Ciphertext<Scheme::BFV>>>&
+                partial_ciphertexts,
+            std::vector<Plaintext<Scheme::BFV>>& plaintexts,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            int party_count = partial_ciphertexts.size();
+
+            if (party_count == 0)
+            {
+                throw std::invalid_argument("No ciphertext to decrypt!");
+            }
+
+            int cipher_count = partial_ciphertexts[0].size();
+
+            if (cipher_count == 0)
+            {
+                throw std::invalid_argument("No ciphertext to decrypt!");
+            }
+
+            for (int i = 0; i < party_count; i++)
+            {
+                if (static_cast<int>(partial_ciphertexts[i].size()) !=
+                    cipher_count)
+                {
+                    throw std::invalid_argument(
+                        "Every party should provide the same number of "
+                        "partial decryptions!");
+                }
+
+                for (int j = 0; j < cipher_count; j++)
+                {
+                    Ciphertext<Scheme::BFV>& partial =
+                        partial_ciphertexts[i][j];
+
+                    if (partial_ciphertexts[0][j].scheme_ != partial.scheme_)
+                    {
+                        throw std::invalid_argument(
+                            "Ciphertext schemes should be same!");
+                    }
+
+                    if (!partial.is_on_device())
+                    {
+                        partial.store_in_device(options.stream_);
+                    }
+                }
+            }
+
+            decrypt_fusion_bfv_batch(partial_ciphertexts, plaintexts,
+                                     options.stream_);
+
+            for (int j = 0; j < cipher_count; j++)
+            {
+                Plaintext<Scheme::BFV>& plaintext = plaintexts[j];
+
+                plaintext.plain_size_ = n;
+                plaintext.scheme_ = scheme_;
+                plaintext.in_ntt_domain_ = false;
+
+                if (options.storage_ == storage_type::HOST)
+                {
+                    plaintext.store_in_host(options.stream_);
+                }
+            }
+        }
+
+        /**
+         * @brief Folds one party's partial decryption into a running sum
+         * (streaming fusion).
+         *
+         * BFV fusion scales and rounds the sum of all shares, so the shares
+         * are folded into a ciphertext accumulator as they arrive and the
+         * plaintext is produced once by the multi_party_decrypt_fusion
+         * overload taking the accumulator. Only the accumulator and the
+         * current share need to be kept regardless of the number of parties.
+         *
+         * @param partial_ciphertext Partial decryption of one party.
+         * @param accumulated The ciphertext accumulating the shares.
+         * @param first True for the first share, which initializes
+         * accumulated.
+         */
+        __host__ void multi_party_decrypt_accumulate(
+            Ciphertext<Scheme::BFV>& partial_ciphertext,
+            Ciphertext<Scheme::BFV>& accumulated, bool first,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            if (!first && !accumulated.is_on_device())
+            {
+                accumulated.store_in_device(options.stream_);
+            }
+
+            input_storage_manager(
+                partial_ciphertext,
+                [&](Ciphertext<Scheme::BFV>& partial_ciphertext_)
+                {
+                    output_storage_manager(
+                        accumulated,
+                        [&](Ciphertext<Scheme::BFV>& accumulated_)
+                        {
+                            decrypt_fusion_bfv_accumulate(partial_ciphertext_,
+                                                          accumulated_, first,
+                                                          options.stream_);
+
+                            accumulated_.scheme_ = scheme_;
+                            accumulated_.ring_size_ = n;
+                            accumulated_.coeff_modulus_count_ = Q_size_;
+                            accumulated_.cipher_size_ = 2;
+                            accumulated_.in_ntt_domain_ = false;
+                        },
+                        options);
+                },
+                options, false);
+        }
+
+        /**
+         * @brief Produces the plaintext from the shares folded in by
+         * multi_party_decrypt_accumulate.
+         *
+         * @param accumulated The ciphertext accumulating every party's share.
+         * @param plaintext The output plaintext.
+         */
+        __host__ void multi_party_decrypt_fusion(
+            Ciphertext<Scheme::BFV>& accumulated,
+            Plaintext<Scheme::BFV>& plaintext,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            input_storage_manager(
+                accumulated,
+                [&](Ciphertext<Scheme::BFV>& accumulated_)
+                {
+                    output_storage_manager(
+                        plaintext,
+                        [&](Plaintext<Scheme::BFV>& plaintext_)
+                        {
+                            decrypt_fusion_bfv_accumulated(
+                                accumulated_, plaintext_, options.stream_);
+
+                            plaintext_.plain_size_ = n;
+                            plaintext_.scheme_ = scheme_;
+                            plaintext_.in_ntt_domain_ = false;
+                        },
+                        options);
+                },
+                options, false);
+        }
+
         /**
          * @brief Returns the seed of the decryptor.
          *
@@ -237,6 +466,28 @@ namespace heongpu
                            Plaintext<Scheme::BFV>& plaintext,
                            const cudaStream_t stream);
 
+        __host__ void partial_decrypt_bfv_batch(
+            std::vector<Ciphertext<Scheme::BFV>>& ciphertexts,
+            Secretkey<Scheme::BFV>& sk,
+            std::vector<Ciphertext<Scheme::BFV>>& partial_ciphertexts,
+            const cudaStream_t stream);
+
+        __host__ void decrypt_fusion_bfv_batch(
+            std::vector<std::vector<Ciphertext<Scheme::BFV>>>&
+                partial_ciphertexts,
+            std::vector<Plaintext<Scheme::BFV>>& plaintexts,
+            const cudaStream_t stream);
+
+        __host__ void decrypt_fusion_bfv_accumulate(
+            Ciphertext<Scheme::BFV>& partial_ciphertext,
+            Ciphertext<Scheme::BFV>& accumulated, bool first,
+            const cudaStream_t stream);
+
+        __host__ void
+        decrypt_fusion_bfv_accumulated(Ciphertext<Scheme::BFV>& accumulated,
+                                       Plaintext<Scheme::BFV>& plaintext,
+                                       const cudaStream_t stream);
+
       private:
         scheme_type scheme_;
         int seed_;
@@ -82,6 +82,65 @@ namespace heongpu
                 options, false);
         }
 
+        /**
+         * @brief Encrypts a batch of plaintexts.
+         *
+         * The randomness of the whole batch is sampled with one call per
+         * distribution, and each encryption step runs as a single kernel
+         * launch or batched NTT over all plaintexts.
+         *
+         * @param ciphertexts The output vector; element i holds the encryption
+         * of plaintexts[i].
+         * @param plaintexts The plaintexts to be encrypted.
+         */
+        __host__ void
+        encrypt(std::vector<Ciphertext<Scheme::BFV>>& ciphertexts,
+                std::vector<Plaintext<Scheme::BFV>>& plaintexts,
+                const ExecutionOptions& options = ExecutionOptions())
+        {
+            int plain_count = plaintexts.size();
+
+            if (plain_count == 0)
+            {
+                throw std::invalid_argument("No plaintext to encrypt!");
+            }
+
+            for (int i = 0; i < plain_count; i++)
+            {
+                if (plaintexts[i].size() < n)
+                {
+                    throw std::invalid_argument("Invalid plaintext size.");
+                }
+            }
+
+            input_vector_storage_manager(
+                plaintexts,
+                [&](std::vector<Plaintext<Scheme::BFV>>& plaintexts_)
+                {
+                    encrypt_bfv_batch(ciphertexts, plaintexts_,
+                                      options.stream_);
+                },
+                options, false);
+
+            for (int i = 0; i < plain_count; i++)
+            {
+                Ciphertext<Scheme::BFV>& ciphertext = ciphertexts[i];
+
+                ciphertext.scheme_ = scheme_;
+                ciphertext.ring_size_ = n;
+                ciphertext.coeff_modulus_count_ = Q_size_;
+                ciphertext.cipher_size_ = 2;
+                ciphertext.in_ntt_domain_ = false;
+                ciphertext.relinearization_required_ = false;
+                ciphertext.ciphertext_generated_ = true;
+
+                if (options.storage_ == storage_type::HOST)
+                {
+                    ciphertext.store_in_host(options.stream_);
+                }
+            }
+        }
+
         /**
          * @brief Returns the seed of the encryptor.
          *
@@ -117,6 +176,11 @@ namespace heongpu
                                   Plaintext<Scheme::BFV>& plaintext,
                                   const cudaStream_t stream);
 
+        __host__ void
+        encrypt_bfv_batch(std::vector<Ciphertext<Scheme::BFV>>& ciphertexts,
+                          std::vector<Plaintext<Scheme::BFV>>& plaintexts,
+                          const cudaStream_t stream);
+
       private:
         scheme_type scheme_;
         int seed_;
@@ -8,6 +8,7 @@
 
 #include "bfv/context.cuh"
 #include "keygeneration.cuh"
+#include "rotationplanner.h"
 
 namespace heongpu
 {
@@ -248,6 +249,11 @@ namespace heongpu
 
         void load(std::istream& is);
 
+      protected:
+        // Reads the BFV layout, which the BGV relinearization key shares,
+        // and checks that the stream holds expected_scheme.
+        void load(std::istream& is, scheme_type expected_scheme);
+
       private:
         scheme_type scheme_;
         keyswitching_type key_type;
@@ -431,6 +437,7 @@ namespace heongpu
               galoiskey_size_(copy.galoiskey_size_),
               custom_galois_elt(copy.custom_galois_elt),
               galois_elt(copy.galois_elt),
+              rotation_plans_(copy.rotation_plans_),
               galois_elt_zero(copy.galois_elt_zero),
               galois_key_generated_(copy.galois_key_generated_)
         {
@@ -490,6 +497,7 @@ namespace heongpu
               galoiskey_size_(std::move(assign.galoiskey_size_)),
               custom_galois_elt(std::move(assign.custom_galois_elt)),
               galois_elt(std::move(assign.galois_elt)),
+              rotation_plans_(assign.rotation_plans_),
               galois_elt_zero(std::move(assign.galois_elt_zero)),
               galois_key_generated_(std::move(assign.galois_key_generated_))
         {
@@ -544,6 +552,7 @@ namespace heongpu
                 galoiskey_size_ = copy.galoiskey_size_;
                 custom_galois_elt = copy.custom_galois_elt;
                 galois_elt = copy.galois_elt;
+                rotation_plans_ = copy.rotation_plans_;
                 galois_elt_zero = copy.galois_elt_zero;
                 galois_key_generated_ = copy.galois_key_generated_;
 
@@ -612,6 +621,7 @@ namespace heongpu
                 galoiskey_size_ = std::move(assign.galoiskey_size_);
                 custom_galois_elt = std::move(assign.custom_galois_elt);
                 galois_elt = std::move(assign.galois_elt);
+                rotation_plans_ = assign.rotation_plans_;
                 galois_elt_zero = std::move(assign.galois_elt_zero);
                 galois_key_generated_ = std::move(assign.galois_key_generated_);
 
@@ -654,7 +664,16 @@ namespace heongpu
 
         void load(std::istream& is);
 
+      protected:
+        // Reads the BFV layout, which the BGV Galois keys share, and checks
+        // that the stream holds expected_scheme.
+        void load(std::istream& is, scheme_type expected_scheme);
+
       private:
+        // Writes everything save() writes before the keys, so that
+        // HEKeyGenerator can stream keys in the same layout.
+        void save_header(std::ostream& os, uint32_t key_count) const;
+
         scheme_type scheme_;
         keyswitching_type key_type;
 
@@ -679,6 +698,11 @@ namespace heongpu
         std::unordered_map<int, DeviceVector<Data64>> device_location_;
         std::unordered_map<int, HostVector<Data64>> host_location_;
 
+        // Steps of rotations without a dedicated key. Copies hold the same
+        // keys and share the cache; a loaded key starts with an empty one.
+        std::shared_ptr<RotationPlanCache> rotation_plans_ =
+            std::make_shared<RotationPlanCache>();
+
         // for rotate_columns
         int galois_elt_zero;
         DeviceVector<Data64> zero_device_location_;
@@ -91,7 +91,9 @@ namespace heongpu
          *
          * This function aggregates all partial public keys generated by the
          * participants into a single final public key for use in multiparty
-         * computations.
+         * computations. The pieces are summed with a pairwise tree reduction,
+         * one kernel launch per tree level; see
+         * accumulate_multi_party_public_key for folding shares in one by one.
          *
          * @param all_pk Vector containing the partial public keys from all
          * participants.
@@ -103,6 +105,25 @@ namespace heongpu
             Publickey<Scheme::BFV>& pk,
             const ExecutionOptions& options = ExecutionOptions());
 
+        /**
+         * @brief Folds one participant's partial public key into the common
+         * public key (Collective, streaming).
+         *
+         * Shares can be folded in as they arrive, so only the common key and
+         * the current share need to be resident on the device regardless of
+         * the participant count. The result equals
+         * generate_multi_party_public_key over the same shares.
+         *
+         * @param pk_piece Partial public key of one participant.
+         * @param pk Reference to the Publickey object accumulating the common
+         * public key.
+         * @param first True for the first share, which initializes pk.
+         */
+        __host__ void accumulate_multi_party_public_key(
+            MultipartyPublickey<Scheme::BFV>& pk_piece,
+            Publickey<Scheme::BFV>& pk, bool first,
+            const ExecutionOptions& options = ExecutionOptions());
+
         /**
          * @brief Generates a relinearization key using a secret key.
          *
@@ -224,7 +245,7 @@ namespace heongpu
          *
          * This function aggregates all partial relinearization key pieces from
          * multiple participants into a single collective relinearization key
-         * for Stage 1.
+         * for Stage 1. The pieces are summed with a pairwise tree reduction.
          *
          * @param all_rk Vector containing partial relinearization keys from all
          * participants.
@@ -236,6 +257,21 @@ namespace heongpu
             MultipartyRelinkey<Scheme::BFV>& rk,
             const ExecutionOptions& options = ExecutionOptions());
 
+        /**
+         * @brief Folds one participant's partial relinearization key into the
+         * Stage 1 collective key (Collective, streaming).
+         *
+         * @param rk_piece Stage 1 relinearization key piece of one
+         * participant.
+         * @param rk Reference to the MultipartyRelinkey object accumulating
+         * the Stage 1 collective key.
+         * @param first True for the first share, which initializes rk.
+         */
+        __host__ void accumulate_multi_party_relin_key(
+            MultipartyRelinkey<Scheme::BFV>& rk_piece,
+            MultipartyRelinkey<Scheme::BFV>& rk, bool first,
+            const ExecutionOptions& options = ExecutionOptions());
+
         /**
          * @brief Combines partial relinearization keys from all participants
          * (Stage 2 - Collective).
@@ -257,6 +293,24 @@ namespace heongpu
             Relinkey<Scheme::BFV>& rk,
             const ExecutionOptions& options = ExecutionOptions());
 
+        /**
+         * @brief Folds one participant's Stage 2 relinearization key piece into
+         * the final relinearization key (Collective, streaming).
+         *
+         * @param rk_piece Stage 2 relinearization key piece of one
+         * participant.
+         * @param rk_common_stage1 Reference to the shared Stage 1 collective
+         * relinearization key.
+         * @param rk Reference to the Relinkey object accumulating the final
+         * key.
+         * @param first True for the first share, which initializes rk.
+         */
+        __host__ void accumulate_multi_party_relin_key(
+            MultipartyRelinkey<Scheme::BFV>& rk_piece,
+            MultipartyRelinkey<Scheme::BFV>& rk_common_stage1,
+            Relinkey<Scheme::BFV>& rk, bool first,
+            const ExecutionOptions& options = ExecutionOptions());
+
         /**
          * @brief Generates a Galois key using a secret key.
          *
@@ -290,6 +344,23 @@ namespace heongpu
             }
         }
 
+        /**
+         * @brief Generates a Galois key and writes it to a stream in the
+         * layout of Galoiskey::save, without keeping it in memory. The stream
+         * can be loaded with Galoiskey::load; gk itself stays ungenerated.
+         *
+         * Only KEYSWITCHING_METHOD_I keys can be streamed.
+         *
+         * @param gk Galoiskey describing the rotations to generate.
+         * @param sk Reference to the Secretkey object used to generate the
+         * Galois key.
+         * @param os Output stream the key is written to.
+         */
+        __host__ void generate_galois_key(
+            Galoiskey<Scheme::BFV>& gk, Secretkey<Scheme::BFV>& sk,
+            std::ostream& os,
+            const ExecutionOptions& options = ExecutionOptions());
+
         /**
          * @brief Generates a partial Galois key for multiparty computation
          * (Each participant).
@@ -336,7 +407,7 @@ namespace heongpu
          *
          * This function aggregates all partial Galois keys generated by the
          * participants into a single final Galois key for use in multiparty
-         * computations.
+         * computations. The pieces are summed with a pairwise tree reduction.
          *
          * @param all_gk Vector containing the partial Galois keys from all
          * participants.
@@ -348,6 +419,20 @@ namespace heongpu
             Galoiskey<Scheme::BFV>& gk,
             const ExecutionOptions& options = ExecutionOptions());
 
+        /**
+         * @brief Folds one participant's partial Galois key into the common
+         * Galois key (Collective, streaming).
+         *
+         * @param gk_piece Partial Galois key of one participant.
+         * @param gk Reference to the Galoiskey object accumulating the common
+         * Galois key.
+         * @param first True for the first share, which initializes gk.
+         */
+        __host__ void accumulate_multi_party_galois_key(
+            MultipartyGaloiskey<Scheme::BFV>& gk_piece,
+            Galoiskey<Scheme::BFV>& gk, bool first,
+            const ExecutionOptions& options = ExecutionOptions());
+
         /**
          * @brief Generates a switch key for key switching between two secret
          * keys.
@@ -433,6 +518,24 @@ namespace heongpu
                                      Secretkey<Scheme::BFV>& sk,
                                      const ExecutionOptions& options);
 
+        // Batched Galois key generation: all keys of a batch share one
+        // random sampling, one NTT and one kernel launch.
+        __host__ void galois_key_elements(Galoiskey<Scheme::BFV>& gk,
+                                          std::vector<int>& storage_elts,
+                                          std::vector<int>& kernel_elts) const;
+
+        __host__ int galois_key_batch_count(int decomp_mod_count) const;
+
+        __host__ void
+        generate_galois_key_batch(Secretkey<Scheme::BFV>& sk,
+                                  const std::vector<int>& galois_elts,
+                                  std::vector<Data64*>& outputs,
+                                  int decomp_mod_count,
+                                  const cudaStream_t stream);
+
+        // Upper bound of the temporary device memory of one key batch.
+        static constexpr size_t galois_key_batch_bytes_ = size_t(1) << 28;
+
         __host__ void
         generate_bfv_galois_key_method_II(Galoiskey<Scheme::BFV>& gk,
                                           Secretkey<Scheme::BFV>& sk,
@@ -474,6 +577,16 @@ namespace heongpu
             MultipartyGaloiskey<Scheme::BFV>& gk, Secretkey<Scheme::BFV>& sk,
             const ExecutionOptions& options);
 
+        __host__ int multi_party_decomp_count(keyswitching_type key_type,
+                                              int d) const;
+
+        __host__ void tree_reduce_multi_party_key(std::vector<Data64*>& pieces,
+                                                  Data64* output,
+                                                  size_t key_size,
+                                                  int decomp_mod_count,
+                                                  bool reduce_second,
+                                                  const cudaStream_t stream);
+
       private:
         scheme_type scheme;
         int seed_;
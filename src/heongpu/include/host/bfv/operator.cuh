@@ -23,6 +23,16 @@
 namespace heongpu
 {
 
+    /**
+     * @brief Number of ciphertext domain transforms performed by an operator,
+     * counted per ciphertext. Key-switching internals are not included.
+     */
+    struct DomainTransformStatistics
+    {
+        uint64_t forward_transforms = 0; // coefficient -> NTT
+        uint64_t inverse_transforms = 0; // NTT -> coefficient
+    };
+
     /**
      * @brief HEOperator is responsible for performing homomorphic operations on
      * encrypted data, such as addition, subtraction, multiplication, and other
@@ -140,6 +150,8 @@ namespace heongpu
                   Ciphertext<Scheme::BFV>& output,
                   const ExecutionOptions& options = ExecutionOptions())
         {
+            require_domain(input1, false, options);
+
             if (input1.relinearization_required_)
             {
                 throw std::invalid_argument(
@@ -200,6 +212,8 @@ namespace heongpu
                           Plaintext<Scheme::BFV>& input2,
                           const ExecutionOptions& options = ExecutionOptions())
         {
+            require_domain(input1, false, options);
+
             if (input1.relinearization_required_)
             {
                 throw std::invalid_argument(
@@ -244,6 +258,8 @@ namespace heongpu
                   Ciphertext<Scheme::BFV>& output,
                   const ExecutionOptions& options = ExecutionOptions())
         {
+            require_domain(input1, false, options);
+
             if (input1.relinearization_required_)
             {
                 throw std::invalid_argument(
@@ -304,6 +320,8 @@ namespace heongpu
                           Plaintext<Scheme::BFV>& input2,
                           const ExecutionOptions& options = ExecutionOptions())
         {
+            require_domain(input1, false, options);
+
             if (input1.relinearization_required_)
             {
                 throw std::invalid_argument(
@@ -348,6 +366,9 @@ namespace heongpu
                  Ciphertext<Scheme::BFV>& output,
                  const ExecutionOptions& options = ExecutionOptions())
         {
+            require_domain(input1, false, options);
+            require_domain(input2, false, options);
+
             if (input1.relinearization_required_ ||
                 input2.relinearization_required_)
             {
@@ -407,8 +428,16 @@ namespace heongpu
          * @brief Multiplies a ciphertext and a plaintext and stores the result
          * in the output.
          *
+         * A plaintext passed through transform_to_ntt is already lifted to
+         * every RNS limb and kept in the NTT domain, so it can be prepared
+         * (and saved) once and reused for any number of products. With an NTT
+         * domain ciphertext the product is then a single pointwise kernel; a
+         * coefficient domain ciphertext additionally pays its own NTT/INTT.
+         * The output is in the domain of input1.
+         *
          * @param input1 Input ciphertext to be multiplied.
-         * @param input2 Input plaintext to be multiplied.
+         * @param input2 Input plaintext to be multiplied, either encoded or
+         * prepared with transform_to_ntt.
          * @param output Ciphertext where the result of the multiplication is
          * stored.
          */
@@ -418,6 +447,8 @@ namespace heongpu
                        Ciphertext<Scheme::BFV>& output,
                        const ExecutionOptions& options = ExecutionOptions())
         {
+            require_domain(input1, true, options);
+
             if (input1.relinearization_required_)
             {
                 throw std::invalid_argument(
@@ -443,17 +474,10 @@ namespace heongpu
                                 output,
                                 [&](Ciphertext<Scheme::BFV>& output_)
                                 {
-                                    if (input1_.in_ntt_domain_ !=
-                                        input2_.in_ntt_domain_)
-                                    {
-                                        throw std::logic_error(
-                                            "BFV ciphertext or "
-                                            "plaintext "
-                                            "should be not in same "
-                                            "domain");
-                                    }
-
-                                    if (input2_.size() < n)
+                                    int plain_size = input2_.in_ntt_domain_
+                                                         ? (n * Q_size_)
+                                                         : n;
+                                    if (input2_.size() < plain_size)
                                     {
                                         throw std::invalid_argument(
                                             "Invalid Plaintext size!");
@@ -586,6 +610,8 @@ namespace heongpu
                     Galoiskey<Scheme::BFV>& galois_key, int shift,
                     const ExecutionOptions& options = ExecutionOptions())
         {
+            require_domain(input1, false, options);
+
             if (input1.relinearization_required_)
             {
                 throw std::invalid_argument("Ciphertext can not be rotated!");
@@ -703,6 +729,8 @@ namespace heongpu
                        Galoiskey<Scheme::BFV>& galois_key,
                        const ExecutionOptions& options = ExecutionOptions())
         {
+            require_domain(input1, false, options);
+
             if (input1.relinearization_required_)
             {
                 throw std::invalid_argument("Ciphertext can not be rotated!");
@@ -790,6 +818,8 @@ namespace heongpu
                      Galoiskey<Scheme::BFV>& galois_key, int galois_elt,
                      const ExecutionOptions& options = ExecutionOptions())
         {
+            require_domain(input1, false, options);
+
             if (input1.relinearization_required_)
             {
                 throw std::invalid_argument("Ciphertext can not be rotated!");
@@ -899,6 +929,8 @@ namespace heongpu
                   Switchkey<Scheme::BFV>& switch_key,
                   const ExecutionOptions& options = ExecutionOptions())
         {
+            require_domain(input1, false, options);
+
             if (input1.relinearization_required_)
             {
                 throw std::invalid_argument("Ciphertext can not be rotated!");
@@ -980,6 +1012,8 @@ namespace heongpu
             Ciphertext<Scheme::BFV>& input1, Ciphertext<Scheme::BFV>& output,
             int index, const ExecutionOptions& options = ExecutionOptions())
         {
+            require_domain(input1, false, options);
+
             if (index != 0)
             {
                 if (input1.in_ntt_domain_ != false)
@@ -1019,10 +1053,141 @@ namespace heongpu
             }
         }
 
+        /**
+         * @brief Returns the Galois elements required by expand for the given
+         * number of outputs. The Galois key passed to expand has to be
+         * generated from these elements, e.g.
+         * Galoiskey<Scheme::BFV>(context, galois_elts).
+         *
+         * @param output_count Number of ciphertexts expand produces.
+         * @return std::vector<uint32_t> One Galois element per expansion level.
+         */
+        __host__ std::vector<uint32_t>
+        expand_galois_elements(int output_count) const
+        {
+            if (output_count <= 0)
+            {
+                throw std::invalid_argument("Output count should be positive!");
+            }
+
+            std::vector<uint32_t> galois_elts;
+            for (int level = 0; (1 << level) < output_count; level++)
+            {
+                galois_elts.push_back((n >> level) + 1);
+            }
+
+            return galois_elts;
+        }
+
+        /**
+         * @brief Obliviously expands one query ciphertext into output_count
+         * selection ciphertexts, as used by PIR servers.
+         *
+         * With k = ceil(log2(output_count)), output i encrypts 2^k times the
+         * coefficients i, i + 2^k, i + 2 * 2^k, ... of the input, moved to the
+         * coefficients 0, 2^k, 2 * 2^k, .... If the query only has non-zero
+         * coefficients below 2^k, output i is the constant 2^k * m_i, so the
+         * client usually scales its query by the inverse of 2^k modulo the
+         * plain modulus. The expansion tree is evaluated level by level: all
+         * ciphertexts of a level are shifted, key-switched and accumulated
+         * with a single launch of each kernel.
+         *
+         * @param input1 Query ciphertext in the coefficient domain.
+         * @param output Output vector, resized to output_count.
+         * @param galois_key Galois key generated from
+         * expand_galois_elements(output_count). Only KEYSWITCHING_METHOD_I
+         * keys are supported.
+         * @param output_count Number of selection ciphertexts.
+         */
+        __host__ void
+        expand(Ciphertext<Scheme::BFV>& input1,
+               std::vector<Ciphertext<Scheme::BFV>>& output,
+               Galoiskey<Scheme::BFV>& galois_key, int output_count,
+               const ExecutionOptions& options = ExecutionOptions())
+        {
+            require_domain(input1, false, options);
+
+            if (output_count <= 0)
+            {
+                throw std::invalid_argument("Output count should be positive!");
+            }
+
+            if (input1.relinearization_required_)
+            {
+                throw std::invalid_argument("Ciphertext can not be expanded!");
+            }
+
+            if (input1.memory_size() < (2 * n * Q_size_))
+            {
+                throw std::invalid_argument("Invalid Ciphertexts size!");
+            }
+
+            if (input1.in_ntt_domain_ != false)
+            {
+                throw std::invalid_argument(
+                    "Ciphertext should be in intt domain");
+            }
+
+            if (output_count > n)
+            {
+                throw std::invalid_argument(
+                    "Output count can not exceed the ring size!");
+            }
+
+            input_storage_manager(
+                input1,
+                [&](Ciphertext<Scheme::BFV>& input1_)
+                {
+                    switch (static_cast<int>(galois_key.key_type))
+                    {
+                        case 1: // KEYSWITCHING_METHOD_I
+
+                            expand_method_I(input1_, output, galois_key,
+                                            output_count, options.stream_);
+
+                            break;
+                        case 2: // KEYSWITCHING_METHOD_II
+                        case 3: // KEYSWITCHING_METHOD_III
+
+                            throw std::invalid_argument(
+                                "Query expansion is only supported for "
+                                "KEYSWITCHING_METHOD_I!");
+
+                            break;
+                        default:
+                            throw std::invalid_argument(
+                                "Invalid Key Switching Type");
+                            break;
+                    }
+                },
+                options, false);
+
+            for (Ciphertext<Scheme::BFV>& output_ : output)
+            {
+                output_.scheme_ = scheme_;
+                output_.ring_size_ = n;
+                output_.coeff_modulus_count_ = Q_size_;
+                output_.cipher_size_ = 2;
+                output_.in_ntt_domain_ = false;
+                output_.relinearization_required_ = false;
+                output_.ciphertext_generated_ = true;
+
+                if (options.storage_ == storage_type::HOST)
+                {
+                    output_.store_in_host(options.stream_);
+                }
+            }
+        }
+
         /**
          * @brief Transforms a plaintext to the NTT domain and stores the result
          * in the output.
          *
+         * The plaintext is lifted to every RNS limb before the transform, so
+         * the output is a prepared plaintext that multiply_plain consumes
+         * without further preprocessing. It can be saved and loaded like any
+         * other plaintext.
+         *
          * @param input1 Input plaintext to be transformed.
          * @param output Plaintext where the result of the transformation is
          * stored.
@@ -1204,6 +1369,49 @@ namespace heongpu
             transform_from_ntt(input1, input1, options);
         }
 
+        /**
+         * @brief Enables or disables lazy domain tracking.
+         *
+         * When enabled, ciphertexts stay in whichever domain the last operation
+         * left them in and are converted in place only when an operation needs
+         * the other one: multiply_plain keeps its input and output in the NTT
+         * domain, additions bring the second operand to the domain of the
+         * first, and rotations, Galois automorphisms, key switching,
+         * ciphertext multiplication (and thus relinearization),
+         * multiply_power_of_X and expand move their input back to the
+         * coefficient domain. Decryption accepts either domain. When disabled
+         * (the default), operations keep their strict domain checks.
+         *
+         * @param enabled Whether operations may change the domain of their
+         * inputs.
+         */
+        __host__ void set_lazy_domain(bool enabled) noexcept
+        {
+            lazy_domain_ = enabled;
+        }
+
+        /**
+         * @brief Returns whether lazy domain tracking is enabled.
+         */
+        __host__ bool lazy_domain() const noexcept { return lazy_domain_; }
+
+        /**
+         * @brief Returns the ciphertext domain transforms performed by this
+         * operator since construction or the last reset.
+         */
+        __host__ DomainTransformStatistics domain_statistics() const noexcept
+        {
+            return domain_statistics_;
+        }
+
+        /**
+         * @brief Resets the domain transform counters.
+         */
+        __host__ void reset_domain_statistics() noexcept
+        {
+            domain_statistics_ = DomainTransformStatistics();
+        }
+
         HEOperator() = default;
         HEOperator(const HEOperator& copy) = default;
         HEOperator(HEOperator&& source) = default;
@@ -1240,6 +1448,12 @@ namespace heongpu
                                          Ciphertext<Scheme::BFV>& output,
                                          const cudaStream_t stream);
 
+        // Moves input1 to the requested domain in place when lazy domain
+        // tracking is enabled; a no-op otherwise.
+        __host__ void require_domain(Ciphertext<Scheme::BFV>& input1,
+                                     bool in_ntt_domain,
+                                     const ExecutionOptions& options);
+
         ///////////////////////////////////////////////////
 
         __host__ void
@@ -1282,6 +1496,12 @@ namespace heongpu
                                              int galois_elt,
                                              const cudaStream_t stream);
 
+        __host__ void
+        expand_method_I(Ciphertext<Scheme::BFV>& input1,
+                        std::vector<Ciphertext<Scheme::BFV>>& output,
+                        Galoiskey<Scheme::BFV>& galois_key, int output_count,
+                        const cudaStream_t stream);
+
         ///////////////////////////////////////////////////
 
         __host__ void rotate_columns_method_I(
@@ -1342,6 +1562,9 @@ namespace heongpu
         int Q_size_;
         int P_size_;
 
+        bool lazy_domain_ = false;
+        DomainTransformStatistics domain_statistics_;
+
         std::shared_ptr<DeviceVector<Modulus64>> modulus_;
         std::shared_ptr<DeviceVector<Root64>> ntt_table_;
         std::shared_ptr<DeviceVector<Root64>> intt_table_;
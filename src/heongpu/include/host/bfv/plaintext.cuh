@@ -195,6 +195,11 @@ namespace heongpu
 
         void load(std::istream& is);
 
+      protected:
+        // Reads the BFV layout, which the BGV plaintext shares, and checks
+        // that the stream holds expected_scheme.
+        void load(std::istream& is, scheme_type expected_scheme);
+
       private:
         scheme_type scheme_;
         int plain_size_;
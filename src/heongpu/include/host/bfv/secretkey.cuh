@@ -299,6 +299,11 @@ namespace heongpu
 
         void load(std::istream& is);
 
+      protected:
+        // Reads the BFV layout, which the BGV secret key shares, and checks
+        // that the stream holds expected_scheme.
+        void load(std::istream& is, scheme_type expected_scheme);
+
       private:
         scheme_type scheme_;
         int ring_size_;
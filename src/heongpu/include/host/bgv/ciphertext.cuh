@@ -0,0 +1,295 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_BGV_CIPHERTEXT_H
+#define HEONGPU_BGV_CIPHERTEXT_H
+
+#include "bgv/context.cuh"
+
+namespace heongpu
+{
+    /**
+     * @brief Ciphertext<Scheme::BGV> is a BGV ciphertext in the coefficient
+     * domain.
+     *
+     * A ciphertext at depth d holds (Q_size - d) RNS limbs per polynomial:
+     * every modulus switch drops the last prime. Modulus switching multiplies
+     * the message by q_l^-1 mod t, so the ciphertext carries the correction
+     * factor its message is multiplied by; decryption removes it.
+     */
+    template <> class Ciphertext<Scheme::BGV>
+    {
+        template <Scheme S> friend class HEEncryptor;
+        template <Scheme S> friend class HEDecryptor;
+        template <Scheme S> friend class HEOperator;
+        template <Scheme S> friend class HEArithmeticOperator;
+
+        template <typename T, typename F>
+        friend void input_storage_manager(T& object, F function,
+                                          ExecutionOptions options,
+                                          bool check_initial_condition);
+        template <typename T, typename F>
+        friend void input_vector_storage_manager(std::vector<T>& objects,
+                                                 F function,
+                                                 ExecutionOptions options,
+                                                 bool is_input_output_same);
+
+      public:
+        /**
+         * @brief Constructs a new Ciphertext object with specified parameters
+         * and CUDA stream.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         * @param options Storage type and stream of the ciphertext.
+         */
+        __host__
+        Ciphertext(HEContext<Scheme::BGV>& context,
+                   const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Stores the ciphertext in the device (GPU) memory.
+         */
+        void store_in_device(cudaStream_t stream = cudaStreamDefault);
+
+        /**
+         * @brief Stores the ciphertext in the host (CPU) memory.
+         */
+        void store_in_host(cudaStream_t stream = cudaStreamDefault);
+
+        /**
+         * @brief Checks whether the data is stored on the device (GPU) memory.
+         */
+        bool is_on_device() const noexcept
+        {
+            return (storage_type_ == storage_type::DEVICE);
+        }
+
+        /**
+         * @brief Returns a pointer to the underlying data of the ciphertext.
+         *
+         * @return Data64* Pointer to the data.
+         */
+        Data64* data();
+
+        /**
+         * @brief Copies the data from the device to the host.
+         *
+         * @param cipher Reference to a vector where the device data will be
+         * copied to.
+         * @param stream The CUDA stream to be used for asynchronous operations.
+         * Defaults to `cudaStreamDefault`.
+         */
+        void get_data(std::vector<Data64>& cipher,
+                      cudaStream_t stream = cudaStreamDefault);
+
+        /**
+         * @brief Switches the Ciphertext CUDA stream.
+         *
+         * @param stream The new CUDA stream to be used.
+         */
+        void switch_stream(cudaStream_t stream)
+        {
+            device_locations_.set_stream(stream);
+        }
+
+        /**
+         * @brief Retrieves the CUDA stream associated with the ciphertext.
+         *
+         * @return The CUDA stream associated with the ciphertext.
+         */
+        cudaStream_t stream() const noexcept
+        {
+            return device_locations_.stream();
+        }
+
+        /**
+         * @brief Returns the size of the polynomial ring used in ciphertext.
+         *
+         * @return int Size of the polynomial ring.
+         */
+        inline int ring_size() const noexcept { return ring_size_; }
+
+        /**
+         * @brief Returns the number of coefficient modulus primes of the
+         * context.
+         *
+         * @return int Number of coefficient modulus primes.
+         */
+        inline int coeff_modulus_count() const noexcept
+        {
+            return coeff_modulus_count_;
+        }
+
+        /**
+         * @brief Returns the size of the ciphertext.
+         *
+         * @return int Size of the ciphertext.
+         */
+        inline int size() const noexcept { return cipher_size_; }
+
+        /**
+         * @brief Returns the number of primes dropped by modulus switching.
+         *
+         * @return int Depth level of the ciphertext.
+         */
+        inline int depth() const noexcept { return depth_; }
+
+        /**
+         * @brief Returns the factor the message is multiplied by, modulo the
+         * plaintext modulus.
+         *
+         * @return Data64 Correction factor.
+         */
+        inline Data64 correction_factor() const noexcept
+        {
+            return correction_factor_;
+        }
+
+        /**
+         * @brief Indicates whether relinearization is required for the
+         * ciphertext.
+         *
+         * @return bool True if relinearization is required, false otherwise.
+         */
+        inline bool relinearization_required() const noexcept
+        {
+            return relinearization_required_;
+        }
+
+        Ciphertext() = default;
+
+        Ciphertext(const Ciphertext& copy)
+            : scheme_(copy.scheme_), ring_size_(copy.ring_size_),
+              coeff_modulus_count_(copy.coeff_modulus_count_),
+              cipher_size_(copy.cipher_size_), depth_(copy.depth_),
+              storage_type_(copy.storage_type_),
+              correction_factor_(copy.correction_factor_),
+              relinearization_required_(copy.relinearization_required_),
+              ciphertext_generated_(copy.ciphertext_generated_)
+        {
+            if (copy.storage_type_ == storage_type::DEVICE)
+            {
+                device_locations_.resize(copy.device_locations_.size(),
+                                         copy.device_locations_.stream());
+                cudaMemcpyAsync(device_locations_.data(),
+                                copy.device_locations_.data(),
+                                copy.device_locations_.size() * sizeof(Data64),
+                                cudaMemcpyDeviceToDevice,
+                                copy.device_locations_.stream());
+            }
+            else
+            {
+                host_locations_ = copy.host_locations_;
+            }
+        }
+
+        Ciphertext(Ciphertext&& assign) noexcept
+            : scheme_(std::move(assign.scheme_)),
+              ring_size_(std::move(assign.ring_size_)),
+              coeff_modulus_count_(std::move(assign.coeff_modulus_count_)),
+              cipher_size_(std::move(assign.cipher_size_)),
+              depth_(std::move(assign.depth_)),
+              storage_type_(std::move(assign.storage_type_)),
+              correction_factor_(std::move(assign.correction_factor_)),
+              relinearization_required_(
+                  std::move(assign.relinearization_required_)),
+              ciphertext_generated_(std::move(assign.ciphertext_generated_)),
+              device_locations_(std::move(assign.device_locations_)),
+              host_locations_(std::move(assign.host_locations_))
+        {
+        }
+
+        Ciphertext& operator=(const Ciphertext& copy)
+        {
+            if (this != &copy)
+            {
+                scheme_ = copy.scheme_;
+                ring_size_ = copy.ring_size_;
+                coeff_modulus_count_ = copy.coeff_modulus_count_;
+                cipher_size_ = copy.cipher_size_;
+                depth_ = copy.depth_;
+                storage_type_ = copy.storage_type_;
+                correction_factor_ = copy.correction_factor_;
+                relinearization_required_ = copy.relinearization_required_;
+                ciphertext_generated_ = copy.ciphertext_generated_;
+
+                if (copy.storage_type_ == storage_type::DEVICE)
+                {
+                    device_locations_.resize(copy.device_locations_.size(),
+                                             copy.device_locations_.stream());
+                    cudaMemcpyAsync(
+                        device_locations_.data(), copy.device_locations_.data(),
+                        copy.device_locations_.size() * sizeof(Data64),
+                        cudaMemcpyDeviceToDevice,
+                        copy.device_locations_.stream());
+                }
+                else
+                {
+                    host_locations_ = copy.host_locations_;
+                }
+            }
+            return *this;
+        }
+
+        Ciphertext& operator=(Ciphertext&& assign) noexcept
+        {
+            if (this != &assign)
+            {
+                scheme_ = std::move(assign.scheme_);
+                ring_size_ = std::move(assign.ring_size_);
+                coeff_modulus_count_ = std::move(assign.coeff_modulus_count_);
+                cipher_size_ = std::move(assign.cipher_size_);
+                depth_ = std::move(assign.depth_);
+                storage_type_ = std::move(assign.storage_type_);
+                correction_factor_ = std::move(assign.correction_factor_);
+                relinearization_required_ =
+                    std::move(assign.relinearization_required_);
+                ciphertext_generated_ = std::move(assign.ciphertext_generated_);
+
+                device_locations_ = std::move(assign.device_locations_);
+                host_locations_ = std::move(assign.host_locations_);
+            }
+            return *this;
+        }
+
+        void save(std::ostream& os) const;
+
+        /**
+         * @brief Returns the number of bytes save() writes, without copying
+         * the ciphertext data.
+         */
+        size_t serialized_size() const;
+
+        void load(std::istream& is);
+
+      private:
+        scheme_type scheme_;
+        int ring_size_;
+        int coeff_modulus_count_;
+        int cipher_size_;
+        int depth_;
+
+        storage_type storage_type_;
+
+        Data64 correction_factor_;
+        bool relinearization_required_;
+
+        bool ciphertext_generated_ = false;
+
+        DeviceVector<Data64> device_locations_;
+        HostVector<Data64> host_locations_;
+
+        int memory_size();
+        void memory_clear(cudaStream_t stream);
+        void memory_set(DeviceVector<Data64>&& new_device_vector);
+
+        void copy_to_device(cudaStream_t stream);
+        void remove_from_device(cudaStream_t stream);
+        void remove_from_host();
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_BGV_CIPHERTEXT_H
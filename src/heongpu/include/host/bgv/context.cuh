@@ -0,0 +1,91 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_BGV_CONTEXT_H
+#define HEONGPU_BGV_CONTEXT_H
+
+#include "bfv/context.cuh"
+
+namespace heongpu
+{
+    /**
+     * @brief HEContext<Scheme::BGV> holds the encryption parameters of the
+     * BGV scheme.
+     *
+     * BGV uses the same ring, RNS bases, NTT tables and plaintext tables as
+     * BFV, so the context is built on top of the BFV context and only adds
+     * the tables of modulus switching. A BGV ciphertext encodes its message
+     * in the least significant bits and drops the last prime of its modulus
+     * after a multiplication, so deep circuits run on fewer limbs.
+     *
+     * Key switching uses method I with a single P prime.
+     */
+    template <>
+    class HEContext<Scheme::BGV> : private HEContext<Scheme::BFV>
+    {
+        template <Scheme S> friend class Secretkey;
+        template <Scheme S> friend class Publickey;
+        template <Scheme S> friend class Plaintext;
+        template <Scheme S> friend class Ciphertext;
+        template <Scheme S> friend class Relinkey;
+        template <Scheme S> friend class Galoiskey;
+        template <Scheme S> friend class HEEncoder;
+        template <Scheme S> friend class HEKeyGenerator;
+        template <Scheme S> friend class HEEncryptor;
+        template <Scheme S> friend class HEDecryptor;
+        template <Scheme S> friend class HEOperator;
+        template <Scheme S> friend class HEArithmeticOperator;
+
+      public:
+        HEContext(const keyswitching_type ks_type,
+                  const sec_level_type = sec_level_type::sec128);
+
+        using HEContext<Scheme::BFV>::set_poly_modulus_degree;
+        using HEContext<Scheme::BFV>::set_coeff_modulus_bit_sizes;
+        using HEContext<Scheme::BFV>::set_coeff_modulus_values;
+        using HEContext<Scheme::BFV>::set_coeff_modulus_default_values;
+        using HEContext<Scheme::BFV>::set_plain_modulus;
+
+        /**
+         * @brief Generates the BFV tables and the modulus switching tables.
+         *
+         * @throws std::invalid_argument if the context does not use key
+         * switching method I with a single P prime.
+         */
+        void generate();
+
+        void print_parameters();
+
+        using HEContext<Scheme::BFV>::get_poly_modulus_degree;
+        using HEContext<Scheme::BFV>::get_log_poly_modulus_degree;
+        using HEContext<Scheme::BFV>::get_ciphertext_modulus_count;
+        using HEContext<Scheme::BFV>::get_key_modulus_count;
+        using HEContext<Scheme::BFV>::get_plain_modulus;
+        using HEContext<Scheme::BFV>::get_key_modulus;
+
+        HEContext() = default;
+
+        using HEContext<Scheme::BFV>::save;
+
+        void load(std::istream& is);
+
+      private:
+        void generate_modulus_switching_parameters();
+
+        // q_l^-1 mod q_i for i < l, for every level l, in the layout of the
+        // CKKS rescale tables.
+        std::shared_ptr<DeviceVector<Data64>> switch_last_q_modinv_;
+
+        // t^-1 mod q_l and q_l^-1 mod t of the last prime of every level,
+        // indexed by the ciphertext depth.
+        std::vector<Data64> switch_plain_inv_;
+        std::vector<Data64> switch_last_q_inv_mod_t_;
+
+        // t^-1 mod P, used when key switching divides by P.
+        Data64 plain_inv_p_;
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_BGV_CONTEXT_H
@@ -0,0 +1,116 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_BGV_DECRYPTOR_H
+#define HEONGPU_BGV_DECRYPTOR_H
+
+#include "ntt.cuh"
+#include "decryption.cuh"
+#include "switchkey.cuh"
+#include "bgv/context.cuh"
+#include "bgv/secretkey.cuh"
+#include "bgv/plaintext.cuh"
+#include "bgv/ciphertext.cuh"
+
+namespace heongpu
+{
+    /**
+     * @brief HEDecryptor<Scheme::BGV> decrypts BGV ciphertexts with a secret
+     * key.
+     *
+     * A copy of the ciphertext is switched down to the first prime, where
+     * c0 + c1 * s is reduced modulo the plaintext modulus and the correction
+     * factor of the ciphertext is removed.
+     */
+    template <> class HEDecryptor<Scheme::BGV>
+    {
+      public:
+        /**
+         * @brief Constructs a new HEDecryptor object with specified parameters
+         * and secret key.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         * @param secret_key Reference to the Secretkey object used for
+         * decryption.
+         */
+        __host__ HEDecryptor(HEContext<Scheme::BGV>& context,
+                             Secretkey<Scheme::BGV>& secret_key);
+
+        /**
+         * @brief Decrypts a ciphertext into a plaintext.
+         *
+         * @param plaintext Plaintext object where the result of the decryption
+         * will be stored.
+         * @param ciphertext Ciphertext object to be decrypted.
+         * @throws std::invalid_argument if the ciphertext has to be
+         * relinearized first.
+         */
+        __host__ void
+        decrypt(Plaintext<Scheme::BGV>& plaintext,
+                Ciphertext<Scheme::BGV>& ciphertext,
+                const ExecutionOptions& options = ExecutionOptions())
+        {
+            if (ciphertext.relinearization_required_)
+            {
+                throw std::invalid_argument(
+                    "Ciphertext should be relinearized before decryption!");
+            }
+
+            input_storage_manager(
+                ciphertext,
+                [&](Ciphertext<Scheme::BGV>& ciphertext_)
+                {
+                    output_storage_manager(
+                        plaintext,
+                        [&](Plaintext<Scheme::BGV>& plaintext_)
+                        {
+                            decrypt_bgv(plaintext_, ciphertext_,
+                                        options.stream_);
+                            plaintext.plain_size_ = n;
+                            plaintext.scheme_ = scheme_;
+                            plaintext.in_ntt_domain_ = false;
+                        },
+                        options);
+                },
+                options, false);
+        }
+
+        HEDecryptor() = default;
+        HEDecryptor(const HEDecryptor& copy) = default;
+        HEDecryptor(HEDecryptor&& source) = default;
+        HEDecryptor& operator=(const HEDecryptor& assign) = default;
+        HEDecryptor& operator=(HEDecryptor&& assign) = default;
+
+      private:
+        __host__ void decrypt_bgv(Plaintext<Scheme::BGV>& plaintext,
+                                  Ciphertext<Scheme::BGV>& ciphertext,
+                                  const cudaStream_t stream);
+
+      private:
+        scheme_type scheme_;
+
+        DeviceVector<Data64> secret_key_;
+
+        int n;
+
+        int n_power;
+
+        int Q_size_;
+
+        std::shared_ptr<DeviceVector<Modulus64>> modulus_;
+        std::shared_ptr<DeviceVector<Root64>> ntt_table_;
+        std::shared_ptr<DeviceVector<Root64>> intt_table_;
+        std::shared_ptr<DeviceVector<Ninverse64>> n_inverse_;
+
+        Modulus64 plain_modulus_;
+
+        std::shared_ptr<DeviceVector<Data64>> switch_last_q_modinv_;
+        std::vector<Data64> switch_plain_inv_;
+        std::vector<Data64> switch_last_q_inv_mod_t_;
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_BGV_DECRYPTOR_H
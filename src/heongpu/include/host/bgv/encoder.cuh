@@ -0,0 +1,35 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_BGV_ENCODER_H
+#define HEONGPU_BGV_ENCODER_H
+
+#include "bgv/context.cuh"
+#include "bgv/plaintext.cuh"
+#include "bfv/encoder.cuh"
+
+namespace heongpu
+{
+    /**
+     * @brief HEEncoder<Scheme::BGV> packs integer vectors into the slots of a
+     * plaintext with the BFV batching encoder; both schemes share the
+     * plaintext space.
+     */
+    template <> class HEEncoder<Scheme::BGV> : public HEEncoder<Scheme::BFV>
+    {
+      public:
+        /**
+         * @brief Constructs a new HEEncoder object with specified parameters.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         */
+        __host__ HEEncoder(HEContext<Scheme::BGV>& context);
+
+        HEEncoder() = default;
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_BGV_ENCODER_H
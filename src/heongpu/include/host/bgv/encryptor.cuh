@@ -0,0 +1,120 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_BGV_ENCRYPTOR_H
+#define HEONGPU_BGV_ENCRYPTOR_H
+
+#include "ntt.cuh"
+#include "encryption.cuh"
+#include "bgv/context.cuh"
+#include "bgv/publickey.cuh"
+#include "bgv/plaintext.cuh"
+#include "bgv/ciphertext.cuh"
+
+namespace heongpu
+{
+    /**
+     * @brief HEEncryptor<Scheme::BGV> encrypts plaintexts into BGV
+     * ciphertexts with a public key.
+     *
+     * The message is placed in the least significant bits of the first
+     * ciphertext polynomial; a new ciphertext is at depth 0 and has a
+     * correction factor of 1.
+     */
+    template <> class HEEncryptor<Scheme::BGV>
+    {
+      public:
+        /**
+         * @brief Constructs a new HEEncryptor object with specified parameters
+         * and public key.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         * @param public_key Reference to the Publickey object used for
+         * encryption.
+         */
+        __host__ HEEncryptor(HEContext<Scheme::BGV>& context,
+                             Publickey<Scheme::BGV>& public_key);
+
+        /**
+         * @brief Encrypts a plaintext into a ciphertext.
+         *
+         * @param ciphertext Ciphertext object where the result of the
+         * encryption will be stored.
+         * @param plaintext Plaintext object to be encrypted.
+         */
+        __host__ void
+        encrypt(Ciphertext<Scheme::BGV>& ciphertext,
+                Plaintext<Scheme::BGV>& plaintext,
+                const ExecutionOptions& options = ExecutionOptions())
+        {
+            if (plaintext.size() < n)
+            {
+                throw std::invalid_argument("Invalid plaintext size.");
+            }
+
+            input_storage_manager(
+                plaintext,
+                [&](Plaintext<Scheme::BGV>& plaintext_)
+                {
+                    output_storage_manager(
+                        ciphertext,
+                        [&](Ciphertext<Scheme::BGV>& ciphertext_)
+                        {
+                            encrypt_bgv(ciphertext_, plaintext_,
+                                        options.stream_);
+
+                            ciphertext.scheme_ = scheme_;
+                            ciphertext.ring_size_ = n;
+                            ciphertext.coeff_modulus_count_ = Q_size_;
+                            ciphertext.cipher_size_ = 2;
+                            ciphertext.depth_ = 0;
+                            ciphertext.correction_factor_ = 1;
+                            ciphertext.relinearization_required_ = false;
+                            ciphertext.ciphertext_generated_ = true;
+                        },
+                        options);
+                },
+                options, false);
+        }
+
+        HEEncryptor() = default;
+        HEEncryptor(const HEEncryptor& copy) = default;
+        HEEncryptor(HEEncryptor&& source) = default;
+        HEEncryptor& operator=(const HEEncryptor& assign) = default;
+        HEEncryptor& operator=(HEEncryptor&& assign) = default;
+
+      private:
+        __host__ void encrypt_bgv(Ciphertext<Scheme::BGV>& ciphertext,
+                                  Plaintext<Scheme::BGV>& plaintext,
+                                  const cudaStream_t stream);
+
+      private:
+        scheme_type scheme_;
+
+        DeviceVector<Data64> public_key_;
+
+        int n;
+
+        int n_power;
+
+        int Q_prime_size_;
+        int Q_size_;
+
+        std::shared_ptr<DeviceVector<Modulus64>> modulus_;
+        std::shared_ptr<DeviceVector<Root64>> ntt_table_;
+        std::shared_ptr<DeviceVector<Root64>> intt_table_;
+        std::shared_ptr<DeviceVector<Ninverse64>> n_inverse_;
+        std::shared_ptr<DeviceVector<Data64>> last_q_modinv_;
+
+        Modulus64 plain_modulus_;
+        Data64 plain_inv_p_;
+
+        Data64 upper_threshold_;
+        std::shared_ptr<DeviceVector<Data64>> upper_halfincrement_;
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_BGV_ENCRYPTOR_H
@@ -0,0 +1,90 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_BGV_EVALUATIONKEY_H
+#define HEONGPU_BGV_EVALUATIONKEY_H
+
+#include "bgv/context.cuh"
+#include "bfv/evaluationkey.cuh"
+
+namespace heongpu
+{
+    /**
+     * @brief Relinkey<Scheme::BGV> is a method I relinearization key whose
+     * error is a multiple of the plaintext modulus. Its layout is the one of
+     * the BFV method I key, so a ciphertext at any level uses the leading
+     * decomposition blocks of the key.
+     */
+    template <> class Relinkey<Scheme::BGV> : public Relinkey<Scheme::BFV>
+    {
+      public:
+        /**
+         * @brief Constructs a new Relinkey object with specified parameters.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         */
+        __host__ Relinkey(HEContext<Scheme::BGV>& context);
+
+        Relinkey() = default;
+
+        /**
+         * @brief Reads a relinearization key written by save(); streams of BFV
+         * relinearization keys are rejected.
+         */
+        void load(std::istream& is);
+    };
+
+    /**
+     * @brief Galoiskey<Scheme::BGV> holds method I Galois keys whose error is
+     * a multiple of the plaintext modulus, laid out like the BFV keys.
+     */
+    template <> class Galoiskey<Scheme::BGV> : public Galoiskey<Scheme::BFV>
+    {
+      public:
+        /**
+         * @brief Constructs a new Galoiskey object with default settings that
+         * allow rotations in the range (-255, 255).
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         */
+        __host__ Galoiskey(HEContext<Scheme::BGV>& context);
+
+        /**
+         * @brief Constructs a new Galoiskey object allowing specific rotations
+         * based on the given vector of shifts.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         * @param shift_vec Vector of integers representing the allowed shifts
+         * for rotations.
+         */
+        __host__ Galoiskey(HEContext<Scheme::BGV>& context,
+                           std::vector<int>& shift_vec);
+
+        /**
+         * @brief Constructs a new Galoiskey object allowing certain Galois
+         * elements given in a vector.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         * @param galois_elts Vector of Galois elements specifying the
+         * rotations allowed.
+         */
+        __host__ Galoiskey(HEContext<Scheme::BGV>& context,
+                           std::vector<uint32_t>& galois_elts);
+
+        Galoiskey() = default;
+
+        /**
+         * @brief Reads a Galois key written by save(); streams of BFV
+         * Galois keys are rejected.
+         */
+        void load(std::istream& is);
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_BGV_EVALUATIONKEY_H
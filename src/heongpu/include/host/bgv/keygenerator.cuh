@@ -0,0 +1,149 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_BGV_KEYGENERATOR_H
+#define HEONGPU_BGV_KEYGENERATOR_H
+
+#include "ntt.cuh"
+#include "keygeneration.cuh"
+#include "multiplication.cuh"
+#include "bgv/context.cuh"
+#include "bgv/secretkey.cuh"
+#include "bgv/publickey.cuh"
+#include "bgv/evaluationkey.cuh"
+
+namespace heongpu
+{
+    /**
+     * @brief HEKeyGenerator<Scheme::BGV> generates the keys of the BGV
+     * scheme.
+     *
+     * The keys have the layout of the BFV method I keys, but every error
+     * polynomial is multiplied by the plaintext modulus t, so that key
+     * switching and encryption leave the message in the least significant
+     * bits untouched.
+     */
+    template <> class HEKeyGenerator<Scheme::BGV>
+    {
+      public:
+        /**
+         * @brief Constructs a new HEKeyGenerator object with specified
+         * parameters.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         */
+        __host__ HEKeyGenerator(HEContext<Scheme::BGV>& context);
+
+        /**
+         * @brief Generates a secret key.
+         *
+         * @param sk Reference to the Secretkey object where the generated
+         * secret key will be stored.
+         */
+        __host__ void generate_secret_key(
+            Secretkey<Scheme::BGV>& sk,
+            const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Generates a public key using a secret key.
+         *
+         * @param pk Reference to the Publickey object where the generated
+         * public key will be stored.
+         * @param sk Reference to the Secretkey object used to generate the
+         * public key.
+         */
+        __host__ void generate_public_key(
+            Publickey<Scheme::BGV>& pk, Secretkey<Scheme::BGV>& sk,
+            const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Generates a relinearization key using a secret key.
+         *
+         * @param rk Reference to the Relinkey object where the generated
+         * relinearization key will be stored.
+         * @param sk Reference to the Secretkey object used to generate the
+         * relinearization key.
+         */
+        __host__ void generate_relin_key(
+            Relinkey<Scheme::BGV>& rk, Secretkey<Scheme::BGV>& sk,
+            const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Generates a Galois key using a secret key.
+         *
+         * @param gk Reference to the Galoiskey object where the generated
+         * Galois key will be stored.
+         * @param sk Reference to the Secretkey object used to generate the
+         * Galois key.
+         */
+        __host__ void generate_galois_key(
+            Galoiskey<Scheme::BGV>& gk, Secretkey<Scheme::BGV>& sk,
+            const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Returns the seed of the key generator.
+         *
+         * @return int Seed of the key generator.
+         */
+        inline int get_seed() const noexcept { return seed_; }
+
+        /**
+         * @brief Sets the seed of the key generator with new seed.
+         */
+        inline void set_seed(int new_seed) { seed_ = new_seed; }
+
+        /**
+         * @brief Returns the offset of the key generator(curand).
+         *
+         * @return int Offset of the key generator.
+         */
+        inline int get_offset() const noexcept { return offset_; }
+
+        /**
+         * @brief Sets the offset of the key generator with new offset(curand).
+         */
+        inline void set_offset(int new_offset) { offset_ = new_offset; }
+
+        HEKeyGenerator() = delete;
+        HEKeyGenerator(const HEKeyGenerator& copy) = delete;
+        HEKeyGenerator(HEKeyGenerator&& source) = delete;
+        HEKeyGenerator& operator=(const HEKeyGenerator& assign) = delete;
+        HEKeyGenerator& operator=(HEKeyGenerator&& assign) = delete;
+
+      private:
+        // Samples poly_count gaussian polynomials over all key moduli,
+        // multiplies them by t and transforms them to the NTT domain.
+        __host__ void generate_plain_scaled_error(Data64* error_poly,
+                                                  int poly_count,
+                                                  const cudaStream_t stream);
+
+        __host__ void generate_galois_key_piece(Secretkey<Scheme::BGV>& sk,
+                                                int galois_elt, Data64* output,
+                                                const cudaStream_t stream);
+
+      private:
+        scheme_type scheme;
+        int seed_;
+        int offset_; // Absolute offset into sequence (curand)
+
+        RNGSeed new_seed_;
+
+        int n;
+
+        int n_power;
+
+        int Q_prime_size_;
+        int Q_size_;
+
+        std::shared_ptr<DeviceVector<Modulus64>> modulus_;
+        std::shared_ptr<DeviceVector<Root64>> ntt_table_;
+        std::shared_ptr<DeviceVector<Data64>> factor_;
+
+        Modulus64 plain_modulus_;
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_BGV_KEYGENERATOR_H
@@ -0,0 +1,466 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_BGV_OPERATOR_H
+#define HEONGPU_BGV_OPERATOR_H
+
+#include "ntt.cuh"
+#include "addition.cuh"
+#include "multiplication.cuh"
+#include "switchkey.cuh"
+#include "keygeneration.cuh"
+
+#include "bgv/context.cuh"
+#include "bgv/encoder.cuh"
+#include "bgv/plaintext.cuh"
+#include "bgv/ciphertext.cuh"
+#include "bgv/evaluationkey.cuh"
+
+namespace heongpu
+{
+    /**
+     * @brief HEOperator<Scheme::BGV> performs homomorphic operations on BGV
+     * ciphertexts.
+     *
+     * Ciphertexts are kept in the coefficient domain like BFV ciphertexts.
+     * Unlike BFV, the noise is controlled by modulus switching: multiply
+     * drops the last prime of the ciphertext modulus from its product, which
+     * divides the noise by that prime and makes every following operation,
+     * relinearization included, work on one limb less.
+     * mod_switch_to_next switches explicitly. Operations on two
+     * ciphertexts require the same depth; differing correction factors are
+     * matched by scaling the second input.
+     */
+    template <> class HEOperator<Scheme::BGV>
+    {
+      protected:
+        /**
+         * @brief Construct a new HEOperator object with the given parameters.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters for the operator.
+         * @param encoder Encoder the plaintexts are packed with.
+         */
+        __host__ HEOperator(HEContext<Scheme::BGV>& context,
+                            HEEncoder<Scheme::BGV>& encoder);
+
+      public:
+        /**
+         * @brief Adds two ciphertexts and stores the result in the output.
+         *
+         * @param input1 First input ciphertext to be added.
+         * @param input2 Second input ciphertext to be added.
+         * @param output Ciphertext where the result of the addition is stored.
+         */
+        __host__ void add(Ciphertext<Scheme::BGV>& input1,
+                          Ciphertext<Scheme::BGV>& input2,
+                          Ciphertext<Scheme::BGV>& output,
+                          const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Adds the second ciphertext to the first ciphertext, modifying
+         * the first ciphertext with the result.
+         *
+         * @param input1 The ciphertext to which the value of input2 will be
+         * added.
+         * @param input2 The ciphertext to be added to input1.
+         */
+        __host__ void
+        add_inplace(Ciphertext<Scheme::BGV>& input1,
+                    Ciphertext<Scheme::BGV>& input2,
+                    const ExecutionOptions& options = ExecutionOptions())
+        {
+            add(input1, input2, input1, options);
+        }
+
+        /**
+         * @brief Subtracts the second ciphertext from the first and stores the
+         * result in the output.
+         *
+         * @param input1 First input ciphertext (minuend).
+         * @param input2 Second input ciphertext (subtrahend).
+         * @param output Ciphertext where the result of the subtraction is
+         * stored.
+         */
+        __host__ void sub(Ciphertext<Scheme::BGV>& input1,
+                          Ciphertext<Scheme::BGV>& input2,
+                          Ciphertext<Scheme::BGV>& output,
+                          const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Subtracts the second ciphertext from the first, modifying the
+         * first ciphertext with the result.
+         *
+         * @param input1 The ciphertext from which input2 will be subtracted.
+         * @param input2 The ciphertext to subtract from input1.
+         */
+        __host__ void
+        sub_inplace(Ciphertext<Scheme::BGV>& input1,
+                    Ciphertext<Scheme::BGV>& input2,
+                    const ExecutionOptions& options = ExecutionOptions())
+        {
+            sub(input1, input2, input1, options);
+        }
+
+        /**
+         * @brief Negates a ciphertext and stores the result in the output.
+         *
+         * @param input1 Input ciphertext to be negated.
+         * @param output Ciphertext where the result of the negation is stored.
+         */
+        __host__ void
+        negate(Ciphertext<Scheme::BGV>& input1, Ciphertext<Scheme::BGV>& output,
+               const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Negates a ciphertext in-place, modifying the input ciphertext.
+         *
+         * @param input1 Ciphertext to be negated.
+         */
+        __host__ void
+        negate_inplace(Ciphertext<Scheme::BGV>& input1,
+                       const ExecutionOptions& options = ExecutionOptions())
+        {
+            negate(input1, input1, options);
+        }
+
+        /**
+         * @brief Adds a ciphertext and a plaintext and stores the result in the
+         * output.
+         *
+         * @param input1 Input ciphertext to be added.
+         * @param input2 Input plaintext to be added.
+         * @param output Ciphertext where the result of the addition is stored.
+         */
+        __host__ void
+        add_plain(Ciphertext<Scheme::BGV>& input1,
+                  Plaintext<Scheme::BGV>& input2,
+                  Ciphertext<Scheme::BGV>& output,
+                  const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Adds a plaintext to a ciphertext in-place, modifying the input
+         * ciphertext.
+         *
+         * @param input1 Ciphertext to which the plaintext will be added.
+         * @param input2 Plaintext to be added to the ciphertext.
+         */
+        __host__ void
+        add_plain_inplace(Ciphertext<Scheme::BGV>& input1,
+                          Plaintext<Scheme::BGV>& input2,
+                          const ExecutionOptions& options = ExecutionOptions())
+        {
+            add_plain(input1, input2, input1, options);
+        }
+
+        /**
+         * @brief Subtracts a plaintext from a ciphertext and stores the result
+         * in the output.
+         *
+         * @param input1 Input ciphertext (minuend).
+         * @param input2 Input plaintext (subtrahend).
+         * @param output Ciphertext where the result of the subtraction is
+         * stored.
+         */
+        __host__ void
+        sub_plain(Ciphertext<Scheme::BGV>& input1,
+                  Plaintext<Scheme::BGV>& input2,
+                  Ciphertext<Scheme::BGV>& output,
+                  const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Subtracts a plaintext from a ciphertext in-place, modifying
+         * the input ciphertext.
+         *
+         * @param input1 Ciphertext from which the plaintext will be subtracted.
+         * @param input2 Plaintext to be subtracted from the ciphertext.
+         */
+        __host__ void
+        sub_plain_inplace(Ciphertext<Scheme::BGV>& input1,
+                          Plaintext<Scheme::BGV>& input2,
+                          const ExecutionOptions& options = ExecutionOptions())
+        {
+            sub_plain(input1, input2, input1, options);
+        }
+
+        /**
+         * @brief Multiplies two ciphertexts and stores the result in the
+         * output. The output has three polynomials and has to be relinearized.
+         * The product is also switched to the next level unless the inputs
+         * are at the last one or set_auto_mod_switch(false) was called.
+         *
+         * @param input1 First input ciphertext to be multiplied.
+         * @param input2 Second input ciphertext to be multiplied.
+         * @param output Ciphertext where the result of the multiplication is
+         * stored.
+         */
+        __host__ void
+        multiply(Ciphertext<Scheme::BGV>& input1,
+                 Ciphertext<Scheme::BGV>& input2,
+                 Ciphertext<Scheme::BGV>& output,
+                 const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Multiplies two ciphertexts in-place, modifying the first
+         * ciphertext.
+         *
+         * @param input1 Ciphertext to be multiplied, and where the result will
+         * be stored.
+         * @param input2 Second input ciphertext to be multiplied.
+         */
+        __host__ void
+        multiply_inplace(Ciphertext<Scheme::BGV>& input1,
+                         Ciphertext<Scheme::BGV>& input2,
+                         const ExecutionOptions& options = ExecutionOptions())
+        {
+            multiply(input1, input2, input1, options);
+        }
+
+        /**
+         * @brief Multiplies a ciphertext and a plaintext and stores the result
+         * in the output.
+         *
+         * @param input1 Input ciphertext to be multiplied.
+         * @param input2 Input plaintext to be multiplied.
+         * @param output Ciphertext where the result of the multiplication is
+         * stored.
+         */
+        __host__ void
+        multiply_plain(Ciphertext<Scheme::BGV>& input1,
+                       Plaintext<Scheme::BGV>& input2,
+                       Ciphertext<Scheme::BGV>& output,
+                       const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Multiplies a plaintext with a ciphertext in-place, modifying
+         * the input ciphertext.
+         *
+         * @param input1 Ciphertext to be multiplied by the plaintext, and
+         * where the result will be stored.
+         * @param input2 Plaintext to be multiplied with the ciphertext.
+         */
+        __host__ void multiply_plain_inplace(
+            Ciphertext<Scheme::BGV>& input1, Plaintext<Scheme::BGV>& input2,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            multiply_plain(input1, input2, input1, options);
+        }
+
+        /**
+         * @brief Relinearizes a ciphertext in-place at its current level.
+         *
+         * @param input1 Ciphertext to be relinearized.
+         * @param relin_key The Relinkey object used for relinearization.
+         */
+        __host__ void relinearize_inplace(
+            Ciphertext<Scheme::BGV>& input1, Relinkey<Scheme::BGV>& relin_key,
+            const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Switches a ciphertext to the next level by dividing it by its
+         * last prime, and stores the result in the output. The message is
+         * kept modulo the plaintext modulus up to the correction factor of
+         * the output.
+         *
+         * @param input1 Input ciphertext to be switched.
+         * @param output Ciphertext where the result is stored.
+         * @throws std::logic_error if the ciphertext is at its last level.
+         */
+        __host__ void mod_switch_to_next(
+            Ciphertext<Scheme::BGV>& input1, Ciphertext<Scheme::BGV>& output,
+            const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Switches a ciphertext to the next level in-place.
+         *
+         * @param input1 Ciphertext to be switched.
+         */
+        __host__ void mod_switch_to_next_inplace(
+            Ciphertext<Scheme::BGV>& input1,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            mod_switch_to_next(input1, input1, options);
+        }
+
+        /**
+         * @brief Rotates the rows of a ciphertext by a given shift value and
+         * stores the result in the output.
+         *
+         * @param input1 Input ciphertext to be rotated.
+         * @param output Ciphertext where the result of the rotation is stored.
+         * @param galois_key Galois key used for the rotation operation.
+         * @param shift Number of positions to shift the rows.
+         */
+        __host__ void
+        rotate_rows(Ciphertext<Scheme::BGV>& input1,
+                    Ciphertext<Scheme::BGV>& output,
+                    Galoiskey<Scheme::BGV>& galois_key, int shift,
+                    const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Rotates the rows of a ciphertext in-place by a given shift
+         * value, modifying the input ciphertext.
+         *
+         * @param input1 Ciphertext to be rotated.
+         * @param galois_key Galois key used for the rotation operation.
+         * @param shift Number of positions to shift the rows.
+         */
+        __host__ void rotate_rows_inplace(
+            Ciphertext<Scheme::BGV>& input1, Galoiskey<Scheme::BGV>& galois_key,
+            int shift, const ExecutionOptions& options = ExecutionOptions())
+        {
+            if (shift == 0)
+            {
+                return;
+            }
+
+            rotate_rows(input1, input1, galois_key, shift, options);
+        }
+
+        /**
+         * @brief Rotates the columns of a ciphertext and stores the result in
+         * the output.
+         *
+         * @param input1 Input ciphertext to be rotated.
+         * @param output Ciphertext where the result of the rotation is stored.
+         * @param galois_key Galois key used for the rotation operation.
+         */
+        __host__ void
+        rotate_columns(Ciphertext<Scheme::BGV>& input1,
+                       Ciphertext<Scheme::BGV>& output,
+                       Galoiskey<Scheme::BGV>& galois_key,
+                       const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Enables or disables modulus switching in multiply.
+         *
+         * When enabled, multiply (and multiply_inplace) drops the last prime
+         * of the three-polynomial product before returning it, so the noise
+         * of the product is divided by that prime and relinearization runs
+         * one level lower. This is the default. When disabled,
+         * mod_switch_to_next has to be called explicitly. multiply_plain is
+         * not affected.
+         *
+         * @param enabled Whether multiply switches its output to the next
+         * level.
+         */
+        __host__ void set_auto_mod_switch(bool enabled) noexcept
+        {
+            auto_mod_switch_ = enabled;
+        }
+
+        /**
+         * @brief Returns whether multiply switches its output to the next
+         * level.
+         */
+        __host__ bool auto_mod_switch() const noexcept
+        {
+            return auto_mod_switch_;
+        }
+
+        HEOperator() = default;
+        HEOperator(const HEOperator& copy) = default;
+        HEOperator(HEOperator&& source) = default;
+        HEOperator& operator=(const HEOperator& assign) = default;
+        HEOperator& operator=(HEOperator&& assign) = default;
+
+      protected:
+        // Returns the data of input2 with its message multiplied to the
+        // correction factor of input1. When the factors differ, the scaled
+        // copy is kept in scaled_memory.
+        __host__ Data64*
+        aligned_correction_data(Ciphertext<Scheme::BGV>& input1,
+                                Ciphertext<Scheme::BGV>& input2,
+                                DeviceVector<Data64>& scaled_memory,
+                                const cudaStream_t stream);
+
+        __host__ void check_binary_inputs(Ciphertext<Scheme::BGV>& input1,
+                                          Ciphertext<Scheme::BGV>& input2);
+
+        // Divides cipher_size polynomials at the given depth by their last
+        // prime; output holds one limb less per polynomial.
+        __host__ void mod_switch_bgv(Data64* input, Data64* output, int depth,
+                                     int cipher_size,
+                                     const cudaStream_t stream);
+
+        __host__ void add_sub_plain_bgv(Ciphertext<Scheme::BGV>& input1,
+                                        Plaintext<Scheme::BGV>& input2,
+                                        Ciphertext<Scheme::BGV>& output,
+                                        bool is_addition,
+                                        const ExecutionOptions& options);
+
+        // Key switches one polynomial of current_decomp_count limbs. The
+        // result holds two polynomials of current_decomp_count + 1 limbs,
+        // the last one being the P limb, in the coefficient domain.
+        __host__ void switch_key_bgv(Data64* input, Data64* key,
+                                     Data64* output, int depth,
+                                     const cudaStream_t stream);
+
+        __host__ void apply_galois_bgv(Ciphertext<Scheme::BGV>& input1,
+                                       Ciphertext<Scheme::BGV>& output,
+                                       Galoiskey<Scheme::BGV>& galois_key,
+                                       int galois_elt,
+                                       const cudaStream_t stream);
+
+        __host__ void rotate_bgv(Ciphertext<Scheme::BGV>& input1,
+                                 Ciphertext<Scheme::BGV>& output,
+                                 Galoiskey<Scheme::BGV>& galois_key, int shift,
+                                 const cudaStream_t stream);
+
+      protected:
+        scheme_type scheme_;
+
+        int n;
+
+        int n_power;
+
+        int Q_prime_size_;
+        int Q_size_;
+
+        std::shared_ptr<DeviceVector<Modulus64>> modulus_;
+        std::shared_ptr<DeviceVector<Root64>> ntt_table_;
+        std::shared_ptr<DeviceVector<Root64>> intt_table_;
+        std::shared_ptr<DeviceVector<Ninverse64>> n_inverse_;
+        std::shared_ptr<DeviceVector<Data64>> last_q_modinv_;
+
+        Modulus64 plain_modulus_;
+        Data64 plain_inv_p_;
+
+        Data64 upper_threshold_;
+        std::shared_ptr<DeviceVector<Data64>> upper_halfincrement_;
+
+        std::shared_ptr<DeviceVector<Data64>> switch_last_q_modinv_;
+        std::vector<Data64> switch_plain_inv_;
+        std::vector<Data64> switch_last_q_inv_mod_t_;
+
+        // Modulus order of the key switching NTTs of every level
+        DeviceVector<int> new_prime_locations_;
+        int* new_prime_locations;
+
+        int slot_count_;
+
+        bool auto_mod_switch_ = true;
+    };
+
+    /**
+     * @brief HEArithmeticOperator performs arithmetic operations on BGV
+     * ciphertexts.
+     */
+    template <>
+    class HEArithmeticOperator<Scheme::BGV> : public HEOperator<Scheme::BGV>
+    {
+      public:
+        /**
+         * @brief Constructs a new HEArithmeticOperator object.
+         *
+         * @param context Encryption parameters.
+         * @param encoder Encoder for arithmetic operations.
+         */
+        HEArithmeticOperator(HEContext<Scheme::BGV>& context,
+                             HEEncoder<Scheme::BGV>& encoder);
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_BGV_OPERATOR_H
@@ -0,0 +1,43 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_BGV_PLAINTEXT_H
+#define HEONGPU_BGV_PLAINTEXT_H
+
+#include "bgv/context.cuh"
+#include "bfv/plaintext.cuh"
+
+namespace heongpu
+{
+    /**
+     * @brief Plaintext<Scheme::BGV> holds ring_size coefficients modulo the
+     * plaintext modulus, like the BFV plaintext.
+     */
+    template <>
+    class Plaintext<Scheme::BGV> : public Plaintext<Scheme::BFV>
+    {
+      public:
+        /**
+         * @brief Constructs a new Plaintext object with specified parameters
+         * and an optional CUDA stream.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         */
+        explicit __host__
+        Plaintext(HEContext<Scheme::BGV>& context,
+                  const ExecutionOptions& options = ExecutionOptions());
+
+        Plaintext() = default;
+
+        /**
+         * @brief Reads a plaintext written by save(); streams of BFV
+         * plaintexts are rejected.
+         */
+        void load(std::istream& is);
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_BGV_PLAINTEXT_H
@@ -0,0 +1,41 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_BGV_PUBLICKEY_H
+#define HEONGPU_BGV_PUBLICKEY_H
+
+#include "bgv/context.cuh"
+#include "bfv/publickey.cuh"
+
+namespace heongpu
+{
+    /**
+     * @brief Publickey<Scheme::BGV> is an encryption of zero under the key
+     * modulus whose error is a multiple of the plaintext modulus. Its layout
+     * is the one of the BFV public key.
+     */
+    template <>
+    class Publickey<Scheme::BGV> : public Publickey<Scheme::BFV>
+    {
+      public:
+        /**
+         * @brief Constructs a new Publickey object with specified parameters.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         */
+        __host__ Publickey(HEContext<Scheme::BGV>& context);
+
+        Publickey() = default;
+
+        /**
+         * @brief Reads a public key written by save(); streams of BFV
+         * public keys are rejected.
+         */
+        void load(std::istream& is);
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_BGV_PUBLICKEY_H
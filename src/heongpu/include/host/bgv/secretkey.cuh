@@ -0,0 +1,51 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_BGV_SECRETKEY_H
+#define HEONGPU_BGV_SECRETKEY_H
+
+#include "bgv/context.cuh"
+#include "bfv/secretkey.cuh"
+
+namespace heongpu
+{
+    /**
+     * @brief Secretkey<Scheme::BGV> is a ternary secret key in the RNS and NTT
+     * domain of the key modulus, stored exactly like the BFV secret key.
+     */
+    template <>
+    class Secretkey<Scheme::BGV> : public Secretkey<Scheme::BFV>
+    {
+      public:
+        /**
+         * @brief Constructs a new Secretkey object with specified parameters.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         */
+        __host__ Secretkey(HEContext<Scheme::BGV>& context);
+
+        /**
+         * @brief Constructs a new Secretkey object with specified parameters.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         * @param hamming_weight Parameter defining hamming weight of secret
+         * key, try to use it as (ring size / 2) for maximum security.
+         */
+        __host__ Secretkey(HEContext<Scheme::BGV>& context,
+                           const int hamming_weight);
+
+        Secretkey() = default;
+
+        /**
+         * @brief Reads a secret key written by save(); streams of BFV
+         * secret keys are rejected.
+         */
+        void load(std::istream& is);
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_BGV_SECRETKEY_H
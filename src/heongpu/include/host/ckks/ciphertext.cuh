@@ -53,6 +53,17 @@ namespace heongpu
          */
         void store_in_host(cudaStream_t stream = cudaStreamDefault);
 
+        /**
+         * @brief Asynchronous form of store_in_host: the host copy of the
+         * ciphertext is valid once the returned Completion is ready.
+         */
+        Completion store_in_host_async(cudaStream_t stream = cudaStreamDefault)
+        {
+            store_in_host(stream);
+
+            return Completion::record(stream);
+        }
+
         /**
          * @brief Checks whether the data is stored on the device (GPU) memory.
          */
@@ -167,7 +178,16 @@ namespace heongpu
          * @return double Scaling factor.
          */
         inline double scale() const noexcept { return scale_; }
-        
+
+        /**
+         * @brief Returns the number of message slots packed in the
+         * ciphertext. It is a power of two not larger than ring_size() / 2; a
+         * smaller value means the message was encoded sparsely.
+         *
+         * @return int Number of slots.
+         */
+        inline int slot_count() const noexcept { return slot_count_; }
+
         /**
          *  @brief Returns the scaling factor used for encoding in CKKS scheme (WARNING: UNSAFE).
          *
@@ -204,6 +224,7 @@ namespace heongpu
               cipher_size_(copy.cipher_size_), depth_(copy.depth_),
               scheme_(copy.scheme_), in_ntt_domain_(copy.in_ntt_domain_),
               storage_type_(copy.storage_type_), scale_(copy.scale_),
+              slot_count_(copy.slot_count_),
               rescale_required_(copy.rescale_required_),
               relinearization_required_(copy.relinearization_required_),
               ciphertext_generated_(copy.ciphertext_generated_)
@@ -236,6 +257,7 @@ namespace heongpu
               in_ntt_domain_(std::move(assign.in_ntt_domain_)),
               storage_type_(std::move(assign.storage_type_)),
               scale_(std::move(assign.scale_)),
+              slot_count_(std::move(assign.slot_count_)),
               rescale_required_(std::move(assign.rescale_required_)),
               relinearization_required_(
                   std::move(assign.relinearization_required_)),
@@ -258,6 +280,7 @@ namespace heongpu
                 storage_type_ = copy.storage_type_;
 
                 scale_ = copy.scale_;
+                slot_count_ = copy.slot_count_;
                 rescale_required_ = copy.rescale_required_;
                 relinearization_required_ = copy.relinearization_required_;
                 ciphertext_generated_ = copy.ciphertext_generated_;
@@ -296,6 +319,7 @@ namespace heongpu
                 storage_type_ = std::move(assign.storage_type_);
 
                 scale_ = std::move(assign.scale_);
+                slot_count_ = std::move(assign.slot_count_);
                 rescale_required_ = std::move(assign.rescale_required_);
                 relinearization_required_ =
                     std::move(assign.relinearization_required_);
@@ -309,6 +333,12 @@ namespace heongpu
 
         void save(std::ostream& os) const;
 
+        /**
+         * @brief Returns the number of bytes save() writes, without copying
+         * the ciphertext data.
+         */
+        size_t serialized_size() const;
+
         void load(std::istream& is);
         void memory_clear(cudaStream_t stream);
         void remove_from_device(cudaStream_t stream);
@@ -323,6 +353,7 @@ namespace heongpu
         storage_type storage_type_;
 
         double scale_;
+        int slot_count_;
         bool rescale_required_;
         bool relinearization_required_;
 
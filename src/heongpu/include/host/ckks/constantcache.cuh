@@ -0,0 +1,152 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_CKKS_CONSTANTCACHE_H
+#define HEONGPU_CKKS_CONSTANTCACHE_H
+
+#include "ckks/plaintext.cuh"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace heongpu
+{
+    enum class constant_kind : std::uint8_t
+    {
+        REAL = 0x1, // Real number in every slot
+        COMPLEX = 0x2, // Complex number in every slot
+        MASK = 0x3, // User vector, identified by a user chosen id
+        SLOT_RANGE = 0x4, // 0/1 mask of a slot range
+        GRAPH_VECTOR = 0x5 // Constant vector of an HEGraph node
+    };
+
+    /**
+     * @brief Identifies an encoded constant: what was encoded, the depth its
+     * RNS representation is trimmed to and the scale it was encoded at.
+     *
+     * value1 and value2 hold the exact bits of the real and imaginary part of
+     * a number, a mask id, or the offset and length of a slot range, so two
+     * keys are equal only if their encodings are.
+     */
+    struct ConstantKey
+    {
+        constant_kind kind;
+        std::uint64_t value1;
+        std::uint64_t value2;
+        int depth;
+        double scale;
+
+        bool operator==(const ConstantKey& other) const
+        {
+            return (kind == other.kind) && (value1 == other.value1) &&
+                   (value2 == other.value2) && (depth == other.depth) &&
+                   (scale == other.scale);
+        }
+    };
+
+    /**
+     * @brief ConstantCache keeps encoded CKKS constants and masks on the
+     * device, keyed by ConstantKey.
+     *
+     * Every entry holds only the RNS limbs of its depth. The cache is bounded
+     * by the device memory of its entries and evicts the least recently used
+     * entry first. Entries are shared: an evicted plaintext stays valid for
+     * the callers still holding it. All member functions are thread safe.
+     */
+    template <> class ConstantCache<Scheme::CKKS>
+    {
+      public:
+        using Entry = std::shared_ptr<Plaintext<Scheme::CKKS>>;
+
+        /**
+         * @brief Constructs an empty cache.
+         *
+         * @param capacity Upper bound on the device memory of the entries, in
+         * bytes.
+         */
+        __host__ explicit ConstantCache(std::size_t capacity = (256ULL << 20));
+
+        /**
+         * @brief Returns the entry of key, or nullptr if it is not cached.
+         */
+        __host__ Entry find(const ConstantKey& key);
+
+        /**
+         * @brief Caches plain under key and returns the cached entry. If key
+         * is already present, the existing entry is kept and returned. A
+         * plaintext larger than the capacity is returned without being cached.
+         */
+        __host__ Entry insert(const ConstantKey& key,
+                              Plaintext<Scheme::CKKS>&& plain);
+
+        /**
+         * @brief Removes every encoding of the user mask mask_id. Has to be
+         * called when the values behind a mask id change.
+         */
+        __host__ void erase_mask(std::uint64_t mask_id);
+
+        /**
+         * @brief Removes all entries.
+         */
+        __host__ void clear();
+
+        /**
+         * @brief Changes the capacity, evicting entries if needed.
+         */
+        __host__ void set_capacity(std::size_t capacity);
+
+        __host__ std::size_t capacity() const;
+
+        /**
+         * @brief Device memory of the cached entries, in bytes.
+         */
+        __host__ std::size_t memory_size() const;
+
+        /**
+         * @brief Number of cached entries.
+         */
+        __host__ std::size_t size() const;
+
+        /**
+         * @brief Number of lookups answered from the cache.
+         */
+        __host__ std::size_t hits() const;
+
+        /**
+         * @brief Number of lookups that required an encoding.
+         */
+        __host__ std::size_t misses() const;
+
+      private:
+        struct KeyHash
+        {
+            std::size_t operator()(const ConstantKey& key) const;
+        };
+
+        using Node = std::pair<ConstantKey, Entry>;
+
+        // Drops least recently used entries until memory_size_ fits into
+        // capacity_. mutex_ has to be held.
+        __host__ void evict();
+
+        __host__ void erase(std::list<Node>::iterator it);
+
+        mutable std::mutex mutex_;
+
+        // Most recently used first.
+        std::list<Node> entries_;
+        std::unordered_map<ConstantKey, std::list<Node>::iterator, KeyHash>
+            index_;
+
+        std::size_t capacity_;
+        std::size_t memory_size_ = 0;
+        std::size_t hits_ = 0;
+        std::size_t misses_ = 0;
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_CKKS_CONSTANTCACHE_H
@@ -8,6 +8,7 @@
 
 #include "util.cuh"
 #include "schemes.h"
+#include "serialformat.h"
 #include "devicevector.cuh"
 #include "hostvector.cuh"
 #include "secstdparams.h"
@@ -33,6 +34,7 @@ namespace heongpu
         template <Scheme S> friend class Galoiskey;
         template <Scheme S> friend class MultipartyGaloiskey;
         template <Scheme S> friend class Switchkey;
+        template <Scheme S> friend class Packingkey;
         template <Scheme S> friend class HEEncoder;
         template <Scheme S> friend class HEKeyGenerator;
         template <Scheme S> friend class HEEncryptor;
@@ -54,6 +56,22 @@ namespace heongpu
         void set_coeff_modulus_values(const std::vector<Data64>& log_Q_bases,
                                       const std::vector<Data64>& log_P_bases);
 
+        /**
+         * @brief Selects the limb width the key-switching keys of this
+         * context are stored with.
+         *
+         * limb_type::LIMB32 packs two RNS limbs into each 64-bit word of a
+         * relinearization or Galois key, halving the key size and the memory
+         * traffic of key switching. It requires KEYSWITCHING_METHOD_I and
+         * every Q and P prime below 2^32, which is checked by generate().
+         * Only the keys are narrowed: ciphertexts, plaintexts and the
+         * multiplication, relinearization and rescale kernels keep 64-bit
+         * limbs.
+         *
+         * @param type Limb width of the key-switching keys.
+         */
+        void set_key_limb_type(limb_type type);
+
         void generate();
 
         void print_parameters();
@@ -80,6 +98,11 @@ namespace heongpu
             return prime_vector_;
         }
 
+        inline limb_type get_key_limb_type() const noexcept
+        {
+            return key_limb_type_;
+        }
+
         HEContext() = default;
 
         void save(std::ostream& os) const;
@@ -94,6 +117,7 @@ namespace heongpu
         scheme_type scheme_;
         sec_level_type sec_level_;
         keyswitching_type keyswitching_type_;
+        limb_type key_limb_type_ = limb_type::LIMB64;
 
         int n;
         int n_power;
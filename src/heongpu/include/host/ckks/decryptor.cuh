@@ -76,6 +76,7 @@ namespace heongpu
                             plaintext.scheme_ = scheme_;
                             plaintext.depth_ = ciphertext.depth_;
                             plaintext.scale_ = ciphertext.scale_;
+                            plaintext.slot_count_ = ciphertext.slot_count_;
                             plaintext.in_ntt_domain_ = true;
                         },
                         options);
@@ -112,11 +113,88 @@ namespace heongpu
             partial_ciphertext.depth_ = ciphertext.depth_;
             partial_ciphertext.in_ntt_domain_ = ciphertext.in_ntt_domain_;
             partial_ciphertext.scale_ = ciphertext.scale_;
+            partial_ciphertext.slot_count_ = ciphertext.slot_count_;
             partial_ciphertext.rescale_required_ = ciphertext.rescale_required_;
             partial_ciphertext.relinearization_required_ =
                 ciphertext.relinearization_required_;
         }
 
+        /**
+         * @brief Performs partial decryptions of a batch of ciphertexts using
+         * a secret key.
+         *
+         * All ciphertexts must be at the same level. The smudging noise of the
+         * whole batch is sampled and transformed at once and every share is
+         * produced by a single kernel launch.
+         *
+         * @param ciphertexts The ciphertexts to be partially decrypted.
+         * @param sk The secret key of the party performing the partial
+         * decryptions.
+         * @param partial_ciphertexts The output vector; element i holds the
+         * partial decryption of ciphertexts[i].
+         */
+        __host__ void multi_party_decrypt_partial(
+            std::vector<Ciphertext<Scheme::CKKS>>& ciphertexts,
+            Secretkey<Scheme::CKKS>& sk,
+            std::vector<Ciphertext<Scheme::CKKS>>& partial_ciphertexts,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            int cipher_count = ciphertexts.size();
+
+            if (cipher_count == 0)
+            {
+                throw std::invalid_argument("No ciphertext to decrypt!");
+            }
+
+            int depth_check = ciphertexts[0].depth_;
+            for (int i = 1; i < cipher_count; i++)
+            {
+                if (depth_check != ciphertexts[i].depth_)
+                {
+                    throw std::invalid_argument(
+                        "Ciphertext levels should be same!");
+                }
+            }
+
+            input_vector_storage_manager(
+                ciphertexts,
+                [&](std::vector<Ciphertext<Scheme::CKKS>>& ciphertexts_)
+                {
+                    input_storage_manager(
+                        sk,
+                        [&](Secretkey<Scheme::CKKS>& sk_)
+                        {
+                            partial_decrypt_ckks_batch(ciphertexts_, sk_,
+                                                       partial_ciphertexts,
+                                                       options.stream_);
+                        },
+                        options, false);
+                },
+                options, false);
+
+            for (int i = 0; i < cipher_count; i++)
+            {
+                Ciphertext<Scheme::CKKS>& partial = partial_ciphertexts[i];
+
+                partial.scheme_ = scheme_;
+                partial.ring_size_ = n;
+                partial.coeff_modulus_count_ = Q_size_;
+                partial.cipher_size_ = 2;
+                partial.depth_ = ciphertexts[i].depth_;
+                partial.in_ntt_domain_ = ciphertexts[i].in_ntt_domain_;
+                partial.scale_ = ciphertexts[i].scale_;
+                partial.slot_count_ = ciphertexts[i].slot_count_;
+                partial.rescale_required_ = ciphertexts[i].rescale_required_;
+                partial.relinearization_required_ =
+                    ciphertexts[i].relinearization_required_;
+
+                if (options.storage_ == storage_type::HOST)
+                {
+                    partial.store_in_host(options.stream_);
+                }
+            }
+        }
+
         /**
          * @brief Fuses partially decrypted ciphertexts into a fully decrypted
          * plaintext.
@@ -182,6 +260,164 @@ namespace heongpu
                             plaintext_.scheme_ = scheme_;
                             plaintext_.depth_ = depth_check;
                             plaintext_.scale_ = scale_check;
+                            plaintext_.slot_count_ =
+                                ciphertexts_[0].slot_count_;
+                            plaintext_.in_ntt_domain_ = true;
+                        },
+                        options);
+                },
+                options, false);
+        }
+
+        /**
+         * @brief Fuses the partial decryptions of a batch of ciphertexts into
+         * plaintexts with a single kernel launch.
+         *
+         * @param partial_ciphertexts Partial decryptions indexed as
+         * [party][ciphertext], i.e. the outputs of the batched
+         * multi_party_decrypt_partial of every party.
+         * @param plaintexts The output vector; element i holds the fusion of
+         * the i-th partial decryption of every party.
+         */
+        __host__ void multi_party_decrypt_fusion(
+            std::vector<std::vector<Ciphertext<Scheme::CKKS>>>&
+                partial_ciphertexts,
+            std::vector<Plaintext<Scheme::CKKS>>& plaintexts,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            int party_count = partial_ciphertexts.size();
+
+            if (party_count == 0)
+            {
+                throw std::invalid_argument("No ciphertext to decrypt!");
+            }
+
+            int cipher_count = partial_ciphertexts[0].size();
+
+            if (cipher_count == 0)
+            {
+                throw std::invalid_argument("No ciphertext to decrypt!");
+            }
+
+            for (int i = 0; i < party_count; i++)
+            {
+                if (static_cast<int>(partial_ciphertexts[i].size()) !=
+                    cipher_count)
+                {
+                    throw std::invalid_argument(
+                        "Every party should provide the same number of "
+                        "partial decryptions!");
+                }
+
+                for (int j = 0; j < cipher_count; j++)
+                {
+                    Ciphertext<Scheme::CKKS>& reference =
+                        partial_ciphertexts[0][j];
+                    Ciphertext<Scheme::CKKS>& partial =
+                        partial_ciphertexts[i][j];
+
+                    if (reference.scheme_ != partial.scheme_)
+                    {
+                        throw std::invalid_argument(
+                            "Ciphertext schemes should be same!");
+                    }
+
+                    if (reference.depth_ != partial.depth_)
+                    {
+                        throw std::invalid_argument(
+                            "Ciphertext levels should be same!");
+                    }
+
+                    if (reference.scale_ != partial.scale_)
+                    {
+                        throw std::invalid_argument(
+                            "Ciphertext scales should be same!");
+                    }
+
+                    if (!partial.is_on_device())
+                    {
+                        partial.store_in_device(options.stream_);
+                    }
+                }
+            }
+
+            decrypt_fusion_ckks_batch(partial_ciphertexts, plaintexts,
+                                      options.stream_);
+
+            for (int j = 0; j < cipher_count; j++)
+            {
+                Plaintext<Scheme::CKKS>& plaintext = plaintexts[j];
+
+                plaintext.plain_size_ = n * Q_size_;
+                plaintext.scheme_ = scheme_;
+                plaintext.depth_ = partial_ciphertexts[0][j].depth_;
+                plaintext.scale_ = partial_ciphertexts[0][j].scale_;
+                plaintext.slot_count_ = partial_ciphertexts[0][j].slot_count_;
+                plaintext.in_ntt_domain_ = true;
+
+                if (options.storage_ == storage_type::HOST)
+                {
+                    plaintext.store_in_host(options.stream_);
+                }
+            }
+        }
+
+        /**
+         * @brief Folds one party's partial decryption into a plaintext
+         * (streaming fusion).
+         *
+         * Partial decryptions can be folded in as they arrive, so only the
+         * plaintext and the current share need to be kept regardless of the
+         * number of parties. After every party's share has been folded in,
+         * plaintext equals the output of multi_party_decrypt_fusion.
+         *
+         * @param partial_ciphertext Partial decryption of one party.
+         * @param plaintext The plaintext accumulating the fusion.
+         * @param first True for the first share, which initializes plaintext.
+         */
+        __host__ void multi_party_decrypt_accumulate(
+            Ciphertext<Scheme::CKKS>& partial_ciphertext,
+            Plaintext<Scheme::CKKS>& plaintext, bool first,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            if (!first)
+            {
+                if (plaintext.depth_ != partial_ciphertext.depth_)
+                {
+                    throw std::invalid_argument(
+                        "Ciphertext levels should be same!");
+                }
+
+                if (plaintext.scale_ != partial_ciphertext.scale_)
+                {
+                    throw std::invalid_argument(
+                        "Ciphertext scales should be same!");
+                }
+
+                if (!plaintext.is_on_device())
+                {
+                    plaintext.store_in_device(options.stream_);
+                }
+            }
+
+            input_storage_manager(
+                partial_ciphertext,
+                [&](Ciphertext<Scheme::CKKS>& partial_ciphertext_)
+                {
+                    output_storage_manager(
+                        plaintext,
+                        [&](Plaintext<Scheme::CKKS>& plaintext_)
+                        {
+                            decrypt_fusion_ckks_accumulate(partial_ciphertext_,
+                                                           plaintext_, first,
+                                                           options.stream_);
+
+                            plaintext_.plain_size_ = n * Q_size_;
+                            plaintext_.scheme_ = scheme_;
+                            plaintext_.depth_ = partial_ciphertext_.depth_;
+                            plaintext_.scale_ = partial_ciphertext_.scale_;
+                            plaintext_.slot_count_ =
+                                partial_ciphertext_.slot_count_;
                             plaintext_.in_ntt_domain_ = true;
                         },
                         options);
@@ -235,6 +471,23 @@ namespace heongpu
                             Plaintext<Scheme::CKKS>& plaintext,
                             const cudaStream_t stream);
 
+        __host__ void partial_decrypt_ckks_batch(
+            std::vector<Ciphertext<Scheme::CKKS>>& ciphertexts,
+            Secretkey<Scheme::CKKS>& sk,
+            std::vector<Ciphertext<Scheme::CKKS>>& partial_ciphertexts,
+            const cudaStream_t stream);
+
+        __host__ void decrypt_fusion_ckks_batch(
+            std::vector<std::vector<Ciphertext<Scheme::CKKS>>>&
+                partial_ciphertexts,
+            std::vector<Plaintext<Scheme::CKKS>>& plaintexts,
+            const cudaStream_t stream);
+
+        __host__ void decrypt_fusion_ckks_accumulate(
+            Ciphertext<Scheme::CKKS>& partial_ciphertext,
+            Plaintext<Scheme::CKKS>& plaintext, bool first,
+            const cudaStream_t stream);
+
       private:
         scheme_type scheme_;
         int seed_;
@@ -42,7 +42,8 @@ namespace heongpu
         __host__ HEEncoder(HEContext<Scheme::CKKS>& context);
 
         /**
-         * @brief Encodes a message of double values into a plaintext.
+         * @brief Encodes a message of double values into a fully packed
+         * plaintext of slot_count() slots.
          *
          * @param plain Plaintext object where the result of the encoding will
          * be stored.
@@ -55,16 +56,40 @@ namespace heongpu
         encode(Plaintext<Scheme::CKKS>& plain,
                const std::vector<double>& message, double scale,
                const ExecutionOptions& options = ExecutionOptions())
+        {
+            encode(plain, message, scale, slot_count_, options);
+        }
+
+        /**
+         * @brief Encodes a message of double values into a sparsely packed
+         * plaintext. Only the slot_count-point FFT is computed and its output
+         * is spread over every (n / (2 * slot_count))-th coefficient, so small
+         * messages do not pay for a full-size transform. Operations on the
+         * resulting ciphertexts keep the slot count, and decoding returns
+         * slot_count values.
+         *
+         * @param plain Plaintext object where the result of the encoding will
+         * be stored.
+         * @param message Vector of double values representing the message to be
+         * encoded.
+         * @param scale parameter defining encoding precision(for CKKS).
+         * @param slot_count Number of slots, a power of two not larger than
+         * slot_count().
+         */
+        __host__ void
+        encode(Plaintext<Scheme::CKKS>& plain,
+               const std::vector<double>& message, double scale, int slot_count,
+               const ExecutionOptions& options = ExecutionOptions())
         {
             if ((scale <= 0) ||
                 (static_cast<int>(log2(scale)) >= total_coeff_bit_count_))
             {
                 throw std::invalid_argument("Scale out of bounds");
             }
-            std::cout << "--- C++ In-Function Debug ---" << std::endl;
-            std::cout << "  Message size: " << message.size() << std::endl;
-            std::cout << "  Internal slot_count_: " << slot_count_ << std::endl;
-            if (message.size() > slot_count_)
+
+            int log_slot_count = check_slot_count(slot_count);
+
+            if (message.size() > slot_count)
                 throw std::invalid_argument(
                     "Vector size can not be higher than slot count!");
 
@@ -72,12 +97,14 @@ namespace heongpu
                 plain,
                 [&](Plaintext<Scheme::CKKS>& plain_)
                 {
-                    encode_ckks(plain_, message, scale, options.stream_);
+                    encode_ckks(plain_, message, scale, log_slot_count,
+                                options.stream_);
 
                     plain.plain_size_ = n * Q_size_;
                     plain.scheme_ = scheme_;
                     plain.depth_ = 0;
                     plain.scale_ = scale;
+                    plain.slot_count_ = slot_count;
                     plain.in_ntt_domain_ = true;
                     plain.plaintext_generated_ = true;
                 },
@@ -87,7 +114,8 @@ namespace heongpu
         //
 
         /**
-         * @brief Encodes a message of double values into a plaintext.
+         * @brief Encodes a message of double values into a fully packed
+         * plaintext of slot_count() slots.
          *
          * @param plain Plaintext object where the result of the encoding will
          * be stored.
@@ -100,6 +128,30 @@ namespace heongpu
         encode(Plaintext<Scheme::CKKS>& plain,
                const HostVector<double>& message, double scale,
                const ExecutionOptions& options = ExecutionOptions())
+        {
+            encode(plain, message, scale, slot_count_, options);
+        }
+
+        /**
+         * @brief Encodes a message of double values into a sparsely packed
+         * plaintext. Only the slot_count-point FFT is computed and its output
+         * is spread over every (n / (2 * slot_count))-th coefficient, so small
+         * messages do not pay for a full-size transform. Operations on the
+         * resulting ciphertexts keep the slot count, and decoding returns
+         * slot_count values.
+         *
+         * @param plain Plaintext object where the result of the encoding will
+         * be stored.
+         * @param message HostVector of double values representing the message
+         * to be encoded.
+         * @param scale parameter defining encoding precision(for CKKS).
+         * @param slot_count Number of slots, a power of two not larger than
+         * slot_count().
+         */
+        __host__ void
+        encode(Plaintext<Scheme::CKKS>& plain,
+               const HostVector<double>& message, double scale, int slot_count,
+               const ExecutionOptions& options = ExecutionOptions())
         {
             if ((scale <= 0) ||
                 (static_cast<int>(log2(scale)) >= total_coeff_bit_count_))
@@ -107,7 +159,9 @@ namespace heongpu
                 throw std::invalid_argument("Scale out of bounds");
             }
 
-            if (message.size() > slot_count_)
+            int log_slot_count = check_slot_count(slot_count);
+
+            if (message.size() > slot_count)
                 throw std::invalid_argument(
                     "Vector size can not be higher than slot count!");
 
@@ -115,12 +169,14 @@ namespace heongpu
                 plain,
                 [&](Plaintext<Scheme::CKKS>& plain_)
                 {
-                    encode_ckks(plain_, message, scale, options.stream_);
+                    encode_ckks(plain_, message, scale, log_slot_count,
+                                options.stream_);
 
                     plain.plain_size_ = n * Q_size_;
                     plain.scheme_ = scheme_;
                     plain.depth_ = 0;
                     plain.scale_ = scale;
+                    plain.slot_count_ = slot_count;
                     plain.in_ntt_domain_ = true;
                     plain.plaintext_generated_ = true;
                 },
@@ -130,7 +186,8 @@ namespace heongpu
         //
 
         /**
-         * @brief Encodes a message of complex numbers into a plaintext.
+         * @brief Encodes a message of complex numbers into a fully packed
+         * plaintext of slot_count() slots.
          *
          * @param plain Plaintext object where the result of the encoding will
          * be stored.
@@ -143,6 +200,31 @@ namespace heongpu
         encode(Plaintext<Scheme::CKKS>& plain,
                const std::vector<Complex64>& message, double scale,
                const ExecutionOptions& options = ExecutionOptions())
+        {
+            encode(plain, message, scale, slot_count_, options);
+        }
+
+        /**
+         * @brief Encodes a message of complex numbers into a sparsely packed
+         * plaintext. Only the slot_count-point FFT is computed and its output
+         * is spread over every (n / (2 * slot_count))-th coefficient, so small
+         * messages do not pay for a full-size transform. Operations on the
+         * resulting ciphertexts keep the slot count, and decoding returns
+         * slot_count values.
+         *
+         * @param plain Plaintext object where the result of the encoding will
+         * be stored.
+         * @param message Vector of Complex64 representing the message to be
+         * encoded.
+         * @param scale parameter defining encoding precision(for CKKS).
+         * @param slot_count Number of slots, a power of two not larger than
+         * slot_count().
+         */
+        __host__ void
+        encode(Plaintext<Scheme::CKKS>& plain,
+               const std::vector<Complex64>& message, double scale,
+               int slot_count,
+               const ExecutionOptions& options = ExecutionOptions())
         {
             if ((scale <= 0) ||
                 (static_cast<int>(log2(scale)) >= total_coeff_bit_count_))
@@ -150,7 +232,9 @@ namespace heongpu
                 throw std::invalid_argument("Scale out of bounds");
             }
 
-            if (message.size() > slot_count_)
+            int log_slot_count = check_slot_count(slot_count);
+
+            if (message.size() > slot_count)
                 throw std::invalid_argument(
                     "Vector size can not be higher than slot count!");
 
@@ -158,12 +242,14 @@ namespace heongpu
                 plain,
                 [&](Plaintext<Scheme::CKKS>& plain_)
                 {
-                    encode_ckks(plain_, message, scale, options.stream_);
+                    encode_ckks(plain_, message, scale, log_slot_count,
+                                options.stream_);
 
                     plain.plain_size_ = n * Q_size_;
                     plain.scheme_ = scheme_;
                     plain.depth_ = 0;
                     plain.scale_ = scale;
+                    plain.slot_count_ = slot_count;
                     plain.in_ntt_domain_ = true;
                     plain.plaintext_generated_ = true;
                 },
@@ -173,7 +259,8 @@ namespace heongpu
         //
 
         /**
-         * @brief Encodes a message of complex numbers into a plaintext.
+         * @brief Encodes a message of complex numbers into a fully packed
+         * plaintext of slot_count() slots.
          *
          * @param plain Plaintext object where the result of the encoding will
          * be stored.
@@ -186,6 +273,31 @@ namespace heongpu
         encode(Plaintext<Scheme::CKKS>& plain,
                const HostVector<Complex64>& message, double scale,
                const ExecutionOptions& options = ExecutionOptions())
+        {
+            encode(plain, message, scale, slot_count_, options);
+        }
+
+        /**
+         * @brief Encodes a message of complex numbers into a sparsely packed
+         * plaintext. Only the slot_count-point FFT is computed and its output
+         * is spread over every (n / (2 * slot_count))-th coefficient, so small
+         * messages do not pay for a full-size transform. Operations on the
+         * resulting ciphertexts keep the slot count, and decoding returns
+         * slot_count values.
+         *
+         * @param plain Plaintext object where the result of the encoding will
+         * be stored.
+         * @param message HostVector of Complex64 representing the message to be
+         * encoded.
+         * @param scale parameter defining encoding precision(for CKKS).
+         * @param slot_count Number of slots, a power of two not larger than
+         * slot_count().
+         */
+        __host__ void
+        encode(Plaintext<Scheme::CKKS>& plain,
+               const HostVector<Complex64>& message, double scale,
+               int slot_count,
+               const ExecutionOptions& options = ExecutionOptions())
         {
             if ((scale <= 0) ||
                 (static_cast<int>(log2(scale)) >= total_coeff_bit_count_))
@@ -193,7 +305,9 @@ namespace heongpu
                 throw std::invalid_argument("Scale out of bounds");
             }
 
-            if (message.size() > slot_count_)
+            int log_slot_count = check_slot_count(slot_count);
+
+            if (message.size() > slot_count)
                 throw std::invalid_argument(
                     "Vector size can not be higher than slot count!");
 
@@ -201,12 +315,14 @@ namespace heongpu
                 plain,
                 [&](Plaintext<Scheme::CKKS>& plain_)
                 {
-                    encode_ckks(plain_, message, scale, options.stream_);
+                    encode_ckks(plain_, message, scale, log_slot_count,
+                                options.stream_);
 
                     plain.plain_size_ = n * Q_size_;
                     plain.scheme_ = scheme_;
                     plain.depth_ = 0;
                     plain.scale_ = scale;
+                    plain.slot_count_ = slot_count;
                     plain.in_ntt_domain_ = true;
                     plain.plaintext_generated_ = true;
                 },
@@ -252,6 +368,7 @@ namespace heongpu
                     plain.scheme_ = scheme_;
                     plain.depth_ = 0;
                     plain.scale_ = scale;
+                    plain.slot_count_ = slot_count_;
                     plain.in_ntt_domain_ = true;
                     plain.plaintext_generated_ = true;
                 },
@@ -295,6 +412,7 @@ namespace heongpu
                     plain.scheme_ = scheme_;
                     plain.depth_ = 0;
                     plain.scale_ = scale;
+                    plain.slot_count_ = slot_count_;
                     plain.in_ntt_domain_ = true;
                     plain.plaintext_generated_ = true;
                 },
@@ -304,7 +422,8 @@ namespace heongpu
         /**
          * @brief Decodes a plaintext into a vector of double values.
          *
-         * @param message Vector where the decoded message will be stored.
+         * @param message Vector where the decoded message will be stored. It
+         * is resized to plain.slot_count().
          * @param plain Plaintext object to be decoded.
          */
         __host__ void
@@ -374,7 +493,76 @@ namespace heongpu
         }
 
         /**
-         * @brief Returns the number of slots.
+         * @brief Asynchronous encode of a HostVector message. Returns once the
+         * copy and the encoding are enqueued on options.stream_; message has
+         * to stay unchanged until the returned Completion is ready.
+         *
+         * @param plain Plaintext object where the result of the encoding will
+         * be stored.
+         * @param message HostVector of double values to be encoded.
+         * @param scale parameter defining encoding precision(for CKKS).
+         * @return Completion Handle of the encoding.
+         */
+        __host__ Completion
+        encode_async(Plaintext<Scheme::CKKS>& plain,
+                     const HostVector<double>& message, double scale,
+                     const ExecutionOptions& options = ExecutionOptions())
+        {
+            encode(plain, message, scale, options);
+
+            return Completion::record(options.stream_);
+        }
+
+        /**
+         * @brief Asynchronous encode of a HostVector message of complex
+         * numbers, see encode_async.
+         */
+        __host__ Completion
+        encode_async(Plaintext<Scheme::CKKS>& plain,
+                     const HostVector<Complex64>& message, double scale,
+                     const ExecutionOptions& options = ExecutionOptions())
+        {
+            encode(plain, message, scale, options);
+
+            return Completion::record(options.stream_);
+        }
+
+        /**
+         * @brief Asynchronous decode into a HostVector. message is resized
+         * before the call returns, and its values are valid once the returned
+         * Completion is ready.
+         *
+         * @param message HostVector where the decoded message will be stored.
+         * @param plain Plaintext object to be decoded.
+         * @return Completion Handle of the decoding and the copy to message.
+         */
+        __host__ Completion
+        decode_async(HostVector<double>& message,
+                     Plaintext<Scheme::CKKS>& plain,
+                     const ExecutionOptions& options = ExecutionOptions())
+        {
+            decode(message, plain, options);
+
+            return Completion::record(options.stream_);
+        }
+
+        /**
+         * @brief Asynchronous decode into a HostVector of complex numbers, see
+         * decode_async.
+         */
+        __host__ Completion
+        decode_async(HostVector<Complex64>& message,
+                     Plaintext<Scheme::CKKS>& plain,
+                     const ExecutionOptions& options = ExecutionOptions())
+        {
+            decode(message, plain, options);
+
+            return Completion::record(options.stream_);
+        }
+
+        /**
+         * @brief Returns the number of slots of a fully packed plaintext,
+         * n / 2.
          *
          * @return int Number of slots.
          */
@@ -387,26 +575,38 @@ namespace heongpu
         HEEncoder& operator=(HEEncoder&& assign) = default;
 
       private:
+        __host__ int check_slot_count(int slot_count) const
+        {
+            if ((slot_count < 1) || (slot_count > slot_count_) ||
+                !is_power_of_two(slot_count))
+            {
+                throw std::invalid_argument(
+                    "Slot count has to be a power of two not larger than n/2!");
+            }
+
+            return int(log2(slot_count));
+        }
+
         __host__ void encode_ckks(Plaintext<Scheme::CKKS>& plain,
                                   const std::vector<double>& message,
-                                  const double scale,
+                                  const double scale, const int log_slot_count,
                                   const cudaStream_t stream);
 
         __host__ void encode_ckks(Plaintext<Scheme::CKKS>& plain,
                                   const HostVector<double>& message,
-                                  const double scale,
+                                  const double scale, const int log_slot_count,
                                   const cudaStream_t stream);
 
         //
 
         __host__ void encode_ckks(Plaintext<Scheme::CKKS>& plain,
                                   const std::vector<Complex64>& message,
-                                  const double scale,
+                                  const double scale, const int log_slot_count,
                                   const cudaStream_t stream);
 
         __host__ void encode_ckks(Plaintext<Scheme::CKKS>& plain,
                                   const HostVector<Complex64>& message,
-                                  const double scale,
+                                  const double scale, const int log_slot_count,
                                   const cudaStream_t stream);
 
         //
@@ -455,6 +655,9 @@ namespace heongpu
         std::shared_ptr<DeviceVector<Complex64>> special_fft_roots_table_;
         std::shared_ptr<DeviceVector<Complex64>> special_ifft_roots_table_;
         std::shared_ptr<DeviceVector<int>> reverse_order;
+        // Bit-reversal tables of the sparse FFT sizes, indexed by
+        // log2(slot count); the last one is reverse_order.
+        std::vector<std::shared_ptr<DeviceVector<int>>> sparse_reverse_order_;
 
         int Q_size_;
         int total_coeff_bit_count_;
@@ -8,6 +8,7 @@
 
 #include "ckks/context.cuh"
 #include "keygeneration.cuh"
+#include "rotationplanner.h"
 
 namespace heongpu
 {
@@ -69,6 +70,11 @@ namespace heongpu
             return (storage_type_ == storage_type::DEVICE);
         }
 
+        /**
+         * @brief Returns the limb width the key is stored with.
+         */
+        limb_type get_limb_type() const noexcept { return limb_type_; }
+
         /**
          * @brief Returns a pointer to the underlying relinearization key data.
          *
@@ -101,6 +107,7 @@ namespace heongpu
               ring_size(copy.ring_size), Q_prime_size_(copy.Q_prime_size_),
               Q_size_(copy.Q_size_), d_(copy.d_), d_tilda_(copy.d_tilda_),
               r_prime_(copy.r_prime_), storage_type_(copy.storage_type_),
+              limb_type_(copy.limb_type_),
               relinkey_size_(copy.relinkey_size_),
               relinkey_size_leveled_(copy.relinkey_size_leveled_),
               relin_key_generated_(copy.relin_key_generated_)
@@ -177,6 +184,7 @@ namespace heongpu
               d_tilda_(std::move(assign.d_tilda_)),
               r_prime_(std::move(assign.r_prime_)),
               storage_type_(std::move(assign.storage_type_)),
+              limb_type_(std::move(assign.limb_type_)),
               relinkey_size_(std::move(assign.relinkey_size_)),
               relinkey_size_leveled_(std::move(assign.relinkey_size_leveled_)),
               relin_key_generated_(std::move(assign.relin_key_generated_))
@@ -243,6 +251,7 @@ namespace heongpu
                 d_tilda_ = copy.d_tilda_;
                 r_prime_ = copy.r_prime_;
                 storage_type_ = copy.storage_type_;
+                limb_type_ = copy.limb_type_;
                 relinkey_size_ = copy.relinkey_size_;
                 relinkey_size_leveled_ = copy.relinkey_size_leveled_;
                 relin_key_generated_ = copy.relin_key_generated_;
@@ -329,6 +338,7 @@ namespace heongpu
                 d_tilda_ = std::move(assign.d_tilda_);
                 r_prime_ = std::move(assign.r_prime_);
                 storage_type_ = std::move(assign.storage_type_);
+                limb_type_ = std::move(assign.limb_type_);
                 relinkey_size_ = std::move(assign.relinkey_size_);
                 relinkey_size_leveled_ =
                     std::move(assign.relinkey_size_leveled_);
@@ -397,6 +407,7 @@ namespace heongpu
         int r_prime_;
 
         storage_type storage_type_;
+        limb_type limb_type_ = limb_type::LIMB64;
         Data64 relinkey_size_;
         std::vector<size_t> relinkey_size_leveled_;
 
@@ -418,6 +429,10 @@ namespace heongpu
         void copy_to_device(cudaStream_t stream);
         void remove_from_device(cudaStream_t stream);
         void remove_from_host();
+
+        // Narrows every limb of a method I key to 32 bits, two limbs per
+        // word, and sets limb_type_ to LIMB32.
+        void compact_limbs(cudaStream_t stream);
     };
 
     /**
@@ -516,6 +531,27 @@ namespace heongpu
         __host__ Galoiskey(HEContext<Scheme::CKKS>& context,
                            std::vector<uint32_t>& galois_elts);
 
+        /**
+         * @brief Constructs a new Galoiskey object whose rotation keys are
+         * chosen for a given workload within a memory budget.
+         *
+         * Every rotation in the workload gets a dedicated key if the budget
+         * allows it. Otherwise signed power-of-two keys are combined with
+         * dedicated keys for the most frequent rotations (see
+         * select_rotation_keys), and rotate_rows composes each rotation from
+         * the generated keys with as few key-switches as possible.
+         *
+         * @param context Reference to the Parameters object that sets the
+         * encryption parameters.
+         * @param rotations Rotations used by the workload. Repeated entries
+         * give a rotation more weight.
+         * @param memory_budget Maximum size in bytes of the generated key,
+         * including the conjugation key.
+         */
+        __host__ Galoiskey(HEContext<Scheme::CKKS>& context,
+                           const std::vector<int>& rotations,
+                           size_t memory_budget);
+
         /**
          * @brief Stores the galois key in the device (GPU) memory.
          */
@@ -534,6 +570,11 @@ namespace heongpu
             return (storage_type_ == storage_type::DEVICE);
         }
 
+        /**
+         * @brief Returns the limb width the key is stored with.
+         */
+        limb_type get_limb_type() const noexcept { return limb_type_; }
+
         /**
          * @brief Returns a pointer to the specified part of the Galois key
          * data.
@@ -567,9 +608,11 @@ namespace heongpu
               Q_size_(copy.Q_size_), d_(copy.d_), customized(copy.customized),
               group_order_(copy.group_order_),
               storage_type_(copy.storage_type_),
+              limb_type_(copy.limb_type_),
               galoiskey_size_(copy.galoiskey_size_),
               custom_galois_elt(copy.custom_galois_elt),
               galois_elt(copy.galois_elt),
+              rotation_plans_(copy.rotation_plans_),
               galois_elt_zero(copy.galois_elt_zero),
               galois_key_generated_(copy.galois_key_generated_)
         {
@@ -626,9 +669,11 @@ namespace heongpu
               customized(std::move(assign.customized)),
               group_order_(std::move(assign.group_order_)),
               storage_type_(std::move(assign.storage_type_)),
+              limb_type_(std::move(assign.limb_type_)),
               galoiskey_size_(std::move(assign.galoiskey_size_)),
               custom_galois_elt(std::move(assign.custom_galois_elt)),
               galois_elt(std::move(assign.galois_elt)),
+              rotation_plans_(assign.rotation_plans_),
               galois_elt_zero(std::move(assign.galois_elt_zero)),
               galois_key_generated_(std::move(assign.galois_key_generated_))
         {
@@ -680,9 +725,11 @@ namespace heongpu
                 customized = copy.customized;
                 group_order_ = copy.group_order_;
                 storage_type_ = copy.storage_type_;
+                limb_type_ = copy.limb_type_;
                 galoiskey_size_ = copy.galoiskey_size_;
                 custom_galois_elt = copy.custom_galois_elt;
                 galois_elt = copy.galois_elt;
+                rotation_plans_ = copy.rotation_plans_;
                 galois_elt_zero = copy.galois_elt_zero;
                 galois_key_generated_ = copy.galois_key_generated_;
 
@@ -748,9 +795,11 @@ namespace heongpu
                 customized = std::move(assign.customized);
                 group_order_ = std::move(assign.group_order_);
                 storage_type_ = std::move(assign.storage_type_);
+                limb_type_ = std::move(assign.limb_type_);
                 galoiskey_size_ = std::move(assign.galoiskey_size_);
                 custom_galois_elt = std::move(assign.custom_galois_elt);
                 galois_elt = std::move(assign.galois_elt);
+                rotation_plans_ = assign.rotation_plans_;
                 galois_elt_zero = std::move(assign.galois_elt_zero);
                 galois_key_generated_ = std::move(assign.galois_key_generated_);
 
@@ -794,6 +843,14 @@ namespace heongpu
         void load(std::istream& is);
 
       private:
+        // Writes everything save() writes before the keys, so that
+        // HEKeyGenerator can stream keys in the same layout.
+        void save_header(std::ostream& os, uint32_t key_count) const;
+
+        // Narrows every limb of the method I keys to 32 bits, two limbs per
+        // word, and sets limb_type_ to LIMB32.
+        void compact_limbs(cudaStream_t stream);
+
         scheme_type scheme_;
         keyswitching_type key_type;
 
@@ -808,6 +865,7 @@ namespace heongpu
         int group_order_;
 
         storage_type storage_type_;
+        limb_type limb_type_ = limb_type::LIMB64;
         Data64 galoiskey_size_;
         std::vector<u_int32_t> custom_galois_elt;
 
@@ -818,6 +876,11 @@ namespace heongpu
         std::unordered_map<int, DeviceVector<Data64>> device_location_;
         std::unordered_map<int, HostVector<Data64>> host_location_;
 
+        // Steps of rotations without a dedicated key. Copies hold the same
+        // keys and share the cache; a loaded key starts with an empty one.
+        std::shared_ptr<RotationPlanCache> rotation_plans_ =
+            std::make_shared<RotationPlanCache>();
+
         // for rotate_columns
         int galois_elt_zero;
         DeviceVector<Data64> zero_device_location_;
@@ -963,5 +1026,89 @@ namespace heongpu
         void remove_from_host();
     };
 
+    /**
+     * @brief Packingkey holds the keys that move TFHE LWE ciphertexts into a
+     * CKKS ciphertext and back.
+     *
+     * The ring key is a Switchkey from the LWE secret key, embedded as the
+     * first coefficients of a ring element, to the CKKS secret key. It turns
+     * every LWE sample into an RLWE ciphertext, which are then merged with
+     * Galois automorphisms (see HEArithmeticOperator::pack_lwe_ciphertexts).
+     * The extraction key is a TFHE key switching key from the coefficients of
+     * the CKKS secret key to the LWE secret key. It holds
+     * N * ks_length * (2^ks_base_bit - 1) LWE samples of dimension n + 1,
+     * e.g. about 400 MB for N = 8192 and the LWE512_K1 TFHE parameters.
+     */
+    template <> class Packingkey<Scheme::CKKS>
+    {
+        template <Scheme S> friend class HEKeyGenerator;
+        template <Scheme S> friend class HEOperator;
+        template <Scheme S> friend class HEArithmeticOperator;
+
+      public:
+        /**
+         * @brief Constructs a new Packingkey object for a CKKS context and the
+         * TFHE context whose ciphertexts are packed.
+         *
+         * @param context Reference to the CKKS context.
+         * @param lwe_context Reference to the TFHE context, which sets the LWE
+         * dimension and the key switching parameters.
+         */
+        __host__ Packingkey(HEContext<Scheme::CKKS>& context,
+                            HEContext<Scheme::TFHE>& lwe_context);
+
+        /**
+         * @brief Stores the packing key in the device (GPU) memory.
+         */
+        void store_in_device(cudaStream_t stream = cudaStreamDefault);
+
+        /**
+         * @brief Stores the packing key in the host (CPU) memory.
+         */
+        void store_in_host(cudaStream_t stream = cudaStreamDefault);
+
+        /**
+         * @brief Checks whether the data is stored on the device (GPU) memory.
+         */
+        bool is_on_device() const
+        {
+            return (storage_type_ == storage_type::DEVICE);
+        }
+
+        /**
+         * @brief Returns the dimension of the LWE ciphertexts the key packs.
+         *
+         * @return int LWE dimension (n).
+         */
+        inline int lwe_size() const noexcept { return lwe_n_; }
+
+        Packingkey() = default;
+        Packingkey(const Packingkey& copy) = default;
+        Packingkey(Packingkey&& source) = default;
+        Packingkey& operator=(const Packingkey& assign) = default;
+        Packingkey& operator=(Packingkey&& assign) = default;
+
+      private:
+        scheme_type scheme_;
+        int ring_size_;
+
+        // LWE context
+        int lwe_n_;
+        int ks_base_bit_;
+        int ks_length_;
+        double ks_stdev_;
+        double max_stdev_;
+
+        storage_type storage_type_;
+        bool packing_key_generated_ = false;
+
+        Switchkey<Scheme::CKKS> ring_key_;
+
+        DeviceVector<int32_t> extraction_key_device_location_a_;
+        DeviceVector<int32_t> extraction_key_device_location_b_;
+        HostVector<int32_t> extraction_key_host_location_a_;
+        HostVector<int32_t> extraction_key_host_location_b_;
+    };
+
 } // namespace heongpu
 #endif // HEONGPU_CKKS_EVALUATIONKEY_H
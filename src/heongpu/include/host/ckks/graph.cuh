@@ -0,0 +1,326 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_CKKS_GRAPH_H
+#define HEONGPU_CKKS_GRAPH_H
+
+#include "ckks/context.cuh"
+#include "ckks/encoder.cuh"
+#include "ckks/plaintext.cuh"
+#include "ckks/ciphertext.cuh"
+#include "ckks/evaluationkey.cuh"
+#include "ckks/operator.cuh"
+
+#include <map>
+#include <tuple>
+
+namespace heongpu
+{
+    /**
+     * @brief Maintenance operations placed by HEGraph::compile, and the number
+     * of nodes removed while recording by folding and fusion.
+     */
+    struct GraphStatistics
+    {
+        int relinearizations = 0;
+        int rescales = 0;
+        int mod_drops = 0;
+        int bootstraps = 0;
+        int fused_nodes = 0;
+    };
+
+    /**
+     * @brief HEGraph records a CKKS computation on symbolic ciphertexts and
+     * compiles it into a schedule of HEArithmeticOperator calls.
+     *
+     * Nodes are recorded with input, constant and the arithmetic functions.
+     * While recording, constant expressions are folded, chains of constant
+     * additions, constant multiplications, rotations and negations are fused
+     * into one node each, and repeated subexpressions are shared.
+     *
+     * compile() then walks the graph once and places the maintenance
+     * operations the user would otherwise write by hand:
+     * - Relinearization and rescale are lazy. The result of a ciphertext
+     *   multiplication stays unrelinearized and unrescaled through additions,
+     *   subtractions and negations with operands in the same state, so a sum
+     *   of products is relinearized and rescaled once.
+     * - Operands of a binary operation are aligned to the deeper level. Every
+     *   mod-dropped copy of a value is created once and shared by all
+     *   consumers that need it at that level.
+     * - If bootstrapping is enabled, a value is bootstrapped only when a
+     *   multiplication would otherwise run out of levels, and the refreshed
+     *   value replaces it for all later consumers.
+     *
+     * execute() runs the schedule, releasing every intermediate ciphertext
+     * after its last use and updating in place where a value is not used
+     * again.
+     */
+    template <> class HEGraph<Scheme::CKKS>
+    {
+      public:
+        /**
+         * @brief Constructs an empty graph.
+         *
+         * @param context Reference to the context of the ciphertexts.
+         * @param encoder Encoder used for constants at execution time.
+         * @param scale Scale at which multiplicative constants are encoded.
+         */
+        __host__ HEGraph(HEContext<Scheme::CKKS>& context,
+                         HEEncoder<Scheme::CKKS>& encoder, double scale);
+
+        /**
+         * @brief Declares the next input ciphertext. Inputs are bound in
+         * declaration order by execute().
+         *
+         * @param depth Depth of the ciphertext that will be bound. A shallower
+         * ciphertext is mod-dropped to it.
+         * @return int Node handle.
+         */
+        __host__ int input(int depth = 0);
+
+        /**
+         * @brief Records a constant broadcast to every slot.
+         */
+        __host__ int constant(double value);
+
+        /**
+         * @brief Records a constant vector, one value per slot. Slots past the
+         * end of the vector are zero.
+         */
+        __host__ int constant(const std::vector<double>& values);
+
+        __host__ int add(int node1, int node2);
+
+        __host__ int sub(int node1, int node2);
+
+        __host__ int negate(int node);
+
+        __host__ int multiply(int node1, int node2);
+
+        __host__ int rotate(int node, int shift);
+
+        __host__ int conjugate(int node);
+
+        /**
+         * @brief Marks a node as the next output. Outputs are relinearized and
+         * rescaled, and written in marking order by execute().
+         */
+        __host__ void output(int node);
+
+        /**
+         * @brief Places relinearizations, rescales, mod-drops and
+         * bootstrappings and builds the execution schedule.
+         *
+         * @param bootstrap_depth Depth of a ciphertext right after
+         * regular_bootstrapping with the operator's bootstrapping parameters.
+         * A negative value disables bootstrapping; compile() then throws if the
+         * circuit needs more levels than the context has.
+         */
+        __host__ void compile(int bootstrap_depth = -1);
+
+        /**
+         * @brief Executes the compiled schedule.
+         *
+         * @param operators Operator performing the computation. Bootstrapping
+         * parameters have to be generated if compile() placed bootstrappings.
+         * @param inputs Input ciphertexts, one per input() call.
+         * @param outputs Output vector, resized to the number of outputs.
+         * @param relin_key Relinearization key.
+         * @param galois_key Galois key for rotations, conjugations and
+         * bootstrapping.
+         * @param options Execution options; outputs are stored according to
+         * options.storage_.
+         */
+        __host__ void
+        execute(HEArithmeticOperator<Scheme::CKKS>& operators,
+                std::vector<Ciphertext<Scheme::CKKS>>& inputs,
+                std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+                Relinkey<Scheme::CKKS>& relin_key,
+                Galoiskey<Scheme::CKKS>& galois_key,
+                const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Executes a compiled schedule that needs no Galois key.
+         */
+        __host__ void
+        execute(HEArithmeticOperator<Scheme::CKKS>& operators,
+                std::vector<Ciphertext<Scheme::CKKS>>& inputs,
+                std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+                Relinkey<Scheme::CKKS>& relin_key,
+                const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Returns the rotation steps used by the graph, to generate
+         * the Galois key with. Bootstrapping needs the operator's
+         * bootstrapping_key_indexs() in addition.
+         */
+        __host__ std::vector<int> rotation_steps() const;
+
+        /**
+         * @brief Returns whether compile() placed any bootstrapping.
+         */
+        inline bool bootstrapping_required() const noexcept
+        {
+            return statistics_.bootstraps > 0;
+        }
+
+        /**
+         * @brief Returns the maintenance operations placed by the last
+         * compile() call and the number of nodes fused while recording.
+         */
+        inline GraphStatistics statistics() const noexcept
+        {
+            return statistics_;
+        }
+
+      private:
+        enum class graph_operation : std::uint8_t
+        {
+            input,
+            constant,
+            add,
+            sub,
+            negate,
+            multiply,
+            rotate,
+            conjugate
+        };
+
+        enum class graph_instruction : std::uint8_t
+        {
+            load_input,
+            add,
+            sub,
+            negate,
+            multiply,
+            add_constant,
+            multiply_constant,
+            rotate,
+            conjugate,
+            relinearize,
+            rescale,
+            mod_drop,
+            bootstrap,
+            store_output
+        };
+
+        struct GraphNode
+        {
+            graph_operation operation;
+            int operand1 = -1;
+            int operand2 = -1;
+            int parameter = 0; // input index or rotation shift
+            int depth = 0; // input depth
+            bool broadcast = true;
+            std::vector<double> values;
+        };
+
+        struct GraphInstruction
+        {
+            graph_instruction instruction;
+            int destination = -1;
+            int source1 = -1;
+            int source2 = -1;
+            int parameter = 0; // input or output index, shift, constant node
+            bool release_source1 = false;
+            bool release_source2 = false;
+        };
+
+        // Relinearization pending implies rescale pending, so the pending
+        // maintenance of a value is a single ordered state.
+        enum value_state
+        {
+            settled = 0,
+            rescale_pending = 1,
+            relinearize_pending = 2
+        };
+
+        struct ValueForm
+        {
+            int reg;
+            int depth;
+            int state;
+        };
+
+        __host__ int add_node(GraphNode node);
+
+        __host__ void check_node(int node) const;
+
+        __host__ bool is_constant(int node) const;
+
+        __host__ std::vector<double> expand_constant(int node) const;
+
+        __host__ int combine_constants(int node1, int node2,
+                                       graph_operation operation);
+
+        __host__ int negate_constant(int node);
+
+        __host__ bool constant_equals(int node, double value) const;
+
+        // Planning
+        __host__ ValueForm emit(graph_instruction instruction, int source1,
+                                int source2, int parameter, int depth,
+                                int state);
+
+        __host__ ValueForm settle(int node, int max_state);
+
+        __host__ ValueForm align(int node, int depth);
+
+        __host__ ValueForm bootstrap(int node);
+
+        __host__ ValueForm level_for_multiplication(int node);
+
+        __host__ void plan_node(int node);
+
+        __host__ void
+        execute_graph(HEArithmeticOperator<Scheme::CKKS>& operators,
+                      std::vector<Ciphertext<Scheme::CKKS>>& inputs,
+                      std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+                      Relinkey<Scheme::CKKS>& relin_key,
+                      Galoiskey<Scheme::CKKS>* galois_key,
+                      const ExecutionOptions& options);
+
+        // Encoding of a constant node, taken from the constant cache of
+        // operators.
+        __host__ ConstantCache<Scheme::CKKS>::Entry
+        encode_constant(HEArithmeticOperator<Scheme::CKKS>& operators,
+                        int node, double scale, int depth,
+                        const ExecutionOptions& options);
+
+        HEContext<Scheme::CKKS>& context_;
+        HEEncoder<Scheme::CKKS>& encoder_;
+        double scale_;
+        int Q_size_;
+        int slot_count_;
+
+        // Unique per graph; identifies its vector constants in the cache.
+        std::uint64_t graph_id_;
+
+        std::vector<GraphNode> nodes_;
+        std::vector<int> input_nodes_;
+        std::vector<int> output_nodes_;
+
+        // Hash-consing of recorded nodes: (operation, operand1, operand2,
+        // parameter) -> node. Constants are never shared.
+        std::map<std::tuple<int, int, int, int>, int> node_lookup_;
+
+        bool compiled_ = false;
+        int bootstrap_depth_ = -1;
+        bool galois_key_required_ = false;
+
+        std::vector<GraphInstruction> instructions_;
+        int register_count_ = 0;
+
+        // Planning state: primary form of every node and all derived forms,
+        // keyed by (node, depth, state).
+        std::vector<ValueForm> primary_form_;
+        std::map<std::tuple<int, int, int>, ValueForm> derived_forms_;
+
+        int fused_nodes_ = 0;
+        GraphStatistics statistics_;
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_CKKS_GRAPH_H
@@ -13,6 +13,7 @@
 #include "ckks/secretkey.cuh"
 #include "ckks/publickey.cuh"
 #include "ckks/evaluationkey.cuh"
+#include "tfhe/secretkey.cuh"
 
 namespace heongpu
 {
@@ -91,7 +92,9 @@ namespace heongpu
          *
          * This function aggregates all partial public keys generated by the
          * participants into a single final public key for use in multiparty
-         * computations.
+         * computations. The pieces are summed with a pairwise tree reduction,
+         * one kernel launch per tree level; see
+         * accumulate_multi_party_public_key for folding shares in one by one.
          *
          * @param all_pk Vector containing the partial public keys from all
          * participants.
@@ -103,6 +106,25 @@ namespace heongpu
             Publickey<Scheme::CKKS>& pk,
             const ExecutionOptions& options = ExecutionOptions());
 
+        /**
+         * @brief Folds one participant's partial public key into the common
+         * public key (Collective, streaming).
+         *
+         * Shares can be folded in as they arrive, so only the common key and
+         * the current share need to be resident on the device regardless of
+         * the participant count. The result equals
+         * generate_multi_party_public_key over the same shares.
+         *
+         * @param pk_piece Partial public key of one participant.
+         * @param pk Reference to the Publickey object accumulating the common
+         * public key.
+         * @param first True for the first share, which initializes pk.
+         */
+        __host__ void accumulate_multi_party_public_key(
+            MultipartyPublickey<Scheme::CKKS>& pk_piece,
+            Publickey<Scheme::CKKS>& pk, bool first,
+            const ExecutionOptions& options = ExecutionOptions());
+
         /**
          * @brief Generates a relinearization key using a secret key.
          *
@@ -133,6 +155,29 @@ namespace heongpu
             }
         }
 
+        /**
+         * @brief Generates a relinearization key trimmed to a maximum level.
+         *
+         * The level of a ciphertext is the number of its remaining Q primes
+         * minus one (Q_size - 1 - depth). A trimmed key only stores the
+         * decomposition blocks needed to relinearize ciphertexts at level
+         * max_level or below, so circuits that only run at the last few
+         * levels need a fraction of the key memory and key-switch bandwidth.
+         * The key must be freshly constructed; KEYSWITCHING_METHOD_III is not
+         * supported.
+         *
+         * @param rk Reference to the Relinkey object where the generated
+         * relinearization key will be stored.
+         * @param sk Reference to the Secretkey object used to generate the
+         * relinearization key.
+         * @param max_level Highest ciphertext level the key is used with, in
+         * [0, Q_size - 1]. Q_size - 1 generates the full key.
+         */
+        __host__ void generate_relin_key(
+            Relinkey<Scheme::CKKS>& rk, Secretkey<Scheme::CKKS>& sk,
+            int max_level,
+            const ExecutionOptions& options = ExecutionOptions());
+
         /**
          * @brief Generates a partial relinearization key piece for multiparty
          * computation (Stage 1 - Each).
@@ -225,7 +270,7 @@ namespace heongpu
          *
          * This function aggregates all partial relinearization key pieces from
          * multiple participants into a single collective relinearization key
-         * for Stage 1.
+         * for Stage 1. The pieces are summed with a pairwise tree reduction.
          *
          * @param all_rk Vector containing partial relinearization keys from all
          * participants.
@@ -237,6 +282,21 @@ namespace heongpu
             MultipartyRelinkey<Scheme::CKKS>& rk,
             const ExecutionOptions& options = ExecutionOptions());
 
+        /**
+         * @brief Folds one participant's partial relinearization key into the
+         * Stage 1 collective key (Collective, streaming).
+         *
+         * @param rk_piece Stage 1 relinearization key piece of one
+         * participant.
+         * @param rk Reference to the MultipartyRelinkey object accumulating
+         * the Stage 1 collective key.
+         * @param first True for the first share, which initializes rk.
+         */
+        __host__ void accumulate_multi_party_relin_key(
+            MultipartyRelinkey<Scheme::CKKS>& rk_piece,
+            MultipartyRelinkey<Scheme::CKKS>& rk, bool first,
+            const ExecutionOptions& options = ExecutionOptions());
+
         /**
          * @brief Combines partial relinearization keys from all participants
          * (Stage 2 - Collective).
@@ -258,6 +318,24 @@ namespace heongpu
             Relinkey<Scheme::CKKS>& rk,
             const ExecutionOptions& options = ExecutionOptions());
 
+        /**
+         * @brief Folds one participant's Stage 2 relinearization key piece into
+         * the final relinearization key (Collective, streaming).
+         *
+         * @param rk_piece Stage 2 relinearization key piece of one
+         * participant.
+         * @param rk_common_stage1 Reference to the shared Stage 1 collective
+         * relinearization key.
+         * @param rk Reference to the Relinkey object accumulating the final
+         * key.
+         * @param first True for the first share, which initializes rk.
+         */
+        __host__ void accumulate_multi_party_relin_key(
+            MultipartyRelinkey<Scheme::CKKS>& rk_piece,
+            MultipartyRelinkey<Scheme::CKKS>& rk_common_stage1,
+            Relinkey<Scheme::CKKS>& rk, bool first,
+            const ExecutionOptions& options = ExecutionOptions());
+
         /**
          * @brief Generates a Galois key using a secret key.
          *
@@ -291,6 +369,42 @@ namespace heongpu
             }
         }
 
+        /**
+         * @brief Generates a Galois key and writes it to a stream in the
+         * layout of Galoiskey::save, without keeping it in memory. The stream
+         * can be loaded with Galoiskey::load; gk itself stays ungenerated.
+         *
+         * Only KEYSWITCHING_METHOD_I keys can be streamed.
+         *
+         * @param gk Galoiskey describing the rotations to generate.
+         * @param sk Reference to the Secretkey object used to generate the
+         * Galois key.
+         * @param os Output stream the key is written to.
+         */
+        __host__ void generate_galois_key(
+            Galoiskey<Scheme::CKKS>& gk, Secretkey<Scheme::CKKS>& sk,
+            std::ostream& os,
+            const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Generates a Galois key trimmed to a maximum level.
+         *
+         * Every rotation key (and the conjugation key) stores only the
+         * decomposition blocks needed for ciphertexts at level max_level or
+         * below. See generate_relin_key for the definition of the level.
+         *
+         * @param gk Reference to the Galoiskey object where the generated
+         * Galois key will be stored.
+         * @param sk Reference to the Secretkey object used to generate the
+         * Galois key.
+         * @param max_level Highest ciphertext level the key is used with, in
+         * [0, Q_size - 1]. Q_size - 1 generates the full key.
+         */
+        __host__ void generate_galois_key(
+            Galoiskey<Scheme::CKKS>& gk, Secretkey<Scheme::CKKS>& sk,
+            int max_level,
+            const ExecutionOptions& options = ExecutionOptions());
+
         /**
          * @brief Generates a partial Galois key for multiparty computation
          * (Each participant).
@@ -337,7 +451,7 @@ namespace heongpu
          *
          * This function aggregates all partial Galois keys generated by the
          * participants into a single final Galois key for use in multiparty
-         * computations.
+         * computations. The pieces are summed with a pairwise tree reduction.
          *
          * @param all_gk Vector containing the partial Galois keys from all
          * participants.
@@ -349,6 +463,20 @@ namespace heongpu
             Galoiskey<Scheme::CKKS>& gk,
             const ExecutionOptions& options = ExecutionOptions());
 
+        /**
+         * @brief Folds one participant's partial Galois key into the common
+         * Galois key (Collective, streaming).
+         *
+         * @param gk_piece Partial Galois key of one participant.
+         * @param gk Reference to the Galoiskey object accumulating the common
+         * Galois key.
+         * @param first True for the first share, which initializes gk.
+         */
+        __host__ void accumulate_multi_party_galois_key(
+            MultipartyGaloiskey<Scheme::CKKS>& gk_piece,
+            Galoiskey<Scheme::CKKS>& gk, bool first,
+            const ExecutionOptions& options = ExecutionOptions());
+
         /**
          * @brief Generates a switch key for key switching between two secret
          * keys.
@@ -385,6 +513,26 @@ namespace heongpu
             }
         }
 
+        /**
+         * @brief Generates the keys that pack TFHE LWE ciphertexts into a CKKS
+         * ciphertext and extract them back.
+         *
+         * The ring key switches from the LWE secret key, placed in the first n
+         * coefficients of a ring element, to the CKKS secret key. The
+         * extraction key is a TFHE key switching key from the coefficients of
+         * the CKKS secret key to the LWE secret key.
+         *
+         * @param pk Reference to the Packingkey object where the generated keys
+         * will be stored.
+         * @param sk Reference to the CKKS Secretkey object.
+         * @param lwe_sk Reference to the TFHE Secretkey object whose LWE key
+         * encrypts the packed ciphertexts.
+         */
+        __host__ void generate_packing_key(
+            Packingkey<Scheme::CKKS>& pk, Secretkey<Scheme::CKKS>& sk,
+            Secretkey<Scheme::TFHE>& lwe_sk,
+            const ExecutionOptions& options = ExecutionOptions());
+
         /**
          * @brief Returns the seed of the key generator.
          *
@@ -416,6 +564,9 @@ namespace heongpu
         HEKeyGenerator& operator=(HEKeyGenerator&& assign) = delete;
 
       private:
+        __host__ int trimmed_decomp_count(keyswitching_type key_type,
+                                          int max_level) const;
+
         __host__ void
         generate_relin_key_method_I(Relinkey<Scheme::CKKS>& rk,
                                     Secretkey<Scheme::CKKS>& sk,
@@ -436,6 +587,24 @@ namespace heongpu
                                      Secretkey<Scheme::CKKS>& sk,
                                      const ExecutionOptions& options);
 
+        // Batched Galois key generation: all keys of a batch share one
+        // random sampling, one NTT and one kernel launch.
+        __host__ void galois_key_elements(Galoiskey<Scheme::CKKS>& gk,
+                                          std::vector<int>& storage_elts,
+                                          std::vector<int>& kernel_elts) const;
+
+        __host__ int galois_key_batch_count(int decomp_mod_count) const;
+
+        __host__ void
+        generate_galois_key_batch(Secretkey<Scheme::CKKS>& sk,
+                                  const std::vector<int>& galois_elts,
+                                  std::vector<Data64*>& outputs,
+                                  int decomp_mod_count,
+                                  const cudaStream_t stream);
+
+        // Upper bound of the temporary device memory of one key batch.
+        static constexpr size_t galois_key_batch_bytes_ = size_t(1) << 28;
+
         __host__ void
         generate_ckks_galois_key_method_II(Galoiskey<Scheme::CKKS>& gk,
                                            Secretkey<Scheme::CKKS>& sk,
@@ -477,6 +646,16 @@ namespace heongpu
             MultipartyGaloiskey<Scheme::CKKS>& gk, Secretkey<Scheme::CKKS>& sk,
             const ExecutionOptions& options);
 
+        __host__ int multi_party_decomp_count(keyswitching_type key_type,
+                                              int d) const;
+
+        __host__ void tree_reduce_multi_party_key(std::vector<Data64*>& pieces,
+                                                  Data64* output,
+                                                  size_t key_size,
+                                                  int decomp_mod_count,
+                                                  bool reduce_second,
+                                                  const cudaStream_t stream);
+
       private:
         scheme_type scheme;
         int seed_;
@@ -492,6 +671,9 @@ namespace heongpu
         int Q_size_;
         int P_size_;
 
+        // Limb width of the generated method I key-switching keys.
+        limb_type key_limb_type_;
+
         std::shared_ptr<DeviceVector<Modulus64>> modulus_;
         std::shared_ptr<DeviceVector<Root64>> ntt_table_;
         std::shared_ptr<DeviceVector<Root64>> intt_table_;
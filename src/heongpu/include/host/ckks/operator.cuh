@@ -19,6 +19,8 @@
 #include "ckks/plaintext.cuh"
 #include "ckks/ciphertext.cuh"
 #include "ckks/evaluationkey.cuh"
+#include "ckks/constantcache.cuh"
+#include "tfhe/ciphertext.cuh"
 
 namespace heongpu
 {
@@ -35,6 +37,8 @@ namespace heongpu
      */
     template <> class HEOperator<Scheme::CKKS>
     {
+        template <Scheme S> friend class HEGraph;
+
       protected:
         /**
          * @brief Construct a new HEOperator object with the given parameters.
@@ -175,6 +179,9 @@ namespace heongpu
                                     output_.in_ntt_domain_ =
                                         input1_.in_ntt_domain_;
                                     output_.scale_ = input1_.scale_;
+                                    output_.slot_count_ =
+                                        std::max(input1_.slot_count_,
+                                                 input2_.slot_count_);
                                     output_.rescale_required_ =
                                         input1_.rescale_required_;
                                     output_.relinearization_required_ =
@@ -277,6 +284,9 @@ namespace heongpu
                                     output_.in_ntt_domain_ =
                                         input1_.in_ntt_domain_;
                                     output_.scale_ = input1_.scale_;
+                                    output_.slot_count_ =
+                                        std::max(input1_.slot_count_,
+                                                 input2_.slot_count_);
                                     output_.rescale_required_ =
                                         input1_.rescale_required_;
                                     output_.relinearization_required_ =
@@ -496,6 +506,140 @@ namespace heongpu
             multiply_plain(input1, input2, input1, options);
         }
 
+        /**
+         * @brief Adds a constant to every slot of a ciphertext. The constant
+         * is encoded at the depth and scale of input1 once and then taken
+         * from the constant cache.
+         *
+         * @param input1 Input ciphertext.
+         * @param value Constant to be added.
+         * @param output Ciphertext where the result of the addition is stored.
+         */
+        __host__ void
+        add_constant(Ciphertext<Scheme::CKKS>& input1, double value,
+                     Ciphertext<Scheme::CKKS>& output,
+                     const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Adds a complex constant to every slot of a ciphertext, see
+         * add_constant.
+         */
+        __host__ void
+        add_constant(Ciphertext<Scheme::CKKS>& input1, Complex64 value,
+                     Ciphertext<Scheme::CKKS>& output,
+                     const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Adds a constant to every slot of a ciphertext in-place.
+         */
+        __host__ void add_constant_inplace(
+            Ciphertext<Scheme::CKKS>& input1, double value,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            add_constant(input1, value, input1, options);
+        }
+
+        /**
+         * @brief Adds a complex constant to every slot of a ciphertext
+         * in-place.
+         */
+        __host__ void add_constant_inplace(
+            Ciphertext<Scheme::CKKS>& input1, Complex64 value,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            add_constant(input1, value, input1, options);
+        }
+
+        /**
+         * @brief Multiplies every slot of a ciphertext by a constant. The
+         * constant is encoded at the scale of the prime the next rescale
+         * drops, so the output has the scale of input1 after rescale_inplace.
+         * The encoding is taken from the constant cache after its first use.
+         *
+         * @param input1 Input ciphertext.
+         * @param value Constant to be multiplied.
+         * @param output Ciphertext where the result of the multiplication is
+         * stored.
+         */
+        __host__ void
+        multiply_constant(Ciphertext<Scheme::CKKS>& input1, double value,
+                          Ciphertext<Scheme::CKKS>& output,
+                          const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Multiplies every slot of a ciphertext by a complex constant,
+         * see multiply_constant.
+         */
+        __host__ void
+        multiply_constant(Ciphertext<Scheme::CKKS>& input1, Complex64 value,
+                          Ciphertext<Scheme::CKKS>& output,
+                          const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Multiplies every slot of a ciphertext by a constant in-place.
+         */
+        __host__ void multiply_constant_inplace(
+            Ciphertext<Scheme::CKKS>& input1, double value,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            multiply_constant(input1, value, input1, options);
+        }
+
+        /**
+         * @brief Multiplies every slot of a ciphertext by a complex constant
+         * in-place.
+         */
+        __host__ void multiply_constant_inplace(
+            Ciphertext<Scheme::CKKS>& input1, Complex64 value,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            multiply_constant(input1, value, input1, options);
+        }
+
+        /**
+         * @brief Returns a mask encoded at depth and scale, for use with
+         * add_plain and multiply_plain. The mask is encoded on the first
+         * request of each (mask_id, depth, scale) and then taken from the
+         * constant cache, so mask is only read on a miss. Call
+         * constant_cache().erase_mask(mask_id) when the values behind mask_id
+         * change.
+         *
+         * @param mask_id User chosen id of the mask.
+         * @param mask Values of the slots; missing slots are zero.
+         * @param depth Depth of the ciphertexts the mask is used with.
+         * @param scale Scale of the encoding.
+         * @return Shared encoded mask; it stays valid after eviction.
+         */
+        __host__ ConstantCache<Scheme::CKKS>::Entry
+        encoded_mask(std::uint64_t mask_id, const std::vector<double>& mask,
+                     int depth, double scale,
+                     const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Returns a constant encoded in every slot at depth and scale,
+         * from the constant cache when present.
+         */
+        __host__ ConstantCache<Scheme::CKKS>::Entry
+        encoded_constant(double value, int depth, double scale,
+                         const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Returns a complex constant encoded in every slot at depth and
+         * scale, from the constant cache when present.
+         */
+        __host__ ConstantCache<Scheme::CKKS>::Entry
+        encoded_constant(Complex64 value, int depth, double scale,
+                         const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Returns the cache of encoded constants and masks. Operators
+         * constructed from each other share it.
+         */
+        ConstantCache<Scheme::CKKS>& constant_cache()
+        {
+            return *constant_cache_;
+        }
+
         /**
          * @brief Performs in-place relinearization of the given ciphertext
          * using the provided relin key.
@@ -624,6 +768,7 @@ namespace heongpu
                             output_.cipher_size_ = 2;
                             output_.depth_ = input1_.depth_;
                             output_.scale_ = input1_.scale_;
+                            output_.slot_count_ = input1_.slot_count_;
                             output_.in_ntt_domain_ = input1_.in_ntt_domain_;
                             output_.rescale_required_ =
                                 input1_.rescale_required_;
@@ -727,6 +872,7 @@ namespace heongpu
                             output_.cipher_size_ = 2;
                             output_.depth_ = input1_.depth_;
                             output_.scale_ = input1_.scale_;
+                            output_.slot_count_ = input1_.slot_count_;
                             output_.in_ntt_domain_ = input1_.in_ntt_domain_;
                             output_.rescale_required_ =
                                 input1_.rescale_required_;
@@ -824,6 +970,7 @@ namespace heongpu
                             output_.cipher_size_ = 2;
                             output_.depth_ = input1_.depth_;
                             output_.scale_ = input1_.scale_;
+                            output_.slot_count_ = input1_.slot_count_;
                             output_.in_ntt_domain_ = input1_.in_ntt_domain_;
                             output_.rescale_required_ =
                                 input1_.rescale_required_;
@@ -904,6 +1051,7 @@ namespace heongpu
                             output_.cipher_size_ = 2;
                             output_.depth_ = input1_.depth_;
                             output_.scale_ = input1_.scale_;
+                            output_.slot_count_ = input1_.slot_count_;
                             output_.in_ntt_domain_ = input1_.in_ntt_domain_;
                             output_.rescale_required_ =
                                 input1_.rescale_required_;
@@ -991,6 +1139,7 @@ namespace heongpu
                             output.cipher_size_ = 2;
                             output.depth_ = input1.depth_ + 1;
                             output.scale_ = input1.scale_;
+                            output.slot_count_ = input1.slot_count_;
                             output.in_ntt_domain_ = input1.in_ntt_domain_;
                             output.rescale_required_ = input1.rescale_required_;
                             output.relinearization_required_ =
@@ -1038,6 +1187,7 @@ namespace heongpu
                                 (n * (current_decomp_count - 1));
                             output.depth_ = input1.depth_ + 1;
                             output.scale_ = input1.scale_;
+                            output.slot_count_ = input1.slot_count_;
                             output.in_ntt_domain_ = input1.in_ntt_domain_;
                             output.plaintext_generated_ = true;
                         },
@@ -1318,8 +1468,8 @@ namespace heongpu
             template <Scheme S> friend class HELogicOperator;
 
           public:
-            __host__ Vandermonde(const int poly_degree, const int CtoS_piece,
-                                 const int StoC_piece,
+            __host__ Vandermonde(const int poly_degree, const int slot_count,
+                                 const int CtoS_piece, const int StoC_piece,
                                  const bool less_key_mode);
 
             __host__ void generate_E_diagonals_index();
@@ -1403,6 +1553,11 @@ namespace heongpu
         int taylor_number_;
         bool less_key_mode_;
 
+        // Number of slots the bootstrapping circuit works on; n / 2 unless a
+        // sparse slot count was requested in BootstrappingConfig.
+        int boot_slot_count_;
+        int boot_log_slot_count_;
+
         std::vector<int> key_indexs_;
 
         std::vector<heongpu::DeviceVector<Data64>> V_matrixs_rotated_encoded_;
@@ -1426,11 +1581,13 @@ namespace heongpu
         // CKKS
         double two_pow_64_;
         std::shared_ptr<DeviceVector<int>> reverse_order_;
+        std::vector<std::shared_ptr<DeviceVector<int>>> sparse_reverse_order_;
         std::shared_ptr<DeviceVector<Complex64>> special_ifft_roots_table_;
 
         __host__ void
         quick_ckks_encoder_vec_complex(Complex64* input, Data64* output,
                                        const double scale,
+                                       const int log_slot_count,
                                        bool use_all_bases = false);
 
         __host__ void
@@ -1448,6 +1605,27 @@ namespace heongpu
                                             const double scale,
                                             bool use_all_bases = false);
 
+        std::shared_ptr<ConstantCache<Scheme::CKKS>> constant_cache_;
+
+        // Returns the entry of key, encoding values over slot_count slots on
+        // a miss. A single value is broadcast to every slot.
+        __host__ ConstantCache<Scheme::CKKS>::Entry
+        cached_encoding(const ConstantKey& key,
+                        const std::vector<Complex64>& values, int slot_count);
+
+        // Plaintext at depth holding the first Q_size_ - depth limbs of
+        // encoded.
+        __host__ Plaintext<Scheme::CKKS>
+        trimmed_plaintext(DeviceVector<Data64>& encoded, int depth,
+                          double scale);
+
+        // MultSum of key switching method I. key holds limbs of width
+        // key_limb_type, see HEContext<Scheme::CKKS>::set_key_limb_type.
+        __host__ void multiply_accumulate_key(
+            Data64* input, Data64* key, limb_type key_limb_type, Data64* output,
+            int first_rns_mod_count, int current_decomp_count,
+            int current_rns_mod_count, cudaStream_t stream);
+
         __host__ std::vector<heongpu::DeviceVector<Data64>>
         encode_V_matrixs(Vandermonde& vandermonde, const double scale,
                          bool use_all_bases = false);
@@ -1575,24 +1753,48 @@ namespace heongpu
             std::vector<int>& bsgs_shift, int n1,
             Galoiskey<Scheme::CKKS>& galois_key, const cudaStream_t stream);
 
-        // Pre-computed encoded parameters
+        // Pre-computed encoded parameters, shared with constant_cache_
         // CtoS part
-        DeviceVector<Data64> encoded_constant_1over2_;
-        DeviceVector<Data64> encoded_complex_minus_iover2_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_1over2_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_complex_minus_iover2_;
         // StoC part
-        DeviceVector<Data64> encoded_complex_i_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_complex_i_;
         // Scale part
-        DeviceVector<Data64> encoded_complex_minus_iscale_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_complex_minus_iscale_;
         // Exponentiate part
-        DeviceVector<Data64> encoded_complex_iscaleoverr_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_complex_iscaleoverr_;
         // Sinus taylor part
-        DeviceVector<Data64> encoded_constant_1_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_1_;
         // DeviceVector<Data64> encoded_constant_1over2_; // we already have it.
-        DeviceVector<Data64> encoded_constant_1over6_;
-        DeviceVector<Data64> encoded_constant_1over24_;
-        DeviceVector<Data64> encoded_constant_1over120_;
-        DeviceVector<Data64> encoded_constant_1over720_;
-        DeviceVector<Data64> encoded_constant_1over5040_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_1over6_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_1over24_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_1over120_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_1over720_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_1over5040_;
+        // Real packing part
+        DeviceVector<Data64> encoded_monomial_i_;
+    };
+
+    /**
+     * @brief Slots [offset, offset + length) of a CKKS ciphertext that hold
+     * meaningful values.
+     */
+    struct SlotRange
+    {
+        int offset;
+        int length;
+    };
+
+    /**
+     * @brief Placement of one input of HEArithmeticOperator::repack: the slots
+     * in source are moved to [target_offset, target_offset + source.length) of
+     * the packed ciphertext with index output.
+     */
+    struct RepackPlacement
+    {
+        SlotRange source;
+        int output;
+        int target_offset;
     };
 
     /**
@@ -1665,6 +1867,270 @@ namespace heongpu
             Galoiskey<Scheme::CKKS>& galois_key,
             Relinkey<Scheme::CKKS>& relin_key,
             const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Performs regular bootstrapping on two ciphertexts with
+         * real-valued slots at the cost of one. The second input is packed
+         * into the imaginary part of the first one, the packed ciphertext is
+         * bootstrapped once and the two real parts are separated again.
+         *
+         * Packing does not consume a level, so both inputs have to be at the
+         * level regular_bootstrapping expects, with equal scale and slot
+         * count. Unpacking consumes one level more than regular_bootstrapping.
+         *
+         * @param input1 First input ciphertext, real-valued.
+         * @param input2 Second input ciphertext, real-valued.
+         * @param output1 Bootstrapped first ciphertext.
+         * @param output2 Bootstrapped second ciphertext.
+         * @param galois_key Galois key.
+         * @param relin_key Relinearization key.
+         * @param options Execution options.
+         */
+        __host__ void regular_bootstrapping_real(
+            Ciphertext<Scheme::CKKS>& input1, Ciphertext<Scheme::CKKS>& input2,
+            Ciphertext<Scheme::CKKS>& output1,
+            Ciphertext<Scheme::CKKS>& output2,
+            Galoiskey<Scheme::CKKS>& galois_key,
+            Relinkey<Scheme::CKKS>& relin_key,
+            const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Performs regular bootstrapping on a batch of ciphertexts with
+         * real-valued slots, two ciphertexts per bootstrapping. An odd last
+         * ciphertext is bootstrapped alone and unpacked the same way, so all
+         * outputs end at the same level.
+         *
+         * @param inputs Input ciphertexts, real-valued.
+         * @param outputs Output vector, resized to inputs.size().
+         * @param galois_key Galois key.
+         * @param relin_key Relinearization key.
+         * @param options Execution options.
+         */
+        __host__ void regular_bootstrapping_real(
+            std::vector<Ciphertext<Scheme::CKKS>>& inputs,
+            std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+            Galoiskey<Scheme::CKKS>& galois_key,
+            Relinkey<Scheme::CKKS>& relin_key,
+            const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Performs slim bootstrapping on two ciphertexts with
+         * real-valued slots at the cost of one. See regular_bootstrapping_real
+         * for the packing; the inputs have to be at the level
+         * slim_bootstrapping expects.
+         *
+         * @param input1 First input ciphertext, real-valued.
+         * @param input2 Second input ciphertext, real-valued.
+         * @param output1 Bootstrapped first ciphertext.
+         * @param output2 Bootstrapped second ciphertext.
+         * @param galois_key Galois key.
+         * @param relin_key Relinearization key.
+         * @param options Execution options.
+         */
+        __host__ void slim_bootstrapping_real(
+            Ciphertext<Scheme::CKKS>& input1, Ciphertext<Scheme::CKKS>& input2,
+            Ciphertext<Scheme::CKKS>& output1,
+            Ciphertext<Scheme::CKKS>& output2,
+            Galoiskey<Scheme::CKKS>& galois_key,
+            Relinkey<Scheme::CKKS>& relin_key,
+            const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Performs slim bootstrapping on a batch of ciphertexts with
+         * real-valued slots, two ciphertexts per bootstrapping.
+         *
+         * @param inputs Input ciphertexts, real-valued.
+         * @param outputs Output vector, resized to inputs.size().
+         * @param galois_key Galois key.
+         * @param relin_key Relinearization key.
+         * @param options Execution options.
+         */
+        __host__ void slim_bootstrapping_real(
+            std::vector<Ciphertext<Scheme::CKKS>>& inputs,
+            std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+            Galoiskey<Scheme::CKKS>& galois_key,
+            Relinkey<Scheme::CKKS>& relin_key,
+            const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Places sparsely filled ciphertexts into the minimal number of
+         * dense ones. Ranges are placed longest first, each at the end of the
+         * first packed ciphertext with enough free slots (first-fit
+         * decreasing).
+         *
+         * @param ranges Occupied slots of every input.
+         * @param slot_count Slot count of the inputs.
+         * @return std::vector<RepackPlacement> One placement per input.
+         */
+        __host__ static std::vector<RepackPlacement>
+        plan_repack(const std::vector<SlotRange>& ranges, int slot_count);
+
+        /**
+         * @brief Returns the rotation steps used by repack and unpack for a
+         * layout, to generate the Galois key with.
+         */
+        __host__ static std::vector<int>
+        repack_rotation_steps(const std::vector<RepackPlacement>& layout,
+                              int slot_count);
+
+        /**
+         * @brief Merges sparsely filled ciphertexts into dense ones.
+         *
+         * Every input is multiplied by the 0/1 mask of its occupied slots and
+         * rotated to its target offset. Inputs that move by the same rotation
+         * into the same packed ciphertext are summed first and rotated once.
+         * The masks are encoded at the scale of the dropped prime, so the
+         * outputs are one level deeper than the inputs at the same scale.
+         *
+         * @param inputs Input ciphertexts, all at the same level and scale.
+         * @param layout Placement of every input, see plan_repack.
+         * @param outputs Output vector, resized to the number of packed
+         * ciphertexts.
+         * @param galois_key Galois key for repack_rotation_steps(layout).
+         * @param options Execution options.
+         */
+        __host__ void
+        repack(std::vector<Ciphertext<Scheme::CKKS>>& inputs,
+               const std::vector<RepackPlacement>& layout,
+               std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+               Galoiskey<Scheme::CKKS>& galois_key,
+               const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Inverse of repack: moves every placement back to its source
+         * slots and clears the other slots. All rotations of one packed
+         * ciphertext are hoisted when the Galois key holds every one of them
+         * directly. Consumes one level.
+         *
+         * @param packed Packed ciphertexts, all at the same level and scale.
+         * @param layout Layout the ciphertexts were packed with.
+         * @param outputs Output vector, resized to layout.size().
+         * @param galois_key Galois key for repack_rotation_steps(layout).
+         * @param options Execution options.
+         */
+        __host__ void
+        unpack(std::vector<Ciphertext<Scheme::CKKS>>& packed,
+               const std::vector<RepackPlacement>& layout,
+               std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+               Galoiskey<Scheme::CKKS>& galois_key,
+               const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Returns the Galois elements pack_lwe_ciphertexts uses, one
+         * per power of two 2^h, 1 <= h <= log2(N): 2^h + 1.
+         *
+         * @return std::vector<uint32_t> Galois elements for the Galois key.
+         */
+        __host__ std::vector<uint32_t> lwe_packing_galois_elements() const
+        {
+            std::vector<uint32_t> galois_elts;
+            for (int h = 1; h <= n_power; h++)
+            {
+                galois_elts.push_back((1u << h) + 1);
+            }
+
+            return galois_elts;
+        }
+
+        /**
+         * @brief Packs the LWE samples of a TFHE ciphertext into the
+         * coefficients of one CKKS ciphertext.
+         *
+         * Every sample is turned into an RLWE ciphertext with the ring key,
+         * then the samples are merged pairwise in a binary tree with Galois
+         * automorphisms, and the remaining coefficients are cleared with a
+         * field trace. Only log2(count) partial results are alive at any
+         * time. With 2^l the smallest power of two not below count, sample j
+         * is placed in coefficient j * N / 2^l, multiplied by the ciphertext
+         * modulus Q of the output level: the phase mu on the torus becomes
+         * Q * mu, so the output scale is Q.
+         *
+         * @param input TFHE ciphertext holding the samples, at most N.
+         * @param output Output ciphertext, in NTT domain.
+         * @param packing_key Packing key of the TFHE secret key.
+         * @param galois_key Galois key for lwe_packing_galois_elements().
+         * @param depth Level of the output; higher levels are cheaper.
+         * @param options Execution options.
+         */
+        __host__ void pack_lwe_ciphertexts(
+            Ciphertext<Scheme::TFHE>& input, Ciphertext<Scheme::CKKS>& output,
+            Packingkey<Scheme::CKKS>& packing_key,
+            Galoiskey<Scheme::CKKS>& galois_key, int depth = 0,
+            const ExecutionOptions& options = ExecutionOptions());
+
+        /**
+         * @brief Inverse of pack_lwe_ciphertexts: extracts count LWE samples
+         * from the coefficients j * N / 2^l of a CKKS ciphertext, with 2^l the
+         * smallest power of two not below count, and switches them to the
+         * TFHE secret key.
+         *
+         * Coefficient x of the phase is mapped to round(2^32 * x / Q) on the
+         * torus, so ciphertexts produced by pack_lwe_ciphertexts decrypt to
+         * their original messages after additions, negations and Galois
+         * automorphisms that keep the layout.
+         *
+         * @param input Input ciphertext.
+         * @param output TFHE ciphertext receiving count samples.
+         * @param packing_key Packing key of the TFHE secret key.
+         * @param count Number of samples.
+         * @param options Execution options.
+         */
+        __host__ void extract_lwe_ciphertexts(
+            Ciphertext<Scheme::CKKS>& input, Ciphertext<Scheme::TFHE>& output,
+            Packingkey<Scheme::CKKS>& packing_key, int count,
+            const ExecutionOptions& options = ExecutionOptions());
+
+      private:
+        __host__ void sub_sum_inplace(Ciphertext<Scheme::CKKS>& cipher,
+                                      Galoiskey<Scheme::CKKS>& galois_key,
+                                      const ExecutionOptions& options);
+
+        __host__ Ciphertext<Scheme::CKKS>
+        pack_real_pair(Ciphertext<Scheme::CKKS>& input1,
+                       Ciphertext<Scheme::CKKS>& input2,
+                       const ExecutionOptions& options);
+
+        // Separates the real and imaginary parts of a bootstrapped packed
+        // ciphertext. output2 may be nullptr when only the real part is kept.
+        __host__ void unpack_real_pair(Ciphertext<Scheme::CKKS>& packed,
+                                       Ciphertext<Scheme::CKKS>& output1,
+                                       Ciphertext<Scheme::CKKS>* output2,
+                                       Galoiskey<Scheme::CKKS>& galois_key,
+                                       const ExecutionOptions& options);
+
+        __host__ void multiply_encoded_constant(
+            Ciphertext<Scheme::CKKS>& cipher, Plaintext<Scheme::CKKS>& constant,
+            const ExecutionOptions& options);
+
+        __host__ void
+        check_repack_ciphertexts(std::vector<Ciphertext<Scheme::CKKS>>& ciphers,
+                                 const std::vector<RepackPlacement>& layout,
+                                 bool packed);
+
+        // 0/1 mask of range, encoded at the scale of the prime a ciphertext at
+        // depth drops when rescaled. Masks are kept in the constant cache.
+        __host__ ConstantCache<Scheme::CKKS>::Entry
+        encode_slot_mask(const SlotRange& range, int slot_count, int depth);
+
+        // Returns cipher multiplied by mask and rescaled, at the scale of
+        // cipher.
+        __host__ Ciphertext<Scheme::CKKS>
+        multiply_slot_mask(Ciphertext<Scheme::CKKS>& cipher,
+                           Plaintext<Scheme::CKKS>& mask,
+                           const ExecutionOptions& options);
+
+        // Empty NTT domain ciphertext at depth with every field set.
+        __host__ Ciphertext<Scheme::CKKS>
+        lwe_packing_ciphertext(int depth, double scale, cudaStream_t stream);
+
+        // Merges two packed subtrees of height - 1 into one of the given
+        // height. odd may be nullptr for an empty subtree.
+        __host__ Ciphertext<Scheme::CKKS>
+        merge_packed_lwes(Ciphertext<Scheme::CKKS>& even,
+                          Ciphertext<Scheme::CKKS>* odd,
+                          DeviceVector<Data64>& monomial,
+                          Galoiskey<Scheme::CKKS>& galois_key, int height,
+                          const ExecutionOptions& options);
     };
 
     /**
@@ -2766,6 +3232,8 @@ namespace heongpu
 
         using HEOperator<Scheme::CKKS>::apply_galois;
         using HEOperator<Scheme::CKKS>::apply_galois_inplace;
+        using HEOperator<Scheme::CKKS>::constant_cache;
+        using HEOperator<Scheme::CKKS>::encoded_constant;
         using HEOperator<Scheme::CKKS>::keyswitch;
         using HEOperator<Scheme::CKKS>::mod_drop;
         using HEOperator<Scheme::CKKS>::mod_drop_inplace;
@@ -2836,21 +3304,21 @@ namespace heongpu
             const ExecutionOptions& options = ExecutionOptions());
 
         // Encoded One
-        DeviceVector<Data64> encoded_constant_one_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_one_;
 
         // Bit bootstrapping
-        DeviceVector<Data64> encoded_constant_minus_1over4_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_minus_1over4_;
 
         // Gate bootstrapping
-        DeviceVector<Data64> encoded_constant_1over3_;
-        DeviceVector<Data64> encoded_constant_2over3_;
-        DeviceVector<Data64> encoded_complex_minus_2over6j_;
-        DeviceVector<Data64> encoded_constant_minus_2over6_;
-        DeviceVector<Data64> encoded_complex_2over6j_;
-        DeviceVector<Data64> encoded_constant_2over6_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_1over3_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_2over3_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_complex_minus_2over6j_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_minus_2over6_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_complex_2over6j_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_2over6_;
         // DeviceVector<Data64> we have -> encoded_complex_minus_iscale_
-        DeviceVector<Data64> encoded_constant_pioversome_;
-        DeviceVector<Data64> encoded_constant_minus_pioversome_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_pioversome_;
+        ConstantCache<Scheme::CKKS>::Entry encoded_constant_minus_pioversome_;
     };
 
 } // namespace heongpu
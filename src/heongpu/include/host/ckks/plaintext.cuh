@@ -64,6 +64,17 @@ namespace heongpu
          */
         void store_in_host(cudaStream_t stream = cudaStreamDefault);
 
+        /**
+         * @brief Asynchronous form of store_in_host: the host copy of the
+         * plaintext is valid once the returned Completion is ready.
+         */
+        Completion store_in_host_async(cudaStream_t stream = cudaStreamDefault)
+        {
+            store_in_host(stream);
+
+            return Completion::record(stream);
+        }
+
         /**
          * @brief Checks whether the data is stored on the device (GPU) memory.
          */
@@ -120,6 +131,14 @@ namespace heongpu
          */
         inline double scale() const noexcept { return scale_; }
 
+        /**
+         * @brief Returns the number of message slots encoded in the plaintext.
+         * It is a power of two not larger than half of the ring size.
+         *
+         * @return int Number of slots.
+         */
+        inline int slot_count() const noexcept { return slot_count_; }
+
         /**
          * @brief Indicates whether the plaintext is in the NTT (Number
          * Theoretic Transform) domain.
@@ -139,6 +158,7 @@ namespace heongpu
         Plaintext(const Plaintext& copy)
             : scheme_(copy.scheme_), plain_size_(copy.plain_size_),
               depth_(copy.depth_), scale_(copy.scale_),
+              slot_count_(copy.slot_count_),
               in_ntt_domain_(copy.in_ntt_domain_),
               storage_type_(copy.storage_type_),
               plaintext_generated_(copy.plaintext_generated_)
@@ -166,6 +186,7 @@ namespace heongpu
               plain_size_(std::move(assign.plain_size_)),
               depth_(std::move(assign.depth_)),
               scale_(std::move(assign.scale_)),
+              slot_count_(std::move(assign.slot_count_)),
               in_ntt_domain_(std::move(assign.in_ntt_domain_)),
               storage_type_(std::move(assign.storage_type_)),
               plaintext_generated_(std::move(assign.plaintext_generated_)),
@@ -182,6 +203,7 @@ namespace heongpu
                 plain_size_ = copy.plain_size_;
                 depth_ = copy.depth_;
                 scale_ = copy.scale_;
+                slot_count_ = copy.slot_count_;
                 in_ntt_domain_ = copy.in_ntt_domain_;
                 storage_type_ = copy.storage_type_;
                 plaintext_generated_ = copy.plaintext_generated_;
@@ -218,6 +240,7 @@ namespace heongpu
                 plaintext_generated_ = std::move(assign.plaintext_generated_);
                 depth_ = std::move(assign.depth_);
                 scale_ = std::move(assign.scale_);
+                slot_count_ = std::move(assign.slot_count_);
                 device_locations_ = std::move(assign.device_locations_);
                 host_locations_ = std::move(assign.host_locations_);
             }
@@ -234,6 +257,7 @@ namespace heongpu
 
         int depth_;
         double scale_;
+        int slot_count_ = 0;
 
         bool in_ntt_domain_ = false;
         storage_type storage_type_;
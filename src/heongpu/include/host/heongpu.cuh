@@ -17,6 +17,19 @@
 #include "bfv/encryptor.cuh"
 #include "bfv/decryptor.cuh"
 #include "bfv/operator.cuh"
+#include "bfv/databasescan.cuh"
+
+#include "bgv/context.cuh"
+#include "bgv/secretkey.cuh"
+#include "bgv/publickey.cuh"
+#include "bgv/plaintext.cuh"
+#include "bgv/ciphertext.cuh"
+#include "bgv/evaluationkey.cuh"
+#include "bgv/encoder.cuh"
+#include "bgv/keygenerator.cuh"
+#include "bgv/encryptor.cuh"
+#include "bgv/decryptor.cuh"
+#include "bgv/operator.cuh"
 
 #include "ckks/context.cuh"
 #include "ckks/secretkey.cuh"
@@ -28,9 +41,12 @@
 #include "ckks/keygenerator.cuh"
 #include "ckks/encryptor.cuh"
 #include "ckks/decryptor.cuh"
+#include "ckks/constantcache.cuh"
 #include "ckks/operator.cuh"
+#include "ckks/graph.cuh"
 
 #include "tfhe/context.cuh"
+#include "tfhe/torusfft.cuh"
 #include "tfhe/secretkey.cuh"
 #include "tfhe/ciphertext.cuh"
 #include "tfhe/keygenerator.cuh"
@@ -15,6 +15,7 @@ namespace heongpu
         template <Scheme S> friend class HEEncryptor;
         template <Scheme S> friend class HEDecryptor;
         template <Scheme S> friend class HELogicOperator;
+        template <Scheme S> friend class HEArithmeticOperator;
 
         template <typename T, typename F>
         friend void input_storage_manager(T& object, F function,
@@ -8,6 +8,7 @@
 
 #include "util.cuh"
 #include "schemes.h"
+#include "serialformat.h"
 #include "devicevector.cuh"
 #include "hostvector.cuh"
 #include "secstdparams.h"
@@ -15,15 +16,48 @@
 #include "random.cuh"
 #include <gmp.h>
 #include "contextpool.cuh"
+#include "tfhe/torusfft.cuh"
 #include <ostream>
 #include <istream>
 
 namespace heongpu
 {
+    /**
+     * @brief Parameter set of a TFHE context.
+     *
+     * Standard deviations are given as fractions of the torus. The polynomial
+     * degree N is fixed to 1024 because the blind rotation kernels run a
+     * fixed-size NTT in shared memory; the LWE dimension n is limited to 1024
+     * by the key switching kernel. sec_level is only recorded, never checked;
+     * set it for parameter sets whose security has been estimated.
+     */
+    struct TFHEParameters
+    {
+        sec_level_type sec_level = sec_level_type::none;
+
+        int n = 512; // LWE dimension
+        int N = 1024; // degree of the TLWE polynomials
+        int k = 1; // number of polynomials in the TLWE mask
+
+        int bk_l = 2; // bootstrapping key decomposition length
+        int bk_bg_bit = 10; // log2 of the bootstrapping key base
+
+        int ks_base_bit = 2; // log2 of the key switching base
+        int ks_length = 8; // key switching decomposition length
+
+        double ks_stdev = 0.0;
+        double bk_stdev = 0.0;
+        double max_stdev = 0.0;
+
+        // Domain of the bootstrapping key and the blind rotation engine.
+        tfhe_blind_rotation_type blind_rotation = tfhe_blind_rotation_type::NTT;
+    };
+
     template <> class HEContext<Scheme::TFHE>
     {
         template <Scheme S> friend class Secretkey;
         template <Scheme S> friend class Bootstrappingkey;
+        template <Scheme S> friend class Packingkey;
         template <Scheme S> friend class Ciphertext;
         template <Scheme S> friend class HEKeyGenerator;
         template <Scheme S> friend class HEEncryptor;
@@ -31,19 +65,101 @@ namespace heongpu
         template <Scheme S> friend class HELogicOperator;
 
       public:
+        /**
+         * @brief Constructs a context with the parameters of the original
+         * TFHE context (LWE512_K1, THROUGHPUT) and its sec128 label.
+         */
         HEContext();
 
-        // HEContext() = default;
+        /**
+         * @brief Constructs a context from one of the built-in parameter
+         * sets.
+         *
+         * The built-in sets have not been run through the lattice estimator,
+         * so they claim no security level; get_sec_level() returns none.
+         *
+         * @param parameter_set LWE dimension and mask size.
+         * @param profile Bootstrapping key decomposition, BALANCED or
+         * THROUGHPUT. THROUGHPUT uses one decomposition level less with a
+         * larger base, which shortens the blind rotation at the cost of noise
+         * margin.
+         * @param blind_rotation Blind rotation engine. Bootstrapping keys
+         * generated with the context are stored in its domain.
+         */
+        HEContext(const tfhe_parameter_set parameter_set,
+                  const tfhe_decomposition_profile profile =
+                      tfhe_decomposition_profile::BALANCED,
+                  const tfhe_blind_rotation_type blind_rotation =
+                      tfhe_blind_rotation_type::NTT);
+
+        /**
+         * @brief Constructs a context from custom parameters.
+         *
+         * @param parameters Parameter set; throws std::invalid_argument if it
+         * is not supported.
+         */
+        explicit HEContext(const TFHEParameters& parameters);
+
+        /**
+         * @brief Returns the parameters of a built-in parameter set. Their
+         * sec_level is none; see the corresponding constructor.
+         */
+        static TFHEParameters
+        get_parameter_set(const tfhe_parameter_set parameter_set,
+                          const tfhe_decomposition_profile profile,
+                          const tfhe_blind_rotation_type blind_rotation =
+                              tfhe_blind_rotation_type::NTT);
+
+        /**
+         * @brief Returns the parameters of the context.
+         */
+        TFHEParameters get_parameters() const;
+
+        inline sec_level_type get_sec_level() const noexcept
+        {
+            return sec_level_;
+        }
+
+        inline tfhe_decomposition_profile
+        get_decomposition_profile() const noexcept
+        {
+            return decomposition_profile_;
+        }
+
+        inline tfhe_blind_rotation_type get_blind_rotation_type() const noexcept
+        {
+            return blind_rotation_;
+        }
+
+        /**
+         * @brief Writes the versioned header, decomposition profile and
+         * parameter set to a stream.
+         */
+        void save(std::ostream& os) const;
+
+        /**
+         * @brief Reads a parameter set written by save() and rebuilds the
+         * context with it. Keys generated with the previous parameters can
+         * not be used with the loaded context. Unversioned streams carry no
+         * blind rotation type and load as NTT.
+         */
+        void load(std::istream& is);
 
       private:
         const scheme_type scheme_ = scheme_type::tfhe;
-        const sec_level_type sec_level_ = sec_level_type::sec128;
+        sec_level_type sec_level_;
+        tfhe_decomposition_profile decomposition_profile_;
 
         Modulus64 prime_;
         std::shared_ptr<DeviceVector<Root64>> ntt_table_;
         std::shared_ptr<DeviceVector<Root64>> intt_table_;
         Ninverse64 n_inverse_;
 
+        tfhe_blind_rotation_type blind_rotation_;
+        // Built only for FFT blind rotation, null otherwise.
+        std::shared_ptr<DeviceVector<double>> fft_root_table_;
+        std::shared_ptr<DeviceVector<double>> fft_twist_table_;
+
         int ks_base_bit_;
         int ks_length_;
 
@@ -75,6 +191,10 @@ namespace heongpu
         int offset_;
 
       private:
+        void set_parameters(const TFHEParameters& parameters);
+
+        void check_parameters(const TFHEParameters& parameters) const;
+
         std::vector<int32_t> compute_h(int l, int bg_bit);
 
         int32_t compute_offset(int l, int bg_bit, int half_bg);
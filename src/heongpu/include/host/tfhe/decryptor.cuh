@@ -61,11 +61,58 @@ namespace heongpu
                 options, false);
         }
 
+        /**
+         * @brief Decrypts a TFHE ciphertext into a vector of integer messages
+         * encoded as m / (2 * message_modulus) on the torus, see the integer
+         * encrypt function of HEEncryptor.
+         *
+         * @param ciphertext Reference to the ciphertext to be decrypted.
+         * @param messages Reference to a vector that will hold the decrypted
+         * messages.
+         * @param message_modulus Size of the message space.
+         * @param options Optional execution options, including the CUDA stream
+         * to use. Defaults to `ExecutionOptions()`.
+         */
+        __host__ void
+        decrypt(Ciphertext<Scheme::TFHE>& ciphertext,
+                std::vector<uint32_t>& messages, uint32_t message_modulus,
+                const ExecutionOptions& options = ExecutionOptions())
+        {
+            if (message_modulus < 2)
+            {
+                throw std::invalid_argument("Invalid message modulus!");
+            }
+
+            input_storage_manager(
+                ciphertext,
+                [&](Ciphertext<Scheme::TFHE>& ciphertext_)
+                {
+                    std::vector<int32_t> phases =
+                        decrypt_lwe_phase(ciphertext, options.stream_);
+
+                    uint64_t phase_modulus = 2ULL * message_modulus;
+                    messages.resize(phases.size());
+                    for (size_t i = 0; i < phases.size(); i++)
+                    {
+                        uint64_t phase = static_cast<uint32_t>(phases[i]);
+                        uint64_t rounded =
+                            ((phase * phase_modulus) + (1ULL << 31)) >> 32;
+                        messages[i] = static_cast<uint32_t>(
+                            (rounded % phase_modulus) % message_modulus);
+                    }
+                },
+                options, false);
+        }
+
       private:
         __host__ void decrypt_lwe(std::vector<bool>& messages,
                                   Ciphertext<Scheme::TFHE>& ciphertext,
                                   const cudaStream_t stream);
 
+        __host__ std::vector<int32_t>
+        decrypt_lwe_phase(Ciphertext<Scheme::TFHE>& ciphertext,
+                          const cudaStream_t stream);
+
       private:
         const scheme_type scheme_ = scheme_type::tfhe;
 
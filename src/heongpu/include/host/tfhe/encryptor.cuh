@@ -77,6 +77,60 @@ namespace heongpu
                 options);
         }
 
+        /**
+         * @brief Encrypts a vector of integer messages into a TFHE ciphertext
+         * for programmable bootstrapping.
+         *
+         * Messages are in [0, message_modulus) and keep one padding bit: a
+         * message m is encoded as m / (2 * message_modulus) on the torus.
+         *
+         * @param ciphertext Output ciphertext where the encrypted result will
+         * be stored.
+         * @param messages Vector of integer messages to encrypt.
+         * @param message_modulus Size of the message space.
+         */
+        __host__ void
+        encrypt(Ciphertext<Scheme::TFHE>& ciphertext,
+                const std::vector<uint32_t>& messages,
+                uint32_t message_modulus,
+                const ExecutionOptions& options = ExecutionOptions())
+        {
+            if (message_modulus < 2)
+            {
+                throw std::invalid_argument("Invalid message modulus!");
+            }
+
+            ciphertext.shape_ = messages.size();
+
+            std::vector<int32_t> encoded_messages;
+            encoded_messages.reserve(ciphertext.shape_);
+            for (uint32_t message : messages)
+            {
+                if (message >= message_modulus)
+                {
+                    throw std::invalid_argument(
+                        "Message is out of the message space!");
+                }
+
+                encoded_messages.push_back(
+                    encode_to_torus32(message, 2 * message_modulus));
+            }
+
+            output_storage_manager(
+                ciphertext,
+                [&](Ciphertext<Scheme::TFHE>& ciphertext_)
+                {
+                    encrypt_lwe_symmetric(ciphertext, encoded_messages,
+                                          options.stream_);
+
+                    ciphertext.n_ = n_;
+                    ciphertext.alpha_min_ = alpha_min_;
+                    ciphertext.alpha_max_ = alpha_max_;
+                    ciphertext.ciphertext_generated_ = true;
+                },
+                options);
+        }
+
         __host__ ~HEEncryptor();
 
       private:
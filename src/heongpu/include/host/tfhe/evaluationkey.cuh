@@ -90,6 +90,15 @@ namespace heongpu
             return boot_key_generated_;
         }
 
+        /**
+         * @brief Returns the domain the boot key is stored in, which selects
+         * the blind rotation engine used with it.
+         */
+        inline tfhe_blind_rotation_type blind_rotation_type() const noexcept
+        {
+            return blind_rotation_;
+        }
+
         Bootstrappingkey() = default;
 
         /**
@@ -106,6 +115,7 @@ namespace heongpu
         Bootstrappingkey(const Bootstrappingkey& copy)
             : bk_k_(copy.bk_k_), bk_base_bit_(copy.bk_base_bit_),
               bk_length_(copy.bk_length_), bk_stdev_(copy.bk_stdev_),
+              blind_rotation_(copy.blind_rotation_),
               boot_key_variances_(copy.boot_key_variances_),
               ks_base_bit_(copy.ks_base_bit_), ks_length_(copy.ks_length_),
               switch_key_variances_(copy.switch_key_variances_),
@@ -186,6 +196,7 @@ namespace heongpu
               bk_base_bit_(std::move(assign.bk_base_bit_)),
               bk_length_(std::move(assign.bk_length_)),
               bk_stdev_(std::move(assign.bk_stdev_)),
+              blind_rotation_(std::move(assign.blind_rotation_)),
               boot_key_variances_(std::move(assign.boot_key_variances_)),
               ks_base_bit_(std::move(assign.ks_base_bit_)),
               ks_length_(std::move(assign.ks_length_)),
@@ -226,6 +237,7 @@ namespace heongpu
                 bk_base_bit_ = copy.bk_base_bit_;
                 bk_length_ = copy.bk_length_;
                 bk_stdev_ = copy.bk_stdev_;
+                blind_rotation_ = copy.blind_rotation_;
                 boot_key_variances_ = copy.boot_key_variances_;
                 ks_base_bit_ = copy.ks_base_bit_;
                 ks_length_ = copy.ks_length_;
@@ -314,6 +326,7 @@ namespace heongpu
                 bk_base_bit_ = std::move(assign.bk_base_bit_);
                 bk_length_ = std::move(assign.bk_length_);
                 bk_stdev_ = std::move(assign.bk_stdev_);
+                blind_rotation_ = std::move(assign.blind_rotation_);
                 boot_key_variances_ = std::move(assign.boot_key_variances_);
                 ks_base_bit_ = std::move(assign.ks_base_bit_);
                 ks_length_ = std::move(assign.ks_length_);
@@ -344,7 +357,10 @@ namespace heongpu
         int bk_base_bit_;
         int bk_length_;
         double bk_stdev_;
+        tfhe_blind_rotation_type blind_rotation_;
 
+        // NTT-domain residues, or for the FFT blind rotation the split-complex
+        // FFT values stored bit for bit as doubles.
         DeviceVector<Data64> boot_key_device_location_;
         HostVector<Data64> boot_key_host_location_;
 
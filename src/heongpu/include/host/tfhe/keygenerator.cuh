@@ -64,6 +64,9 @@ namespace heongpu
         std::shared_ptr<DeviceVector<Root64>> intt_table_;
         Ninverse64 n_inverse_;
 
+        std::shared_ptr<DeviceVector<double>> fft_root_table_;
+        std::shared_ptr<DeviceVector<double>> fft_twist_table_;
+
         int ks_base_bit_;
         int ks_length_;
 
@@ -794,6 +794,164 @@ namespace heongpu
                 options, (&input1 == &output));
         }
 
+        /**
+         * @brief Evaluates a univariate function on TFHE ciphertexts with
+         * programmable bootstrapping.
+         *
+         * The message space is [0, lut.size()) with one padding bit: a message
+         * m is encoded as m / (2 * lut.size()) on the torus, as done by the
+         * integer encrypt and decrypt functions. The lookup table is written
+         * into the test polynomial of the blind rotation, so any function
+         * costs one bootstrapping and one key switching, and the output is in
+         * the same message space.
+         *
+         * @param input Input ciphertext.
+         * @param output Output ciphertext, encrypting lut[m].
+         * @param lut Lookup table. Its size is the message modulus, a power of
+         * two not larger than N / 2.
+         * @param boot_key Bootstrapping key for the operation.
+         * @param options Optional CUDA execution settings.
+         */
+        __host__ void
+        programmable_bootstrapping(Ciphertext<Scheme::TFHE>& input,
+                                   Ciphertext<Scheme::TFHE>& output,
+                                   const std::vector<uint32_t>& lut,
+                                   Bootstrappingkey<Scheme::TFHE>& boot_key,
+                                   const ExecutionOptions& options =
+                                       ExecutionOptions())
+        {
+            if (!input.ciphertext_generated_)
+            {
+                throw std::runtime_error("Input ciphertext is not generated!");
+            }
+
+            check_lookup_table(lut);
+
+            input_storage_manager(
+                input,
+                [&](Ciphertext<Scheme::TFHE>& input_)
+                {
+                    input_storage_manager(
+                        boot_key,
+                        [&](Bootstrappingkey<Scheme::TFHE>& boot_key_)
+                        {
+                            output_storage_manager(
+                                output,
+                                [&](Ciphertext<Scheme::TFHE>& output_)
+                                {
+                                    Ciphertext<Scheme::TFHE> temp_cipher =
+                                        generate_empty_ciphertext(
+                                            (k_ * N_), input_.shape_,
+                                            options.stream_);
+
+                                    programmable_bootstrapping_computation(
+                                        input_, temp_cipher, lut, boot_key_,
+                                        options.stream_);
+
+                                    set_output_ciphertext(output_, input_,
+                                                          options.stream_);
+
+                                    key_switching(temp_cipher, output_,
+                                                  boot_key_, options.stream_);
+                                },
+                                options);
+                        },
+                        options, false);
+                },
+                options, (&input == &output));
+        }
+
+        /**
+         * @brief Evaluates several univariate functions on the same TFHE
+         * ciphertexts with a single blind rotation (multi-value programmable
+         * bootstrapping).
+         *
+         * The test polynomial of every lookup table factors into a box
+         * polynomial shared by all tables and a sparse polynomial holding the
+         * table values. Only the shared part is blind rotated; each output is
+         * then the rotated accumulator times its sparse polynomial, followed
+         * by sample extraction and key switching. The output noise grows with
+         * the norm of the table values, so small message spaces are expected.
+         *
+         * @param input Input ciphertext, encoded as for
+         * programmable_bootstrapping.
+         * @param outputs Output vector, resized to luts.size(); outputs[i]
+         * encrypts luts[i][m].
+         * @param luts Lookup tables, all of the same size.
+         * @param boot_key Bootstrapping key for the operation.
+         * @param options Optional CUDA execution settings.
+         */
+        __host__ void multi_value_bootstrapping(
+            Ciphertext<Scheme::TFHE>& input,
+            std::vector<Ciphertext<Scheme::TFHE>>& outputs,
+            const std::vector<std::vector<uint32_t>>& luts,
+            Bootstrappingkey<Scheme::TFHE>& boot_key,
+            const ExecutionOptions& options = ExecutionOptions())
+        {
+            if (!input.ciphertext_generated_)
+            {
+                throw std::runtime_error("Input ciphertext is not generated!");
+            }
+
+            if (luts.empty())
+            {
+                throw std::invalid_argument("Lookup table vector is empty!");
+            }
+
+            for (const std::vector<uint32_t>& lut : luts)
+            {
+                if (lut.size() != luts[0].size())
+                {
+                    throw std::invalid_argument(
+                        "Lookup tables should have the same size!");
+                }
+
+                check_lookup_table(lut);
+            }
+
+            input_storage_manager(
+                input,
+                [&](Ciphertext<Scheme::TFHE>& input_)
+                {
+                    input_storage_manager(
+                        boot_key,
+                        [&](Bootstrappingkey<Scheme::TFHE>& boot_key_)
+                        {
+                            std::vector<Ciphertext<Scheme::TFHE>> temp_ciphers;
+                            for (size_t i = 0; i < luts.size(); i++)
+                            {
+                                temp_ciphers.push_back(
+                                    generate_empty_ciphertext(
+                                        (k_ * N_), input_.shape_,
+                                        options.stream_));
+                            }
+
+                            multi_value_bootstrapping_computation(
+                                input_, temp_ciphers, luts, boot_key_,
+                                options.stream_);
+
+                            outputs.resize(luts.size());
+                            for (size_t i = 0; i < luts.size(); i++)
+                            {
+                                output_storage_manager(
+                                    outputs[i],
+                                    [&](Ciphertext<Scheme::TFHE>& output_)
+                                    {
+                                        set_output_ciphertext(output_, input_,
+                                                              options.stream_);
+
+                                        key_switching(temp_ciphers[i], output_,
+                                                      boot_key_,
+                                                      options.stream_);
+                                    },
+                                    options);
+                            }
+                        },
+                        options, false);
+                },
+                options, false);
+        }
+
       private:
         __host__ void NAND_pre_computation(Ciphertext<Scheme::TFHE>& input1,
                                            Ciphertext<Scheme::TFHE>& input2,
@@ -839,6 +997,43 @@ namespace heongpu
                                     Bootstrappingkey<Scheme::TFHE>& boot_key,
                                     cudaStream_t stream);
 
+        __host__ void programmable_bootstrapping_computation(
+            Ciphertext<Scheme::TFHE>& input, Ciphertext<Scheme::TFHE>& output,
+            const std::vector<uint32_t>& lut,
+            Bootstrappingkey<Scheme::TFHE>& boot_key, cudaStream_t stream);
+
+        __host__ void multi_value_bootstrapping_computation(
+            Ciphertext<Scheme::TFHE>& input,
+            std::vector<Ciphertext<Scheme::TFHE>>& outputs,
+            const std::vector<std::vector<uint32_t>>& luts,
+            Bootstrappingkey<Scheme::TFHE>& boot_key, cudaStream_t stream);
+
+        // Returns the (k + 1) * N accumulator of every input after the blind
+        // rotation of test_vector, or of the gate test polynomial if
+        // test_vector is nullptr.
+        __host__ DeviceVector<int32_t>
+        blind_rotation(Ciphertext<Scheme::TFHE>& input,
+                       Bootstrappingkey<Scheme::TFHE>& boot_key,
+                       const int32_t* test_vector, cudaStream_t stream);
+
+        // Blind rotation with a bootstrapping key in the FFT domain.
+        __host__ void
+        blind_rotation_fft(Ciphertext<Scheme::TFHE>& input,
+                           Bootstrappingkey<Scheme::TFHE>& boot_key,
+                           const int32_t* test_vector,
+                           DeviceVector<int32_t>& accumulator,
+                           cudaStream_t stream);
+
+        __host__ void check_lookup_table(const std::vector<uint32_t>& lut);
+
+        __host__ std::vector<int32_t>
+        generate_test_vector(const std::vector<uint32_t>& lut);
+
+        // Sets the metadata and the memory of a key-switched output.
+        __host__ void set_output_ciphertext(Ciphertext<Scheme::TFHE>& output,
+                                            Ciphertext<Scheme::TFHE>& input,
+                                            cudaStream_t stream);
+
         __host__ void key_switching(Ciphertext<Scheme::TFHE>& input,
                                     Ciphertext<Scheme::TFHE>& output,
                                     Bootstrappingkey<Scheme::TFHE>& boot_key,
@@ -857,6 +1052,9 @@ namespace heongpu
         std::shared_ptr<DeviceVector<Root64>> intt_table_;
         Ninverse64 n_inverse_;
 
+        std::shared_ptr<DeviceVector<double>> fft_root_table_;
+        std::shared_ptr<DeviceVector<double>> fft_twist_table_;
+
         int ks_base_bit_;
         int ks_length_;
 
@@ -0,0 +1,96 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_TFHE_TORUSFFT_H
+#define HEONGPU_TFHE_TORUSFFT_H
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+namespace heongpu
+{
+    /**
+     * @brief Host implementation of the negacyclic FFT used by the FFT blind
+     * rotation.
+     *
+     * A real polynomial a of degree N in R[X]/(X^N + 1) is folded into the
+     * N/2 complex values (a_j + i * a_{j + N/2}) * psi^j with
+     * psi = exp(i * pi / N), and transformed with a size N/2 FFT. The result
+     * holds a evaluated at the N/2 roots of X^N + 1 whose N/2-th power is i,
+     * in bit-reversed order; the remaining evaluations are their conjugates.
+     * Products in this domain are pointwise.
+     *
+     * The twiddle tables are shared with the device kernels, so host and
+     * device transforms are computed with the same values and in the same
+     * order.
+     */
+    class TorusFFT
+    {
+      public:
+        /**
+         * @brief Creates the tables for polynomials of degree N.
+         *
+         * @param N Polynomial degree, a power of two and at least 4.
+         */
+        explicit TorusFFT(int N);
+
+        /**
+         * @brief Forward transform of a torus polynomial.
+         *
+         * @param input N coefficients, interpreted as signed integers.
+         * @param output N/2 complex values in bit-reversed order.
+         */
+        void forward(const std::vector<int32_t>& input,
+                     std::vector<std::complex<double>>& output) const;
+
+        /**
+         * @brief Inverse transform, rounding every coefficient to the nearest
+         * integer modulo 2^32.
+         *
+         * @param input N/2 complex values in bit-reversed order.
+         * @param output N coefficients.
+         */
+        void inverse(const std::vector<std::complex<double>>& input,
+                     std::vector<int32_t>& output) const;
+
+        /**
+         * @brief Negacyclic product modulo 2^32 through the FFT.
+         *
+         * The product is exact as long as every coefficient of the
+         * unreduced result stays below 2^52 in magnitude, e.g. when one
+         * operand is a gadget decomposition with small digits.
+         */
+        std::vector<int32_t> multiply(const std::vector<int32_t>& input1,
+                                      const std::vector<int32_t>& input2) const;
+
+        /**
+         * @brief Roots exp(2 * pi * i * j / (N/2)) for j < N/4; real parts
+         * followed by imaginary parts.
+         */
+        inline const std::vector<double>& root_table() const noexcept
+        {
+            return root_table_;
+        }
+
+        /**
+         * @brief Twisting factors psi^j for j < N/2; real parts followed by
+         * imaginary parts.
+         */
+        inline const std::vector<double>& twist_table() const noexcept
+        {
+            return twist_table_;
+        }
+
+      private:
+        int N_;
+        int M_; // N / 2 complex points
+
+        std::vector<double> root_table_;
+        std::vector<double> twist_table_;
+    };
+
+} // namespace heongpu
+#endif // HEONGPU_TFHE_TORUSFFT_H
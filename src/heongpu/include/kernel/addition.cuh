@@ -50,6 +50,18 @@ namespace heongpu
         Modulus64 plain_mod, Data64 Q_mod_t, Data64 upper_threshold,
         Data64* coeffdiv_plain, int n_power);
 
+    // Homomorphic Plaintext Addition Kernel(BGV)
+    __global__ void addition_plain_bgv_poly(
+        Data64* cipher, Data64* plain, Data64* output, Modulus64* modulus,
+        Modulus64 plain_mod, Data64 correction, Data64 upper_threshold,
+        Data64* upper_halfincrement, int n_power);
+
+    // Homomorphic Plaintext Substraction Kernel(BGV)
+    __global__ void substraction_plain_bgv_poly(
+        Data64* cipher, Data64* plain, Data64* output, Modulus64* modulus,
+        Modulus64 plain_mod, Data64 correction, Data64 upper_threshold,
+        Data64* upper_halfincrement, int n_power);
+
     // Homomorphic Plaintext Addition Kernel(CKKS)
     __global__ void addition_plain_ckks_poly(Data64* in1, Data64* in2,
                                              Data64* out, Modulus64* modulus,
@@ -10,6 +10,7 @@
 #include "modular_arith.cuh"
 #include "complex.cuh"
 #include "small_ntt.cuh"
+#include "small_fft.cuh"
 
 namespace heongpu
 {
@@ -160,11 +161,18 @@ namespace heongpu
        bk_half, int n, int N, int N_power, int k, int bk_bit, int bk_length);
     */
 
+    // Coefficient index of X^rotation * v, where v is test_vector, or the
+    // constant polynomial encoded if test_vector is nullptr.
+    __device__ int32_t tfhe_rotated_test_vector(const int32_t* test_vector,
+                                                int32_t encoded, int index,
+                                                int rotation, int N);
+
     __global__ void tfhe_bootstrapping_kernel_unique_step1(
         const int32_t* input_a, const int32_t* input_b, Data64* output,
         const Data64* boot_key,
         const Root64* __restrict__ forward_root_of_unity_table,
-        const Modulus64 modulus, const int32_t encoded, const int32_t bk_offset,
+        const Modulus64 modulus, const int32_t encoded,
+        const int32_t* test_vector, const int32_t bk_offset,
         const int32_t bk_mask, const int32_t bk_half, int n, int N, int N_power,
         int k, int bk_bit, int bk_length);
 
@@ -180,7 +188,8 @@ namespace heongpu
         const Data64* input, const int32_t* input_b, int32_t* output,
         const Root64* __restrict__ inverse_root_of_unity_table,
         const Ninverse64 n_inverse, const Modulus64 modulus,
-        const int32_t encoded, int n, int N, int N_power, int k, int bk_length);
+        const int32_t encoded, const int32_t* test_vector, int n, int N,
+        int N_power, int k, int bk_length);
 
     __global__ void tfhe_bootstrapping_kernel_regular_step2(
         const Data64* input, int32_t* output,
@@ -188,16 +197,91 @@ namespace heongpu
         const Ninverse64 n_inverse, const Modulus64 modulus, int n, int N,
         int k, int bk_length);
 
+    // (X^rotation - 1) * polynomial at coefficients threadIdx.x and
+    // threadIdx.x + blockDim.x, rotation in [0, 2N].
+    __device__ int32_t2 tfhe_rotation_difference(const uint32_t* polynomial,
+                                                 int rotation, int N);
+
+    // FFT blind rotation. Same data flow and memory layout as the NTT
+    // kernels above, with every NTT-domain polynomial replaced by N/2
+    // split-complex FFT values (N/2 real parts followed by N/2 imaginary
+    // parts).
+    __global__ void tfhe_bootstrapping_fft_kernel_unique_step1(
+        const int32_t* input_a, const int32_t* input_b, double* output,
+        const double* boot_key, const double* fft_root_table,
+        const double* fft_twist_table, const int32_t encoded,
+        const int32_t* test_vector, const int32_t bk_offset,
+        const int32_t bk_mask, const int32_t bk_half, int n, int N, int N_power,
+        int k, int bk_bit, int bk_length);
+
+    __global__ void tfhe_bootstrapping_fft_kernel_regular_step1(
+        const int32_t* input_a, const int32_t* input_c, double* output,
+        const double* boot_key, int boot_index, const double* fft_root_table,
+        const double* fft_twist_table, const int32_t bk_offset,
+        const int32_t bk_mask, const int32_t bk_half, int n, int N, int N_power,
+        int k, int bk_bit, int bk_length);
+
+    __global__ void tfhe_bootstrapping_fft_kernel_unique_step2(
+        const double* input, const int32_t* input_b, int32_t* output,
+        const double* fft_root_table, const double* fft_twist_table,
+        const int32_t encoded, const int32_t* test_vector, int N, int N_power,
+        int k, int bk_length);
+
+    __global__ void tfhe_bootstrapping_fft_kernel_regular_step2(
+        const double* input, int32_t* output, const double* fft_root_table,
+        const double* fft_twist_table, int N, int k, int bk_length);
+
     __global__ void tfhe_sample_extraction_kernel(const int32_t* input,
                                                   int32_t* output_a,
                                                   int32_t* output_b, int N,
                                                   int k, int index);
 
+    // Multiplies blind-rotated accumulators by sum_m lut[m] * X^(m * N /
+    // lut_size), one lookup table per blockIdx.z.
+    __global__ void tfhe_lut_multiplication_kernel(const int32_t* input,
+                                                   int32_t* output,
+                                                   const int32_t* lut,
+                                                   int lut_size, int shape,
+                                                   int N, int k);
+
     __global__ void tfhe_key_switching_kernel(
         const int32_t* input_a, const int32_t* input_b, int32_t* output_a,
         int32_t* output_b, const int32_t* ks_key_a, const int32_t* ks_key_b,
         int ks_base_bit_, int ks_length_, int n, int N, int k);
 
+    ///////////////////////////////////////////////////////
+    // LWE packing
+
+    // Turns LWE sample lwe_index into an RLWE ciphertext in coefficient form
+    // whose phase has round(phase * Q / 2^32) / N as its constant term.
+    // lift_factors holds floor(Q / 2^32) / N and 1 / N for every prime and
+    // torus_remainder is Q mod 2^32.
+    __global__ void tfhe_lwe_to_rlwe_kernel(
+        const int32_t* input_a, const int32_t* input_b, Data64* output,
+        Modulus64* modulus, const Data64* lift_factors, Data64 torus_remainder,
+        int lwe_index, int lwe_n, int n_power, int rns_mod_count);
+
+    // sum = even + monomial * odd, difference = even - monomial * odd, in NTT
+    // domain.
+    __global__ void lwe_packing_butterfly_kernel(
+        const Data64* even, const Data64* odd, const Data64* monomial,
+        Data64* sum, Data64* difference, Modulus64* modulus, int n_power,
+        int rns_mod_count);
+
+    // Maps both polynomials of an RLWE ciphertext from Z_Q to the torus with
+    // the CRT. crt_inverse holds ((Q / q_i) mod q_i)^-1. Output is TFHE
+    // layout: a = -c1 followed by b = c0.
+    __global__ void rlwe_to_torus_kernel(const Data64* input, int32_t* output,
+                                         Modulus64* modulus,
+                                         const Data64* crt_inverse,
+                                         int n_power, int rns_mod_count);
+
+    // Extracts the coefficients blockIdx.x * stride as LWE samples of
+    // dimension N.
+    __global__ void tfhe_strided_sample_extraction_kernel(
+        const int32_t* input, int32_t* output_a, int32_t* output_b, int N,
+        int stride);
+
 } // namespace heongpu
 
 #endif // HEONGPU_BOOTSTRAPPING_H
\ No newline at end of file
@@ -59,12 +59,66 @@ namespace heongpu
                                            Modulus64* modulus, int n_power,
                                            int decomp_mod_count);
 
+    // Adds the residue mt of a summed BFV partial decryption to the plain
+    // modulus and gamma sums of the fusion.
+    __device__ void decryption_fusion_bfv_accumulate(
+        Data64 mt, Modulus64 modulus, Modulus64 plain_mod, Modulus64 gamma,
+        Data64 Qi_t, Data64 Qi_gamma, Data64 Qi_inverse, Data64& sum_t,
+        Data64& sum_gamma);
+
+    // Rounds the accumulated sums of one coefficient to the plaintext.
+    __device__ Data64 decryption_fusion_bfv_round(
+        Data64 sum_t, Data64 sum_gamma, Modulus64 plain_mod, Modulus64 gamma,
+        Data64 mulq_inv_t, Data64 mulq_inv_gamma, Data64 inv_gamma);
+
     __global__ void decryption_fusion_bfv_kernel(
         Data64* ct, Data64* plain, Modulus64* modulus, Modulus64 plain_mod,
         Modulus64 gamma, Data64* Qi_t, Data64* Qi_gamma, Data64* Qi_inverse,
         Data64 mulq_inv_t, Data64 mulq_inv_gamma, Data64 inv_gamma, int n_power,
         int decomp_mod_count);
 
+    // Batched BFV multiparty decryption: blockIdx.z selects the ciphertext.
+    // ct1 holds the NTT form of every ciphertext's second polynomial back to
+    // back and is multiplied by sk in place.
+    __global__ void sk_multiplication_bfv_batch_kernel(Data64* ct1, Data64* sk,
+                                                       Modulus64* modulus,
+                                                       int n_power,
+                                                       int decomp_mod_count);
+
+    // Writes (ct0, ct1 * sk + e) of every ciphertext; ct1_sk and error_poly
+    // are in coefficient form and laid out like the input of
+    // sk_multiplication_bfv_batch_kernel.
+    __global__ void partial_decrypt_bfv_batch_kernel(
+        Data64** ciphertexts, Data64** partial_ciphertexts, Data64* ct1_sk,
+        Data64* error_poly, Modulus64* modulus, int n_power,
+        int decomp_mod_count);
+
+    // partial_ciphertexts holds party_count pointers per ciphertext. The
+    // shares are summed and scaled to the plaintext in one pass.
+    __global__ void decrypt_fusion_bfv_batch_kernel(
+        Data64** partial_ciphertexts, Data64** plaintexts, Modulus64* modulus,
+        Modulus64 plain_mod, Modulus64 gamma, Data64* Qi_t, Data64* Qi_gamma,
+        Data64* Qi_inverse, Data64 mulq_inv_t, Data64 mulq_inv_gamma,
+        Data64 inv_gamma, int n_power, int decomp_mod_count, int party_count);
+
+    // Batched multiparty decryption: blockIdx.z selects the ciphertext.
+    __global__ void partial_decrypt_ckks_batch_kernel(
+        Data64** ciphertexts, Data64** partial_ciphertexts, Data64* sk,
+        Data64* error_poly, Modulus64* modulus, int n_power,
+        int decomp_mod_count);
+
+    // partial_ciphertexts holds party_count pointers per ciphertext.
+    __global__ void decrypt_fusion_ckks_batch_kernel(
+        Data64** partial_ciphertexts, Data64** plaintexts, Modulus64* modulus,
+        int n_power, int decomp_mod_count, int party_count);
+
+    // BGV decryption on a single limb: centers c0 + c1 * s modulo q0, reduces
+    // it modulo t and removes the correction factor of the ciphertext.
+    __global__ void decryption_bgv_kernel(Data64* ct0, Data64* ct1s,
+                                          Data64* plain, Modulus64* modulus,
+                                          Modulus64 plain_mod,
+                                          Data64 correction_inv, int n_power);
+
     //////////////////////////////////////////////////////////////////////////////////
     //////////////////////////////////////////////////////////////////////////////////
     //////////////////////////////////////////////////////////////////////////////////
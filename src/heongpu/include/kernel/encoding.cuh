@@ -34,17 +34,21 @@ namespace heongpu
 
     __global__ void complex_to_double_kernel(Complex64* input, double* output);
 
+    // Slot idx of the (slot_count = n >> (log_gap + 1)) slot message lives in
+    // coefficients (idx << log_gap) and (idx << log_gap) + n / 2. log_gap is
+    // zero for fully packed plaintexts; for sparse ones the remaining
+    // coefficients have to be zero.
     __global__ void
     encode_kernel_ckks_conversion(Data64* plaintext, Complex64* complex_message,
                                   Modulus64* modulus, int coeff_modulus_count,
                                   double two_pow_64, int* reverse_order,
-                                  int n_power);
+                                  int log_gap, int n_power);
 
     __global__ void encode_kernel_compose(
         Complex64* complex_message, Data64* plaintext, Modulus64* modulus,
         Data64* Mi_inv, Data64* Mi, Data64* upper_half_threshold,
         Data64* decryption_modulus, int coeff_modulus_count, double scale,
-        double two_pow_64, int* reverse_order, int n_power);
+        double two_pow_64, int* reverse_order, int log_gap, int n_power);
 
 } // namespace heongpu
 #endif // HEONGPU_ENCODING_H
\ No newline at end of file
@@ -37,6 +37,36 @@ namespace heongpu
                                               Data64* plaintext,
                                               Modulus64* modulus, int n_power);
 
+    // Batch encryption. blockIdx.z = 2 * i + c addresses component c of the
+    // i-th encryption; u, e and pk_u hold the encryptions back to back.
+    __global__ void pk_u_batch_kernel(Data64* pk, Data64* u, Data64* pk_u,
+                                      Modulus64* modulus, int n_power,
+                                      int rns_mod_count);
+
+    __global__ void enc_div_lastq_bfv_batch_kernel(
+        Data64* pk, Data64* e, Data64** plain, Data64** ct, Modulus64* modulus,
+        Data64* half, Data64* half_mod, Data64* last_q_modinv,
+        Modulus64 plain_mod, Data64 Q_mod_t, Data64 upper_threshold,
+        Data64* coeffdiv_plain, int n_power, int Q_prime_size, int Q_size,
+        int P_size);
+
+    // Adds plaintext i to the first component of the i-th encryption in
+    // ciphertext and writes both components to output[i].
+    __global__ void cipher_message_add_batch_kernel(Data64* ciphertext,
+                                                    Data64** plaintext,
+                                                    Data64** output,
+                                                    Modulus64* modulus,
+                                                    int n_power, int Q_size);
+
+    // BGV encryption: adds t * e to pk * u, divides the result by P keeping it
+    // unchanged modulo t, and adds the centered plaintext to the first
+    // component.
+    __global__ void enc_div_lastq_bgv_kernel(
+        Data64* pk, Data64* e, Data64* plain, Data64* ct, Modulus64* modulus,
+        Data64* last_q_modinv, Data64 plain_mod, Data64 plain_inv,
+        Data64 upper_threshold, Data64* upper_halfincrement, int n_power,
+        int Q_prime_size, int Q_size);
+
     //////////////////////////////////////////////////////////////////////////////////
     //////////////////////////////////////////////////////////////////////////////////
     //////////////////////////////////////////////////////////////////////////////////
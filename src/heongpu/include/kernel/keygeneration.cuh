@@ -12,6 +12,7 @@
 #include "modular_arith.cuh"
 #include "util.cuh"
 #include "small_ntt.cuh"
+#include "small_fft.cuh"
 
 namespace heongpu
 {
@@ -37,10 +38,13 @@ namespace heongpu
 
     // Relinearization Key Generation
 
+    // Only the leading decomp_mod_count decomposition blocks are generated, so
+    // a level-trimmed key is written at its stored size.
     __global__ void relinkey_gen_kernel(Data64* relin_key, Data64* secret_key,
                                         Data64* error_poly, Data64* a_poly,
                                         Modulus64* modulus, Data64* factor,
-                                        int n_power, int rns_mod_count);
+                                        int n_power, int rns_mod_count,
+                                        int decomp_mod_count);
 
     __global__ void multi_party_relinkey_piece_method_I_stage_I_kernel(
         Data64* rk, Data64* sk, Data64* a, Data64* u, Data64* e0, Data64* e1,
@@ -107,6 +111,15 @@ namespace heongpu
                                          int galois_elt, int n_power,
                                          int rns_mod_count);
 
+    // Batched galoiskey_gen_kernel. blockIdx.z selects the key: it is written
+    // to galois_keys[z] with galois_elts[z], and its error and a polynomials
+    // start at z * decomp_mod_count * rns_mod_count * n. Only the leading
+    // decomp_mod_count decomposition blocks are generated.
+    __global__ void galoiskey_gen_batch_kernel(
+        Data64** galois_keys, Data64* secret_key, Data64* error_poly,
+        Data64* a_poly, Modulus64* modulus, Data64* factor, int* galois_elts,
+        int n_power, int rns_mod_count, int decomp_mod_count);
+
     __global__ void galoiskey_gen_II_kernel(
         Data64* galois_key_temp, Data64* secret_key, Data64* error_poly,
         Data64* a_poly, Modulus64* modulus, Data64* factor, int galois_elt,
@@ -116,6 +129,19 @@ namespace heongpu
         Data64* gk_1, Data64* gk_2, Modulus64* modulus, int n_power,
         int rns_mod_count, int decomp_mod_count, bool first);
 
+    // Pairwise tree reduction of multiparty key pieces. Each z-block adds
+    // input[left + stride] to input[left] and writes output[left], where
+    // left = 2 * stride * blockIdx.z. The second component is summed only
+    // when reduce_second is set, otherwise it is taken from input[left].
+    __global__ void multi_party_key_tree_reduction_kernel(
+        Data64** input, Data64** output, Modulus64* modulus, int n_power,
+        int rns_mod_count, int decomp_mod_count, int stride, int count,
+        bool reduce_second);
+
+    // Narrows size key limbs to 32 bits. The moduli have to be below 2^32.
+    __global__ void compact_key_limbs_kernel(Data64* input, Data32* output,
+                                             Data64 size);
+
     // Switch Key Generation
 
     __global__ void switchkey_gen_kernel(Data64* switch_key,
@@ -158,6 +184,12 @@ namespace heongpu
         const Root64* __restrict__ forward_root_of_unity_table,
         const Modulus64 modulus, int N);
 
+    // Centered lift of a secret key given modulo one prime, e.g. the
+    // coefficients of a CKKS secret key for a TFHE key switching key.
+    __global__ void tfhe_convert_rlwekey_from_rns_kernel(
+        int32_t* key_out, const Data64* key_in, const Modulus64* modulus,
+        int N);
+
     __global__ void tfhe_generate_bootkey_kernel(
         const Data64* sk_rlwe, const int32_t* sk_lwe, int32_t* boot_key,
         const Root64* __restrict__ forward_root_of_unity_table,
@@ -170,5 +202,10 @@ namespace heongpu
         const Root64* __restrict__ forward_root_of_unity_table,
         const Modulus64 modulus, int N, int k, int bk_length);
 
+    // Bootstrapping key in the split-complex FFT domain of SmallForwardFFT.
+    __global__ void tfhe_convert_bootkey_fft_domain_kernel(
+        double* key_out, const int32_t* key_in, const double* fft_root_table,
+        const double* fft_twist_table, int N, int k, int bk_length);
+
 } // namespace heongpu
 #endif // HEONGPU_KEYGENERATION_H
\ No newline at end of file
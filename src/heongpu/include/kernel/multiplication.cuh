@@ -55,5 +55,13 @@ namespace heongpu
         int iteration_count, int current_decomp_count, int first_decomp_count,
         int n_power);
 
+    // Multiplies every polynomial by an integer scalar. blockIdx.y selects the
+    // RNS modulus and blockIdx.z the polynomial.
+    __global__ void cipher_scalar_multiplication_kernel(Data64* input,
+                                                        Data64 scalar,
+                                                        Data64* output,
+                                                        Modulus64* modulus,
+                                                        int n_power);
+
 } // namespace heongpu
 #endif // HEONGPU_MULTIPLICATION_H
\ No newline at end of file
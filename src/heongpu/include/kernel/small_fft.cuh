@@ -0,0 +1,36 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_SMALLFFT_H
+#define HEONGPU_SMALLFFT_H
+
+#include <cuda_runtime.h>
+
+namespace heongpu
+{
+    /**
+     * @brief Negacyclic forward FFT of a degree 1024 polynomial in shared
+     * memory, matching TorusFFT::forward. Runs with 512 threads.
+     *
+     * On entry real_in_shared[j] and imag_in_shared[j] hold coefficients j and
+     * j + 512. On exit they hold the 512 evaluations in bit-reversed order.
+     */
+    __device__ void SmallForwardFFT(double* real_in_shared,
+                                    double* imag_in_shared,
+                                    const double* root_table,
+                                    const double* twist_table);
+
+    /**
+     * @brief Inverse of SmallForwardFFT, including the 1/512 scaling. On exit
+     * real_in_shared[j] and imag_in_shared[j] hold coefficients j and j + 512.
+     */
+    __device__ void SmallInverseFFT(double* real_in_shared,
+                                    double* imag_in_shared,
+                                    const double* root_table,
+                                    const double* twist_table);
+
+} // namespace heongpu
+
+#endif // HEONGPU_SMALLFFT_H
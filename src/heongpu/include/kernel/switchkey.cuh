@@ -30,8 +30,11 @@ namespace heongpu
                                          Data64* output, Modulus64* modulus,
                                          int n_power, int Q_tilda_size, int d);
 
+    // T is the limb type the key is stored with; Data32 keys hold limbs of
+    // moduli below 2^32.
+    template <typename T>
     __global__ void multiply_accumulate_leveled_kernel(
-        Data64* input, Data64* relinkey, Data64* output, Modulus64* modulus,
+        Data64* input, T* relinkey, Data64* output, Modulus64* modulus,
         int first_rns_mod_count, int current_decomp_mod_count, int n_power);
 
     __global__ void multiply_accumulate_leveled_method_II_kernel(
@@ -185,6 +188,63 @@ namespace heongpu
         Data64* half, Data64* half_mod, Data64* last_q_modinv, int galois_elt,
         int n_power, int Q_prime_size, int Q_size, int P_size);
 
+    // Batched automorphisms for BFV query expansion: blockIdx.z runs over the
+    // ciphertexts (or ciphertext polynomials) of one expansion level.
+    __global__ void cipher_broadcast_batch_kernel(Data64* input, Data64* output,
+                                                  Modulus64* modulus,
+                                                  int n_power, int Q_size,
+                                                  int rns_mod_count);
+
+    __global__ void multiply_accumulate_batch_kernel(Data64* input,
+                                                     Data64* relinkey,
+                                                     Data64* output,
+                                                     Modulus64* modulus,
+                                                     int n_power,
+                                                     int decomp_mod_count);
+
+    __global__ void divide_round_lastq_permute_add_bfv_kernel(
+        Data64* input, Data64* ct, Data64* output, Modulus64* modulus,
+        Data64* half, Data64* half_mod, Data64* last_q_modinv, int galois_elt,
+        int n_power, int Q_prime_size, int Q_size, int P_size);
+
+    // BGV modulus switching and key switching. Dividing a BGV polynomial by
+    // its last modulus has to keep it unchanged modulo the plaintext modulus
+    // t: the polynomial is first made divisible by subtracting t * w, where w
+    // is the centered value of (last limb) * t^-1 modulo the last modulus.
+    // bgv_divisibility_correction returns t * w modulo modulus.
+    __device__ Data64 bgv_divisibility_correction(Data64 last_ct,
+                                                  Modulus64 last_modulus,
+                                                  Data64 plain_inv,
+                                                  Data64 plain_mod,
+                                                  Modulus64 modulus);
+
+    // Drops the last of the current_decomp_count limbs of every polynomial.
+    // blockIdx.y selects one of the remaining limbs, blockIdx.z the
+    // polynomial.
+    __global__ void bgv_mod_switch_kernel(Data64* input, Data64* output,
+                                          Modulus64* modulus,
+                                          Data64* last_q_modinv,
+                                          Data64 plain_inv, Data64 plain_mod,
+                                          int n_power,
+                                          int current_decomp_count);
+
+    // Divides the key switching result (current_decomp_count limbs and the P
+    // limb per polynomial) by P and adds it to the first two polynomials of
+    // ct.
+    __global__ void bgv_divide_lastq_kernel(
+        Data64* input, Data64* ct, Data64* output, Modulus64* modulus,
+        Data64* last_q_modinv, Data64 plain_inv, Data64 plain_mod, int n_power,
+        int current_decomp_count, int first_decomp_count);
+
+    // bgv_divide_lastq_kernel for rotations: the key switched second
+    // polynomial replaces the one of ct and the result is permuted by
+    // galois_elt.
+    __global__ void bgv_divide_lastq_permute_kernel(
+        Data64* input, Data64* ct, Data64* output, Modulus64* modulus,
+        Data64* last_q_modinv, Data64 plain_inv, Data64 plain_mod,
+        int galois_elt, int n_power, int current_decomp_count,
+        int first_decomp_count);
+
     ///////////////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,107 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_COMPLETION_H
+#define HEONGPU_COMPLETION_H
+
+#include "common.cuh"
+#include "storagemanager.cuh"
+#include <functional>
+#include <future>
+#include <memory>
+#include <utility>
+
+namespace heongpu
+{
+    /**
+     * @brief Completion is a handle to the work enqueued on a CUDA stream up
+     * to the point the handle was recorded.
+     *
+     * Every operation of the library is asynchronous with respect to the host:
+     * it only enqueues kernels and copies on the stream of its
+     * ExecutionOptions. A Completion records a CUDA event behind that work, so
+     * the host can poll it, block on it, make another stream wait for it, or
+     * attach a continuation, without synchronizing the whole stream or device.
+     * Copies into HostVector (pinned) memory are complete, and their contents
+     * valid, once the Completion recorded after them is ready.
+     *
+     * Handles are cheap to copy; copies share the same event. A default
+     * constructed Completion is already complete.
+     */
+    class Completion
+    {
+      public:
+        /**
+         * @brief Returns a handle for all work enqueued so far on stream.
+         *
+         * @param stream The CUDA stream to record.
+         */
+        static Completion record(cudaStream_t stream);
+
+        Completion() = default;
+
+        /**
+         * @brief Returns true if the recorded work has finished. Never blocks.
+         */
+        bool ready() const;
+
+        /**
+         * @brief Blocks the calling host thread until the recorded work has
+         * finished. The thread sleeps instead of spinning.
+         */
+        void wait() const;
+
+        /**
+         * @brief Makes all work enqueued later on stream wait for the
+         * recorded work, without blocking the host.
+         *
+         * @param stream The CUDA stream that waits.
+         */
+        void wait_on(cudaStream_t stream) const;
+
+        /**
+         * @brief Runs callback on the host once the recorded work has
+         * finished.
+         *
+         * Continuations run in order on a single library thread, so they may
+         * call the library and the CUDA API, and they never stall a stream.
+         * Callbacks should return quickly; long running work belongs on the
+         * caller's own threads.
+         *
+         * @param callback Function to run.
+         * @return std::future<void> Becomes ready after the callback returns
+         * and rethrows the exception of the callback, if any.
+         */
+        std::future<void> then(std::function<void()> callback) const;
+
+      private:
+        struct State;
+
+        std::shared_ptr<State> state_;
+    };
+
+    /**
+     * @brief Runs work, which enqueues operations on options.stream_, and
+     * returns the Completion of that work.
+     *
+     * @code
+     * Completion done = launch_async(options, [&]()
+     *     { operators.multiply(c1, c2, c3, options); });
+     * @endcode
+     *
+     * @param options Execution options whose stream the work uses.
+     * @param work Callable that enqueues the operations.
+     * @return Completion Handle of everything work enqueued.
+     */
+    template <typename F>
+    Completion launch_async(const ExecutionOptions& options, F&& work)
+    {
+        std::forward<F>(work)();
+
+        return Completion::record(options.stream_);
+    }
+
+} // namespace heongpu
+#endif // HEONGPU_COMPLETION_H
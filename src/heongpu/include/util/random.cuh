@@ -49,6 +49,20 @@ namespace heongpu
         }
     };
 
+    /**
+     * @brief RandomNumberGenerator provides the DRBG used for encryption and
+     * key generation.
+     *
+     * initialize() sets the master seed once per process. The master seed is
+     * never used to generate numbers directly: every host thread that
+     * requests random numbers gets its own DRBG, instantiated on first use
+     * with a key and nonce derived from the master seed by HMAC-SHA256 over a
+     * unique instance counter, and released when the thread exits.
+     * Concurrent encryptions and key generations from different threads
+     * therefore never share DRBG state, and set() reseeds only the calling
+     * thread's DRBG. The stream arguments only select where the generation
+     * kernels run.
+     */
     class RandomNumberGenerator
     {
       public:
@@ -705,9 +719,24 @@ namespace heongpu
         RandomNumberGenerator(const RandomNumberGenerator&) = delete;
         RandomNumberGenerator& operator=(const RandomNumberGenerator&) = delete;
 
-        static std::shared_ptr<rngongpu::RNG<rngongpu::Mode::AES>> generator_;
+        using DRBG = rngongpu::RNG<rngongpu::Mode::AES>;
+
+        /**
+         * @brief Returns the DRBG of the calling thread, instantiating it from
+         * the master seed on first use.
+         */
+        DRBG* generator();
+
         static bool initialized_;
         static std::mutex mutex_;
+
+        // Master seed, only used to derive the per-thread DRBG seeds.
+        static std::vector<unsigned char> master_key_;
+        static std::vector<unsigned char> master_nonce_;
+        static std::vector<unsigned char> master_personalization_string_;
+        static rngongpu::SecurityLevel security_level_;
+        static bool prediction_resistance_enabled_;
+        static Data64 instance_count_;
     };
 
 } // namespace heongpu
@@ -0,0 +1,103 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_ROTATION_PLANNER_H
+#define HEONGPU_ROTATION_PLANNER_H
+
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace heongpu
+{
+    /**
+     * @brief Returns the non-adjacent form (NAF) of value as a list of signed
+     * powers of two, e.g. 255 -> {-1, 256}.
+     *
+     * The NAF has the minimal number of non-zero signed binary digits, so it
+     * needs at most as many rotation steps as the plain binary decomposition
+     * and usually fewer (255 needs 2 steps instead of 8).
+     */
+    std::vector<int> naf_decomposition(int value);
+
+    /**
+     * @brief Decomposes a slot rotation into the shortest sequence of
+     * rotations for which keys are available.
+     *
+     * Rotations are cyclic in slot_count, so a rotation by shift is the same
+     * as a rotation by shift - slot_count. Both signed-digit representations
+     * are tried first; a breadth-first search over the rotation group then
+     * looks for a shorter composition that reuses composite keys (e.g. a
+     * dedicated key for 96 when the workload rotates by 97).
+     *
+     * @param shift Requested rotation.
+     * @param available_shifts Rotations for which a Galois key exists.
+     * @param slot_count Number of slots the rotation acts on (n / 2).
+     * @return Rotations taken from available_shifts whose sum equals shift
+     * modulo slot_count. Empty if shift is a multiple of slot_count.
+     * @throws std::logic_error if shift cannot be composed from the available
+     * rotations.
+     */
+    std::vector<int>
+    plan_rotation_steps(int shift, const std::vector<int>& available_shifts,
+                        int slot_count);
+
+    /**
+     * @brief Memoizes plan_rotation_steps for one fixed set of available
+     * rotations.
+     *
+     * The breadth-first search of plan_rotation_steps allocates and visits up
+     * to slot_count nodes, which costs more than the key-switches it plans on
+     * large rings. Every Galois key owns a cache, so a shift is only planned
+     * the first time it is requested. Lookups are thread-safe.
+     */
+    class RotationPlanCache
+    {
+      public:
+        /**
+         * @brief Returns the planned steps for shift, computing them with
+         * plan_rotation_steps on the first request.
+         *
+         * @param shift Requested rotation.
+         * @param available_shifts Rotations for which a Galois key exists.
+         * Must be the same set on every call.
+         * @param slot_count Number of slots the rotation acts on (n / 2).
+         */
+        std::vector<int> plan(int shift,
+                              const std::vector<int>& available_shifts,
+                              int slot_count);
+
+      private:
+        std::mutex mutex_;
+        std::unordered_map<int, std::vector<int>> plans_;
+    };
+
+    /**
+     * @brief Chooses which rotation keys to generate for a workload.
+     *
+     * If the budget allows, every distinct rotation gets a dedicated key.
+     * Otherwise the selection starts from the signed-digit (NAF) powers of two
+     * the workload needs (or, if those do not fit, from the smallest power of
+     * two dividing every rotation) and greedily adds the power of two or
+     * workload rotation that saves the most key-switches, weighted by how
+     * often each rotation appears. Keys that no rotation ends up using are
+     * dropped.
+     *
+     * @param rotations Rotations used by the workload. Repeated entries give
+     * a rotation more weight.
+     * @param slot_count Number of slots the rotation acts on (n / 2).
+     * @param max_key_count Maximum number of rotation keys to generate.
+     * @return Rotations to generate keys for.
+     * @throws std::invalid_argument if max_key_count is zero while the
+     * workload contains a non-trivial rotation.
+     */
+    std::vector<int> select_rotation_keys(const std::vector<int>& rotations,
+                                          int slot_count,
+                                          std::size_t max_key_count);
+
+} // namespace heongpu
+#endif // HEONGPU_ROTATION_PLANNER_H
@@ -14,11 +14,14 @@ namespace heongpu
     {
         BFV,
         CKKS,
-        TFHE
+        TFHE,
+        BGV
     };
 
     template <Scheme S> class Ciphertext;
 
+    template <Scheme S> class ConstantCache;
+
     template <Scheme S> class HEContext;
 
     template <Scheme S> class HEDecryptor;
@@ -37,10 +40,16 @@ namespace heongpu
 
     template <Scheme S> class Switchkey;
 
+    template <Scheme S> class Packingkey;
+
     template <Scheme S> class Bootstrappingkey;
 
     template <Scheme S> class HEKeyGenerator;
 
+    template <Scheme S> class HEDatabaseScanner;
+
+    template <Scheme S> class HEGraph;
+
     template <Scheme S> class HEOperator;
 
     template <Scheme S> class HEArithmeticOperator;
@@ -100,6 +109,12 @@ namespace heongpu
         KEYSWITCHING_METHOD_III = 0x3, // EXTERNALPRODUCT_2 = 0x3
     };
 
+    enum class limb_type : std::uint8_t
+    {
+        LIMB64 = 0x1, // One RNS limb per 64-bit word
+        LIMB32 = 0x2, // Two RNS limbs per 64-bit word, moduli below 2^32
+    };
+
     enum class logic_bootstrapping_type : std::uint8_t
     {
         NONE = 0x0,
@@ -109,5 +124,27 @@ namespace heongpu
                                   // https://eprint.iacr.org/2024/767.pdf
     };
 
+    enum class tfhe_decomposition_profile : std::uint8_t
+    {
+        NONE = 0x0, // Custom parameters
+        BALANCED = 0x1, // Deeper decompositions, larger noise margin
+        THROUGHPUT = 0x2, // Fewer decomposition levels, faster bootstrapping
+    };
+
+    // Built-in TFHE parameter sets, named by geometry. They carry no security
+    // estimate, see HEContext<Scheme::TFHE>::get_parameter_set.
+    enum class tfhe_parameter_set : std::uint8_t
+    {
+        LWE512_K1 = 0x1, // n = 512, k = 1
+        LWE768_K2 = 0x2, // n = 768, k = 2
+        LWE1024_K2 = 0x3, // n = 1024, k = 2
+    };
+
+    enum class tfhe_blind_rotation_type : std::uint8_t
+    {
+        NTT = 0x1, // External products modulo a 64-bit prime
+        FFT = 0x2, // External products with a double-precision FFT
+    };
+
 } // namespace heongpu
 #endif // HEONGPU_SCHEMES_H
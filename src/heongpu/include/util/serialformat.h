@@ -0,0 +1,89 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_SERIALFORMAT_H
+#define HEONGPU_SERIALFORMAT_H
+
+#include "schemes.h"
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+namespace heongpu
+{
+    namespace serialformat
+    {
+        /**
+         * @brief First byte of a versioned stream. It is never a valid
+         * scheme_type, so streams written before versioning (which start
+         * with the scheme byte) are still recognised.
+         */
+        constexpr std::uint8_t version_tag = 0xFF;
+
+        /**
+         * @brief Stream version of streams without a version tag.
+         */
+        constexpr std::uint32_t legacy_version = 0;
+
+        /**
+         * @brief Version written by the current save() functions.
+         *
+         * Version 1 adds slot_count_ to CKKS plaintexts and ciphertexts,
+         * key_limb_type_ to the CKKS context, limb_type_ to CKKS Relinkey
+         * and Galoiskey, and blind_rotation_ to the TFHE context.
+         */
+        constexpr std::uint32_t current_version = 1;
+
+        /**
+         * @brief Number of bytes written by write_header().
+         */
+        constexpr std::size_t header_size = sizeof(std::uint8_t) +
+                                            sizeof(std::uint32_t) +
+                                            sizeof(scheme_type);
+
+        /**
+         * @brief Writes the version tag, the current version and the scheme.
+         */
+        inline void write_header(std::ostream& os, scheme_type scheme)
+        {
+            os.write((const char*) &version_tag, sizeof(version_tag));
+            os.write((const char*) &current_version, sizeof(current_version));
+            os.write((const char*) &scheme, sizeof(scheme));
+        }
+
+        /**
+         * @brief Reads the header written by write_header(), or the bare
+         * scheme byte of a legacy stream.
+         * @return Stream version; legacy_version for untagged streams.
+         * @throws std::runtime_error if the version is newer than
+         * current_version.
+         */
+        inline std::uint32_t read_header(std::istream& is, scheme_type& scheme)
+        {
+            std::uint8_t first = 0;
+            is.read((char*) &first, sizeof(first));
+
+            if (first != version_tag)
+            {
+                scheme = static_cast<scheme_type>(first);
+                return legacy_version;
+            }
+
+            std::uint32_t version = 0;
+            is.read((char*) &version, sizeof(version));
+            if (version > current_version)
+            {
+                throw std::runtime_error("Unsupported stream version!");
+            }
+
+            is.read((char*) &scheme, sizeof(scheme));
+            return version;
+        }
+
+    } // namespace serialformat
+} // namespace heongpu
+
+#endif // HEONGPU_SERIALFORMAT_H
@@ -46,6 +46,30 @@ namespace heongpu
          */
         std::vector<uint8_t> decompress(const std::vector<uint8_t>& data);
 
+        /**
+         * @brief Upper bound of the compressed size of size bytes.
+         */
+        size_t compress_bound(size_t size);
+
+        /**
+         * @brief Compress raw data into a caller-provided buffer.
+         * @return Number of bytes written to output.
+         * @throws std::length_error if capacity is too small, std::runtime_error
+         * on other failures.
+         */
+        size_t compress(const uint8_t* data, size_t size, uint8_t* output,
+                        size_t capacity);
+
+        /**
+         * @brief Decompress zlib-compressed data into a caller-provided
+         * buffer.
+         * @return Number of bytes written to output.
+         * @throws std::length_error if capacity is too small, std::runtime_error
+         * on other failures.
+         */
+        size_t decompress(const uint8_t* data, size_t size, uint8_t* output,
+                          size_t capacity);
+
         /**
          * @brief Trait to detect serializable types (having save/load methods).
          */
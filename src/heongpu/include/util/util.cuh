@@ -18,6 +18,7 @@
 #include <stdexcept>
 #include <set>
 #include "storagemanager.cuh"
+#include "completion.cuh"
 #include <gmp.h>
 
 namespace heongpu
@@ -63,9 +64,10 @@ namespace heongpu
         int StoC_piece_; // Default: 3
         int taylor_number_; // Default: 11
         bool less_key_mode_; // Default: false
+        int slot_count_; // Default: 0 (fully packed, n / 2 slots)
 
         BootstrappingConfig(int CtoS = 3, int StoC = 3, int taylor = 11,
-                            bool less_key_mode = false);
+                            bool less_key_mode = false, int slot_count = 0);
 
       private:
         void validate(); // Validates the configuration input values
@@ -0,0 +1,404 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "bfv/databasescan.cuh"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace heongpu
+{
+    __host__ HEDatabaseScanner<Scheme::BFV>::HEDatabaseScanner(
+        HEContext<Scheme::BFV>& context, const std::string& filename,
+        int chunk_row_count)
+    {
+        if (!context.context_generated_)
+        {
+            throw std::invalid_argument("HEContext is not generated!");
+        }
+
+        if (chunk_row_count <= 0)
+        {
+            throw std::invalid_argument("Chunk row count should be positive!");
+        }
+
+        scheme_ = context.scheme_;
+        n = context.n;
+        n_power = context.n_power;
+        Q_size_ = context.Q_size;
+
+        modulus_ = context.modulus_;
+        ntt_table_ = context.ntt_table_;
+        intt_table_ = context.intt_table_;
+        n_inverse_ = context.n_inverse_;
+
+        record_size_ = record_header_size_ + (n * Q_size_ * sizeof(Data64));
+
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("Unable to open database file: " +
+                                     filename);
+        }
+
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) != 0)
+        {
+            close(fd);
+            throw std::runtime_error("Unable to stat database file: " +
+                                     filename);
+        }
+
+        mapped_size_ = file_stat.st_size;
+        if (mapped_size_ < database_header_size_)
+        {
+            close(fd);
+            throw std::runtime_error("Invalid database file!");
+        }
+
+        void* mapped =
+            mmap(nullptr, mapped_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapped == MAP_FAILED)
+        {
+            throw std::runtime_error("Unable to map database file: " +
+                                     filename);
+        }
+        mapped_data_ = static_cast<const unsigned char*>(mapped);
+        madvise(mapped, mapped_size_, MADV_SEQUENTIAL);
+
+        const unsigned char* header = mapped_data_;
+        auto read_field = [&](void* field, size_t size)
+        {
+            std::memcpy(field, header, size);
+            header += size;
+        };
+
+        uint32_t magic;
+        scheme_type scheme;
+        int ring_size;
+        int coeff_modulus_count;
+        Data64 plain_modulus;
+        read_field(&magic, sizeof(magic));
+        read_field(&scheme, sizeof(scheme));
+        read_field(&ring_size, sizeof(ring_size));
+        read_field(&coeff_modulus_count, sizeof(coeff_modulus_count));
+        read_field(&plain_modulus, sizeof(plain_modulus));
+        read_field(&row_count_, sizeof(row_count_));
+        read_field(&column_count_, sizeof(column_count_));
+
+        if ((magic != database_magic_) || (scheme != scheme_type::bfv))
+        {
+            munmap(mapped, mapped_size_);
+            throw std::runtime_error("Invalid database file!");
+        }
+
+        if ((ring_size != n) || (coeff_modulus_count != Q_size_) ||
+            (plain_modulus != context.plain_modulus_.value))
+        {
+            munmap(mapped, mapped_size_);
+            throw std::invalid_argument(
+                "Database was prepared with different parameters!");
+        }
+
+        if ((column_count_ <= 0) ||
+            (mapped_size_ != database_header_size_ +
+                                 (row_count_ * column_count_ * record_size_)))
+        {
+            munmap(mapped, mapped_size_);
+            throw std::runtime_error("Database file size does not match its "
+                                     "header!");
+        }
+
+        chunk_row_count_ = static_cast<int>(std::min<uint64_t>(
+            chunk_row_count, std::max<uint64_t>(row_count_, 1)));
+
+        HEONGPU_CUDA_CHECK(
+            cudaStreamCreateWithFlags(&copy_stream_, cudaStreamNonBlocking));
+        for (int i = 0; i < 2; i++)
+        {
+            HEONGPU_CUDA_CHECK(cudaEventCreateWithFlags(
+                &copy_done_[i], cudaEventDisableTiming));
+            HEONGPU_CUDA_CHECK(cudaEventCreateWithFlags(
+                &compute_done_[i], cudaEventDisableTiming));
+        }
+    }
+
+    HEDatabaseScanner<Scheme::BFV>::~HEDatabaseScanner()
+    {
+        cudaStreamSynchronize(copy_stream_);
+        for (int i = 0; i < 2; i++)
+        {
+            cudaEventDestroy(copy_done_[i]);
+            cudaEventDestroy(compute_done_[i]);
+        }
+        cudaStreamDestroy(copy_stream_);
+
+        munmap(const_cast<unsigned char*>(mapped_data_), mapped_size_);
+    }
+
+    __host__ void HEDatabaseScanner<Scheme::BFV>::save_header(
+        std::ostream& os, HEContext<Scheme::BFV>& context, uint64_t row_count,
+        int column_count)
+    {
+        if (!context.context_generated_)
+        {
+            throw std::invalid_argument("HEContext is not generated!");
+        }
+
+        if (column_count <= 0)
+        {
+            throw std::invalid_argument("Column count should be positive!");
+        }
+
+        uint32_t magic = database_magic_;
+        scheme_type scheme = scheme_type::bfv;
+        Data64 plain_modulus = context.plain_modulus_.value;
+
+        os.write((char*) &magic, sizeof(magic));
+        os.write((char*) &scheme, sizeof(scheme));
+        os.write((char*) &context.n, sizeof(context.n));
+        os.write((char*) &context.Q_size, sizeof(context.Q_size));
+        os.write((char*) &plain_modulus, sizeof(plain_modulus));
+        os.write((char*) &row_count, sizeof(row_count));
+        os.write((char*) &column_count, sizeof(column_count));
+    }
+
+    __host__ void HEDatabaseScanner<Scheme::BFV>::save_row(
+        std::ostream& os, int column_count,
+        std::vector<Plaintext<Scheme::BFV>>& row)
+    {
+        if (static_cast<int>(row.size()) != column_count)
+        {
+            throw std::invalid_argument(
+                "Row size does not match the column count of the header!");
+        }
+
+        for (Plaintext<Scheme::BFV>& plain : row)
+        {
+            if (!plain.in_ntt_domain())
+            {
+                throw std::invalid_argument(
+                    "Database plaintexts should be prepared with "
+                    "transform_to_ntt!");
+            }
+
+            plain.save(os);
+        }
+    }
+
+    __host__ void HEDatabaseScanner<Scheme::BFV>::scan(
+        std::vector<Ciphertext<Scheme::BFV>>& query,
+        std::vector<Ciphertext<Scheme::BFV>>& results,
+        const ExecutionOptions& options)
+    {
+        if (static_cast<int>(query.size()) != column_count_)
+        {
+            throw std::invalid_argument(
+                "Query size should match the database column count!");
+        }
+
+        bool in_ntt_domain = query[0].in_ntt_domain_;
+        for (Ciphertext<Scheme::BFV>& cipher : query)
+        {
+            if (cipher.relinearization_required_)
+            {
+                throw std::invalid_argument("Query ciphertexts can not be "
+                                            "multiplied because of the "
+                                            "non-linear part! Please use "
+                                            "relinearization operation!");
+            }
+
+            if (cipher.memory_size() < (2 * n * Q_size_))
+            {
+                throw std::invalid_argument("Invalid query ciphertext size!");
+            }
+
+            if (cipher.in_ntt_domain_ != in_ntt_domain)
+            {
+                throw std::invalid_argument(
+                    "Query ciphertexts should be in the same domain!");
+            }
+        }
+
+        input_vector_storage_manager(
+            query,
+            [&](std::vector<Ciphertext<Scheme::BFV>>& query_)
+            { scan_bfv(query_, results, options.stream_); },
+            options, false);
+
+        for (Ciphertext<Scheme::BFV>& result : results)
+        {
+            result.scheme_ = scheme_;
+            result.ring_size_ = n;
+            result.coeff_modulus_count_ = Q_size_;
+            result.cipher_size_ = 2;
+            result.in_ntt_domain_ = in_ntt_domain;
+            result.relinearization_required_ = false;
+            result.ciphertext_generated_ = true;
+
+            if (options.storage_ == storage_type::HOST)
+            {
+                result.store_in_host(options.stream_);
+            }
+        }
+    }
+
+    __host__ void HEDatabaseScanner<Scheme::BFV>::scan_bfv(
+        std::vector<Ciphertext<Scheme::BFV>>& query,
+        std::vector<Ciphertext<Scheme::BFV>>& results,
+        const cudaStream_t stream)
+    {
+        size_t cipher_memory = 2 * n * Q_size_;
+        size_t row_memory = static_cast<size_t>(column_count_) * n * Q_size_;
+        bool in_ntt_domain = query[0].in_ntt_domain_;
+
+        // The query is laid out back to back in the NTT domain, as expected by
+        // cipherplain_multiply_accumulate_kernel.
+        DeviceVector<Data64> query_memory(column_count_ * cipher_memory,
+                                          stream);
+        for (int i = 0; i < column_count_; i++)
+        {
+            cudaMemcpyAsync(query_memory.data() + (i * cipher_memory),
+                            query[i].data(), cipher_memory * sizeof(Data64),
+                            cudaMemcpyDeviceToDevice, stream);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        }
+
+        if (!in_ntt_domain)
+        {
+            gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+                .n_power = n_power,
+                .ntt_type = gpuntt::FORWARD,
+                .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+                .zero_padding = false,
+                .stream = stream};
+
+            gpuntt::GPU_NTT_Inplace(query_memory.data(), ntt_table_->data(),
+                                    modulus_->data(), cfg_ntt,
+                                    2 * Q_size_ * column_count_, Q_size_);
+        }
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_intt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::INVERSE,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .mod_inverse = n_inverse_->data(),
+            .stream = stream};
+
+        results.resize(row_count_);
+
+        // Two pinned staging buffers and two device chunks. While the kernels
+        // of chunk k run on the compute stream, the host packs chunk k + 1
+        // into the other staging buffer and the copy stream uploads it.
+        size_t chunk_memory = chunk_row_count_ * row_memory;
+        HostVector<Data64> staging[2] = {HostVector<Data64>(chunk_memory),
+                                         HostVector<Data64>(chunk_memory)};
+        DeviceVector<Data64> device_chunk[2] = {
+            DeviceVector<Data64>(chunk_memory, stream),
+            DeviceVector<Data64>(chunk_memory, stream)};
+
+        // The device chunks are allocated on the compute stream and written by
+        // the copy stream.
+        HEONGPU_CUDA_CHECK(cudaEventRecord(compute_done_[0], stream));
+        HEONGPU_CUDA_CHECK(cudaEventRecord(compute_done_[1], stream));
+
+        uint64_t chunk_count =
+            (row_count_ + chunk_row_count_ - 1) / chunk_row_count_;
+        for (uint64_t chunk = 0; chunk < chunk_count; chunk++)
+        {
+            int slot = chunk & 1;
+            uint64_t first_row = chunk * chunk_row_count_;
+            int chunk_rows = static_cast<int>(std::min<uint64_t>(
+                chunk_row_count_, row_count_ - first_row));
+
+            // The staging buffer is reused once its previous upload is done.
+            if (chunk >= 2)
+            {
+                HEONGPU_CUDA_CHECK(cudaEventSynchronize(copy_done_[slot]));
+            }
+
+            stage_chunk(staging[slot].data(), first_row, chunk_rows);
+
+            HEONGPU_CUDA_CHECK(
+                cudaStreamWaitEvent(copy_stream_, compute_done_[slot], 0));
+            cudaMemcpyAsync(device_chunk[slot].data(), staging[slot].data(),
+                            chunk_rows * row_memory * sizeof(Data64),
+                            cudaMemcpyHostToDevice, copy_stream_);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+            HEONGPU_CUDA_CHECK(cudaEventRecord(copy_done_[slot], copy_stream_));
+
+            HEONGPU_CUDA_CHECK(
+                cudaStreamWaitEvent(stream, copy_done_[slot], 0));
+            for (int i = 0; i < chunk_rows; i++)
+            {
+                DeviceVector<Data64> output_memory(cipher_memory, stream);
+
+                cipherplain_multiply_accumulate_kernel<<<
+                    dim3((n >> 8), Q_size_, 2), 256, 0, stream>>>(
+                    query_memory.data(),
+                    device_chunk[slot].data() + (i * row_memory),
+                    output_memory.data(), modulus_->data(), column_count_,
+                    Q_size_, Q_size_, n_power);
+                HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                if (!in_ntt_domain)
+                {
+                    gpuntt::GPU_NTT_Inplace(
+                        output_memory.data(), intt_table_->data(),
+                        modulus_->data(), cfg_intt, 2 * Q_size_, Q_size_);
+                }
+
+                results[first_row + i].memory_set(std::move(output_memory));
+            }
+            HEONGPU_CUDA_CHECK(cudaEventRecord(compute_done_[slot], stream));
+        }
+
+        // Pinned staging memory is released on return.
+        HEONGPU_CUDA_CHECK(cudaStreamSynchronize(copy_stream_));
+    }
+
+    __host__ void HEDatabaseScanner<Scheme::BFV>::stage_chunk(
+        Data64* staging, uint64_t first_row, int chunk_rows)
+    {
+        size_t plain_memory = n * Q_size_;
+        size_t record_count = static_cast<size_t>(chunk_rows) * column_count_;
+        const unsigned char* record =
+            mapped_data_ + database_header_size_ +
+            (first_row * column_count_ * record_size_);
+
+        for (size_t i = 0; i < record_count; i++)
+        {
+            scheme_type scheme;
+            int plain_size;
+            bool in_ntt_domain;
+            std::memcpy(&scheme, record, sizeof(scheme));
+            std::memcpy(&plain_size, record + sizeof(scheme),
+                        sizeof(plain_size));
+            std::memcpy(&in_ntt_domain,
+                        record + sizeof(scheme) + sizeof(plain_size),
+                        sizeof(in_ntt_domain));
+
+            if ((scheme != scheme_type::bfv) ||
+                (plain_size != static_cast<int>(plain_memory)) ||
+                !in_ntt_domain)
+            {
+                // Uploads in flight still read the staging buffers.
+                cudaStreamSynchronize(copy_stream_);
+                throw std::runtime_error("Invalid database record!");
+            }
+
+            std::memcpy(staging + (i * plain_memory),
+                        record + record_header_size_,
+                        plain_memory * sizeof(Data64));
+            record += record_size_;
+        }
+    }
+
+} // namespace heongpu
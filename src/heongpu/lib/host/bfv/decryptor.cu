@@ -368,4 +368,196 @@ namespace heongpu
         plaintext.memory_set(std::move(output_memory));
     }
 
+    __host__ void HEDecryptor<Scheme::BFV>::partial_decrypt_bfv_batch(
+        std::vector<Ciphertext<Scheme::BFV>>& ciphertexts,
+        Secretkey<Scheme::BFV>& sk,
+        std::vector<Ciphertext<Scheme::BFV>>& partial_ciphertexts,
+        const cudaStream_t stream)
+    {
+        int cipher_count = ciphertexts.size();
+        int poly_size = Q_size_ << n_power;
+
+        // Second polynomials of the batch are gathered so that the forward
+        // and inverse transforms run once for the whole batch.
+        DeviceVector<Data64> ct1_memory(cipher_count * poly_size, stream);
+        for (int i = 0; i < cipher_count; i++)
+        {
+            cudaMemcpyAsync(ct1_memory.data() + (i * poly_size),
+                            ciphertexts[i].data() + poly_size,
+                            poly_size * sizeof(Data64),
+                            cudaMemcpyDeviceToDevice, stream);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        }
+
+        if (!ciphertexts[0].in_ntt_domain_)
+        {
+            gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+                .n_power = n_power,
+                .ntt_type = gpuntt::FORWARD,
+                .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+                .zero_padding = false,
+                .stream = stream};
+
+            gpuntt::GPU_NTT_Inplace(ct1_memory.data(), ntt_table_->data(),
+                                    modulus_->data(), cfg_ntt,
+                                    cipher_count * Q_size_, Q_size_);
+        }
+
+        sk_multiplication_bfv_batch_kernel<<<
+            dim3((n >> 8), Q_size_, cipher_count), 256, 0, stream>>>(
+            ct1_memory.data(), sk.data(), modulus_->data(), n_power, Q_size_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_intt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::INVERSE,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .mod_inverse = n_inverse_->data(),
+            .stream = stream};
+
+        gpuntt::GPU_NTT_Inplace(ct1_memory.data(), intt_table_->data(),
+                                modulus_->data(), cfg_intt,
+                                cipher_count * Q_size_, Q_size_);
+
+        DeviceVector<Data64> error_poly(cipher_count * poly_size, stream);
+
+        RandomNumberGenerator::instance()
+            .modular_gaussian_random_number_generation(
+                error_std_dev, error_poly.data(), modulus_->data(), n_power,
+                Q_size_, cipher_count, stream);
+
+        partial_ciphertexts.resize(cipher_count);
+
+        std::vector<Data64*> input_pointers(cipher_count);
+        std::vector<Data64*> output_pointers(cipher_count);
+        for (int i = 0; i < cipher_count; i++)
+        {
+            DeviceVector<Data64> output_memory((2 * n * Q_size_), stream);
+            partial_ciphertexts[i].memory_set(std::move(output_memory));
+
+            input_pointers[i] = ciphertexts[i].data();
+            output_pointers[i] = partial_ciphertexts[i].data();
+        }
+
+        DeviceVector<Data64*> input_pointers_device(cipher_count, stream);
+        cudaMemcpyAsync(input_pointers_device.data(), input_pointers.data(),
+                        cipher_count * sizeof(Data64*), cudaMemcpyHostToDevice,
+                        stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        DeviceVector<Data64*> output_pointers_device(cipher_count, stream);
+        cudaMemcpyAsync(output_pointers_device.data(), output_pointers.data(),
+                        cipher_count * sizeof(Data64*), cudaMemcpyHostToDevice,
+                        stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        partial_decrypt_bfv_batch_kernel<<<
+            dim3((n >> 8), Q_size_, cipher_count), 256, 0, stream>>>(
+            input_pointers_device.data(), output_pointers_device.data(),
+            ct1_memory.data(), error_poly.data(), modulus_->data(), n_power,
+            Q_size_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+    }
+
+    __host__ void HEDecryptor<Scheme::BFV>::decrypt_fusion_bfv_batch(
+        std::vector<std::vector<Ciphertext<Scheme::BFV>>>& partial_ciphertexts,
+        std::vector<Plaintext<Scheme::BFV>>& plaintexts,
+        const cudaStream_t stream)
+    {
+        int party_count = partial_ciphertexts.size();
+        int cipher_count = partial_ciphertexts[0].size();
+
+        plaintexts.resize(cipher_count);
+
+        // Shares of one ciphertext are contiguous so that a thread block reads
+        // all of them for its coefficient range.
+        std::vector<Data64*> share_pointers(cipher_count * party_count);
+        std::vector<Data64*> output_pointers(cipher_count);
+        for (int j = 0; j < cipher_count; j++)
+        {
+            for (int i = 0; i < party_count; i++)
+            {
+                share_pointers[(j * party_count) + i] =
+                    partial_ciphertexts[i][j].data();
+            }
+
+            DeviceVector<Data64> output_memory(n, stream);
+            plaintexts[j].memory_set(std::move(output_memory));
+            output_pointers[j] = plaintexts[j].data();
+        }
+
+        DeviceVector<Data64*> share_pointers_device(share_pointers.size(),
+                                                    stream);
+        cudaMemcpyAsync(share_pointers_device.data(), share_pointers.data(),
+                        share_pointers.size() * sizeof(Data64*),
+                        cudaMemcpyHostToDevice, stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        DeviceVector<Data64*> output_pointers_device(cipher_count, stream);
+        cudaMemcpyAsync(output_pointers_device.data(), output_pointers.data(),
+                        cipher_count * sizeof(Data64*), cudaMemcpyHostToDevice,
+                        stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        decrypt_fusion_bfv_batch_kernel<<<dim3((n >> 8), 1, cipher_count), 256,
+                                          0, stream>>>(
+            share_pointers_device.data(), output_pointers_device.data(),
+            modulus_->data(), plain_modulus_, gamma_, Qi_t_->data(),
+            Qi_gamma_->data(), Qi_inverse_->data(), mulq_inv_t_,
+            mulq_inv_gamma_, inv_gamma_, n_power, Q_size_, party_count);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+    }
+
+    __host__ void HEDecryptor<Scheme::BFV>::decrypt_fusion_bfv_accumulate(
+        Ciphertext<Scheme::BFV>& partial_ciphertext,
+        Ciphertext<Scheme::BFV>& accumulated, bool first,
+        const cudaStream_t stream)
+    {
+        if (first)
+        {
+            DeviceVector<Data64> output_memory((2 * n * Q_size_), stream);
+
+            cudaMemcpyAsync(output_memory.data(), partial_ciphertext.data(),
+                            (2 * n * Q_size_) * sizeof(Data64),
+                            cudaMemcpyDeviceToDevice, stream);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+            accumulated.memory_set(std::move(output_memory));
+        }
+        else
+        {
+            Data64* ct1 = partial_ciphertext.data() + (Q_size_ << n_power);
+            Data64* sum = accumulated.data() + (Q_size_ << n_power);
+
+            addition<<<dim3((n >> 8), Q_size_, 1), 256, 0, stream>>>(
+                ct1, sum, sum, modulus_->data(), n_power);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        }
+    }
+
+    __host__ void HEDecryptor<Scheme::BFV>::decrypt_fusion_bfv_accumulated(
+        Ciphertext<Scheme::BFV>& accumulated, Plaintext<Scheme::BFV>& plaintext,
+        const cudaStream_t stream)
+    {
+        DeviceVector<Data64> output_memory(n, stream);
+
+        DeviceVector<Data64> temp_sum(Q_size_ << n_power, stream);
+
+        Data64* ct0 = accumulated.data();
+        Data64* ct1 = accumulated.data() + (Q_size_ << n_power);
+        addition<<<dim3((n >> 8), Q_size_, 1), 256, 0, stream>>>(
+            ct0, ct1, temp_sum.data(), modulus_->data(), n_power);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        decryption_fusion_bfv_kernel<<<dim3((n >> 8), 1, 1), 256, 0, stream>>>(
+            temp_sum.data(), output_memory.data(), modulus_->data(),
+            plain_modulus_, gamma_, Qi_t_->data(), Qi_gamma_->data(),
+            Qi_inverse_->data(), mulq_inv_t_, mulq_inv_gamma_, inv_gamma_,
+            n_power, Q_size_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        plaintext.memory_set(std::move(output_memory));
+    }
+
 } // namespace heongpu
\ No newline at end of file
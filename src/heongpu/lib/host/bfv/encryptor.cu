@@ -131,4 +131,97 @@ namespace heongpu
         ciphertext.memory_set(std::move(output_memory));
     }
 
+    __host__ void HEEncryptor<Scheme::BFV>::encrypt_bfv_batch(
+        std::vector<Ciphertext<Scheme::BFV>>& ciphertexts,
+        std::vector<Plaintext<Scheme::BFV>>& plaintexts,
+        const cudaStream_t stream)
+    {
+        int plain_count = plaintexts.size();
+
+        // u, e and pk * u of every encryption are stored back to back.
+        DeviceVector<Data64> gpu_space(5 * plain_count * Q_prime_size_ * n,
+                                       stream);
+        Data64* u_poly = gpu_space.data();
+        Data64* error_poly = u_poly + (plain_count * Q_prime_size_ * n);
+        Data64* pk_u_poly = error_poly + (2 * plain_count * Q_prime_size_ * n);
+
+        RandomNumberGenerator::instance()
+            .modular_ternary_random_number_generation(
+                u_poly, modulus_->data(), n_power, Q_prime_size_, plain_count,
+                stream);
+
+        RandomNumberGenerator::instance()
+            .modular_gaussian_random_number_generation(
+                error_std_dev, error_poly, modulus_->data(), n_power,
+                Q_prime_size_, 2 * plain_count, stream);
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::FORWARD,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .stream = stream};
+
+        gpuntt::GPU_NTT_Inplace(u_poly, ntt_table_->data(), modulus_->data(),
+                                cfg_ntt, plain_count * Q_prime_size_,
+                                Q_prime_size_);
+
+        pk_u_batch_kernel<<<dim3((n >> 8), Q_prime_size_, 2 * plain_count),
+                            256, 0, stream>>>(public_key_.data(), u_poly,
+                                              pk_u_poly, modulus_->data(),
+                                              n_power, Q_prime_size_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_intt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::INVERSE,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .mod_inverse = n_inverse_->data(),
+            .stream = stream};
+
+        gpuntt::GPU_NTT_Inplace(pk_u_poly, intt_table_->data(),
+                                modulus_->data(), cfg_intt,
+                                2 * plain_count * Q_prime_size_,
+                                Q_prime_size_);
+
+        ciphertexts.resize(plain_count);
+
+        std::vector<Data64*> plain_pointers(plain_count);
+        std::vector<Data64*> cipher_pointers(plain_count);
+        for (int i = 0; i < plain_count; i++)
+        {
+            if (!(ciphertexts[i].is_on_device() &&
+                  (ciphertexts[i].memory_size() == (2 * n * Q_size_))))
+            {
+                DeviceVector<Data64> cipher_memory((2 * n * Q_size_), stream);
+                ciphertexts[i].memory_set(std::move(cipher_memory));
+            }
+
+            plain_pointers[i] = plaintexts[i].data();
+            cipher_pointers[i] = ciphertexts[i].data();
+        }
+
+        DeviceVector<Data64*> plain_pointers_device(plain_count, stream);
+        cudaMemcpyAsync(plain_pointers_device.data(), plain_pointers.data(),
+                        plain_count * sizeof(Data64*), cudaMemcpyHostToDevice,
+                        stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        DeviceVector<Data64*> cipher_pointers_device(plain_count, stream);
+        cudaMemcpyAsync(cipher_pointers_device.data(), cipher_pointers.data(),
+                        plain_count * sizeof(Data64*), cudaMemcpyHostToDevice,
+                        stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        enc_div_lastq_bfv_batch_kernel<<<
+            dim3((n >> 8), Q_size_, 2 * plain_count), 256, 0, stream>>>(
+            pk_u_poly, error_poly, plain_pointers_device.data(),
+            cipher_pointers_device.data(), modulus_->data(), half_->data(),
+            half_mod_->data(), last_q_modinv_->data(), plain_modulus_,
+            Q_mod_t_, upper_threshold_, coeeff_div_plainmod_->data(), n_power,
+            Q_prime_size_, Q_size_, P_size_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+    }
+
 } // namespace heongpu
\ No newline at end of file
@@ -148,12 +148,18 @@ namespace heongpu
     }
 
     void Relinkey<Scheme::BFV>::load(std::istream& is)
+    {
+        load(is, scheme_type::bfv);
+    }
+
+    void Relinkey<Scheme::BFV>::load(std::istream& is,
+                                     scheme_type expected_scheme)
     {
         if ((!relin_key_generated_))
         {
             is.read((char*) &scheme_, sizeof(scheme_));
 
-            if (scheme_ != scheme_type::bfv)
+            if (scheme_ != expected_scheme)
             {
                 throw std::runtime_error("Invalid scheme binary!");
             }
@@ -557,55 +563,13 @@ namespace heongpu
     {
         if (galois_key_generated_)
         {
-            os.write((char*) &scheme_, sizeof(scheme_));
-
-            os.write((char*) &key_type, sizeof(key_type));
-
-            os.write((char*) &ring_size, sizeof(ring_size));
-
-            os.write((char*) &Q_prime_size_, sizeof(Q_prime_size_));
-
-            os.write((char*) &Q_size_, sizeof(Q_size_));
-
-            os.write((char*) &d_, sizeof(d_));
-
-            os.write((char*) &customized, sizeof(customized));
-
-            os.write((char*) &group_order_, sizeof(group_order_));
-
-            os.write((char*) &storage_type_, sizeof(storage_type_));
-
-            os.write((char*) &galois_key_generated_,
-                     sizeof(galois_key_generated_));
-
-            if (customized)
-            {
-                uint32_t custom_galois_elt_size = custom_galois_elt.size();
-                os.write((char*) &custom_galois_elt_size,
-                         sizeof(custom_galois_elt_size));
-                os.write((char*) custom_galois_elt.data(),
-                         sizeof(u_int32_t) * custom_galois_elt_size);
-            }
-            else
-            {
-                uint32_t galois_elt_size = galois_elt.size();
-                os.write((char*) &galois_elt_size, sizeof(galois_elt_size));
-                for (auto& galois : galois_elt)
-                {
-                    os.write((char*) &galois.first, sizeof(galois.first));
-                    os.write((char*) &galois.second, sizeof(galois.second));
-                }
-            }
-
-            os.write((char*) &galois_elt_zero, sizeof(galois_elt_zero));
-
-            os.write((char*) &galoiskey_size_, sizeof(galoiskey_size_));
+            uint32_t key_count = (storage_type_ == storage_type::DEVICE)
+                                     ? device_location_.size()
+                                     : host_location_.size();
+            save_header(os, key_count);
 
             if (storage_type_ == storage_type::DEVICE)
             {
-                uint32_t key_count = device_location_.size();
-                os.write((char*) &key_count, sizeof(key_count));
-
                 for (auto& galois_key_mem : device_location_)
                 {
                     HostVector<Data64> host_locations_temp(galoiskey_size_);
@@ -634,9 +598,6 @@ namespace heongpu
             }
             else
             {
-                uint32_t key_count = host_location_.size();
-                os.write((char*) &key_count, sizeof(key_count));
-
                 for (auto& galois_key_mem : host_location_)
                 {
                     os.write((char*) &galois_key_mem.first,
@@ -656,13 +617,71 @@ namespace heongpu
         }
     }
 
+    void Galoiskey<Scheme::BFV>::save_header(std::ostream& os,
+                                              uint32_t key_count) const
+    {
+        os.write((char*) &scheme_, sizeof(scheme_));
+
+        os.write((char*) &key_type, sizeof(key_type));
+
+        os.write((char*) &ring_size, sizeof(ring_size));
+
+        os.write((char*) &Q_prime_size_, sizeof(Q_prime_size_));
+
+        os.write((char*) &Q_size_, sizeof(Q_size_));
+
+        os.write((char*) &d_, sizeof(d_));
+
+        os.write((char*) &customized, sizeof(customized));
+
+        os.write((char*) &group_order_, sizeof(group_order_));
+
+        os.write((char*) &storage_type_, sizeof(storage_type_));
+
+        os.write((char*) &galois_key_generated_,
+                 sizeof(galois_key_generated_));
+
+        if (customized)
+        {
+            uint32_t custom_galois_elt_size = custom_galois_elt.size();
+            os.write((char*) &custom_galois_elt_size,
+                     sizeof(custom_galois_elt_size));
+            os.write((char*) custom_galois_elt.data(),
+                     sizeof(u_int32_t) * custom_galois_elt_size);
+        }
+        else
+        {
+            uint32_t galois_elt_size = galois_elt.size();
+            os.write((char*) &galois_elt_size, sizeof(galois_elt_size));
+            for (auto& galois : galois_elt)
+            {
+                os.write((char*) &galois.first, sizeof(galois.first));
+                os.write((char*) &galois.second, sizeof(galois.second));
+            }
+        }
+
+        os.write((char*) &galois_elt_zero, sizeof(galois_elt_zero));
+
+        os.write((char*) &galoiskey_size_, sizeof(galoiskey_size_));
+
+        os.write((char*) &key_count, sizeof(key_count));
+    }
+
     void Galoiskey<Scheme::BFV>::load(std::istream& is)
+    {
+        load(is, scheme_type::bfv);
+    }
+
+    void Galoiskey<Scheme::BFV>::load(std::istream& is,
+                                      scheme_type expected_scheme)
     {
         if ((!galois_key_generated_))
         {
+            rotation_plans_ = std::make_shared<RotationPlanCache>();
+
             is.read((char*) &scheme_, sizeof(scheme_));
 
-            if (scheme_ != scheme_type::bfv)
+            if (scheme_ != expected_scheme)
             {
                 throw std::runtime_error("Invalid scheme binary!");
             }
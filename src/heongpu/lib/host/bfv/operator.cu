@@ -172,6 +172,11 @@ namespace heongpu
                                                Ciphertext<Scheme::BFV>& output,
                                                const ExecutionOptions& options)
     {
+        if (input1.in_ntt_domain_ != input2.in_ntt_domain_)
+        {
+            require_domain(input2, input1.in_ntt_domain_, options);
+        }
+
         if (input1.relinearization_required_ !=
             input2.relinearization_required_)
         {
@@ -239,6 +244,11 @@ namespace heongpu
                                                Ciphertext<Scheme::BFV>& output,
                                                const ExecutionOptions& options)
     {
+        if (input1.in_ntt_domain_ != input2.in_ntt_domain_)
+        {
+            require_domain(input2, input1.in_ntt_domain_, options);
+        }
+
         if (input1.relinearization_required_ !=
             input2.relinearization_required_)
         {
@@ -541,31 +551,53 @@ namespace heongpu
     {
         DeviceVector<Data64> output_memory((2 * n * Q_size_), stream);
 
-        if (input1.in_ntt_domain_)
-        {
-            cipherplain_kernel<<<dim3((n >> 8), Q_size_, 2), 256, 0, stream>>>(
-                input1.data(), input2.data(), output_memory.data(),
-                modulus_->data(), n_power, Q_size_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
-        }
-        else
-        {
-            DeviceVector<Data64> temp_plain_mul(n * Q_size_, stream);
-            Data64* temp1_plain_mul = temp_plain_mul.data();
+        gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::FORWARD,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .stream = stream};
 
+        // Plaintexts in the NTT domain were lifted and transformed once by
+        // transform_to_ntt; only encoded plaintexts are prepared here.
+        Data64* plain = input2.data();
+        DeviceVector<Data64> temp_plain_mul(
+            input2.in_ntt_domain_ ? 0 : (n * Q_size_), stream);
+        if (!input2.in_ntt_domain_)
+        {
             threshold_kernel<<<dim3((n >> 8), Q_size_, 1), 256, 0, stream>>>(
-                input2.data(), temp1_plain_mul, modulus_->data(),
+                input2.data(), temp_plain_mul.data(), modulus_->data(),
                 upper_halfincrement_->data(), upper_threshold_, n_power,
                 Q_size_);
             HEONGPU_CUDA_CHECK(cudaGetLastError());
 
-            gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
-                .n_power = n_power,
-                .ntt_type = gpuntt::FORWARD,
-                .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
-                .zero_padding = false,
-                .stream = stream};
+            gpuntt::GPU_NTT_Inplace(temp_plain_mul.data(), ntt_table_->data(),
+                                    modulus_->data(), cfg_ntt, Q_size_,
+                                    Q_size_);
 
+            plain = temp_plain_mul.data();
+        }
+
+        Data64* cipher = input1.data();
+        if (!input1.in_ntt_domain_)
+        {
+            domain_statistics_.forward_transforms++;
+            domain_statistics_.inverse_transforms++;
+
+            gpuntt::GPU_NTT(input1.data(), output_memory.data(),
+                            ntt_table_->data(), modulus_->data(), cfg_ntt,
+                            2 * Q_size_, Q_size_);
+
+            cipher = output_memory.data();
+        }
+
+        cipherplain_kernel<<<dim3((n >> 8), Q_size_, 2), 256, 0, stream>>>(
+            cipher, plain, output_memory.data(), modulus_->data(), n_power,
+            Q_size_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        if (!input1.in_ntt_domain_)
+        {
             gpuntt::ntt_rns_configuration<Data64> cfg_intt = {
                 .n_power = n_power,
                 .ntt_type = gpuntt::INVERSE,
@@ -574,19 +606,6 @@ namespace heongpu
                 .mod_inverse = n_inverse_->data(),
                 .stream = stream};
 
-            gpuntt::GPU_NTT_Inplace(temp1_plain_mul, ntt_table_->data(),
-                                    modulus_->data(), cfg_ntt, Q_size_,
-                                    Q_size_);
-
-            gpuntt::GPU_NTT(input1.data(), output_memory.data(),
-                            ntt_table_->data(), modulus_->data(), cfg_ntt,
-                            2 * Q_size_, Q_size_);
-
-            cipherplain_kernel<<<dim3((n >> 8), Q_size_, 2), 256, 0, stream>>>(
-                output_memory.data(), temp1_plain_mul, output_memory.data(),
-                modulus_->data(), n_power, Q_size_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
-
             gpuntt::GPU_NTT_Inplace(output_memory.data(), intt_table_->data(),
                                     modulus_->data(), cfg_intt, 2 * Q_size_,
                                     Q_size_);
@@ -826,32 +845,32 @@ namespace heongpu
         }
         else
         {
-            std::vector<int> required_galoiselt;
-            int shift_num = abs(shift);
-            int negative = (shift < 0) ? (-1) : 1;
-            while (shift_num != 0)
+            std::vector<int> available_shifts;
+            available_shifts.reserve(galois_key.galois_elt.size());
+            for (const auto& galois : galois_key.galois_elt)
+            {
+                available_shifts.push_back(galois.first);
+            }
+
+            std::vector<int> steps =
+                galois_key.rotation_plans_->plan(shift, available_shifts,
+                                                 (n >> 1));
+
+            if (steps.empty())
             {
-                int power = int(log2(shift_num));
-                int power_2 = pow(2, power);
-                shift_num = shift_num - power_2;
-
-                int index_in = power_2 * negative;
-
-                if (!(galois_key.galois_elt.find(index_in) !=
-                      galois_key.galois_elt.end()))
-                {
-                    throw std::logic_error("Galois key not present!");
-                }
-                galoiselt = galois_key.galois_elt[index_in];
-                required_galoiselt.push_back(galoiselt);
+                output = input1;
+                return;
             }
 
-            Ciphertext<Scheme::BFV>& in_data = input1;
-            for (auto& galois_elt : required_galoiselt)
+            // The first step reads input1, the following ones rotate output
+            // in place, so neither the input nor the intermediate results are
+            // copied.
+            Ciphertext<Scheme::BFV>* in_data = &input1;
+            for (int step : steps)
             {
-                apply_galois_method_I(in_data, output, galois_key, galois_elt,
-                                      stream);
-                in_data = output;
+                apply_galois_method_I(*in_data, output, galois_key,
+                                      galois_key.galois_elt[step], stream);
+                in_data = &output;
             }
         }
     }
@@ -874,32 +893,32 @@ namespace heongpu
         }
         else
         {
-            std::vector<int> required_galoiselt;
-            int shift_num = abs(shift);
-            int negative = (shift < 0) ? (-1) : 1;
-            while (shift_num != 0)
+            std::vector<int> available_shifts;
+            available_shifts.reserve(galois_key.galois_elt.size());
+            for (const auto& galois : galois_key.galois_elt)
             {
-                int power = int(log2(shift_num));
-                int power_2 = pow(2, power);
-                shift_num = shift_num - power_2;
-
-                int index_in = power_2 * negative;
-
-                if (!(galois_key.galois_elt.find(index_in) !=
-                      galois_key.galois_elt.end()))
-                {
-                    throw std::logic_error("Galois key not present!");
-                }
-                galoiselt = galois_key.galois_elt[index_in];
-                required_galoiselt.push_back(galoiselt);
+                available_shifts.push_back(galois.first);
             }
 
-            Ciphertext<Scheme::BFV>& in_data = input1;
-            for (auto& galois_elt : required_galoiselt)
+            std::vector<int> steps =
+                galois_key.rotation_plans_->plan(shift, available_shifts,
+                                                 (n >> 1));
+
+            if (steps.empty())
             {
-                apply_galois_method_II(in_data, output, galois_key, galois_elt,
-                                       stream);
-                in_data = output;
+                output = input1;
+                return;
+            }
+
+            // The first step reads input1, the following ones rotate output
+            // in place, so neither the input nor the intermediate results are
+            // copied.
+            Ciphertext<Scheme::BFV>* in_data = &input1;
+            for (int step : steps)
+            {
+                apply_galois_method_II(*in_data, output, galois_key,
+                                       galois_key.galois_elt[step], stream);
+                in_data = &output;
             }
         }
     }
@@ -1069,6 +1088,142 @@ namespace heongpu
         output.memory_set(std::move(output_memory));
     }
 
+    __host__ void HEOperator<Scheme::BFV>::expand_method_I(
+        Ciphertext<Scheme::BFV>& input1,
+        std::vector<Ciphertext<Scheme::BFV>>& output,
+        Galoiskey<Scheme::BFV>& galois_key, int output_count,
+        const cudaStream_t stream)
+    {
+        std::vector<uint32_t> galois_elts =
+            expand_galois_elements(output_count);
+        for (uint32_t galois_elt : galois_elts)
+        {
+            bool key_exist =
+                (galois_key.storage_type_ == storage_type::DEVICE)
+                    ? (galois_key.device_location_.find(galois_elt) !=
+                       galois_key.device_location_.end())
+                    : (galois_key.host_location_.find(galois_elt) !=
+                       galois_key.host_location_.end());
+            if (!key_exist)
+            {
+                throw std::invalid_argument(
+                    "Galois key is not generated for the expansion elements!");
+            }
+        }
+
+        int level_count = galois_elts.size();
+        int max_count = 1 << level_count;
+        int cipher_size = 2 * n * Q_size_;
+
+        // Ping-pong buffers holding one level each. A level of m ciphertexts
+        // occupies the first half of its buffer, the ciphertexts multiplied by
+        // X^(-m) are written to the second half.
+        DeviceVector<Data64> level_memory(2 * max_count * cipher_size, stream);
+        Data64* level_in = level_memory.data();
+        Data64* level_out = level_in + (max_count * cipher_size);
+
+        // Key switching temporaries for the largest (last) level.
+        DeviceVector<Data64> temp_rotation(
+            max_count * ((n * Q_size_ * Q_prime_size_) +
+                         (2 * n * Q_prime_size_)),
+            stream);
+        Data64* temp1_rotation = temp_rotation.data();
+        Data64* temp2_rotation =
+            temp1_rotation + (max_count * n * Q_size_ * Q_prime_size_);
+
+        cudaMemcpyAsync(level_in, input1.data(), cipher_size * sizeof(Data64),
+                        cudaMemcpyDeviceToDevice, stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::FORWARD,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .stream = stream};
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_intt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::INVERSE,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .mod_inverse = n_inverse_->data(),
+            .stream = stream};
+
+        for (int level = 0; level < level_count; level++)
+        {
+            int level_size = 1 << level;
+            int batch_size = level_size << 1;
+            int galois_elt = galois_elts[level];
+
+            negacyclic_shift_poly_coeffmod_kernel<<<
+                dim3((n >> 8), Q_size_, 2 * level_size), 256, 0, stream>>>(
+                level_in, level_in + (level_size * cipher_size),
+                modulus_->data(), (n << 1) - level_size, n_power);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+            cipher_broadcast_batch_kernel<<<dim3((n >> 8), Q_size_, batch_size),
+                                            256, 0, stream>>>(
+                level_in, temp1_rotation, modulus_->data(), n_power, Q_size_,
+                Q_prime_size_);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+            gpuntt::GPU_NTT_Inplace(temp1_rotation, ntt_table_->data(),
+                                    modulus_->data(), cfg_ntt,
+                                    batch_size * Q_size_ * Q_prime_size_,
+                                    Q_prime_size_);
+
+            if (galois_key.storage_type_ == storage_type::DEVICE)
+            {
+                multiply_accumulate_batch_kernel<<<
+                    dim3((n >> 8), Q_prime_size_, batch_size), 256, 0,
+                    stream>>>(temp1_rotation,
+                              galois_key.device_location_[galois_elt].data(),
+                              temp2_rotation, modulus_->data(), n_power,
+                              Q_size_);
+                HEONGPU_CUDA_CHECK(cudaGetLastError());
+            }
+            else
+            {
+                DeviceVector<Data64> key_location(
+                    galois_key.host_location_[galois_elt], stream);
+                multiply_accumulate_batch_kernel<<<
+                    dim3((n >> 8), Q_prime_size_, batch_size), 256, 0,
+                    stream>>>(temp1_rotation, key_location.data(),
+                              temp2_rotation, modulus_->data(), n_power,
+                              Q_size_);
+                HEONGPU_CUDA_CHECK(cudaGetLastError());
+            }
+
+            gpuntt::GPU_NTT_Inplace(temp2_rotation, intt_table_->data(),
+                                    modulus_->data(), cfg_intt,
+                                    2 * batch_size * Q_prime_size_,
+                                    Q_prime_size_);
+
+            // ModDown + Permute + Add
+            divide_round_lastq_permute_add_bfv_kernel<<<
+                dim3((n >> 8), Q_size_, 2 * batch_size), 256, 0, stream>>>(
+                temp2_rotation, level_in, level_out, modulus_->data(),
+                half_p_->data(), half_mod_->data(), last_q_modinv_->data(),
+                galois_elt, n_power, Q_prime_size_, Q_size_, P_size_);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+            std::swap(level_in, level_out);
+        }
+
+        output.resize(output_count);
+        for (int i = 0; i < output_count; i++)
+        {
+            DeviceVector<Data64> output_memory(cipher_size, stream);
+            cudaMemcpyAsync(output_memory.data(), level_in + (i * cipher_size),
+                            cipher_size * sizeof(Data64),
+                            cudaMemcpyDeviceToDevice, stream);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+            output[i].memory_set(std::move(output_memory));
+        }
+    }
+
     __host__ void HEOperator<Scheme::BFV>::rotate_columns_method_I(
         Ciphertext<Scheme::BFV>& input1, Ciphertext<Scheme::BFV>& output,
         Galoiskey<Scheme::BFV>& galois_key, const cudaStream_t stream)
@@ -1459,6 +1614,7 @@ namespace heongpu
         gpuntt::GPU_NTT(input1.data(), output_memory.data(), ntt_table_->data(),
                         modulus_->data(), cfg_ntt, 2 * Q_size_, Q_size_);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
+        domain_statistics_.forward_transforms++;
 
         output.memory_set(std::move(output_memory));
     }
@@ -1481,10 +1637,31 @@ namespace heongpu
                         intt_table_->data(), modulus_->data(), cfg_intt,
                         2 * Q_size_, Q_size_);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
+        domain_statistics_.inverse_transforms++;
 
         output.memory_set(std::move(output_memory));
     }
 
+    __host__ void
+    HEOperator<Scheme::BFV>::require_domain(Ciphertext<Scheme::BFV>& input1,
+                                            bool in_ntt_domain,
+                                            const ExecutionOptions& options)
+    {
+        if (!lazy_domain_ || (input1.in_ntt_domain_ == in_ntt_domain))
+        {
+            return;
+        }
+
+        if (in_ntt_domain)
+        {
+            transform_to_ntt_inplace(input1, options);
+        }
+        else
+        {
+            transform_from_ntt_inplace(input1, options);
+        }
+    }
+
     ////////////////////////////////////////////////////////////////
     ////////////////////////////////////////////////////////////////
     //                       BOOTSRAPPING                         //
@@ -281,12 +281,18 @@ namespace heongpu
     }
 
     void Secretkey<Scheme::BFV>::load(std::istream& is)
+    {
+        load(is, scheme_type::bfv);
+    }
+
+    void Secretkey<Scheme::BFV>::load(std::istream& is,
+                                      scheme_type expected_scheme)
     {
         if ((!secret_key_generated_))
         {
             is.read((char*) &scheme_, sizeof(scheme_));
 
-            if (scheme_ != scheme_type::bfv)
+            if (scheme_ != expected_scheme)
             {
                 throw std::runtime_error("Invalid scheme binary!");
             }
@@ -0,0 +1,127 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "bgv/context.cuh"
+
+namespace heongpu
+{
+    HEContext<Scheme::BGV>::HEContext(const keyswitching_type ks_type,
+                                      const sec_level_type sec_level)
+        : HEContext<Scheme::BFV>(ks_type, sec_level)
+    {
+        scheme_ = scheme_type::bgv;
+    }
+
+    void HEContext<Scheme::BGV>::generate()
+    {
+        if (keyswitching_type_ != keyswitching_type::KEYSWITCHING_METHOD_I)
+        {
+            throw std::invalid_argument(
+                "BGV supports only key switching method I!");
+        }
+
+        if (coeff_modulus_specified_ && (P_size != 1))
+        {
+            throw std::invalid_argument(
+                "BGV supports only a single P modulus!");
+        }
+
+        HEContext<Scheme::BFV>::generate();
+
+        generate_modulus_switching_parameters();
+    }
+
+    void HEContext<Scheme::BGV>::print_parameters()
+    {
+        if (context_generated_)
+        {
+            std::string scheme_string = "BGV";
+            std::cout << "==== HEonGPU a GPU Based Homomorphic Encryption "
+                         "Library ====\n"
+                      << std::endl;
+            std::cout << "Encryption parameters:" << std::endl;
+            std::cout << "-->   scheme: " << scheme_string << std::endl;
+            std::cout << "-->   poly_modulus_degree: " << n << std::endl;
+            std::cout << "-->   Q_tilta size: Q( ";
+
+            for (std::size_t i = 0; i < Q_mod_bit_sizes_.size() - 1; i++)
+            {
+                std::cout << Q_mod_bit_sizes_[i] << " + ";
+            }
+            std::cout << Q_mod_bit_sizes_.back();
+            std::cout << " ) + P( ";
+            for (std::size_t i = 0; i < P_mod_bit_sizes_.size() - 1; i++)
+            {
+                std::cout << P_mod_bit_sizes_[i] << " + ";
+            }
+            std::cout << P_mod_bit_sizes_.back();
+            std::cout << " ) bits" << std::endl;
+
+            std::cout << "-->   plain_modulus: " << plain_modulus_.value
+                      << std::endl;
+
+            std::cout << std::endl;
+        }
+        else
+        {
+            std::cout << "Parameters is not generated yet!" << std::endl;
+        }
+    }
+
+    void HEContext<Scheme::BGV>::load(std::istream& is)
+    {
+        HEContext<Scheme::BFV>::load(is);
+
+        if (scheme_ != scheme_type::bgv)
+        {
+            throw std::runtime_error("Invalid scheme binary!");
+        }
+
+        if ((keyswitching_type_ != keyswitching_type::KEYSWITCHING_METHOD_I) ||
+            (P_size != 1))
+        {
+            throw std::runtime_error("Invalid BGV key switching parameters!");
+        }
+
+        generate_modulus_switching_parameters();
+    }
+
+    void HEContext<Scheme::BGV>::generate_modulus_switching_parameters()
+    {
+        Modulus64 plain_mod = plain_modulus_;
+
+        std::vector<Data64> switch_last_q_modinv;
+        switch_plain_inv_.clear();
+        switch_last_q_inv_mod_t_.clear();
+        for (int j = 0; j < (Q_size - 1); j++)
+        {
+            int inner = (Q_size - 1) - j;
+
+            Data64 plain_mod_q = plain_mod.value % prime_vector_[inner].value;
+            switch_plain_inv_.push_back(
+                OPERATOR64::modinv(plain_mod_q, prime_vector_[inner]));
+
+            Data64 q_mod_plain = prime_vector_[inner].value % plain_mod.value;
+            switch_last_q_inv_mod_t_.push_back(
+                OPERATOR64::modinv(q_mod_plain, plain_mod));
+
+            for (int i = 0; i < inner; i++)
+            {
+                Data64 temp_ =
+                    prime_vector_[inner].value % prime_vector_[i].value;
+                switch_last_q_modinv.push_back(
+                    OPERATOR64::modinv(temp_, prime_vector_[i]));
+            }
+        }
+
+        switch_last_q_modinv_ =
+            std::make_shared<DeviceVector<Data64>>(switch_last_q_modinv);
+
+        Modulus64 key_mod = prime_vector_[Q_size];
+        plain_inv_p_ =
+            OPERATOR64::modinv(plain_mod.value % key_mod.value, key_mod);
+    }
+
+} // namespace heongpu
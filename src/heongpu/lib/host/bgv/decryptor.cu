@@ -0,0 +1,130 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "bgv/decryptor.cuh"
+
+namespace heongpu
+{
+    __host__
+    HEDecryptor<Scheme::BGV>::HEDecryptor(HEContext<Scheme::BGV>& context,
+                                          Secretkey<Scheme::BGV>& secret_key)
+    {
+        if (!context.context_generated_)
+        {
+            throw std::invalid_argument("HEContext is not generated!");
+        }
+
+        scheme_ = context.scheme_;
+
+        if (secret_key.storage_type_ == storage_type::DEVICE)
+        {
+            secret_key_ = secret_key.device_locations_;
+        }
+        else
+        {
+            secret_key.store_in_device();
+            secret_key_ = secret_key.device_locations_;
+        }
+
+        n = context.n;
+        n_power = context.n_power;
+
+        Q_size_ = context.Q_size;
+
+        modulus_ = context.modulus_;
+
+        ntt_table_ = context.ntt_table_;
+        intt_table_ = context.intt_table_;
+
+        n_inverse_ = context.n_inverse_;
+
+        plain_modulus_ = context.plain_modulus_;
+
+        switch_last_q_modinv_ = context.switch_last_q_modinv_;
+        switch_plain_inv_ = context.switch_plain_inv_;
+        switch_last_q_inv_mod_t_ = context.switch_last_q_inv_mod_t_;
+    }
+
+    __host__ void
+    HEDecryptor<Scheme::BGV>::decrypt_bgv(Plaintext<Scheme::BGV>& plaintext,
+                                          Ciphertext<Scheme::BGV>& ciphertext,
+                                          const cudaStream_t stream)
+    {
+        int current_decomp_count = Q_size_ - ciphertext.depth_;
+        Data64 correction = ciphertext.correction_factor_;
+
+        // Noise only has to stay below q0 / 2, so the ciphertext is switched
+        // down to the first prime and decrypted on a single limb.
+        int location = 0;
+        for (int i = 0; i < ciphertext.depth_; i++)
+        {
+            location += (Q_size_ - 1 - i);
+        }
+
+        Data64* ct = ciphertext.data();
+        DeviceVector<Data64> switched_memory;
+        for (int i = ciphertext.depth_; i < (Q_size_ - 1); i++)
+        {
+            DeviceVector<Data64> output_memory(
+                2 * (current_decomp_count - 1) * n, stream);
+
+            bgv_mod_switch_kernel<<<
+                dim3((n >> 8), current_decomp_count - 1, 2), 256, 0, stream>>>(
+                ct, output_memory.data(), modulus_->data(),
+                switch_last_q_modinv_->data() + location, switch_plain_inv_[i],
+                plain_modulus_.value, n_power, current_decomp_count);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+            correction = OPERATOR64::mult(
+                correction, switch_last_q_inv_mod_t_[i], plain_modulus_);
+
+            location += (Q_size_ - 1 - i);
+            current_decomp_count--;
+
+            switched_memory = std::move(output_memory);
+            ct = switched_memory.data();
+        }
+
+        DeviceVector<Data64> temp_memory(n, stream);
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::FORWARD,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .stream = stream};
+
+        gpuntt::GPU_NTT(ct + n, temp_memory.data(), ntt_table_->data(),
+                        modulus_->data(), cfg_ntt, 1, 1);
+
+        sk_multiplication<<<dim3((n >> 8), 1, 1), 256, 0, stream>>>(
+            temp_memory.data(), secret_key_.data(), temp_memory.data(),
+            modulus_->data(), n_power, 1);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_intt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::INVERSE,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .mod_inverse = n_inverse_->data(),
+            .stream = stream};
+
+        gpuntt::GPU_NTT_Inplace(temp_memory.data(), intt_table_->data(),
+                                modulus_->data(), cfg_intt, 1, 1);
+
+        Data64 correction_inv = OPERATOR64::modinv(correction, plain_modulus_);
+
+        DeviceVector<Data64> output_memory(n, stream);
+
+        decryption_bgv_kernel<<<dim3((n >> 8), 1, 1), 256, 0, stream>>>(
+            ct, temp_memory.data(), output_memory.data(), modulus_->data(),
+            plain_modulus_, correction_inv, n_power);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        plaintext.memory_set(std::move(output_memory));
+    }
+
+} // namespace heongpu
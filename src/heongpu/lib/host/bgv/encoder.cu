@@ -0,0 +1,15 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "bgv/encoder.cuh"
+
+namespace heongpu
+{
+    __host__ HEEncoder<Scheme::BGV>::HEEncoder(HEContext<Scheme::BGV>& context)
+        : HEEncoder<Scheme::BFV>(context)
+    {
+    }
+
+} // namespace heongpu
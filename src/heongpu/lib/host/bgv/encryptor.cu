@@ -0,0 +1,112 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "bgv/encryptor.cuh"
+
+namespace heongpu
+{
+    __host__
+    HEEncryptor<Scheme::BGV>::HEEncryptor(HEContext<Scheme::BGV>& context,
+                                          Publickey<Scheme::BGV>& public_key)
+    {
+        if (!context.context_generated_)
+        {
+            throw std::invalid_argument("HEContext is not generated!");
+        }
+
+        scheme_ = context.scheme_;
+
+        if (public_key.storage_type_ == storage_type::DEVICE)
+        {
+            public_key_ = public_key.device_locations_;
+        }
+        else
+        {
+            public_key.store_in_device();
+            public_key_ = public_key.device_locations_;
+        }
+
+        n = context.n;
+        n_power = context.n_power;
+
+        Q_prime_size_ = context.Q_prime_size;
+        Q_size_ = context.Q_size;
+
+        modulus_ = context.modulus_;
+
+        last_q_modinv_ = context.last_q_modinv_;
+
+        ntt_table_ = context.ntt_table_;
+        intt_table_ = context.intt_table_;
+
+        n_inverse_ = context.n_inverse_;
+
+        plain_modulus_ = context.plain_modulus_;
+        plain_inv_p_ = context.plain_inv_p_;
+
+        upper_threshold_ = context.upper_threshold_;
+        upper_halfincrement_ = context.upper_halfincrement_;
+    }
+
+    __host__ void
+    HEEncryptor<Scheme::BGV>::encrypt_bgv(Ciphertext<Scheme::BGV>& ciphertext,
+                                          Plaintext<Scheme::BGV>& plaintext,
+                                          const cudaStream_t stream)
+    {
+        DeviceVector<Data64> output_memory((2 * n * Q_size_), stream);
+
+        DeviceVector<Data64> gpu_space(5 * Q_prime_size_ * n, stream);
+        Data64* u_poly = gpu_space.data();
+        Data64* error_poly = u_poly + (Q_prime_size_ * n);
+        Data64* pk_u_poly = error_poly + (2 * Q_prime_size_ * n);
+
+        RandomNumberGenerator::instance()
+            .modular_ternary_random_number_generation(
+                u_poly, modulus_->data(), n_power, Q_prime_size_, 1, stream);
+
+        RandomNumberGenerator::instance()
+            .modular_gaussian_random_number_generation(
+                error_std_dev, error_poly, modulus_->data(), n_power,
+                Q_prime_size_, 2, stream);
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::FORWARD,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .stream = stream};
+
+        gpuntt::GPU_NTT_Inplace(u_poly, ntt_table_->data(), modulus_->data(),
+                                cfg_ntt, Q_prime_size_, Q_prime_size_);
+
+        pk_u_kernel<<<dim3((n >> 8), Q_prime_size_, 2), 256, 0, stream>>>(
+            public_key_.data(), u_poly, pk_u_poly, modulus_->data(), n_power,
+            Q_prime_size_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_intt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::INVERSE,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .mod_inverse = n_inverse_->data(),
+            .stream = stream};
+
+        gpuntt::GPU_NTT_Inplace(pk_u_poly, intt_table_->data(),
+                                modulus_->data(), cfg_intt, 2 * Q_prime_size_,
+                                Q_prime_size_);
+
+        enc_div_lastq_bgv_kernel<<<dim3((n >> 8), Q_size_, 2), 256, 0,
+                                   stream>>>(
+            pk_u_poly, error_poly, plaintext.data(), output_memory.data(),
+            modulus_->data(), last_q_modinv_->data(), plain_modulus_.value,
+            plain_inv_p_, upper_threshold_, upper_halfincrement_->data(),
+            n_power, Q_prime_size_, Q_size_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        ciphertext.memory_set(std::move(output_memory));
+    }
+
+} // namespace heongpu
@@ -0,0 +1,43 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "bgv/evaluationkey.cuh"
+
+namespace heongpu
+{
+    __host__ Relinkey<Scheme::BGV>::Relinkey(HEContext<Scheme::BGV>& context)
+        : Relinkey<Scheme::BFV>(context)
+    {
+    }
+
+    __host__ Galoiskey<Scheme::BGV>::Galoiskey(HEContext<Scheme::BGV>& context)
+        : Galoiskey<Scheme::BFV>(context)
+    {
+    }
+
+    __host__ Galoiskey<Scheme::BGV>::Galoiskey(HEContext<Scheme::BGV>& context,
+                                               std::vector<int>& shift_vec)
+        : Galoiskey<Scheme::BFV>(context, shift_vec)
+    {
+    }
+
+    __host__
+    Galoiskey<Scheme::BGV>::Galoiskey(HEContext<Scheme::BGV>& context,
+                                      std::vector<uint32_t>& galois_elts)
+        : Galoiskey<Scheme::BFV>(context, galois_elts)
+    {
+    }
+
+    void Relinkey<Scheme::BGV>::load(std::istream& is)
+    {
+        Relinkey<Scheme::BFV>::load(is, scheme_type::bgv);
+    }
+
+    void Galoiskey<Scheme::BGV>::load(std::istream& is)
+    {
+        Galoiskey<Scheme::BFV>::load(is, scheme_type::bgv);
+    }
+
+} // namespace heongpu
@@ -0,0 +1,343 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "bgv/keygenerator.cuh"
+
+namespace heongpu
+{
+    __host__
+    HEKeyGenerator<Scheme::BGV>::HEKeyGenerator(HEContext<Scheme::BGV>& context)
+    {
+        if (!context.context_generated_)
+        {
+            throw std::invalid_argument("HEContext is not generated!");
+        }
+
+        scheme = context.scheme_;
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        seed_ = gen();
+        offset_ = gen();
+
+        new_seed_ = RNGSeed();
+
+        n = context.n;
+        n_power = context.n_power;
+
+        Q_prime_size_ = context.Q_prime_size;
+        Q_size_ = context.Q_size;
+
+        modulus_ = context.modulus_;
+        ntt_table_ = context.ntt_table_;
+        factor_ = context.factor_;
+
+        plain_modulus_ = context.plain_modulus_;
+    }
+
+    __host__ void HEKeyGenerator<Scheme::BGV>::generate_secret_key(
+        Secretkey<Scheme::BGV>& sk, const ExecutionOptions& options)
+    {
+        if (sk.secret_key_generated_)
+        {
+            throw std::logic_error("Secretkey is already generated!");
+        }
+
+        input_storage_manager(
+            sk,
+            [&](Secretkey<Scheme::BGV>& sk_)
+            {
+                DeviceVector<int> secret_key_without_rns((n), options.stream_);
+
+                secretkey_gen_kernel<<<dim3((n >> 8), 1, 1), 256, 0,
+                                       options.stream_>>>(
+                    secret_key_without_rns.data(), sk_.hamming_weight_, n_power,
+                    seed_);
+                HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                DeviceVector<Data64> secret_key_rns(
+                    (sk_.coeff_modulus_count() * n), options.stream_);
+
+                secretkey_rns_kernel<<<dim3((n >> 8), 1, 1), 256, 0,
+                                       options.stream_>>>(
+                    secret_key_without_rns.data(), secret_key_rns.data(),
+                    modulus_->data(), n_power, Q_prime_size_);
+                HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+                    .n_power = n_power,
+                    .ntt_type = gpuntt::FORWARD,
+                    .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+                    .zero_padding = false,
+                    .stream = options.stream_};
+
+                gpuntt::GPU_NTT_Inplace(secret_key_rns.data(),
+                                        ntt_table_->data(), modulus_->data(),
+                                        cfg_ntt, Q_prime_size_, Q_prime_size_);
+                HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                sk_.in_ntt_domain_ = true;
+                sk_.secret_key_generated_ = true;
+
+                sk_.memory_set(std::move(secret_key_rns));
+            },
+            options, true);
+    }
+
+    __host__ void HEKeyGenerator<Scheme::BGV>::generate_public_key(
+        Publickey<Scheme::BGV>& pk, Secretkey<Scheme::BGV>& sk,
+        const ExecutionOptions& options)
+    {
+        if (!sk.secret_key_generated_)
+        {
+            throw std::logic_error("Secretkey is not generated!");
+        }
+
+        if (pk.public_key_generated_)
+        {
+            throw std::logic_error("Publickey is already generated!");
+        }
+
+        input_storage_manager(
+            sk,
+            [&](Secretkey<Scheme::BGV>& sk_)
+            {
+                output_storage_manager(
+                    pk,
+                    [&](Publickey<Scheme::BGV>& pk_)
+                    {
+                        DeviceVector<Data64> output_memory(
+                            (2 * Q_prime_size_ * n), options.stream_);
+
+                        DeviceVector<Data64> errors_a(2 * Q_prime_size_ * n,
+                                                      options.stream_);
+                        Data64* error_poly = errors_a.data();
+                        Data64* a_poly = error_poly + (Q_prime_size_ * n);
+
+                        RandomNumberGenerator::instance()
+                            .modular_uniform_random_number_generation(
+                                a_poly, modulus_->data(), n_power,
+                                Q_prime_size_, 1, options.stream_);
+
+                        generate_plain_scaled_error(error_poly, 1,
+                                                    options.stream_);
+
+                        publickey_gen_kernel<<<dim3((n >> 8), Q_prime_size_, 1),
+                                               256, 0, options.stream_>>>(
+                            output_memory.data(), sk_.data(), error_poly,
+                            a_poly, modulus_->data(), n_power, Q_prime_size_);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        pk_.memory_set(std::move(output_memory));
+
+                        pk_.in_ntt_domain_ = true;
+                        pk_.public_key_generated_ = true;
+                    },
+                    options);
+            },
+            options, false);
+    }
+
+    __host__ void HEKeyGenerator<Scheme::BGV>::generate_relin_key(
+        Relinkey<Scheme::BGV>& rk, Secretkey<Scheme::BGV>& sk,
+        const ExecutionOptions& options)
+    {
+        if (!sk.secret_key_generated_)
+        {
+            throw std::logic_error("Secretkey is not generated!");
+        }
+
+        if (rk.relin_key_generated_)
+        {
+            throw std::logic_error("Relinkey is already generated!");
+        }
+
+        input_storage_manager(
+            sk,
+            [&](Secretkey<Scheme::BGV>& sk_)
+            {
+                output_storage_manager(
+                    rk,
+                    [&](Relinkey<Scheme::BGV>& rk_)
+                    {
+                        DeviceVector<Data64> errors_a(
+                            2 * Q_prime_size_ * Q_size_ * n, options.stream_);
+                        Data64* error_poly = errors_a.data();
+                        Data64* a_poly =
+                            error_poly + (Q_prime_size_ * Q_size_ * n);
+
+                        RandomNumberGenerator::instance()
+                            .modular_uniform_random_number_generation(
+                                a_poly, modulus_->data(), n_power,
+                                Q_prime_size_, Q_size_, options.stream_);
+
+                        generate_plain_scaled_error(error_poly, Q_size_,
+                                                    options.stream_);
+
+                        DeviceVector<Data64> output_memory(rk_.relinkey_size_,
+                                                           options.stream_);
+
+                        relinkey_gen_kernel<<<dim3((n >> 8), Q_prime_size_, 1),
+                                              256, 0, options.stream_>>>(
+                            output_memory.data(), sk_.data(), error_poly,
+                            a_poly, modulus_->data(), factor_->data(), n_power,
+                            Q_prime_size_, Q_size_);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        rk_.memory_set(std::move(output_memory));
+
+                        rk_.relin_key_generated_ = true;
+                    },
+                    options);
+            },
+            options, false);
+    }
+
+    __host__ void HEKeyGenerator<Scheme::BGV>::generate_galois_key(
+        Galoiskey<Scheme::BGV>& gk, Secretkey<Scheme::BGV>& sk,
+        const ExecutionOptions& options)
+    {
+        if (!sk.secret_key_generated_)
+        {
+            throw std::logic_error("Secretkey is not generated!");
+        }
+
+        if (gk.galois_key_generated_)
+        {
+            throw std::logic_error("Galoiskey is already generated!");
+        }
+
+        input_storage_manager(
+            sk,
+            [&](Secretkey<Scheme::BGV>& sk_)
+            {
+                // Row rotation keys are generated with the inverse of their
+                // Galois element, the column rotation key with its own.
+                std::vector<int> storage_elts;
+                std::vector<int> kernel_elts;
+                if (!gk.customized)
+                {
+                    for (auto& galois : gk.galois_elt)
+                    {
+                        storage_elts.push_back(galois.second);
+                        kernel_elts.push_back(modInverse(galois.second, 2 * n));
+                    }
+                }
+                else
+                {
+                    for (auto& galois_ : gk.custom_galois_elt)
+                    {
+                        storage_elts.push_back(galois_);
+                        kernel_elts.push_back(modInverse(galois_, 2 * n));
+                    }
+                }
+
+                int key_count = kernel_elts.size();
+                for (int i = 0; i < key_count; i++)
+                {
+                    DeviceVector<Data64> output_memory(gk.galoiskey_size_,
+                                                       options.stream_);
+
+                    generate_galois_key_piece(sk_, kernel_elts[i],
+                                              output_memory.data(),
+                                              options.stream_);
+
+                    if (options.storage_ == storage_type::DEVICE)
+                    {
+                        gk.device_location_[storage_elts[i]] =
+                            std::move(output_memory);
+                    }
+                    else
+                    {
+                        gk.host_location_[storage_elts[i]] =
+                            HostVector<Data64>(gk.galoiskey_size_);
+                        cudaMemcpyAsync(
+                            gk.host_location_[storage_elts[i]].data(),
+                            output_memory.data(),
+                            gk.galoiskey_size_ * sizeof(Data64),
+                            cudaMemcpyDeviceToHost, options.stream_);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+                    }
+                }
+
+                // Columns Rotate
+                DeviceVector<Data64> zero_memory(gk.galoiskey_size_,
+                                                 options.stream_);
+
+                generate_galois_key_piece(sk_, gk.galois_elt_zero,
+                                          zero_memory.data(), options.stream_);
+
+                if (options.storage_ == storage_type::DEVICE)
+                {
+                    gk.zero_device_location_ = std::move(zero_memory);
+                }
+                else
+                {
+                    gk.zero_host_location_ =
+                        HostVector<Data64>(gk.galoiskey_size_);
+                    cudaMemcpyAsync(gk.zero_host_location_.data(),
+                                    zero_memory.data(),
+                                    gk.galoiskey_size_ * sizeof(Data64),
+                                    cudaMemcpyDeviceToHost, options.stream_);
+                    HEONGPU_CUDA_CHECK(cudaGetLastError());
+                }
+
+                gk.galois_key_generated_ = true;
+                gk.storage_type_ = options.storage_;
+            },
+            options, false);
+    }
+
+    __host__ void HEKeyGenerator<Scheme::BGV>::generate_plain_scaled_error(
+        Data64* error_poly, int poly_count, const cudaStream_t stream)
+    {
+        RandomNumberGenerator::instance()
+            .modular_gaussian_random_number_generation(
+                error_std_dev, error_poly, modulus_->data(), n_power,
+                Q_prime_size_, poly_count, stream);
+
+        // Scaling by t is linear, so it is done before the NTT.
+        cipher_scalar_multiplication_kernel<<<
+            dim3((n >> 8), Q_prime_size_, poly_count), 256, 0, stream>>>(
+            error_poly, plain_modulus_.value, error_poly, modulus_->data(),
+            n_power);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::FORWARD,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .stream = stream};
+
+        gpuntt::GPU_NTT_Inplace(error_poly, ntt_table_->data(),
+                                modulus_->data(), cfg_ntt,
+                                poly_count * Q_prime_size_, Q_prime_size_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+    }
+
+    __host__ void HEKeyGenerator<Scheme::BGV>::generate_galois_key_piece(
+        Secretkey<Scheme::BGV>& sk, int galois_elt, Data64* output,
+        const cudaStream_t stream)
+    {
+        DeviceVector<Data64> errors_a(2 * Q_prime_size_ * Q_size_ * n, stream);
+        Data64* error_poly = errors_a.data();
+        Data64* a_poly = error_poly + (Q_prime_size_ * Q_size_ * n);
+
+        RandomNumberGenerator::instance()
+            .modular_uniform_random_number_generation(
+                a_poly, modulus_->data(), n_power, Q_prime_size_, Q_size_,
+                stream);
+
+        generate_plain_scaled_error(error_poly, Q_size_, stream);
+
+        galoiskey_gen_kernel<<<dim3((n >> 8), Q_prime_size_, 1), 256, 0,
+                               stream>>>(output, sk.data(), error_poly, a_poly,
+                                         modulus_->data(), factor_->data(),
+                                         galois_elt, n_power, Q_prime_size_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+    }
+
+} // namespace heongpu
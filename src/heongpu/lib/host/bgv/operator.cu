@@ -0,0 +1,1027 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "bgv/operator.cuh"
+
+namespace heongpu
+{
+    __host__
+    HEOperator<Scheme::BGV>::HEOperator(HEContext<Scheme::BGV>& context,
+                                        HEEncoder<Scheme::BGV>& encoder)
+    {
+        if (!context.context_generated_)
+        {
+            throw std::invalid_argument("HEContext is not generated!");
+        }
+
+        scheme_ = context.scheme_;
+
+        n = context.n;
+
+        n_power = context.n_power;
+
+        Q_prime_size_ = context.Q_prime_size;
+        Q_size_ = context.Q_size;
+
+        modulus_ = context.modulus_;
+
+        ntt_table_ = context.ntt_table_;
+
+        intt_table_ = context.intt_table_;
+
+        n_inverse_ = context.n_inverse_;
+
+        last_q_modinv_ = context.last_q_modinv_;
+
+        plain_modulus_ = context.plain_modulus_;
+        plain_inv_p_ = context.plain_inv_p_;
+
+        upper_threshold_ = context.upper_threshold_;
+        upper_halfincrement_ = context.upper_halfincrement_;
+
+        switch_last_q_modinv_ = context.switch_last_q_modinv_;
+        switch_plain_inv_ = context.switch_plain_inv_;
+        switch_last_q_inv_mod_t_ = context.switch_last_q_inv_mod_t_;
+
+        // Unlike CKKS, a BGV ciphertext can be key switched at its last level
+        // too, so the order is stored for all Q_size levels.
+        std::vector<int> prime_loc;
+        int counter = Q_size_;
+        for (int i = 0; i < Q_size_; i++)
+        {
+            for (int j = 0; j < counter; j++)
+            {
+                prime_loc.push_back(j);
+            }
+            counter--;
+            prime_loc.push_back(Q_size_);
+        }
+
+        new_prime_locations_ = DeviceVector<int>(prime_loc);
+        new_prime_locations = new_prime_locations_.data();
+
+        slot_count_ = encoder.slot_count_;
+    }
+
+    __host__ void HEOperator<Scheme::BGV>::add(Ciphertext<Scheme::BGV>& input1,
+                                               Ciphertext<Scheme::BGV>& input2,
+                                               Ciphertext<Scheme::BGV>& output,
+                                               const ExecutionOptions& options)
+    {
+        check_binary_inputs(input1, input2);
+
+        int cipher_size = input1.relinearization_required_ ? 3 : 2;
+
+        int current_decomp_count = Q_size_ - input1.depth_;
+
+        input_storage_manager(
+            input1,
+            [&](Ciphertext<Scheme::BGV>& input1_)
+            {
+                input_storage_manager(
+                    input2,
+                    [&](Ciphertext<Scheme::BGV>& input2_)
+                    {
+                        output_storage_manager(
+                            output,
+                            [&](Ciphertext<Scheme::BGV>& output_)
+                            {
+                                DeviceVector<Data64> scaled_memory;
+                                Data64* input2_data = aligned_correction_data(
+                                    input1_, input2_, scaled_memory,
+                                    options.stream_);
+
+                                DeviceVector<Data64> output_memory(
+                                    (cipher_size * n * current_decomp_count),
+                                    options.stream_);
+
+                                addition<<<dim3((n >> 8), current_decomp_count,
+                                                cipher_size),
+                                           256, 0, options.stream_>>>(
+                                    input1_.data(), input2_data,
+                                    output_memory.data(), modulus_->data(),
+                                    n_power);
+                                HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                                output_.scheme_ = scheme_;
+                                output_.ring_size_ = n;
+                                output_.coeff_modulus_count_ = Q_size_;
+                                output_.cipher_size_ = cipher_size;
+                                output_.depth_ = input1_.depth_;
+                                output_.correction_factor_ =
+                                    input1_.correction_factor_;
+                                output_.relinearization_required_ =
+                                    input1_.relinearization_required_;
+                                output_.ciphertext_generated_ = true;
+
+                                output_.memory_set(std::move(output_memory));
+                            },
+                            options);
+                    },
+                    options, (&input2 == &output));
+            },
+            options, (&input1 == &output));
+    }
+
+    __host__ void HEOperator<Scheme::BGV>::sub(Ciphertext<Scheme::BGV>& input1,
+                                               Ciphertext<Scheme::BGV>& input2,
+                                               Ciphertext<Scheme::BGV>& output,
+                                               const ExecutionOptions& options)
+    {
+        check_binary_inputs(input1, input2);
+
+        int cipher_size = input1.relinearization_required_ ? 3 : 2;
+
+        int current_decomp_count = Q_size_ - input1.depth_;
+
+        input_storage_manager(
+            input1,
+            [&](Ciphertext<Scheme::BGV>& input1_)
+            {
+                input_storage_manager(
+                    input2,
+                    [&](Ciphertext<Scheme::BGV>& input2_)
+                    {
+                        output_storage_manager(
+                            output,
+                            [&](Ciphertext<Scheme::BGV>& output_)
+                            {
+                                DeviceVector<Data64> scaled_memory;
+                                Data64* input2_data = aligned_correction_data(
+                                    input1_, input2_, scaled_memory,
+                                    options.stream_);
+
+                                DeviceVector<Data64> output_memory(
+                                    (cipher_size * n * current_decomp_count),
+                                    options.stream_);
+
+                                substraction<<<dim3((n >> 8),
+                                                    current_decomp_count,
+                                                    cipher_size),
+                                               256, 0, options.stream_>>>(
+                                    input1_.data(), input2_data,
+                                    output_memory.data(), modulus_->data(),
+                                    n_power);
+                                HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                                output_.scheme_ = scheme_;
+                                output_.ring_size_ = n;
+                                output_.coeff_modulus_count_ = Q_size_;
+                                output_.cipher_size_ = cipher_size;
+                                output_.depth_ = input1_.depth_;
+                                output_.correction_factor_ =
+                                    input1_.correction_factor_;
+                                output_.relinearization_required_ =
+                                    input1_.relinearization_required_;
+                                output_.ciphertext_generated_ = true;
+
+                                output_.memory_set(std::move(output_memory));
+                            },
+                            options);
+                    },
+                    options, (&input2 == &output));
+            },
+            options, (&input1 == &output));
+    }
+
+    __host__ void
+    HEOperator<Scheme::BGV>::negate(Ciphertext<Scheme::BGV>& input1,
+                                    Ciphertext<Scheme::BGV>& output,
+                                    const ExecutionOptions& options)
+    {
+        int cipher_size = input1.relinearization_required_ ? 3 : 2;
+
+        int current_decomp_count = Q_size_ - input1.depth_;
+
+        if (input1.memory_size() < (cipher_size * n * current_decomp_count))
+        {
+            throw std::invalid_argument("Invalid Ciphertexts size!");
+        }
+
+        input_storage_manager(
+            input1,
+            [&](Ciphertext<Scheme::BGV>& input1_)
+            {
+                output_storage_manager(
+                    output,
+                    [&](Ciphertext<Scheme::BGV>& output_)
+                    {
+                        DeviceVector<Data64> output_memory(
+                            (cipher_size * n * current_decomp_count),
+                            options.stream_);
+
+                        negation<<<dim3((n >> 8), current_decomp_count,
+                                        cipher_size),
+                                   256, 0, options.stream_>>>(
+                            input1_.data(), output_memory.data(),
+                            modulus_->data(), n_power);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        output_.scheme_ = scheme_;
+                        output_.ring_size_ = n;
+                        output_.coeff_modulus_count_ = Q_size_;
+                        output_.cipher_size_ = cipher_size;
+                        output_.depth_ = input1_.depth_;
+                        output_.correction_factor_ = input1_.correction_factor_;
+                        output_.relinearization_required_ =
+                            input1_.relinearization_required_;
+                        output_.ciphertext_generated_ = true;
+
+                        output_.memory_set(std::move(output_memory));
+                    },
+                    options);
+            },
+            options, (&input1 == &output));
+    }
+
+    __host__ void
+    HEOperator<Scheme::BGV>::add_plain(Ciphertext<Scheme::BGV>& input1,
+                                       Plaintext<Scheme::BGV>& input2,
+                                       Ciphertext<Scheme::BGV>& output,
+                                       const ExecutionOptions& options)
+    {
+        add_sub_plain_bgv(input1, input2, output, true, options);
+    }
+
+    __host__ void
+    HEOperator<Scheme::BGV>::sub_plain(Ciphertext<Scheme::BGV>& input1,
+                                       Plaintext<Scheme::BGV>& input2,
+                                       Ciphertext<Scheme::BGV>& output,
+                                       const ExecutionOptions& options)
+    {
+        add_sub_plain_bgv(input1, input2, output, false, options);
+    }
+
+    __host__ void
+    HEOperator<Scheme::BGV>::multiply(Ciphertext<Scheme::BGV>& input1,
+                                      Ciphertext<Scheme::BGV>& input2,
+                                      Ciphertext<Scheme::BGV>& output,
+                                      const ExecutionOptions& options)
+    {
+        check_binary_inputs(input1, input2);
+
+        if (input1.relinearization_required_)
+        {
+            throw std::invalid_argument(
+                "Ciphertexts should be relinearized before multiplication!");
+        }
+
+        int current_decomp_count = Q_size_ - input1.depth_;
+
+        input_storage_manager(
+            input1,
+            [&](Ciphertext<Scheme::BGV>& input1_)
+            {
+                input_storage_manager(
+                    input2,
+                    [&](Ciphertext<Scheme::BGV>& input2_)
+                    {
+                        output_storage_manager(
+                            output,
+                            [&](Ciphertext<Scheme::BGV>& output_)
+                            {
+                                cudaStream_t stream = options.stream_;
+
+                                DeviceVector<Data64> temp_mul(
+                                    (4 * n * current_decomp_count), stream);
+                                Data64* temp1_mul = temp_mul.data();
+                                Data64* temp2_mul =
+                                    temp1_mul + (2 * n * current_decomp_count);
+
+                                DeviceVector<Data64> output_memory(
+                                    (3 * n * current_decomp_count), stream);
+
+                                gpuntt::ntt_rns_configuration<Data64> cfg_ntt =
+                                    {.n_power = n_power,
+                                     .ntt_type = gpuntt::FORWARD,
+                                     .reduction_poly =
+                                         gpuntt::ReductionPolynomial::X_N_plus,
+                                     .zero_padding = false,
+                                     .stream = stream};
+
+                                gpuntt::GPU_NTT(
+                                    input1_.data(), temp1_mul,
+                                    ntt_table_->data(), modulus_->data(),
+                                    cfg_ntt, 2 * current_decomp_count,
+                                    current_decomp_count);
+
+                                gpuntt::GPU_NTT(
+                                    input2_.data(), temp2_mul,
+                                    ntt_table_->data(), modulus_->data(),
+                                    cfg_ntt, 2 * current_decomp_count,
+                                    current_decomp_count);
+
+                                cross_multiplication<<<
+                                    dim3((n >> 8), current_decomp_count, 1),
+                                    256, 0, stream>>>(
+                                    temp1_mul, temp2_mul, output_memory.data(),
+                                    modulus_->data(), n_power,
+                                    current_decomp_count);
+                                HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                                gpuntt::ntt_rns_configuration<Data64> cfg_intt =
+                                    {.n_power = n_power,
+                                     .ntt_type = gpuntt::INVERSE,
+                                     .reduction_poly =
+                                         gpuntt::ReductionPolynomial::X_N_plus,
+                                     .zero_padding = false,
+                                     .mod_inverse = n_inverse_->data(),
+                                     .stream = stream};
+
+                                gpuntt::GPU_NTT_Inplace(
+                                    output_memory.data(), intt_table_->data(),
+                                    modulus_->data(), cfg_intt,
+                                    3 * current_decomp_count,
+                                    current_decomp_count);
+
+                                int depth = input1_.depth_;
+                                Data64 correction_factor = OPERATOR64::mult(
+                                    input1_.correction_factor_,
+                                    input2_.correction_factor_,
+                                    plain_modulus_);
+
+                                if (auto_mod_switch_ &&
+                                    (depth < (Q_size_ - 1)))
+                                {
+                                    DeviceVector<Data64> switched_memory(
+                                        (3 * n * (current_decomp_count - 1)),
+                                        stream);
+                                    mod_switch_bgv(output_memory.data(),
+                                                   switched_memory.data(),
+                                                   depth, 3, stream);
+                                    output_memory = std::move(switched_memory);
+
+                                    correction_factor = OPERATOR64::mult(
+                                        correction_factor,
+                                        switch_last_q_inv_mod_t_[depth],
+                                        plain_modulus_);
+                                    depth++;
+                                }
+
+                                output_.scheme_ = scheme_;
+                                output_.ring_size_ = n;
+                                output_.coeff_modulus_count_ = Q_size_;
+                                output_.cipher_size_ = 3;
+                                output_.depth_ = depth;
+                                output_.correction_factor_ = correction_factor;
+                                output_.relinearization_required_ = true;
+                                output_.ciphertext_generated_ = true;
+
+                                output_.memory_set(std::move(output_memory));
+                            },
+                            options);
+                    },
+                    options, (&input2 == &output));
+            },
+            options, (&input1 == &output));
+    }
+
+    __host__ void
+    HEOperator<Scheme::BGV>::multiply_plain(Ciphertext<Scheme::BGV>& input1,
+                                            Plaintext<Scheme::BGV>& input2,
+                                            Ciphertext<Scheme::BGV>& output,
+                                            const ExecutionOptions& options)
+    {
+        if (input1.relinearization_required_)
+        {
+            throw std::invalid_argument(
+                "Ciphertext should be relinearized before multiplication!");
+        }
+
+        if (input2.in_ntt_domain_ || (input2.size() < n))
+        {
+            throw std::invalid_argument("Invalid plaintext!");
+        }
+
+        int current_decomp_count = Q_size_ - input1.depth_;
+
+        if (input1.memory_size() < (2 * n * current_decomp_count))
+        {
+            throw std::invalid_argument("Invalid Ciphertexts size!");
+        }
+
+        input_storage_manager(
+            input1,
+            [&](Ciphertext<Scheme::BGV>& input1_)
+            {
+                input_storage_manager(
+                    input2,
+                    [&](Plaintext<Scheme::BGV>& input2_)
+                    {
+                        output_storage_manager(
+                            output,
+                            [&](Ciphertext<Scheme::BGV>& output_)
+                            {
+                                cudaStream_t stream = options.stream_;
+
+                                DeviceVector<Data64> temp_plain(
+                                    (n * current_decomp_count), stream);
+
+                                DeviceVector<Data64> output_memory(
+                                    (2 * n * current_decomp_count), stream);
+
+                                threshold_kernel<<<
+                                    dim3((n >> 8), current_decomp_count, 1),
+                                    256, 0, stream>>>(
+                                    input2_.data(), temp_plain.data(),
+                                    modulus_->data(),
+                                    upper_halfincrement_->data(),
+                                    upper_threshold_, n_power,
+                                    current_decomp_count);
+                                HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                                gpuntt::ntt_rns_configuration<Data64> cfg_ntt =
+                                    {.n_power = n_power,
+                                     .ntt_type = gpuntt::FORWARD,
+                                     .reduction_poly =
+                                         gpuntt::ReductionPolynomial::X_N_plus,
+                                     .zero_padding = false,
+                                     .stream = stream};
+
+                                gpuntt::GPU_NTT_Inplace(
+                                    temp_plain.data(), ntt_table_->data(),
+                                    modulus_->data(), cfg_ntt,
+                                    current_decomp_count,
+                                    current_decomp_count);
+
+                                gpuntt::GPU_NTT(
+                                    input1_.data(), output_memory.data(),
+                                    ntt_table_->data(), modulus_->data(),
+                                    cfg_ntt, 2 * current_decomp_count,
+                                    current_decomp_count);
+
+                                cipherplain_kernel<<<
+                                    dim3((n >> 8), current_decomp_count, 2),
+                                    256, 0, stream>>>(
+                                    output_memory.data(), temp_plain.data(),
+                                    output_memory.data(), modulus_->data(),
+                                    n_power, current_decomp_count);
+                                HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                                gpuntt::ntt_rns_configuration<Data64> cfg_intt =
+                                    {.n_power = n_power,
+                                     .ntt_type = gpuntt::INVERSE,
+                                     .reduction_poly =
+                                         gpuntt::ReductionPolynomial::X_N_plus,
+                                     .zero_padding = false,
+                                     .mod_inverse = n_inverse_->data(),
+                                     .stream = stream};
+
+                                gpuntt::GPU_NTT_Inplace(
+                                    output_memory.data(), intt_table_->data(),
+                                    modulus_->data(), cfg_intt,
+                                    2 * current_decomp_count,
+                                    current_decomp_count);
+
+                                output_.scheme_ = scheme_;
+                                output_.ring_size_ = n;
+                                output_.coeff_modulus_count_ = Q_size_;
+                                output_.cipher_size_ = 2;
+                                output_.depth_ = input1_.depth_;
+                                output_.correction_factor_ =
+                                    input1_.correction_factor_;
+                                output_.relinearization_required_ = false;
+                                output_.ciphertext_generated_ = true;
+
+                                output_.memory_set(std::move(output_memory));
+                            },
+                            options);
+                    },
+                    options, false);
+            },
+            options, (&input1 == &output));
+    }
+
+    __host__ void HEOperator<Scheme::BGV>::relinearize_inplace(
+        Ciphertext<Scheme::BGV>& input1, Relinkey<Scheme::BGV>& relin_key,
+        const ExecutionOptions& options)
+    {
+        if (!input1.relinearization_required_)
+        {
+            throw std::invalid_argument(
+                "Ciphertexts can not be relinearized!");
+        }
+
+        int current_decomp_count = Q_size_ - input1.depth_;
+
+        if (input1.memory_size() < (3 * n * current_decomp_count))
+        {
+            throw std::invalid_argument("Invalid Ciphertexts size!");
+        }
+
+        input_storage_manager(
+            input1,
+            [&](Ciphertext<Scheme::BGV>& input1_)
+            {
+                cudaStream_t stream = options.stream_;
+
+                DeviceVector<Data64> temp_relin(
+                    2 * n * (current_decomp_count + 1), stream);
+
+                // TODO: make it efficient
+                if (relin_key.storage_type_ == storage_type::DEVICE)
+                {
+                    switch_key_bgv(input1_.data() +
+                                       (current_decomp_count << (n_power + 1)),
+                                   relin_key.data(), temp_relin.data(),
+                                   input1_.depth_, stream);
+                }
+                else
+                {
+                    DeviceVector<Data64> key_location(
+                        relin_key.host_location_, stream);
+                    switch_key_bgv(input1_.data() +
+                                       (current_decomp_count << (n_power + 1)),
+                                   key_location.data(), temp_relin.data(),
+                                   input1_.depth_, stream);
+                }
+
+                DeviceVector<Data64> output_memory(
+                    (2 * n * current_decomp_count), stream);
+
+                bgv_divide_lastq_kernel<<<
+                    dim3((n >> 8), current_decomp_count, 2), 256, 0, stream>>>(
+                    temp_relin.data(), input1_.data(), output_memory.data(),
+                    modulus_->data(), last_q_modinv_->data(), plain_inv_p_,
+                    plain_modulus_.value, n_power, current_decomp_count,
+                    Q_size_);
+                HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                input1_.cipher_size_ = 2;
+                input1_.relinearization_required_ = false;
+
+                input1_.memory_set(std::move(output_memory));
+            },
+            options, true);
+    }
+
+    __host__ void HEOperator<Scheme::BGV>::mod_switch_to_next(
+        Ciphertext<Scheme::BGV>& input1, Ciphertext<Scheme::BGV>& output,
+        const ExecutionOptions& options)
+    {
+        if (input1.relinearization_required_)
+        {
+            throw std::invalid_argument(
+                "Ciphertext should be relinearized before modulus switching!");
+        }
+
+        if (input1.depth_ >= (Q_size_ - 1))
+        {
+            throw std::logic_error(
+                "Ciphertext modulus can not be switched further!");
+        }
+
+        int current_decomp_count = Q_size_ - input1.depth_;
+
+        if (input1.memory_size() < (2 * n * current_decomp_count))
+        {
+            throw std::invalid_argument("Invalid Ciphertexts size!");
+        }
+
+        input_storage_manager(
+            input1,
+            [&](Ciphertext<Scheme::BGV>& input1_)
+            {
+                output_storage_manager(
+                    output,
+                    [&](Ciphertext<Scheme::BGV>& output_)
+                    {
+                        int depth = input1_.depth_;
+
+                        DeviceVector<Data64> output_memory(
+                            (2 * n * (current_decomp_count - 1)),
+                            options.stream_);
+
+                        mod_switch_bgv(input1_.data(), output_memory.data(),
+                                       depth, 2, options.stream_);
+
+                        output_.scheme_ = scheme_;
+                        output_.ring_size_ = n;
+                        output_.coeff_modulus_count_ = Q_size_;
+                        output_.cipher_size_ = 2;
+                        output_.depth_ = depth + 1;
+                        output_.correction_factor_ = OPERATOR64::mult(
+                            input1_.correction_factor_,
+                            switch_last_q_inv_mod_t_[depth], plain_modulus_);
+                        output_.relinearization_required_ = false;
+                        output_.ciphertext_generated_ = true;
+
+                        output_.memory_set(std::move(output_memory));
+                    },
+                    options);
+            },
+            options, (&input1 == &output));
+    }
+
+    __host__ void HEOperator<Scheme::BGV>::mod_switch_bgv(
+        Data64* input, Data64* output, int depth, int cipher_size,
+        const cudaStream_t stream)
+    {
+        int current_decomp_count = Q_size_ - depth;
+
+        int location = 0;
+        for (int i = 0; i < depth; i++)
+        {
+            location += (Q_size_ - 1 - i);
+        }
+
+        bgv_mod_switch_kernel<<<dim3((n >> 8), current_decomp_count - 1,
+                                     cipher_size),
+                                256, 0, stream>>>(
+            input, output, modulus_->data(),
+            switch_last_q_modinv_->data() + location, switch_plain_inv_[depth],
+            plain_modulus_.value, n_power, current_decomp_count);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+    }
+
+    __host__ void HEOperator<Scheme::BGV>::rotate_rows(
+        Ciphertext<Scheme::BGV>& input1, Ciphertext<Scheme::BGV>& output,
+        Galoiskey<Scheme::BGV>& galois_key, int shift,
+        const ExecutionOptions& options)
+    {
+        if (input1.relinearization_required_)
+        {
+            throw std::invalid_argument("Ciphertext can not be rotated!");
+        }
+
+        int current_decomp_count = Q_size_ - input1.depth_;
+
+        if (input1.memory_size() < (2 * n * current_decomp_count))
+        {
+            throw std::invalid_argument("Invalid Ciphertexts size!");
+        }
+
+        if (shift == 0)
+        {
+            output = input1;
+            return;
+        }
+
+        input_storage_manager(
+            input1,
+            [&](Ciphertext<Scheme::BGV>& input1_)
+            {
+                output_storage_manager(
+                    output,
+                    [&](Ciphertext<Scheme::BGV>& output_)
+                    {
+                        // Set before rotating, multi-step rotations read
+                        // the depth of the output between the steps.
+                        output_.scheme_ = scheme_;
+                        output_.ring_size_ = n;
+                        output_.coeff_modulus_count_ = Q_size_;
+                        output_.cipher_size_ = 2;
+                        output_.depth_ = input1_.depth_;
+                        output_.correction_factor_ =
+                            input1_.correction_factor_;
+                        output_.relinearization_required_ = false;
+                        output_.ciphertext_generated_ = true;
+
+                        rotate_bgv(input1_, output_, galois_key, shift,
+                                   options.stream_);
+                    },
+                    options);
+            },
+            options, (&input1 == &output));
+    }
+
+    __host__ void HEOperator<Scheme::BGV>::rotate_columns(
+        Ciphertext<Scheme::BGV>& input1, Ciphertext<Scheme::BGV>& output,
+        Galoiskey<Scheme::BGV>& galois_key, const ExecutionOptions& options)
+    {
+        if (input1.relinearization_required_)
+        {
+            throw std::invalid_argument("Ciphertext can not be rotated!");
+        }
+
+        int current_decomp_count = Q_size_ - input1.depth_;
+
+        if (input1.memory_size() < (2 * n * current_decomp_count))
+        {
+            throw std::invalid_argument("Invalid Ciphertexts size!");
+        }
+
+        input_storage_manager(
+            input1,
+            [&](Ciphertext<Scheme::BGV>& input1_)
+            {
+                output_storage_manager(
+                    output,
+                    [&](Ciphertext<Scheme::BGV>& output_)
+                    {
+                        // Set before rotating, multi-step rotations read
+                        // the depth of the output between the steps.
+                        output_.scheme_ = scheme_;
+                        output_.ring_size_ = n;
+                        output_.coeff_modulus_count_ = Q_size_;
+                        output_.cipher_size_ = 2;
+                        output_.depth_ = input1_.depth_;
+                        output_.correction_factor_ =
+                            input1_.correction_factor_;
+                        output_.relinearization_required_ = false;
+                        output_.ciphertext_generated_ = true;
+
+                        apply_galois_bgv(input1_, output_, galois_key,
+                                         galois_key.galois_elt_zero,
+                                         options.stream_);
+                    },
+                    options);
+            },
+            options, (&input1 == &output));
+    }
+
+    __host__ Data64* HEOperator<Scheme::BGV>::aligned_correction_data(
+        Ciphertext<Scheme::BGV>& input1, Ciphertext<Scheme::BGV>& input2,
+        DeviceVector<Data64>& scaled_memory, const cudaStream_t stream)
+    {
+        if (input1.correction_factor_ == input2.correction_factor_)
+        {
+            return input2.data();
+        }
+
+        // input2 * (f1 / f2) carries its message with the factor f1.
+        Data64 scale = OPERATOR64::mult(
+            input1.correction_factor_,
+            OPERATOR64::modinv(input2.correction_factor_, plain_modulus_),
+            plain_modulus_);
+
+        int cipher_size = input2.relinearization_required_ ? 3 : 2;
+        int current_decomp_count = Q_size_ - input2.depth_;
+
+        scaled_memory = DeviceVector<Data64>(
+            cipher_size * n * current_decomp_count, stream);
+
+        cipher_scalar_multiplication_kernel<<<
+            dim3((n >> 8), current_decomp_count, cipher_size), 256, 0,
+            stream>>>(input2.data(), scale, scaled_memory.data(),
+                      modulus_->data(), n_power);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        return scaled_memory.data();
+    }
+
+    __host__ void HEOperator<Scheme::BGV>::check_binary_inputs(
+        Ciphertext<Scheme::BGV>& input1, Ciphertext<Scheme::BGV>& input2)
+    {
+        if (input1.depth_ != input2.depth_)
+        {
+            throw std::logic_error("Ciphertexts leveled are not equal");
+        }
+
+        if (input1.relinearization_required_ !=
+            input2.relinearization_required_)
+        {
+            throw std::invalid_argument("Ciphertexts can not be added because "
+                                        "ciphertext sizes have to be equal!");
+        }
+
+        int cipher_size = input1.relinearization_required_ ? 3 : 2;
+
+        int current_decomp_count = Q_size_ - input1.depth_;
+
+        if (input1.memory_size() < (cipher_size * n * current_decomp_count) ||
+            input2.memory_size() < (cipher_size * n * current_decomp_count))
+        {
+            throw std::invalid_argument("Invalid Ciphertexts size!");
+        }
+    }
+
+    __host__ void HEOperator<Scheme::BGV>::add_sub_plain_bgv(
+        Ciphertext<Scheme::BGV>& input1, Plaintext<Scheme::BGV>& input2,
+        Ciphertext<Scheme::BGV>& output, bool is_addition,
+        const ExecutionOptions& options)
+    {
+        if (input2.in_ntt_domain_ || (input2.size() < n))
+        {
+            throw std::invalid_argument("Invalid plaintext!");
+        }
+
+        int cipher_size = input1.relinearization_required_ ? 3 : 2;
+
+        int current_decomp_count = Q_size_ - input1.depth_;
+
+        if (input1.memory_size() < (cipher_size * n * current_decomp_count))
+        {
+            throw std::invalid_argument("Invalid Ciphertexts size!");
+        }
+
+        input_storage_manager(
+            input1,
+            [&](Ciphertext<Scheme::BGV>& input1_)
+            {
+                input_storage_manager(
+                    input2,
+                    [&](Plaintext<Scheme::BGV>& input2_)
+                    {
+                        output_storage_manager(
+                            output,
+                            [&](Ciphertext<Scheme::BGV>& output_)
+                            {
+                                DeviceVector<Data64> output_memory(
+                                    (cipher_size * n * current_decomp_count),
+                                    options.stream_);
+
+                                dim3 grid((n >> 8), current_decomp_count,
+                                          cipher_size);
+                                if (is_addition)
+                                {
+                                    addition_plain_bgv_poly<<<
+                                        grid, 256, 0, options.stream_>>>(
+                                        input1_.data(), input2_.data(),
+                                        output_memory.data(), modulus_->data(),
+                                        plain_modulus_,
+                                        input1_.correction_factor_,
+                                        upper_threshold_,
+                                        upper_halfincrement_->data(), n_power);
+                                }
+                                else
+                                {
+                                    substraction_plain_bgv_poly<<<
+                                        grid, 256, 0, options.stream_>>>(
+                                        input1_.data(), input2_.data(),
+                                        output_memory.data(), modulus_->data(),
+                                        plain_modulus_,
+                                        input1_.correction_factor_,
+                                        upper_threshold_,
+                                        upper_halfincrement_->data(), n_power);
+                                }
+                                HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                                output_.scheme_ = scheme_;
+                                output_.ring_size_ = n;
+                                output_.coeff_modulus_count_ = Q_size_;
+                                output_.cipher_size_ = cipher_size;
+                                output_.depth_ = input1_.depth_;
+                                output_.correction_factor_ =
+                                    input1_.correction_factor_;
+                                output_.relinearization_required_ =
+                                    input1_.relinearization_required_;
+                                output_.ciphertext_generated_ = true;
+
+                                output_.memory_set(std::move(output_memory));
+                            },
+                            options);
+                    },
+                    options, false);
+            },
+            options, (&input1 == &output));
+    }
+
+    __host__ void HEOperator<Scheme::BGV>::switch_key_bgv(
+        Data64* input, Data64* key, Data64* output, int depth,
+        const cudaStream_t stream)
+    {
+        int current_decomp_count = Q_size_ - depth;
+        int current_rns_mod_count = current_decomp_count + 1;
+
+        DeviceVector<Data64> temp_broadcast(
+            n * current_decomp_count * current_rns_mod_count, stream);
+
+        cipher_broadcast_leveled_kernel<<<
+            dim3((n >> 8), current_decomp_count, 1), 256, 0, stream>>>(
+            input, temp_broadcast.data(), modulus_->data(), Q_prime_size_,
+            current_rns_mod_count, n_power);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::FORWARD,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .stream = stream};
+
+        int counter = Q_prime_size_;
+        int location = 0;
+        for (int i = 0; i < depth; i++)
+        {
+            location += counter;
+            counter--;
+        }
+
+        gpuntt::GPU_NTT_Modulus_Ordered_Inplace(
+            temp_broadcast.data(), ntt_table_->data(), modulus_->data(),
+            cfg_ntt, current_decomp_count * current_rns_mod_count,
+            current_rns_mod_count, new_prime_locations + location);
+
+        multiply_accumulate_leveled_kernel<<<
+            dim3((n >> 8), current_rns_mod_count, 1), 256, 0, stream>>>(
+            temp_broadcast.data(), key, output, modulus_->data(),
+            Q_prime_size_, current_decomp_count, n_power);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_intt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::INVERSE,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .mod_inverse = n_inverse_->data(),
+            .stream = stream};
+
+        gpuntt::GPU_NTT_Modulus_Ordered_Inplace(
+            output, intt_table_->data(), modulus_->data(), cfg_intt,
+            2 * current_rns_mod_count, current_rns_mod_count,
+            new_prime_locations + location);
+    }
+
+    __host__ void HEOperator<Scheme::BGV>::apply_galois_bgv(
+        Ciphertext<Scheme::BGV>& input1, Ciphertext<Scheme::BGV>& output,
+        Galoiskey<Scheme::BGV>& galois_key, int galois_elt,
+        const cudaStream_t stream)
+    {
+        int current_decomp_count = Q_size_ - input1.depth_;
+
+        DeviceVector<Data64> temp_rotation(2 * n * (current_decomp_count + 1),
+                                           stream);
+
+        Data64* ct1 = input1.data() + (current_decomp_count << n_power);
+        bool zero_key = (galois_elt == galois_key.galois_elt_zero);
+
+        // TODO: make it efficient
+        if (galois_key.storage_type_ == storage_type::DEVICE)
+        {
+            Data64* key = zero_key
+                              ? galois_key.zero_device_location_.data()
+                              : galois_key.device_location_[galois_elt].data();
+            switch_key_bgv(ct1, key, temp_rotation.data(), input1.depth_,
+                           stream);
+        }
+        else
+        {
+            DeviceVector<Data64> key_location(
+                zero_key ? galois_key.zero_host_location_
+                         : galois_key.host_location_[galois_elt],
+                stream);
+            switch_key_bgv(ct1, key_location.data(), temp_rotation.data(),
+                           input1.depth_, stream);
+        }
+
+        DeviceVector<Data64> output_memory((2 * n * current_decomp_count),
+                                           stream);
+
+        // ModDown + Permute
+        bgv_divide_lastq_permute_kernel<<<
+            dim3((n >> 8), current_decomp_count, 2), 256, 0, stream>>>(
+            temp_rotation.data(), input1.data(), output_memory.data(),
+            modulus_->data(), last_q_modinv_->data(), plain_inv_p_,
+            plain_modulus_.value, galois_elt, n_power, current_decomp_count,
+            Q_size_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        output.memory_set(std::move(output_memory));
+    }
+
+    __host__ void HEOperator<Scheme::BGV>::rotate_bgv(
+        Ciphertext<Scheme::BGV>& input1, Ciphertext<Scheme::BGV>& output,
+        Galoiskey<Scheme::BGV>& galois_key, int shift,
+        const cudaStream_t stream)
+    {
+        int galoiselt = steps_to_galois_elt(shift, n, galois_key.group_order_);
+        bool key_exist = (galois_key.storage_type_ == storage_type::DEVICE)
+                             ? (galois_key.device_location_.find(galoiselt) !=
+                                galois_key.device_location_.end())
+                             : (galois_key.host_location_.find(galoiselt) !=
+                                galois_key.host_location_.end());
+        if (key_exist)
+        {
+            apply_galois_bgv(input1, output, galois_key, galoiselt, stream);
+        }
+        else
+        {
+            std::vector<int> available_shifts;
+            available_shifts.reserve(galois_key.galois_elt.size());
+            for (const auto& galois : galois_key.galois_elt)
+            {
+                available_shifts.push_back(galois.first);
+            }
+
+            std::vector<int> steps =
+                galois_key.rotation_plans_->plan(shift, available_shifts,
+                                                 (n >> 1));
+
+            if (steps.empty())
+            {
+                output = input1;
+                return;
+            }
+
+            // The first step reads input1, the following ones rotate output
+            // in place.
+            Ciphertext<Scheme::BGV>* in_data = &input1;
+            for (int step : steps)
+            {
+                apply_galois_bgv(*in_data, output, galois_key,
+                                 galois_key.galois_elt[step], stream);
+                in_data = &output;
+            }
+        }
+    }
+
+    HEArithmeticOperator<Scheme::BGV>::HEArithmeticOperator(
+        HEContext<Scheme::BGV>& context, HEEncoder<Scheme::BGV>& encoder)
+        : HEOperator<Scheme::BGV>(context, encoder)
+    {
+    }
+
+} // namespace heongpu
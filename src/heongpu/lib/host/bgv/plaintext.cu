@@ -0,0 +1,22 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "bgv/plaintext.cuh"
+
+namespace heongpu
+{
+    __host__
+    Plaintext<Scheme::BGV>::Plaintext(HEContext<Scheme::BGV>& context,
+                                      const ExecutionOptions& options)
+        : Plaintext<Scheme::BFV>(context, options)
+    {
+    }
+
+    void Plaintext<Scheme::BGV>::load(std::istream& is)
+    {
+        Plaintext<Scheme::BFV>::load(is, scheme_type::bgv);
+    }
+
+} // namespace heongpu
@@ -0,0 +1,20 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "bgv/publickey.cuh"
+
+namespace heongpu
+{
+    __host__ Publickey<Scheme::BGV>::Publickey(HEContext<Scheme::BGV>& context)
+        : Publickey<Scheme::BFV>(context)
+    {
+    }
+
+    void Publickey<Scheme::BGV>::load(std::istream& is)
+    {
+        Publickey<Scheme::BFV>::load(is, scheme_type::bgv);
+    }
+
+} // namespace heongpu
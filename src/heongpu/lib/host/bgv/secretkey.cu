@@ -0,0 +1,26 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "bgv/secretkey.cuh"
+
+namespace heongpu
+{
+    __host__ Secretkey<Scheme::BGV>::Secretkey(HEContext<Scheme::BGV>& context)
+        : Secretkey<Scheme::BFV>(context)
+    {
+    }
+
+    __host__ Secretkey<Scheme::BGV>::Secretkey(HEContext<Scheme::BGV>& context,
+                                               const int hamming_weight)
+        : Secretkey<Scheme::BFV>(context, hamming_weight)
+    {
+    }
+
+    void Secretkey<Scheme::BGV>::load(std::istream& is)
+    {
+        Secretkey<Scheme::BFV>::load(is, scheme_type::bgv);
+    }
+
+} // namespace heongpu
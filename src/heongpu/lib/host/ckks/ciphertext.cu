@@ -34,6 +34,7 @@ namespace heongpu
         rescale_required_ = false;
         relinearization_required_ = false;
         scale_ = 0;
+        slot_count_ = context.n >> 1;
 
         storage_type_ = options.storage_;
 
@@ -165,11 +166,36 @@ namespace heongpu
         }
     }
 
+    size_t Ciphertext<Scheme::CKKS>::serialized_size() const
+    {
+        if (!ciphertext_generated_)
+        {
+            throw std::runtime_error(
+                "Ciphertext is not generated so can not be serialized!");
+        }
+
+        size_t header_size =
+            serialformat::header_size + sizeof(ring_size_) +
+            sizeof(coeff_modulus_count_) + sizeof(cipher_size_) +
+            sizeof(depth_) + sizeof(in_ntt_domain_) + sizeof(storage_type_) +
+            sizeof(scale_) + sizeof(slot_count_) + sizeof(rescale_required_) +
+            sizeof(relinearization_required_) + sizeof(ciphertext_generated_);
+
+        size_t ciphertext_memory_size =
+            (storage_type_ == storage_type::DEVICE)
+                ? static_cast<size_t>(cipher_size_) *
+                      (coeff_modulus_count_ - depth_) * ring_size_
+                : host_locations_.size();
+
+        return header_size + sizeof(uint32_t) +
+               (sizeof(Data64) * ciphertext_memory_size);
+    }
+
     void Ciphertext<Scheme::CKKS>::save(std::ostream& os) const
     {
         if (ciphertext_generated_)
         {
-            os.write((char*) &scheme_, sizeof(scheme_));
+            serialformat::write_header(os, scheme_);
 
             os.write((char*) &ring_size_, sizeof(ring_size_));
 
@@ -186,6 +212,8 @@ namespace heongpu
 
             os.write((char*) &scale_, sizeof(scale_));
 
+            os.write((char*) &slot_count_, sizeof(slot_count_));
+
             os.write((char*) &rescale_required_, sizeof(rescale_required_));
 
             os.write((char*) &relinearization_required_,
@@ -235,7 +263,7 @@ namespace heongpu
     {
         if ((!ciphertext_generated_))
         {
-            is.read((char*) &scheme_, sizeof(scheme_));
+            uint32_t version = serialformat::read_header(is, scheme_);
 
             if (scheme_ != scheme_type::ckks)
             {
@@ -257,6 +285,16 @@ namespace heongpu
 
             is.read((char*) &scale_, sizeof(scale_));
 
+            if (version >= 1)
+            {
+                is.read((char*) &slot_count_, sizeof(slot_count_));
+            }
+            else
+            {
+                // Legacy streams predate sparse packing.
+                slot_count_ = ring_size_ >> 1;
+            }
+
             is.read((char*) &rescale_required_, sizeof(rescale_required_));
 
             is.read((char*) &relinearization_required_,
@@ -0,0 +1,162 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "ckks/constantcache.cuh"
+
+#include <functional>
+
+namespace heongpu
+{
+    __host__ std::size_t ConstantCache<Scheme::CKKS>::KeyHash::operator()(
+        const ConstantKey& key) const
+    {
+        std::size_t seed = static_cast<std::size_t>(key.kind);
+        auto combine = [&seed](std::size_t value)
+        { seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2); };
+
+        combine(std::hash<std::uint64_t>()(key.value1));
+        combine(std::hash<std::uint64_t>()(key.value2));
+        combine(std::hash<int>()(key.depth));
+        combine(std::hash<double>()(key.scale));
+
+        return seed;
+    }
+
+    __host__ ConstantCache<Scheme::CKKS>::ConstantCache(std::size_t capacity)
+        : capacity_(capacity)
+    {
+    }
+
+    __host__ ConstantCache<Scheme::CKKS>::Entry
+    ConstantCache<Scheme::CKKS>::find(const ConstantKey& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = index_.find(key);
+        if (it == index_.end())
+        {
+            misses_++;
+            return nullptr;
+        }
+
+        hits_++;
+        entries_.splice(entries_.begin(), entries_, it->second);
+
+        return it->second->second;
+    }
+
+    __host__ ConstantCache<Scheme::CKKS>::Entry
+    ConstantCache<Scheme::CKKS>::insert(const ConstantKey& key,
+                                        Plaintext<Scheme::CKKS>&& plain)
+    {
+        Entry entry = std::make_shared<Plaintext<Scheme::CKKS>>(
+            std::move(plain));
+        std::size_t entry_size = entry->size() * sizeof(Data64);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // Another thread may have encoded the same key meanwhile.
+        auto it = index_.find(key);
+        if (it != index_.end())
+        {
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return it->second->second;
+        }
+
+        if (entry_size > capacity_)
+        {
+            return entry;
+        }
+
+        entries_.emplace_front(key, entry);
+        index_.emplace(key, entries_.begin());
+        memory_size_ += entry_size;
+
+        evict();
+
+        return entry;
+    }
+
+    __host__ void ConstantCache<Scheme::CKKS>::erase_mask(std::uint64_t mask_id)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (auto it = entries_.begin(); it != entries_.end();)
+        {
+            auto next = std::next(it);
+            if ((it->first.kind == constant_kind::MASK) &&
+                (it->first.value1 == mask_id))
+            {
+                erase(it);
+            }
+            it = next;
+        }
+    }
+
+    __host__ void ConstantCache<Scheme::CKKS>::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        entries_.clear();
+        index_.clear();
+        memory_size_ = 0;
+    }
+
+    __host__ void
+    ConstantCache<Scheme::CKKS>::set_capacity(std::size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        capacity_ = capacity;
+        evict();
+    }
+
+    __host__ std::size_t ConstantCache<Scheme::CKKS>::capacity() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return capacity_;
+    }
+
+    __host__ std::size_t ConstantCache<Scheme::CKKS>::memory_size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return memory_size_;
+    }
+
+    __host__ std::size_t ConstantCache<Scheme::CKKS>::size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+    __host__ std::size_t ConstantCache<Scheme::CKKS>::hits() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return hits_;
+    }
+
+    __host__ std::size_t ConstantCache<Scheme::CKKS>::misses() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return misses_;
+    }
+
+    __host__ void ConstantCache<Scheme::CKKS>::evict()
+    {
+        while ((memory_size_ > capacity_) && !entries_.empty())
+        {
+            erase(std::prev(entries_.end()));
+        }
+    }
+
+    __host__ void
+    ConstantCache<Scheme::CKKS>::erase(std::list<Node>::iterator it)
+    {
+        memory_size_ -= it->second->size() * sizeof(Data64);
+        index_.erase(it->first);
+        entries_.erase(it);
+    }
+
+} // namespace heongpu
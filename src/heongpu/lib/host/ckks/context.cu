@@ -264,11 +264,41 @@ namespace heongpu
         }
     }
 
+    void HEContext<Scheme::CKKS>::set_key_limb_type(limb_type type)
+    {
+        if (context_generated_)
+        {
+            throw std::logic_error("Key limb type cannot be changed after the "
+                                   "context is generated!");
+        }
+
+        key_limb_type_ = type;
+    }
+
     void HEContext<Scheme::CKKS>::generate()
     {
         if ((!context_generated_) && (poly_modulus_degree_specified_) &&
             (coeff_modulus_specified_))
         {
+            if (key_limb_type_ == limb_type::LIMB32)
+            {
+                if (keyswitching_type_ !=
+                    keyswitching_type::KEYSWITCHING_METHOD_I)
+                {
+                    throw std::invalid_argument(
+                        "32-bit key limbs require KEYSWITCHING_METHOD_I!");
+                }
+
+                for (const Modulus64& prime : prime_vector_)
+                {
+                    if (prime.value >= (1ULL << 32))
+                    {
+                        throw std::invalid_argument(
+                            "32-bit key limbs require all moduli below 2^32!");
+                    }
+                }
+            }
+
             // Memory pool initialization
             MemoryPool::instance().initialize();
             MemoryPool::instance().use_memory_pool(true);
@@ -685,6 +715,11 @@ namespace heongpu
             }
             std::cout << P_mod_bit_sizes_.back();
             std::cout << " ) bits" << std::endl;
+            if (key_limb_type_ == limb_type::LIMB32)
+            {
+                std::cout << "-->   key-switching key limbs: 32 bits"
+                          << std::endl;
+            }
 
             std::cout << std::endl;
         }
@@ -698,12 +733,14 @@ namespace heongpu
     {
         if ((poly_modulus_degree_specified_) && (coeff_modulus_specified_))
         {
-            os.write((char*) &scheme_, sizeof(scheme_));
+            serialformat::write_header(os, scheme_);
 
             os.write((char*) &sec_level_, sizeof(sec_level_));
 
             os.write((char*) &keyswitching_type_, sizeof(keyswitching_type_));
 
+            os.write((char*) &key_limb_type_, sizeof(key_limb_type_));
+
             os.write((char*) &n, sizeof(n));
 
             os.write((char*) &n_power, sizeof(n_power));
@@ -757,12 +794,21 @@ namespace heongpu
     {
         if ((!context_generated_))
         {
-            is.read((char*) &scheme_, sizeof(scheme_));
+            uint32_t version = serialformat::read_header(is, scheme_);
 
             is.read((char*) &sec_level_, sizeof(sec_level_));
 
             is.read((char*) &keyswitching_type_, sizeof(keyswitching_type_));
 
+            if (version >= 1)
+            {
+                is.read((char*) &key_limb_type_, sizeof(key_limb_type_));
+            }
+            else
+            {
+                key_limb_type_ = limb_type::LIMB64;
+            }
+
             is.read((char*) &n, sizeof(n));
 
             is.read((char*) &n_power, sizeof(n_power));
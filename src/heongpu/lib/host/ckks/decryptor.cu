@@ -147,4 +147,150 @@ namespace heongpu
         plaintext.memory_set(std::move(output_memory));
     }
 
+    __host__ void HEDecryptor<Scheme::CKKS>::partial_decrypt_ckks_batch(
+        std::vector<Ciphertext<Scheme::CKKS>>& ciphertexts,
+        Secretkey<Scheme::CKKS>& sk,
+        std::vector<Ciphertext<Scheme::CKKS>>& partial_ciphertexts,
+        const cudaStream_t stream)
+    {
+        int cipher_count = ciphertexts.size();
+        int current_decomp_count = Q_size_ - ciphertexts[0].depth_;
+
+        DeviceVector<Data64> error_poly(cipher_count * current_decomp_count * n,
+                                        stream);
+
+        RandomNumberGenerator::instance()
+            .modular_gaussian_random_number_generation(
+                error_std_dev, error_poly.data(), modulus_->data(), n_power,
+                current_decomp_count, cipher_count, stream);
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::FORWARD,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .stream = stream};
+
+        gpuntt::GPU_NTT_Inplace(error_poly.data(), ntt_table_->data(),
+                                modulus_->data(), cfg_ntt,
+                                cipher_count * current_decomp_count,
+                                current_decomp_count);
+
+        partial_ciphertexts.resize(cipher_count);
+
+        std::vector<Data64*> input_pointers(cipher_count);
+        std::vector<Data64*> output_pointers(cipher_count);
+        for (int i = 0; i < cipher_count; i++)
+        {
+            DeviceVector<Data64> output_memory((2 * n * current_decomp_count),
+                                               stream);
+            partial_ciphertexts[i].memory_set(std::move(output_memory));
+
+            input_pointers[i] = ciphertexts[i].data();
+            output_pointers[i] = partial_ciphertexts[i].data();
+        }
+
+        DeviceVector<Data64*> input_pointers_device(cipher_count, stream);
+        cudaMemcpyAsync(input_pointers_device.data(), input_pointers.data(),
+                        cipher_count * sizeof(Data64*), cudaMemcpyHostToDevice,
+                        stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        DeviceVector<Data64*> output_pointers_device(cipher_count, stream);
+        cudaMemcpyAsync(output_pointers_device.data(), output_pointers.data(),
+                        cipher_count * sizeof(Data64*), cudaMemcpyHostToDevice,
+                        stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        partial_decrypt_ckks_batch_kernel<<<
+            dim3((n >> 8), current_decomp_count, cipher_count), 256, 0,
+            stream>>>(input_pointers_device.data(),
+                      output_pointers_device.data(), sk.data(),
+                      error_poly.data(), modulus_->data(), n_power,
+                      current_decomp_count);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+    }
+
+    __host__ void HEDecryptor<Scheme::CKKS>::decrypt_fusion_ckks_batch(
+        std::vector<std::vector<Ciphertext<Scheme::CKKS>>>& partial_ciphertexts,
+        std::vector<Plaintext<Scheme::CKKS>>& plaintexts,
+        const cudaStream_t stream)
+    {
+        int party_count = partial_ciphertexts.size();
+        int cipher_count = partial_ciphertexts[0].size();
+        int current_decomp_count = Q_size_ - partial_ciphertexts[0][0].depth_;
+
+        plaintexts.resize(cipher_count);
+
+        // Shares of one ciphertext are contiguous so that a thread block reads
+        // all of them for its coefficient range.
+        std::vector<Data64*> share_pointers(cipher_count * party_count);
+        std::vector<Data64*> output_pointers(cipher_count);
+        for (int j = 0; j < cipher_count; j++)
+        {
+            for (int i = 0; i < party_count; i++)
+            {
+                share_pointers[(j * party_count) + i] =
+                    partial_ciphertexts[i][j].data();
+            }
+
+            DeviceVector<Data64> output_memory(n * current_decomp_count,
+                                               stream);
+            plaintexts[j].memory_set(std::move(output_memory));
+            output_pointers[j] = plaintexts[j].data();
+        }
+
+        DeviceVector<Data64*> share_pointers_device(share_pointers.size(),
+                                                    stream);
+        cudaMemcpyAsync(share_pointers_device.data(), share_pointers.data(),
+                        share_pointers.size() * sizeof(Data64*),
+                        cudaMemcpyHostToDevice, stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        DeviceVector<Data64*> output_pointers_device(cipher_count, stream);
+        cudaMemcpyAsync(output_pointers_device.data(), output_pointers.data(),
+                        cipher_count * sizeof(Data64*), cudaMemcpyHostToDevice,
+                        stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        decrypt_fusion_ckks_batch_kernel<<<
+            dim3((n >> 8), current_decomp_count, cipher_count), 256, 0,
+            stream>>>(share_pointers_device.data(),
+                      output_pointers_device.data(), modulus_->data(), n_power,
+                      current_decomp_count, party_count);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+    }
+
+    __host__ void HEDecryptor<Scheme::CKKS>::decrypt_fusion_ckks_accumulate(
+        Ciphertext<Scheme::CKKS>& partial_ciphertext,
+        Plaintext<Scheme::CKKS>& plaintext, bool first,
+        const cudaStream_t stream)
+    {
+        int current_decomp_count = Q_size_ - partial_ciphertext.depth_;
+
+        Data64* ct0 = partial_ciphertext.data();
+        Data64* ct1 =
+            partial_ciphertext.data() + (current_decomp_count << n_power);
+
+        if (first)
+        {
+            DeviceVector<Data64> output_memory(n * current_decomp_count,
+                                               stream);
+
+            addition<<<dim3((n >> 8), current_decomp_count, 1), 256, 0,
+                       stream>>>(ct0, ct1, output_memory.data(),
+                                 modulus_->data(), n_power);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+            plaintext.memory_set(std::move(output_memory));
+        }
+        else
+        {
+            addition<<<dim3((n >> 8), current_decomp_count, 1), 256, 0,
+                       stream>>>(ct1, plaintext.data(), plaintext.data(),
+                                 modulus_->data(), n_power);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        }
+    }
+
 } // namespace heongpu
\ No newline at end of file
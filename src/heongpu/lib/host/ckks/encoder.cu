@@ -114,6 +114,19 @@ namespace heongpu
 
         reverse_order = std::make_shared<DeviceVector<int>>(bit_reverse_vec);
 
+        for (int log_slots = 0; log_slots < log_slot_count_; log_slots++)
+        {
+            std::vector<int> sparse_bit_reverse_vec(1 << log_slots);
+            for (int i = 0; i < (1 << log_slots); i++)
+            {
+                sparse_bit_reverse_vec[i] = gpuntt::bitreverse(i, log_slots);
+            }
+
+            sparse_reverse_order_.push_back(
+                std::make_shared<DeviceVector<int>>(sparse_bit_reverse_vec));
+        }
+        sparse_reverse_order_.push_back(reverse_order);
+
         Mi_ = context.Mi_;
         Mi_inv_ = context.Mi_inv_;
         upper_half_threshold_ = context.upper_half_threshold_;
@@ -122,25 +135,37 @@ namespace heongpu
 
     __host__ void HEEncoder<Scheme::CKKS>::encode_ckks(
         Plaintext<Scheme::CKKS>& plain, const std::vector<double>& message,
-        const double scale, const cudaStream_t stream)
+        const double scale, const int log_slot_count, const cudaStream_t stream)
     {
+        int slot_count = 1 << log_slot_count;
+        int log_gap = (n_power - 1) - log_slot_count;
+        int thread_count = std::min(slot_count, 256);
+        int block_count = slot_count / thread_count;
+
         DeviceVector<Data64> output_memory(n * Q_size_, stream);
+        if (log_gap != 0)
+        {
+            // Only every (1 << log_gap)-th coefficient is written below.
+            cudaMemsetAsync(output_memory.data(), 0,
+                            n * Q_size_ * sizeof(Data64), stream);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        }
 
-        DeviceVector<double> message_gpu(slot_count_, stream);
+        DeviceVector<double> message_gpu(slot_count, stream);
         cudaMemcpyAsync(message_gpu.data(), message.data(),
                         message.size() * sizeof(double), cudaMemcpyHostToDevice,
                         stream);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
-        DeviceVector<Complex64> temp_complex(n, stream);
-        double_to_complex_kernel<<<dim3(((slot_count_) >> 8), 1, 1), 256, 0,
+        DeviceVector<Complex64> temp_complex(slot_count, stream);
+        double_to_complex_kernel<<<dim3(block_count, 1, 1), thread_count, 0,
                                    stream>>>(message_gpu.data(),
                                              temp_complex.data());
 
-        double fix = scale / static_cast<double>(slot_count_);
+        double fix = scale / static_cast<double>(slot_count);
 
         gpufft::fft_configuration<Float64> cfg_ifft{};
-        cfg_ifft.n_power = log_slot_count_;
+        cfg_ifft.n_power = log_slot_count;
         cfg_ifft.fft_type = gpufft::type::INVERSE;
         cfg_ifft.mod_inverse = Complex64(fix, 0.0);
         cfg_ifft.stream = stream;
@@ -148,10 +173,11 @@ namespace heongpu
         gpufft::GPU_Special_FFT(temp_complex.data(),
                                 special_ifft_roots_table_->data(), cfg_ifft, 1);
 
-        encode_kernel_ckks_conversion<<<dim3(((slot_count_) >> 8), 1, 1), 256,
+        encode_kernel_ckks_conversion<<<dim3(block_count, 1, 1), thread_count,
                                         0, stream>>>(
             output_memory.data(), temp_complex.data(), modulus_->data(),
-            Q_size_, two_pow_64, reverse_order->data(), n_power);
+            Q_size_, two_pow_64, sparse_reverse_order_[log_slot_count]->data(),
+            log_gap, n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
         gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
@@ -171,25 +197,37 @@ namespace heongpu
 
     __host__ void HEEncoder<Scheme::CKKS>::encode_ckks(
         Plaintext<Scheme::CKKS>& plain, const HostVector<double>& message,
-        const double scale, const cudaStream_t stream)
+        const double scale, const int log_slot_count, const cudaStream_t stream)
     {
+        int slot_count = 1 << log_slot_count;
+        int log_gap = (n_power - 1) - log_slot_count;
+        int thread_count = std::min(slot_count, 256);
+        int block_count = slot_count / thread_count;
+
         DeviceVector<Data64> output_memory(n * Q_size_, stream);
+        if (log_gap != 0)
+        {
+            // Only every (1 << log_gap)-th coefficient is written below.
+            cudaMemsetAsync(output_memory.data(), 0,
+                            n * Q_size_ * sizeof(Data64), stream);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        }
 
-        DeviceVector<double> message_gpu(slot_count_, stream);
+        DeviceVector<double> message_gpu(slot_count, stream);
         cudaMemcpyAsync(message_gpu.data(), message.data(),
                         message.size() * sizeof(double), cudaMemcpyHostToDevice,
                         stream);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
-        DeviceVector<Complex64> temp_complex(n, stream);
-        double_to_complex_kernel<<<dim3(((slot_count_) >> 8), 1, 1), 256, 0,
+        DeviceVector<Complex64> temp_complex(slot_count, stream);
+        double_to_complex_kernel<<<dim3(block_count, 1, 1), thread_count, 0,
                                    stream>>>(message_gpu.data(),
                                              temp_complex.data());
 
-        double fix = scale / static_cast<double>(slot_count_);
+        double fix = scale / static_cast<double>(slot_count);
 
         gpufft::fft_configuration<Float64> cfg_ifft{};
-        cfg_ifft.n_power = log_slot_count_;
+        cfg_ifft.n_power = log_slot_count;
         cfg_ifft.fft_type = gpufft::type::INVERSE;
         cfg_ifft.mod_inverse = Complex64(fix, 0.0);
         cfg_ifft.stream = stream;
@@ -197,10 +235,11 @@ namespace heongpu
         gpufft::GPU_Special_FFT(temp_complex.data(),
                                 special_ifft_roots_table_->data(), cfg_ifft, 1);
 
-        encode_kernel_ckks_conversion<<<dim3(((slot_count_) >> 8), 1, 1), 256,
+        encode_kernel_ckks_conversion<<<dim3(block_count, 1, 1), thread_count,
                                         0, stream>>>(
             output_memory.data(), temp_complex.data(), modulus_->data(),
-            Q_size_, two_pow_64, reverse_order->data(), n_power);
+            Q_size_, two_pow_64, sparse_reverse_order_[log_slot_count]->data(),
+            log_gap, n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
         gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
@@ -220,20 +259,32 @@ namespace heongpu
 
     __host__ void HEEncoder<Scheme::CKKS>::encode_ckks(
         Plaintext<Scheme::CKKS>& plain, const std::vector<Complex64>& message,
-        const double scale, const cudaStream_t stream)
+        const double scale, const int log_slot_count, const cudaStream_t stream)
     {
+        int slot_count = 1 << log_slot_count;
+        int log_gap = (n_power - 1) - log_slot_count;
+        int thread_count = std::min(slot_count, 256);
+        int block_count = slot_count / thread_count;
+
         DeviceVector<Data64> output_memory(n * Q_size_, stream);
+        if (log_gap != 0)
+        {
+            // Only every (1 << log_gap)-th coefficient is written below.
+            cudaMemsetAsync(output_memory.data(), 0,
+                            n * Q_size_ * sizeof(Data64), stream);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        }
 
-        DeviceVector<Complex64> message_gpu(slot_count_, stream);
+        DeviceVector<Complex64> message_gpu(slot_count, stream);
         cudaMemcpyAsync(message_gpu.data(), message.data(),
                         message.size() * sizeof(Complex64),
                         cudaMemcpyHostToDevice, stream);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
-        double fix = scale / static_cast<double>(slot_count_);
+        double fix = scale / static_cast<double>(slot_count);
 
         gpufft::fft_configuration<Float64> cfg_ifft{};
-        cfg_ifft.n_power = log_slot_count_;
+        cfg_ifft.n_power = log_slot_count;
         cfg_ifft.fft_type = gpufft::type::INVERSE;
         cfg_ifft.mod_inverse = Complex64(fix, 0.0);
         cfg_ifft.stream = stream;
@@ -241,10 +292,11 @@ namespace heongpu
         gpufft::GPU_Special_FFT(message_gpu.data(),
                                 special_ifft_roots_table_->data(), cfg_ifft, 1);
 
-        encode_kernel_ckks_conversion<<<dim3(((slot_count_) >> 8), 1, 1), 256,
+        encode_kernel_ckks_conversion<<<dim3(block_count, 1, 1), thread_count,
                                         0, stream>>>(
             output_memory.data(), message_gpu.data(), modulus_->data(), Q_size_,
-            two_pow_64, reverse_order->data(), n_power);
+            two_pow_64, sparse_reverse_order_[log_slot_count]->data(), log_gap,
+            n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
         gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
@@ -264,20 +316,32 @@ namespace heongpu
 
     __host__ void HEEncoder<Scheme::CKKS>::encode_ckks(
         Plaintext<Scheme::CKKS>& plain, const HostVector<Complex64>& message,
-        const double scale, const cudaStream_t stream)
+        const double scale, const int log_slot_count, const cudaStream_t stream)
     {
+        int slot_count = 1 << log_slot_count;
+        int log_gap = (n_power - 1) - log_slot_count;
+        int thread_count = std::min(slot_count, 256);
+        int block_count = slot_count / thread_count;
+
         DeviceVector<Data64> output_memory(n * Q_size_, stream);
+        if (log_gap != 0)
+        {
+            // Only every (1 << log_gap)-th coefficient is written below.
+            cudaMemsetAsync(output_memory.data(), 0,
+                            n * Q_size_ * sizeof(Data64), stream);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        }
 
-        DeviceVector<Complex64> message_gpu(slot_count_, stream);
+        DeviceVector<Complex64> message_gpu(slot_count, stream);
         cudaMemcpyAsync(message_gpu.data(), message.data(),
                         message.size() * sizeof(Complex64),
                         cudaMemcpyHostToDevice, stream);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
-        double fix = scale / static_cast<double>(slot_count_);
+        double fix = scale / static_cast<double>(slot_count);
 
         gpufft::fft_configuration<Float64> cfg_ifft{};
-        cfg_ifft.n_power = log_slot_count_;
+        cfg_ifft.n_power = log_slot_count;
         cfg_ifft.fft_type = gpufft::type::INVERSE;
         cfg_ifft.mod_inverse = Complex64(fix, 0.0);
         cfg_ifft.stream = stream;
@@ -285,10 +349,11 @@ namespace heongpu
         gpufft::GPU_Special_FFT(message_gpu.data(),
                                 special_ifft_roots_table_->data(), cfg_ifft, 1);
 
-        encode_kernel_ckks_conversion<<<dim3(((slot_count_) >> 8), 1, 1), 256,
+        encode_kernel_ckks_conversion<<<dim3(block_count, 1, 1), thread_count,
                                         0, stream>>>(
             output_memory.data(), message_gpu.data(), modulus_->data(), Q_size_,
-            two_pow_64, reverse_order->data(), n_power);
+            two_pow_64, sparse_reverse_order_[log_slot_count]->data(), log_gap,
+            n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
         gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
@@ -347,7 +412,14 @@ namespace heongpu
     {
         int current_modulus_count = Q_size_ - plain.depth_;
 
-        DeviceVector<double> message_gpu(slot_count_, stream);
+        int slot_count =
+            (plain.slot_count_ == 0) ? slot_count_ : plain.slot_count_;
+        int log_slot_count = int(log2(slot_count));
+        int log_gap = (n_power - 1) - log_slot_count;
+        int thread_count = std::min(slot_count, 256);
+        int block_count = slot_count / thread_count;
+
+        DeviceVector<double> message_gpu(slot_count, stream);
 
         DeviceVector<Data64> temp_plain(n * current_modulus_count, stream);
 
@@ -373,32 +445,33 @@ namespace heongpu
             counter--;
         }
 
-        DeviceVector<Complex64> temp_complex(n, stream);
-        encode_kernel_compose<<<dim3((slot_count_ >> 8), 1, 1), 256, 0,
+        DeviceVector<Complex64> temp_complex(slot_count, stream);
+        encode_kernel_compose<<<dim3(block_count, 1, 1), thread_count, 0,
                                 stream>>>(
             temp_complex.data(), temp_plain.data(), modulus_->data(),
             Mi_inv_->data() + location1, Mi_->data() + location2,
             upper_half_threshold_->data() + location1,
             decryption_modulus_->data() + location1, current_modulus_count,
-            plain.scale_, two_pow_64, reverse_order->data(), n_power);
+            plain.scale_, two_pow_64,
+            sparse_reverse_order_[log_slot_count]->data(), log_gap, n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
         gpufft::fft_configuration<Float64> cfg_fft{};
-        cfg_fft.n_power = log_slot_count_;
+        cfg_fft.n_power = log_slot_count;
         cfg_fft.fft_type = gpufft::type::FORWARD;
         cfg_fft.stream = stream;
 
         gpufft::GPU_Special_FFT(temp_complex.data(),
                                 special_fft_roots_table_->data(), cfg_fft, 1);
 
-        complex_to_double_kernel<<<dim3(((slot_count_) >> 8), 1, 1), 256, 0,
+        complex_to_double_kernel<<<dim3(block_count, 1, 1), thread_count, 0,
                                    stream>>>(temp_complex.data(),
                                              message_gpu.data());
 
-        message.resize(slot_count_);
+        message.resize(slot_count);
 
         cudaMemcpyAsync(message.data(), message_gpu.data(),
-                        slot_count_ * sizeof(double), cudaMemcpyDeviceToHost,
+                        slot_count * sizeof(double), cudaMemcpyDeviceToHost,
                         stream);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
     }
@@ -410,7 +483,14 @@ namespace heongpu
     {
         int current_modulus_count = Q_size_ - plain.depth_;
 
-        DeviceVector<double> message_gpu(slot_count_, stream);
+        int slot_count =
+            (plain.slot_count_ == 0) ? slot_count_ : plain.slot_count_;
+        int log_slot_count = int(log2(slot_count));
+        int log_gap = (n_power - 1) - log_slot_count;
+        int thread_count = std::min(slot_count, 256);
+        int block_count = slot_count / thread_count;
+
+        DeviceVector<double> message_gpu(slot_count, stream);
 
         DeviceVector<Data64> temp_plain(n * current_modulus_count, stream);
 
@@ -436,33 +516,33 @@ namespace heongpu
             counter--;
         }
 
-        DeviceVector<Complex64> temp_complex(n, stream);
-
-        encode_kernel_compose<<<dim3((slot_count_ >> 8), 1, 1), 256, 0,
+        DeviceVector<Complex64> temp_complex(slot_count, stream);
+        encode_kernel_compose<<<dim3(block_count, 1, 1), thread_count, 0,
                                 stream>>>(
             temp_complex.data(), temp_plain.data(), modulus_->data(),
             Mi_inv_->data() + location1, Mi_->data() + location2,
             upper_half_threshold_->data() + location1,
             decryption_modulus_->data() + location1, current_modulus_count,
-            plain.scale_, two_pow_64, reverse_order->data(), n_power);
+            plain.scale_, two_pow_64,
+            sparse_reverse_order_[log_slot_count]->data(), log_gap, n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
         gpufft::fft_configuration<Float64> cfg_fft{};
-        cfg_fft.n_power = log_slot_count_;
+        cfg_fft.n_power = log_slot_count;
         cfg_fft.fft_type = gpufft::type::FORWARD;
         cfg_fft.stream = stream;
 
         gpufft::GPU_Special_FFT(temp_complex.data(),
                                 special_fft_roots_table_->data(), cfg_fft, 1);
 
-        complex_to_double_kernel<<<dim3(((slot_count_) >> 8), 1, 1), 256, 0,
+        complex_to_double_kernel<<<dim3(block_count, 1, 1), thread_count, 0,
                                    stream>>>(temp_complex.data(),
                                              message_gpu.data());
 
-        message.resize(slot_count_);
+        message.resize(slot_count);
 
         cudaMemcpyAsync(message.data(), message_gpu.data(),
-                        slot_count_ * sizeof(double), cudaMemcpyDeviceToHost,
+                        slot_count * sizeof(double), cudaMemcpyDeviceToHost,
                         stream);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
     }
@@ -474,7 +554,14 @@ namespace heongpu
     {
         int current_modulus_count = Q_size_ - plain.depth_;
 
-        DeviceVector<Complex64> message_gpu(slot_count_, stream);
+        int slot_count =
+            (plain.slot_count_ == 0) ? slot_count_ : plain.slot_count_;
+        int log_slot_count = int(log2(slot_count));
+        int log_gap = (n_power - 1) - log_slot_count;
+        int thread_count = std::min(slot_count, 256);
+        int block_count = slot_count / thread_count;
+
+        DeviceVector<Complex64> message_gpu(slot_count, stream);
 
         DeviceVector<Data64> temp_plain(n * current_modulus_count, stream);
 
@@ -500,27 +587,28 @@ namespace heongpu
             counter--;
         }
 
-        encode_kernel_compose<<<dim3((slot_count_ >> 8), 1, 1), 256, 0,
+        encode_kernel_compose<<<dim3(block_count, 1, 1), thread_count, 0,
                                 stream>>>(
             message_gpu.data(), temp_plain.data(), modulus_->data(),
             Mi_inv_->data() + location1, Mi_->data() + location2,
             upper_half_threshold_->data() + location1,
             decryption_modulus_->data() + location1, current_modulus_count,
-            plain.scale_, two_pow_64, reverse_order->data(), n_power);
+            plain.scale_, two_pow_64,
+            sparse_reverse_order_[log_slot_count]->data(), log_gap, n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
         gpufft::fft_configuration<Float64> cfg_fft{};
-        cfg_fft.n_power = log_slot_count_;
+        cfg_fft.n_power = log_slot_count;
         cfg_fft.fft_type = gpufft::type::FORWARD;
         cfg_fft.stream = stream;
 
         gpufft::GPU_Special_FFT(message_gpu.data(),
                                 special_fft_roots_table_->data(), cfg_fft, 1);
 
-        message.resize(slot_count_);
+        message.resize(slot_count);
 
         cudaMemcpyAsync(message.data(), message_gpu.data(),
-                        slot_count_ * sizeof(Complex64), cudaMemcpyDeviceToHost,
+                        slot_count * sizeof(Complex64), cudaMemcpyDeviceToHost,
                         stream);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
     }
@@ -532,7 +620,14 @@ namespace heongpu
     {
         int current_modulus_count = Q_size_ - plain.depth_;
 
-        DeviceVector<Complex64> message_gpu(slot_count_, stream);
+        int slot_count =
+            (plain.slot_count_ == 0) ? slot_count_ : plain.slot_count_;
+        int log_slot_count = int(log2(slot_count));
+        int log_gap = (n_power - 1) - log_slot_count;
+        int thread_count = std::min(slot_count, 256);
+        int block_count = slot_count / thread_count;
+
+        DeviceVector<Complex64> message_gpu(slot_count, stream);
 
         DeviceVector<Data64> temp_plain(n * current_modulus_count, stream);
 
@@ -558,27 +653,28 @@ namespace heongpu
             counter--;
         }
 
-        encode_kernel_compose<<<dim3((slot_count_ >> 8), 1, 1), 256, 0,
+        encode_kernel_compose<<<dim3(block_count, 1, 1), thread_count, 0,
                                 stream>>>(
             message_gpu.data(), temp_plain.data(), modulus_->data(),
             Mi_inv_->data() + location1, Mi_->data() + location2,
             upper_half_threshold_->data() + location1,
             decryption_modulus_->data() + location1, current_modulus_count,
-            plain.scale_, two_pow_64, reverse_order->data(), n_power);
+            plain.scale_, two_pow_64,
+            sparse_reverse_order_[log_slot_count]->data(), log_gap, n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
         gpufft::fft_configuration<Float64> cfg_fft{};
-        cfg_fft.n_power = log_slot_count_;
+        cfg_fft.n_power = log_slot_count;
         cfg_fft.fft_type = gpufft::type::FORWARD;
         cfg_fft.stream = stream;
 
         gpufft::GPU_Special_FFT(message_gpu.data(),
                                 special_fft_roots_table_->data(), cfg_fft, 1);
 
-        message.resize(slot_count_);
+        message.resize(slot_count);
 
         cudaMemcpyAsync(message.data(), message_gpu.data(),
-                        slot_count_ * sizeof(Complex64), cudaMemcpyDeviceToHost,
+                        slot_count * sizeof(Complex64), cudaMemcpyDeviceToHost,
                         stream);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
     }
@@ -4,6 +4,7 @@
 // Developer: Alişah Özcan
 
 #include "ckks/evaluationkey.cuh"
+#include "tfhe/context.cuh"
 
 namespace heongpu
 {
@@ -26,7 +27,8 @@ namespace heongpu
         {
             case 1: // KEYSWITCHING_METHOD_I
             {
-                relinkey_size_ = 2 * Q_size_ * Q_prime_size_ * ring_size;
+                d_ = Q_size_;
+                relinkey_size_ = 2 * d_ * Q_prime_size_ * ring_size;
             }
             break;
             case 2: // KEYSWITCHING_METHOD_II
@@ -166,7 +168,7 @@ namespace heongpu
 
         if (relin_key_generated_)
         {
-            os.write((char*) &scheme_, sizeof(scheme_));
+            serialformat::write_header(os, scheme_);
 
             os.write((char*) &key_type, sizeof(key_type));
 
@@ -184,6 +186,8 @@ namespace heongpu
 
             os.write((char*) &storage_type_, sizeof(storage_type_));
 
+            os.write((char*) &limb_type_, sizeof(limb_type_));
+
             os.write((char*) &relin_key_generated_,
                      sizeof(relin_key_generated_));
 
@@ -218,7 +222,7 @@ namespace heongpu
     {
         if ((!relin_key_generated_))
         {
-            is.read((char*) &scheme_, sizeof(scheme_));
+            uint32_t version = serialformat::read_header(is, scheme_);
 
             if (scheme_ != scheme_type::ckks)
             {
@@ -241,11 +245,30 @@ namespace heongpu
 
             is.read((char*) &storage_type_, sizeof(storage_type_));
 
+            if (version >= 1)
+            {
+                is.read((char*) &limb_type_, sizeof(limb_type_));
+            }
+            else
+            {
+                limb_type_ = limb_type::LIMB64;
+            }
+
             is.read((char*) &relin_key_generated_,
                     sizeof(relin_key_generated_));
 
             is.read((char*) &relinkey_size_, sizeof(relinkey_size_));
 
+            if (key_type == keyswitching_type::KEYSWITCHING_METHOD_I)
+            {
+                // Number of decomposition blocks; less than Q_size for a
+                // level-trimmed key. 32-bit limbs are stored two per word.
+                Data64 limb_count = (limb_type_ == limb_type::LIMB32)
+                                        ? (2 * relinkey_size_)
+                                        : relinkey_size_;
+                d_ = limb_count / (2 * Q_prime_size_ * ring_size);
+            }
+
             storage_type_ = storage_type::DEVICE;
             relin_key_generated_ = true;
 
@@ -444,6 +467,45 @@ namespace heongpu
         }
     }
 
+    void Relinkey<Scheme::CKKS>::compact_limbs(cudaStream_t stream)
+    {
+        if ((limb_type_ == limb_type::LIMB32) ||
+            (key_type != keyswitching_type::KEYSWITCHING_METHOD_I))
+        {
+            return;
+        }
+
+        // Ring sizes are even, so the limbs fill whole words.
+        Data64 word_count = relinkey_size_ >> 1;
+
+        if (storage_type_ == storage_type::DEVICE)
+        {
+            DeviceVector<Data64> compact_key(word_count, stream);
+            compact_key_limbs_kernel<<<((relinkey_size_ + 255) >> 8), 256, 0,
+                                       stream>>>(
+                device_location_.data(),
+                reinterpret_cast<Data32*>(compact_key.data()), relinkey_size_);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+            device_location_ = std::move(compact_key);
+        }
+        else
+        {
+            // Host limbs may still be in flight on stream.
+            cudaStreamSynchronize(stream);
+
+            HostVector<Data64> compact_key(word_count);
+            Data32* limbs = reinterpret_cast<Data32*>(compact_key.data());
+            for (Data64 i = 0; i < relinkey_size_; i++)
+            {
+                limbs[i] = static_cast<Data32>(host_location_[i]);
+            }
+            host_location_ = std::move(compact_key);
+        }
+
+        relinkey_size_ = word_count;
+        limb_type_ = limb_type::LIMB32;
+    }
+
     __host__ MultipartyRelinkey<Scheme::CKKS>::MultipartyRelinkey(
         HEContext<Scheme::CKKS>& context, const RNGSeed seed)
         : Relinkey(context), seed_(seed)
@@ -473,7 +535,8 @@ namespace heongpu
         {
             case 1: // KEYSWITCHING_METHOD_I
             {
-                galoiskey_size_ = 2 * Q_size_ * Q_prime_size_ * ring_size;
+                d_ = Q_size_;
+                galoiskey_size_ = 2 * d_ * Q_prime_size_ * ring_size;
 
                 for (int i = 0; i < MAX_SHIFT; i++)
                 {
@@ -540,7 +603,8 @@ namespace heongpu
         {
             case 1: // KEYSWITCHING_METHOD_I
             {
-                galoiskey_size_ = 2 * Q_size_ * Q_prime_size_ * ring_size;
+                d_ = Q_size_;
+                galoiskey_size_ = 2 * d_ * Q_prime_size_ * ring_size;
 
                 for (int shift : shift_vec)
                 {
@@ -604,7 +668,8 @@ namespace heongpu
             {
                 galois_elt_zero =
                     steps_to_galois_elt(0, ring_size, group_order_);
-                galoiskey_size_ = 2 * Q_size_ * Q_prime_size_ * ring_size;
+                d_ = Q_size_;
+                galoiskey_size_ = 2 * d_ * Q_prime_size_ * ring_size;
                 custom_galois_elt = galois_elts;
             }
             break;
@@ -627,6 +692,74 @@ namespace heongpu
         }
     }
 
+    __host__
+    Galoiskey<Scheme::CKKS>::Galoiskey(HEContext<Scheme::CKKS>& context,
+                                       const std::vector<int>& rotations,
+                                       size_t memory_budget)
+    {
+        if (!context.context_generated_)
+        {
+            throw std::invalid_argument("HEContext is not generated!");
+        }
+
+        scheme_ = context.scheme_;
+        key_type = context.keyswitching_type_;
+
+        ring_size = context.n;
+        Q_prime_size_ = context.Q_prime_size;
+        Q_size_ = context.Q_size;
+
+        customized = false;
+
+        group_order_ = 5;
+
+        switch (static_cast<int>(context.keyswitching_type_))
+        {
+            case 1: // KEYSWITCHING_METHOD_I
+                d_ = Q_size_;
+                galoiskey_size_ = 2 * d_ * Q_prime_size_ * ring_size;
+                break;
+            case 2: // KEYSWITCHING_METHOD_II
+                d_ = context.d_leveled->operator[](0);
+                galoiskey_size_ = 2 * d_ * Q_prime_size_ * ring_size;
+                break;
+            case 3: // KEYSWITCHING_METHOD_III
+                throw std::invalid_argument(
+                    "Galoiskey does not support KEYSWITCHING_METHOD_III");
+                break;
+            default:
+                throw std::invalid_argument("Invalid Key Switching Type");
+                break;
+        }
+
+        // Keys are stored as generated by the key generator: method I keys
+        // of a LIMB32 context hold two limbs per word.
+        size_t stored_key_size = galoiskey_size_;
+        if ((context.key_limb_type_ == limb_type::LIMB32) &&
+            (key_type == keyswitching_type::KEYSWITCHING_METHOD_I))
+        {
+            stored_key_size = galoiskey_size_ >> 1;
+        }
+
+        // The conjugation key is always generated.
+        size_t key_count = memory_budget / (stored_key_size * sizeof(Data64));
+        if (key_count < 1)
+        {
+            throw std::invalid_argument(
+                "Memory budget is too small for the Galois key!");
+        }
+
+        std::vector<int> shifts =
+            select_rotation_keys(rotations, (ring_size >> 1), key_count - 1);
+        for (int shift : shifts)
+        {
+            galois_elt[shift] =
+                steps_to_galois_elt(shift, ring_size, group_order_);
+        }
+
+        galois_elt_zero = steps_to_galois_elt(0, ring_size, group_order_);
+    }
+
     void Galoiskey<Scheme::CKKS>::store_in_device(cudaStream_t stream)
     {
         if (storage_type_ == storage_type::DEVICE)
@@ -715,55 +848,13 @@ namespace heongpu
     {
         if (galois_key_generated_)
         {
-            os.write((char*) &scheme_, sizeof(scheme_));
-
-            os.write((char*) &key_type, sizeof(key_type));
-
-            os.write((char*) &ring_size, sizeof(ring_size));
-
-            os.write((char*) &Q_prime_size_, sizeof(Q_prime_size_));
-
-            os.write((char*) &Q_size_, sizeof(Q_size_));
-
-            os.write((char*) &d_, sizeof(d_));
-
-            os.write((char*) &customized, sizeof(customized));
-
-            os.write((char*) &group_order_, sizeof(group_order_));
-
-            os.write((char*) &storage_type_, sizeof(storage_type_));
-
-            os.write((char*) &galois_key_generated_,
-                     sizeof(galois_key_generated_));
-
-            if (customized)
-            {
-                uint32_t custom_galois_elt_size = custom_galois_elt.size();
-                os.write((char*) &custom_galois_elt_size,
-                         sizeof(custom_galois_elt_size));
-                os.write((char*) custom_galois_elt.data(),
-                         sizeof(u_int32_t) * custom_galois_elt_size);
-            }
-            else
-            {
-                uint32_t galois_elt_size = galois_elt.size();
-                os.write((char*) &galois_elt_size, sizeof(galois_elt_size));
-                for (auto& galois : galois_elt)
-                {
-                    os.write((char*) &galois.first, sizeof(galois.first));
-                    os.write((char*) &galois.second, sizeof(galois.second));
-                }
-            }
-
-            os.write((char*) &galois_elt_zero, sizeof(galois_elt_zero));
-
-            os.write((char*) &galoiskey_size_, sizeof(galoiskey_size_));
+            uint32_t key_count = (storage_type_ == storage_type::DEVICE)
+                                     ? device_location_.size()
+                                     : host_location_.size();
+            save_header(os, key_count);
 
             if (storage_type_ == storage_type::DEVICE)
             {
-                uint32_t key_count = device_location_.size();
-                os.write((char*) &key_count, sizeof(key_count));
-
                 for (auto& galois_key_mem : device_location_)
                 {
                     HostVector<Data64> host_locations_temp(galoiskey_size_);
@@ -792,9 +883,6 @@ namespace heongpu
             }
             else
             {
-                uint32_t key_count = host_location_.size();
-                os.write((char*) &key_count, sizeof(key_count));
-
                 for (auto& galois_key_mem : host_location_)
                 {
                     os.write((char*) &galois_key_mem.first,
@@ -814,11 +902,65 @@ namespace heongpu
         }
     }
 
+    void Galoiskey<Scheme::CKKS>::save_header(std::ostream& os,
+                                              uint32_t key_count) const
+    {
+        serialformat::write_header(os, scheme_);
+
+        os.write((char*) &key_type, sizeof(key_type));
+
+        os.write((char*) &ring_size, sizeof(ring_size));
+
+        os.write((char*) &Q_prime_size_, sizeof(Q_prime_size_));
+
+        os.write((char*) &Q_size_, sizeof(Q_size_));
+
+        os.write((char*) &d_, sizeof(d_));
+
+        os.write((char*) &customized, sizeof(customized));
+
+        os.write((char*) &group_order_, sizeof(group_order_));
+
+        os.write((char*) &storage_type_, sizeof(storage_type_));
+
+        os.write((char*) &limb_type_, sizeof(limb_type_));
+
+        os.write((char*) &galois_key_generated_,
+                 sizeof(galois_key_generated_));
+
+        if (customized)
+        {
+            uint32_t custom_galois_elt_size = custom_galois_elt.size();
+            os.write((char*) &custom_galois_elt_size,
+                     sizeof(custom_galois_elt_size));
+            os.write((char*) custom_galois_elt.data(),
+                     sizeof(u_int32_t) * custom_galois_elt_size);
+        }
+        else
+        {
+            uint32_t galois_elt_size = galois_elt.size();
+            os.write((char*) &galois_elt_size, sizeof(galois_elt_size));
+            for (auto& galois : galois_elt)
+            {
+                os.write((char*) &galois.first, sizeof(galois.first));
+                os.write((char*) &galois.second, sizeof(galois.second));
+            }
+        }
+
+        os.write((char*) &galois_elt_zero, sizeof(galois_elt_zero));
+
+        os.write((char*) &galoiskey_size_, sizeof(galoiskey_size_));
+
+        os.write((char*) &key_count, sizeof(key_count));
+    }
+
     void Galoiskey<Scheme::CKKS>::load(std::istream& is)
     {
         if ((!galois_key_generated_))
         {
-            is.read((char*) &scheme_, sizeof(scheme_));
+            rotation_plans_ = std::make_shared<RotationPlanCache>();
+
+            uint32_t version = serialformat::read_header(is, scheme_);
 
             if (scheme_ != scheme_type::ckks)
             {
@@ -841,6 +983,15 @@ namespace heongpu
 
             is.read((char*) &storage_type_, sizeof(storage_type_));
 
+            if (version >= 1)
+            {
+                is.read((char*) &limb_type_, sizeof(limb_type_));
+            }
+            else
+            {
+                limb_type_ = limb_type::LIMB64;
+            }
+
             is.read((char*) &galois_key_generated_,
                     sizeof(galois_key_generated_));
 
@@ -874,6 +1025,14 @@ namespace heongpu
 
             is.read((char*) &galoiskey_size_, sizeof(galoiskey_size_));
 
+            if (key_type == keyswitching_type::KEYSWITCHING_METHOD_I)
+            {
+                Data64 limb_count = (limb_type_ == limb_type::LIMB32)
+                                        ? (2 * galoiskey_size_)
+                                        : galoiskey_size_;
+                d_ = limb_count / (2 * Q_prime_size_ * ring_size);
+            }
+
             uint32_t key_count;
             is.read((char*) &key_count, sizeof(key_count));
 
@@ -906,6 +1065,71 @@ namespace heongpu
         }
     }
 
+    void Galoiskey<Scheme::CKKS>::compact_limbs(cudaStream_t stream)
+    {
+        if ((limb_type_ == limb_type::LIMB32) ||
+            (key_type != keyswitching_type::KEYSWITCHING_METHOD_I))
+        {
+            return;
+        }
+
+        // Ring sizes are even, so the limbs fill whole words.
+        Data64 word_count = galoiskey_size_ >> 1;
+
+        if (storage_type_ == storage_type::DEVICE)
+        {
+            auto compact = [&](DeviceVector<Data64>& key)
+            {
+                DeviceVector<Data64> compact_key(word_count, stream);
+                compact_key_limbs_kernel<<<((galoiskey_size_ + 255) >> 8), 256,
+                                           0, stream>>>(
+                    key.data(), reinterpret_cast<Data32*>(compact_key.data()),
+                    galoiskey_size_);
+                HEONGPU_CUDA_CHECK(cudaGetLastError());
+                key = std::move(compact_key);
+            };
+
+            for (auto& [elt, key] : device_location_)
+            {
+                compact(key);
+            }
+
+            if (zero_device_location_.size() > 0)
+            {
+                compact(zero_device_location_);
+            }
+        }
+        else
+        {
+            // Host limbs may still be in flight on stream.
+            cudaStreamSynchronize(stream);
+
+            auto compact = [&](HostVector<Data64>& key)
+            {
+                HostVector<Data64> compact_key(word_count);
+                Data32* limbs = reinterpret_cast<Data32*>(compact_key.data());
+                for (Data64 i = 0; i < galoiskey_size_; i++)
+                {
+                    limbs[i] = static_cast<Data32>(key[i]);
+                }
+                key = std::move(compact_key);
+            };
+
+            for (auto& [elt, key] : host_location_)
+            {
+                compact(key);
+            }
+
+            if (zero_host_location_.size() > 0)
+            {
+                compact(zero_host_location_);
+            }
+        }
+
+        galoiskey_size_ = word_count;
+        limb_type_ = limb_type::LIMB32;
+    }
+
     __host__ MultipartyGaloiskey<Scheme::CKKS>::MultipartyGaloiskey(
         HEContext<Scheme::CKKS>& context, const RNGSeed seed)
         : Galoiskey(context), seed_(seed)
@@ -1193,4 +1417,92 @@ namespace heongpu
         }
     }
 
+    __host__
+    Packingkey<Scheme::CKKS>::Packingkey(HEContext<Scheme::CKKS>& context,
+                                         HEContext<Scheme::TFHE>& lwe_context)
+    {
+        if (!context.context_generated_)
+        {
+            throw std::invalid_argument("HEContext is not generated!");
+        }
+
+        if (lwe_context.n_ > context.n)
+        {
+            throw std::invalid_argument(
+                "LWE dimension can not exceed the ring size!");
+        }
+
+        scheme_ = context.scheme_;
+        ring_size_ = context.n;
+
+        lwe_n_ = lwe_context.n_;
+        ks_base_bit_ = lwe_context.ks_base_bit_;
+        ks_length_ = lwe_context.ks_length_;
+        ks_stdev_ = lwe_context.ks_stdev_;
+        max_stdev_ = lwe_context.max_stdev_;
+
+        storage_type_ = storage_type::DEVICE;
+
+        ring_key_ = Switchkey<Scheme::CKKS>(context);
+    }
+
+    void Packingkey<Scheme::CKKS>::store_in_device(cudaStream_t stream)
+    {
+        if (storage_type_ == storage_type::DEVICE)
+        {
+            // pass
+        }
+        else
+        {
+            ring_key_.store_in_device(stream);
+
+            extraction_key_device_location_a_ =
+                DeviceVector<int32_t>(extraction_key_host_location_a_, stream);
+            extraction_key_host_location_a_.resize(0);
+            extraction_key_host_location_a_.shrink_to_fit();
+
+            extraction_key_device_location_b_ =
+                DeviceVector<int32_t>(extraction_key_host_location_b_, stream);
+            extraction_key_host_location_b_.resize(0);
+            extraction_key_host_location_b_.shrink_to_fit();
+
+            storage_type_ = storage_type::DEVICE;
+        }
+    }
+
+    void Packingkey<Scheme::CKKS>::store_in_host(cudaStream_t stream)
+    {
+        if (storage_type_ == storage_type::DEVICE)
+        {
+            ring_key_.store_in_host(stream);
+
+            extraction_key_host_location_a_ = HostVector<int32_t>(
+                extraction_key_device_location_a_.size());
+            cudaMemcpyAsync(extraction_key_host_location_a_.data(),
+                            extraction_key_device_location_a_.data(),
+                            extraction_key_device_location_a_.size() *
+                                sizeof(int32_t),
+                            cudaMemcpyDeviceToHost, stream);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+            extraction_key_host_location_b_ = HostVector<int32_t>(
+                extraction_key_device_location_b_.size());
+            cudaMemcpyAsync(extraction_key_host_location_b_.data(),
+                            extraction_key_device_location_b_.data(),
+                            extraction_key_device_location_b_.size() *
+                                sizeof(int32_t),
+                            cudaMemcpyDeviceToHost, stream);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+            extraction_key_device_location_a_.resize(0, stream);
+            extraction_key_device_location_b_.resize(0, stream);
+
+            storage_type_ = storage_type::HOST;
+        }
+        else
+        {
+            // pass
+        }
+    }
+
 } // namespace heongpu
\ No newline at end of file
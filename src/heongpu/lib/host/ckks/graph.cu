@@ -0,0 +1,1034 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "ckks/graph.cuh"
+
+#include <atomic>
+#include <set>
+
+namespace heongpu
+{
+    __host__ HEGraph<Scheme::CKKS>::HEGraph(HEContext<Scheme::CKKS>& context,
+                                            HEEncoder<Scheme::CKKS>& encoder,
+                                            double scale)
+        : context_(context), encoder_(encoder), scale_(scale)
+    {
+        if (scale <= 0.0)
+        {
+            throw std::invalid_argument("Scale has to be positive!");
+        }
+
+        Q_size_ = context.get_ciphertext_modulus_count();
+        slot_count_ = encoder.slot_count();
+
+        static std::atomic<std::uint64_t> graph_count(0);
+        graph_id_ = graph_count++;
+    }
+
+    __host__ int HEGraph<Scheme::CKKS>::input(int depth)
+    {
+        if ((depth < 0) || (depth >= Q_size_))
+        {
+            throw std::invalid_argument("Invalid input depth!");
+        }
+
+        GraphNode node;
+        node.operation = graph_operation::input;
+        node.parameter = static_cast<int>(input_nodes_.size());
+        node.depth = depth;
+
+        int index = add_node(node);
+        input_nodes_.push_back(index);
+
+        return index;
+    }
+
+    __host__ int HEGraph<Scheme::CKKS>::constant(double value)
+    {
+        GraphNode node;
+        node.operation = graph_operation::constant;
+        node.broadcast = true;
+        node.values = {value};
+
+        return add_node(node);
+    }
+
+    __host__ int
+    HEGraph<Scheme::CKKS>::constant(const std::vector<double>& values)
+    {
+        if (static_cast<int>(values.size()) > slot_count_)
+        {
+            throw std::invalid_argument(
+                "Constant has more values than the slot count!");
+        }
+
+        GraphNode node;
+        node.operation = graph_operation::constant;
+        node.broadcast = false;
+        node.values = values;
+        node.values.resize(slot_count_, 0.0);
+
+        return add_node(node);
+    }
+
+    __host__ int HEGraph<Scheme::CKKS>::add(int node1, int node2)
+    {
+        check_node(node1);
+        check_node(node2);
+
+        if (is_constant(node1) && is_constant(node2))
+        {
+            return combine_constants(node1, node2, graph_operation::add);
+        }
+
+        if (is_constant(node1))
+        {
+            std::swap(node1, node2);
+        }
+
+        if (is_constant(node2))
+        {
+            if (constant_equals(node2, 0.0))
+            {
+                fused_nodes_++;
+                return node1;
+            }
+
+            // (x + c1) + c2 -> x + (c1 + c2)
+            GraphNode inner = nodes_[node1];
+            if ((inner.operation == graph_operation::add) &&
+                is_constant(inner.operand2))
+            {
+                int folded = combine_constants(inner.operand2, node2,
+                                               graph_operation::add);
+                fused_nodes_++;
+                return add(inner.operand1, folded);
+            }
+        }
+        else if (node1 > node2)
+        {
+            std::swap(node1, node2);
+        }
+
+        GraphNode node;
+        node.operation = graph_operation::add;
+        node.operand1 = node1;
+        node.operand2 = node2;
+
+        return add_node(node);
+    }
+
+    __host__ int HEGraph<Scheme::CKKS>::sub(int node1, int node2)
+    {
+        check_node(node1);
+        check_node(node2);
+
+        if (is_constant(node1) && is_constant(node2))
+        {
+            return combine_constants(node1, node2, graph_operation::sub);
+        }
+
+        // Constants are subtracted as negated additions so that they fuse
+        // with neighbouring constant additions.
+        if (is_constant(node2))
+        {
+            return add(node1, negate_constant(node2));
+        }
+
+        if (is_constant(node1))
+        {
+            return add(negate(node2), node1);
+        }
+
+        GraphNode node;
+        node.operation = graph_operation::sub;
+        node.operand1 = node1;
+        node.operand2 = node2;
+
+        return add_node(node);
+    }
+
+    __host__ int HEGraph<Scheme::CKKS>::negate(int node)
+    {
+        check_node(node);
+
+        if (is_constant(node))
+        {
+            return negate_constant(node);
+        }
+
+        GraphNode inner = nodes_[node];
+        if (inner.operation == graph_operation::negate)
+        {
+            fused_nodes_++;
+            return inner.operand1;
+        }
+
+        // -(x * c) -> x * (-c)
+        if ((inner.operation == graph_operation::multiply) &&
+            is_constant(inner.operand2))
+        {
+            fused_nodes_++;
+            return multiply(inner.operand1, negate_constant(inner.operand2));
+        }
+
+        GraphNode result;
+        result.operation = graph_operation::negate;
+        result.operand1 = node;
+
+        return add_node(result);
+    }
+
+    __host__ int HEGraph<Scheme::CKKS>::multiply(int node1, int node2)
+    {
+        check_node(node1);
+        check_node(node2);
+
+        if (is_constant(node1) && is_constant(node2))
+        {
+            return combine_constants(node1, node2, graph_operation::multiply);
+        }
+
+        if (is_constant(node1))
+        {
+            std::swap(node1, node2);
+        }
+
+        if (is_constant(node2))
+        {
+            if (constant_equals(node2, 1.0))
+            {
+                fused_nodes_++;
+                return node1;
+            }
+
+            // (x * c1) * c2 -> x * (c1 * c2), saving a level.
+            GraphNode inner = nodes_[node1];
+            if ((inner.operation == graph_operation::multiply) &&
+                is_constant(inner.operand2))
+            {
+                int folded = combine_constants(inner.operand2, node2,
+                                               graph_operation::multiply);
+                fused_nodes_++;
+                return multiply(inner.operand1, folded);
+            }
+        }
+        else if (node1 > node2)
+        {
+            std::swap(node1, node2);
+        }
+
+        GraphNode node;
+        node.operation = graph_operation::multiply;
+        node.operand1 = node1;
+        node.operand2 = node2;
+
+        return add_node(node);
+    }
+
+    __host__ int HEGraph<Scheme::CKKS>::rotate(int node, int shift)
+    {
+        check_node(node);
+
+        shift = ((shift % slot_count_) + slot_count_) % slot_count_;
+        if (shift == 0)
+        {
+            fused_nodes_++;
+            return node;
+        }
+
+        if (is_constant(node))
+        {
+            fused_nodes_++;
+            if (nodes_[node].broadcast)
+            {
+                return node;
+            }
+
+            GraphNode rotated = nodes_[node];
+            for (int i = 0; i < slot_count_; i++)
+            {
+                rotated.values[i] =
+                    nodes_[node].values[(i + shift) % slot_count_];
+            }
+
+            return add_node(rotated);
+        }
+
+        // Consecutive rotations are merged into one key-switch.
+        GraphNode inner = nodes_[node];
+        if (inner.operation == graph_operation::rotate)
+        {
+            fused_nodes_++;
+            node = inner.operand1;
+            shift = (shift + inner.parameter) % slot_count_;
+            if (shift == 0)
+            {
+                return node;
+            }
+        }
+
+        GraphNode result;
+        result.operation = graph_operation::rotate;
+        result.operand1 = node;
+        result.parameter = shift;
+
+        return add_node(result);
+    }
+
+    __host__ int HEGraph<Scheme::CKKS>::conjugate(int node)
+    {
+        check_node(node);
+
+        // Constants are real.
+        if (is_constant(node))
+        {
+            fused_nodes_++;
+            return node;
+        }
+
+        GraphNode inner = nodes_[node];
+        if (inner.operation == graph_operation::conjugate)
+        {
+            fused_nodes_++;
+            return inner.operand1;
+        }
+
+        GraphNode result;
+        result.operation = graph_operation::conjugate;
+        result.operand1 = node;
+
+        return add_node(result);
+    }
+
+    __host__ void HEGraph<Scheme::CKKS>::output(int node)
+    {
+        check_node(node);
+
+        if (is_constant(node))
+        {
+            throw std::invalid_argument("Constants can not be graph outputs!");
+        }
+
+        output_nodes_.push_back(node);
+        compiled_ = false;
+    }
+
+    __host__ void HEGraph<Scheme::CKKS>::compile(int bootstrap_depth)
+    {
+        if (output_nodes_.empty())
+        {
+            throw std::invalid_argument("Graph has no outputs!");
+        }
+
+        if (bootstrap_depth >= (Q_size_ - 1))
+        {
+            throw std::invalid_argument(
+                "Bootstrapping has to leave at least one level!");
+        }
+
+        compiled_ = false;
+        bootstrap_depth_ = bootstrap_depth;
+        galois_key_required_ = false;
+        instructions_.clear();
+        register_count_ = 0;
+        primary_form_.assign(nodes_.size(), ValueForm{-1, 0, settled});
+        derived_forms_.clear();
+        statistics_ = GraphStatistics();
+
+        // Only nodes an output depends on are scheduled.
+        std::vector<bool> reachable(nodes_.size(), false);
+        std::vector<int> stack(output_nodes_.begin(), output_nodes_.end());
+        while (!stack.empty())
+        {
+            int node = stack.back();
+            stack.pop_back();
+            if (reachable[node])
+            {
+                continue;
+            }
+
+            reachable[node] = true;
+            if (nodes_[node].operand1 >= 0)
+            {
+                stack.push_back(nodes_[node].operand1);
+            }
+            if (nodes_[node].operand2 >= 0)
+            {
+                stack.push_back(nodes_[node].operand2);
+            }
+        }
+
+        // Operands are always recorded before their users, so index order is
+        // a topological order.
+        for (int node = 0; node < static_cast<int>(nodes_.size()); node++)
+        {
+            if (reachable[node] && !is_constant(node))
+            {
+                plan_node(node);
+            }
+        }
+
+        for (int i = 0; i < static_cast<int>(output_nodes_.size()); i++)
+        {
+            ValueForm form = settle(output_nodes_[i], settled);
+
+            GraphInstruction instruction;
+            instruction.instruction = graph_instruction::store_output;
+            instruction.source1 = form.reg;
+            instruction.parameter = i;
+            instructions_.push_back(instruction);
+        }
+
+        // Every register is released by its last reader.
+        std::vector<int> last_use(register_count_, -1);
+        for (int i = 0; i < static_cast<int>(instructions_.size()); i++)
+        {
+            if (instructions_[i].source1 >= 0)
+            {
+                last_use[instructions_[i].source1] = i;
+            }
+            if (instructions_[i].source2 >= 0)
+            {
+                last_use[instructions_[i].source2] = i;
+            }
+        }
+
+        for (int i = 0; i < static_cast<int>(instructions_.size()); i++)
+        {
+            GraphInstruction& instruction = instructions_[i];
+            instruction.release_source1 =
+                (instruction.source1 >= 0) &&
+                (last_use[instruction.source1] == i);
+            instruction.release_source2 =
+                (instruction.source2 >= 0) &&
+                (instruction.source2 != instruction.source1) &&
+                (last_use[instruction.source2] == i);
+        }
+
+        statistics_.fused_nodes = fused_nodes_;
+        compiled_ = true;
+    }
+
+    __host__ void HEGraph<Scheme::CKKS>::execute(
+        HEArithmeticOperator<Scheme::CKKS>& operators,
+        std::vector<Ciphertext<Scheme::CKKS>>& inputs,
+        std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+        Relinkey<Scheme::CKKS>& relin_key, Galoiskey<Scheme::CKKS>& galois_key,
+        const ExecutionOptions& options)
+    {
+        execute_graph(operators, inputs, outputs, relin_key, &galois_key,
+                      options);
+    }
+
+    __host__ void HEGraph<Scheme::CKKS>::execute(
+        HEArithmeticOperator<Scheme::CKKS>& operators,
+        std::vector<Ciphertext<Scheme::CKKS>>& inputs,
+        std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+        Relinkey<Scheme::CKKS>& relin_key, const ExecutionOptions& options)
+    {
+        execute_graph(operators, inputs, outputs, relin_key, nullptr, options);
+    }
+
+    __host__ std::vector<int> HEGraph<Scheme::CKKS>::rotation_steps() const
+    {
+        if (!compiled_)
+        {
+            throw std::logic_error("Graph is not compiled!");
+        }
+
+        std::set<int> steps;
+        for (const GraphInstruction& instruction : instructions_)
+        {
+            if (instruction.instruction == graph_instruction::rotate)
+            {
+                steps.insert(instruction.parameter);
+            }
+        }
+
+        return std::vector<int>(steps.begin(), steps.end());
+    }
+
+    __host__ int HEGraph<Scheme::CKKS>::add_node(GraphNode node)
+    {
+        compiled_ = false;
+
+        if ((node.operation == graph_operation::input) ||
+            (node.operation == graph_operation::constant))
+        {
+            nodes_.push_back(node);
+            return static_cast<int>(nodes_.size()) - 1;
+        }
+
+        std::tuple<int, int, int, int> key(static_cast<int>(node.operation),
+                                           node.operand1, node.operand2,
+                                           node.parameter);
+        auto it = node_lookup_.find(key);
+        if (it != node_lookup_.end())
+        {
+            fused_nodes_++;
+            return it->second;
+        }
+
+        nodes_.push_back(node);
+        int index = static_cast<int>(nodes_.size()) - 1;
+        node_lookup_[key] = index;
+
+        return index;
+    }
+
+    __host__ void HEGraph<Scheme::CKKS>::check_node(int node) const
+    {
+        if ((node < 0) || (node >= static_cast<int>(nodes_.size())))
+        {
+            throw std::invalid_argument("Invalid graph node!");
+        }
+    }
+
+    __host__ bool HEGraph<Scheme::CKKS>::is_constant(int node) const
+    {
+        return nodes_[node].operation == graph_operation::constant;
+    }
+
+    __host__ std::vector<double>
+    HEGraph<Scheme::CKKS>::expand_constant(int node) const
+    {
+        if (nodes_[node].broadcast)
+        {
+            return std::vector<double>(slot_count_, nodes_[node].values[0]);
+        }
+
+        return nodes_[node].values;
+    }
+
+    __host__ int
+    HEGraph<Scheme::CKKS>::combine_constants(int node1, int node2,
+                                             graph_operation operation)
+    {
+        auto combine = [&](double a, double b)
+        {
+            switch (operation)
+            {
+                case graph_operation::add:
+                    return a + b;
+                case graph_operation::sub:
+                    return a - b;
+                case graph_operation::multiply:
+                    return a * b;
+                default:
+                    throw std::logic_error("Invalid constant operation!");
+            }
+        };
+
+        GraphNode node;
+        node.operation = graph_operation::constant;
+        if (nodes_[node1].broadcast && nodes_[node2].broadcast)
+        {
+            node.broadcast = true;
+            node.values = {
+                combine(nodes_[node1].values[0], nodes_[node2].values[0])};
+        }
+        else
+        {
+            std::vector<double> values1 = expand_constant(node1);
+            std::vector<double> values2 = expand_constant(node2);
+
+            node.broadcast = false;
+            node.values.resize(slot_count_);
+            for (int i = 0; i < slot_count_; i++)
+            {
+                node.values[i] = combine(values1[i], values2[i]);
+            }
+        }
+
+        fused_nodes_++;
+        return add_node(node);
+    }
+
+    __host__ int HEGraph<Scheme::CKKS>::negate_constant(int node)
+    {
+        GraphNode negated = nodes_[node];
+        for (double& value : negated.values)
+        {
+            value = -value;
+        }
+
+        return add_node(negated);
+    }
+
+    __host__ bool HEGraph<Scheme::CKKS>::constant_equals(int node,
+                                                         double value) const
+    {
+        for (double element : nodes_[node].values)
+        {
+            if (element != value)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    __host__ HEGraph<Scheme::CKKS>::ValueForm
+    HEGraph<Scheme::CKKS>::emit(graph_instruction instruction, int source1,
+                                int source2, int parameter, int depth,
+                                int state)
+    {
+        GraphInstruction inst;
+        inst.instruction = instruction;
+        inst.destination = register_count_++;
+        inst.source1 = source1;
+        inst.source2 = source2;
+        inst.parameter = parameter;
+        instructions_.push_back(inst);
+
+        switch (instruction)
+        {
+            case graph_instruction::relinearize:
+                statistics_.relinearizations++;
+                break;
+            case graph_instruction::rescale:
+                statistics_.rescales++;
+                break;
+            case graph_instruction::mod_drop:
+                statistics_.mod_drops++;
+                break;
+            case graph_instruction::bootstrap:
+                statistics_.bootstraps++;
+                break;
+            default:
+                break;
+        }
+
+        return ValueForm{inst.destination, depth, state};
+    }
+
+    __host__ HEGraph<Scheme::CKKS>::ValueForm
+    HEGraph<Scheme::CKKS>::settle(int node, int max_state)
+    {
+        ValueForm form = primary_form_[node];
+        while (form.state > max_state)
+        {
+            graph_instruction instruction;
+            int depth;
+            int state;
+            if (form.state == relinearize_pending)
+            {
+                instruction = graph_instruction::relinearize;
+                depth = form.depth;
+                state = rescale_pending;
+            }
+            else
+            {
+                instruction = graph_instruction::rescale;
+                depth = form.depth + 1;
+                state = settled;
+            }
+
+            std::tuple<int, int, int> key(node, depth, state);
+            auto it = derived_forms_.find(key);
+            if (it != derived_forms_.end())
+            {
+                form = it->second;
+            }
+            else
+            {
+                form = emit(instruction, form.reg, -1, 0, depth, state);
+                derived_forms_[key] = form;
+            }
+        }
+
+        return form;
+    }
+
+    __host__ HEGraph<Scheme::CKKS>::ValueForm
+    HEGraph<Scheme::CKKS>::align(int node, int depth)
+    {
+        ValueForm form = settle(node, settled);
+        if (form.depth > depth)
+        {
+            throw std::logic_error("Value is deeper than the target level!");
+        }
+
+        while (form.depth < depth)
+        {
+            std::tuple<int, int, int> key(node, form.depth + 1, settled);
+            auto it = derived_forms_.find(key);
+            if (it != derived_forms_.end())
+            {
+                form = it->second;
+            }
+            else
+            {
+                form = emit(graph_instruction::mod_drop, form.reg, -1, 0,
+                            form.depth + 1, settled);
+                derived_forms_[key] = form;
+            }
+        }
+
+        return form;
+    }
+
+    __host__ HEGraph<Scheme::CKKS>::ValueForm
+    HEGraph<Scheme::CKKS>::bootstrap(int node)
+    {
+        ValueForm form = align(node, Q_size_ - 1);
+        ValueForm refreshed = emit(graph_instruction::bootstrap, form.reg, -1,
+                                   0, bootstrap_depth_, settled);
+
+        // Later consumers use the refreshed value.
+        primary_form_[node] = refreshed;
+        derived_forms_[std::make_tuple(node, bootstrap_depth_,
+                                       static_cast<int>(settled))] = refreshed;
+        galois_key_required_ = true;
+
+        return refreshed;
+    }
+
+    __host__ HEGraph<Scheme::CKKS>::ValueForm
+    HEGraph<Scheme::CKKS>::level_for_multiplication(int node)
+    {
+        ValueForm form = settle(node, settled);
+        if (form.depth <= (Q_size_ - 2))
+        {
+            return form;
+        }
+
+        if (bootstrap_depth_ < 0)
+        {
+            throw std::logic_error(
+                "Graph needs more levels than the context has!");
+        }
+
+        return bootstrap(node);
+    }
+
+    __host__ void HEGraph<Scheme::CKKS>::plan_node(int node)
+    {
+        const GraphNode current = nodes_[node];
+        ValueForm form;
+
+        switch (current.operation)
+        {
+            case graph_operation::input:
+            {
+                form = emit(graph_instruction::load_input, -1, -1,
+                            current.parameter, current.depth, settled);
+                break;
+            }
+            case graph_operation::add:
+            case graph_operation::sub:
+            {
+                graph_instruction instruction =
+                    (current.operation == graph_operation::add)
+                        ? graph_instruction::add
+                        : graph_instruction::sub;
+
+                if (is_constant(current.operand2))
+                {
+                    ValueForm input1 = settle(current.operand1, settled);
+                    form = emit(graph_instruction::add_constant, input1.reg,
+                                -1, current.operand2, input1.depth, settled);
+                    break;
+                }
+
+                // Pending maintenance is kept if both operands share it, so
+                // that sums of products are relinearized and rescaled once.
+                ValueForm input1 = primary_form_[current.operand1];
+                ValueForm input2 = primary_form_[current.operand2];
+                if ((input1.depth != input2.depth) ||
+                    (input1.state != input2.state))
+                {
+                    int state = std::min(input1.state, input2.state);
+                    input1 = settle(current.operand1, state);
+                    input2 = settle(current.operand2, state);
+
+                    if ((input1.depth != input2.depth) ||
+                        (input1.state != input2.state))
+                    {
+                        input1 = settle(current.operand1, settled);
+                        input2 = settle(current.operand2, settled);
+                        int depth = std::max(input1.depth, input2.depth);
+                        input1 = align(current.operand1, depth);
+                        input2 = align(current.operand2, depth);
+                    }
+                }
+
+                form = emit(instruction, input1.reg, input2.reg, 0,
+                            input1.depth, input1.state);
+                break;
+            }
+            case graph_operation::negate:
+            {
+                ValueForm input1 = primary_form_[current.operand1];
+                form = emit(graph_instruction::negate, input1.reg, -1, 0,
+                            input1.depth, input1.state);
+                break;
+            }
+            case graph_operation::multiply:
+            {
+                if (is_constant(current.operand2))
+                {
+                    ValueForm input1 =
+                        level_for_multiplication(current.operand1);
+                    form = emit(graph_instruction::multiply_constant,
+                                input1.reg, -1, current.operand2,
+                                input1.depth, rescale_pending);
+                    break;
+                }
+
+                level_for_multiplication(current.operand1);
+                level_for_multiplication(current.operand2);
+
+                int depth = std::max(settle(current.operand1, settled).depth,
+                                     settle(current.operand2, settled).depth);
+                ValueForm input1 = align(current.operand1, depth);
+                ValueForm input2 = align(current.operand2, depth);
+
+                form = emit(graph_instruction::multiply, input1.reg,
+                            input2.reg, 0, depth, relinearize_pending);
+                break;
+            }
+            case graph_operation::rotate:
+            case graph_operation::conjugate:
+            {
+                graph_instruction instruction =
+                    (current.operation == graph_operation::rotate)
+                        ? graph_instruction::rotate
+                        : graph_instruction::conjugate;
+
+                ValueForm input1 = settle(current.operand1, settled);
+                form = emit(instruction, input1.reg, -1, current.parameter,
+                            input1.depth, settled);
+                galois_key_required_ = true;
+                break;
+            }
+            default:
+                throw std::logic_error("Invalid graph operation!");
+        }
+
+        primary_form_[node] = form;
+    }
+
+    __host__ void HEGraph<Scheme::CKKS>::execute_graph(
+        HEArithmeticOperator<Scheme::CKKS>& operators,
+        std::vector<Ciphertext<Scheme::CKKS>>& inputs,
+        std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+        Relinkey<Scheme::CKKS>& relin_key, Galoiskey<Scheme::CKKS>* galois_key,
+        const ExecutionOptions& options)
+    {
+        if (!compiled_)
+        {
+            throw std::logic_error("Graph is not compiled!");
+        }
+
+        if (inputs.size() != input_nodes_.size())
+        {
+            throw std::invalid_argument("Invalid number of graph inputs!");
+        }
+
+        if (galois_key_required_ && (galois_key == nullptr))
+        {
+            throw std::invalid_argument("Graph needs a Galois key!");
+        }
+
+        ExecutionOptions options_inner =
+            ExecutionOptions()
+                .set_stream(options.stream_)
+                .set_storage_type(storage_type::DEVICE)
+                .set_initial_location(true);
+
+        std::vector<Ciphertext<Scheme::CKKS>> registers(register_count_);
+        outputs.resize(output_nodes_.size());
+
+        for (const GraphInstruction& instruction : instructions_)
+        {
+            Ciphertext<Scheme::CKKS>* source1 =
+                (instruction.source1 >= 0) ? &registers[instruction.source1]
+                                           : nullptr;
+            Ciphertext<Scheme::CKKS>* source2 =
+                (instruction.source2 >= 0) ? &registers[instruction.source2]
+                                           : nullptr;
+            Ciphertext<Scheme::CKKS>* destination =
+                (instruction.destination >= 0)
+                    ? &registers[instruction.destination]
+                    : nullptr;
+
+            // Maintenance operations update the source in place when it is
+            // not read again.
+            auto take_source = [&]()
+            {
+                if (instruction.release_source1)
+                {
+                    *destination = std::move(*source1);
+                }
+                else
+                {
+                    *destination = *source1;
+                }
+            };
+
+            auto new_destination = [&]()
+            {
+                *destination =
+                    Ciphertext<Scheme::CKKS>(context_, options_inner);
+            };
+
+            switch (instruction.instruction)
+            {
+                case graph_instruction::load_input:
+                {
+                    Ciphertext<Scheme::CKKS>& input =
+                        inputs[instruction.parameter];
+                    int depth =
+                        nodes_[input_nodes_[instruction.parameter]].depth;
+
+                    if (input.rescale_required() ||
+                        input.relinearization_required())
+                    {
+                        throw std::invalid_argument(
+                            "Graph inputs have to be relinearized and "
+                            "rescaled!");
+                    }
+
+                    if (input.depth() > depth)
+                    {
+                        throw std::invalid_argument(
+                            "Graph input is deeper than declared!");
+                    }
+
+                    *destination = input;
+                    while (destination->depth() < depth)
+                    {
+                        operators.mod_drop_inplace(*destination, options_inner);
+                    }
+                    break;
+                }
+                case graph_instruction::add:
+                    new_destination();
+                    operators.add(*source1, *source2, *destination,
+                                  options_inner);
+                    break;
+                case graph_instruction::sub:
+                    new_destination();
+                    operators.sub(*source1, *source2, *destination,
+                                  options_inner);
+                    break;
+                case graph_instruction::negate:
+                    take_source();
+                    operators.negate_inplace(*destination, options_inner);
+                    break;
+                case graph_instruction::multiply:
+                    new_destination();
+                    operators.multiply(*source1, *source2, *destination,
+                                       options_inner);
+                    break;
+                case graph_instruction::add_constant:
+                {
+                    ConstantCache<Scheme::CKKS>::Entry plain =
+                        encode_constant(operators, instruction.parameter,
+                                        source1->scale(), source1->depth(),
+                                        options_inner);
+                    take_source();
+                    operators.add_plain_inplace(*destination, *plain,
+                                                options_inner);
+                    break;
+                }
+                case graph_instruction::multiply_constant:
+                {
+                    ConstantCache<Scheme::CKKS>::Entry plain =
+                        encode_constant(operators, instruction.parameter,
+                                        scale_, source1->depth(),
+                                        options_inner);
+                    take_source();
+                    operators.multiply_plain_inplace(*destination, *plain,
+                                                     options_inner);
+                    break;
+                }
+                case graph_instruction::rotate:
+                    new_destination();
+                    operators.rotate_rows(*source1, *destination, *galois_key,
+                                          instruction.parameter,
+                                          options_inner);
+                    break;
+                case graph_instruction::conjugate:
+                    new_destination();
+                    operators.conjugate(*source1, *destination, *galois_key,
+                                        options_inner);
+                    break;
+                case graph_instruction::relinearize:
+                    take_source();
+                    operators.relinearize_inplace(*destination, relin_key,
+                                                  options_inner);
+                    break;
+                case graph_instruction::rescale:
+                    take_source();
+                    operators.rescale_inplace(*destination, options_inner);
+                    break;
+                case graph_instruction::mod_drop:
+                    take_source();
+                    operators.mod_drop_inplace(*destination, options_inner);
+                    break;
+                case graph_instruction::bootstrap:
+                    *destination = operators.regular_bootstrapping(
+                        *source1, *galois_key, relin_key, options_inner);
+                    break;
+                case graph_instruction::store_output:
+                    output_storage_manager(
+                        outputs[instruction.parameter],
+                        [&](Ciphertext<Scheme::CKKS>& output_)
+                        {
+                            if (instruction.release_source1)
+                            {
+                                output_ = std::move(*source1);
+                            }
+                            else
+                            {
+                                output_ = *source1;
+                            }
+                        },
+                        options);
+                    break;
+                default:
+                    throw std::logic_error("Invalid graph instruction!");
+            }
+
+            if (instruction.release_source1)
+            {
+                *source1 = Ciphertext<Scheme::CKKS>();
+            }
+            if (instruction.release_source2)
+            {
+                *source2 = Ciphertext<Scheme::CKKS>();
+            }
+        }
+    }
+
+    __host__ ConstantCache<Scheme::CKKS>::Entry
+    HEGraph<Scheme::CKKS>::encode_constant(
+        HEArithmeticOperator<Scheme::CKKS>& operators, int node, double scale,
+        int depth, const ExecutionOptions& options)
+    {
+        const GraphNode& constant = nodes_[node];
+        if (constant.broadcast)
+        {
+            return operators.encoded_constant(constant.values[0], depth, scale,
+                                              options);
+        }
+
+        std::vector<Complex64> values(slot_count_);
+        for (int i = 0; i < slot_count_; i++)
+        {
+            values[i] = Complex64(constant.values[i], 0.0);
+        }
+
+        ConstantKey key{constant_kind::GRAPH_VECTOR, graph_id_,
+                        static_cast<std::uint64_t>(node), depth, scale};
+
+        return operators.cached_encoding(key, values, slot_count_);
+    }
+
+} // namespace heongpu
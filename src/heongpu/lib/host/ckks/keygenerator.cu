@@ -31,6 +31,8 @@ namespace heongpu
         Q_size_ = context.Q_size;
         P_size_ = context.P_size;
 
+        key_limb_type_ = context.key_limb_type_;
+
         modulus_ = context.modulus_;
         ntt_table_ = context.ntt_table_;
         intt_table_ = context.intt_table_;
@@ -295,25 +297,83 @@ namespace heongpu
                         DeviceVector<Data64> output_memory(
                             (2 * Q_prime_size_ * n), options.stream_);
 
-                        global_memory_replace_kernel<<<
-                            dim3((n >> 8), Q_prime_size_, 2), 256, 0,
-                            options.stream_>>>(all_pk[0].data(),
-                                               output_memory.data(), n_power);
-                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+                        std::vector<Data64*> pieces;
+                        for (int i = 0; i < participant_count; i++)
+                        {
+                            pieces.push_back(all_pk_[i].data());
+                        }
+
+                        tree_reduce_multi_party_key(
+                            pieces, output_memory.data(), 2 * Q_prime_size_ * n,
+                            1, false, options.stream_);
+
+                        pk_.memory_set(std::move(output_memory));
+
+                        pk_.in_ntt_domain_ = true;
+                        pk_.public_key_generated_ = true;
+                    },
+                    options);
+            },
+            options, false);
+    }
+
+    __host__ void
+    HEKeyGenerator<Scheme::CKKS>::accumulate_multi_party_public_key(
+        MultipartyPublickey<Scheme::CKKS>& pk_piece,
+        Publickey<Scheme::CKKS>& pk, bool first,
+        const ExecutionOptions& options)
+    {
+        if (!pk_piece.public_key_generated_)
+        {
+            throw std::invalid_argument(
+                "MultipartyPublickey is not generated!");
+        }
+
+        if (!first)
+        {
+            if (!pk.public_key_generated_)
+            {
+                throw std::logic_error("Common publickey has no share yet!");
+            }
+
+            if (!pk.is_on_device())
+            {
+                pk.store_in_device(options.stream_);
+            }
+        }
+
+        input_storage_manager(
+            pk_piece,
+            [&](MultipartyPublickey<Scheme::CKKS>& pk_piece_)
+            {
+                output_storage_manager(
+                    pk,
+                    [&](Publickey<Scheme::CKKS>& pk_)
+                    {
+                        if (first)
+                        {
+                            DeviceVector<Data64> output_memory(
+                                (2 * Q_prime_size_ * n), options.stream_);
+
+                            global_memory_replace_kernel<<<
+                                dim3((n >> 8), Q_prime_size_, 2), 256, 0,
+                                options.stream_>>>(pk_piece_.data(),
+                                                   output_memory.data(),
+                                                   n_power);
+                            HEONGPU_CUDA_CHECK(cudaGetLastError());
 
-                        for (int i = 1; i < participant_count; i++)
+                            pk_.memory_set(std::move(output_memory));
+                        }
+                        else
                         {
                             threshold_pk_addition<<<dim3((n >> 8),
                                                          Q_prime_size_, 1),
                                                     256, 0, options.stream_>>>(
-                                all_pk[i].data(), output_memory.data(),
-                                output_memory.data(), modulus_->data(), n_power,
-                                false);
+                                pk_piece_.data(), pk_.data(), pk_.data(),
+                                modulus_->data(), n_power, false);
                             HEONGPU_CUDA_CHECK(cudaGetLastError());
                         }
 
-                        pk_.memory_set(std::move(output_memory));
-
                         pk_.in_ntt_domain_ = true;
                         pk_.public_key_generated_ = true;
                     },
@@ -322,6 +382,63 @@ namespace heongpu
             options, false);
     }
 
+    __host__ void HEKeyGenerator<Scheme::CKKS>::generate_relin_key(
+        Relinkey<Scheme::CKKS>& rk, Secretkey<Scheme::CKKS>& sk, int max_level,
+        const ExecutionOptions& options)
+    {
+        if (rk.relin_key_generated_)
+        {
+            throw std::logic_error("Relinkey is already generated!");
+        }
+
+        rk.d_ = trimmed_decomp_count(rk.key_type, max_level);
+        rk.relinkey_size_ = 2 * rk.d_ * Q_prime_size_ * n;
+
+        generate_relin_key(rk, sk, options);
+    }
+
+    __host__ void HEKeyGenerator<Scheme::CKKS>::generate_galois_key(
+        Galoiskey<Scheme::CKKS>& gk, Secretkey<Scheme::CKKS>& sk, int max_level,
+        const ExecutionOptions& options)
+    {
+        if (gk.galois_key_generated_)
+        {
+            throw std::logic_error("Galoiskey is already generated!");
+        }
+
+        gk.d_ = trimmed_decomp_count(gk.key_type, max_level);
+        gk.galoiskey_size_ = 2 * gk.d_ * Q_prime_size_ * n;
+
+        generate_galois_key(gk, sk, options);
+    }
+
+    __host__ int HEKeyGenerator<Scheme::CKKS>::trimmed_decomp_count(
+        keyswitching_type key_type, int max_level) const
+    {
+        if ((max_level < 0) || (max_level >= Q_size_))
+        {
+            throw std::invalid_argument("Invalid key level!");
+        }
+
+        // Decomposition blocks of a key are ordered so that a ciphertext at
+        // depth l only reads a prefix of them, hence the deepest supported
+        // depth fixes how many blocks have to be generated.
+        int min_depth = Q_size_ - 1 - max_level;
+        switch (static_cast<int>(key_type))
+        {
+            case 1: // KEYSWITCHING_METHOD_I
+                return Q_size_ - min_depth;
+            case 2: // KEYSWITCHING_METHOD_II
+                return d_leveled_->operator[](min_depth);
+            case 3: // KEYSWITCHING_METHOD_III
+                throw std::invalid_argument(
+                    "KEYSWITCHING_METHOD_III keys can not be trimmed to a "
+                    "level!");
+            default:
+                throw std::invalid_argument("Invalid Key Switching Type");
+        }
+    }
+
     __host__ void HEKeyGenerator<Scheme::CKKS>::generate_relin_key_method_I(
         Relinkey<Scheme::CKKS>& rk, Secretkey<Scheme::CKKS>& sk,
         const ExecutionOptions& options)
@@ -344,22 +461,25 @@ namespace heongpu
                     rk,
                     [&](Relinkey<Scheme::CKKS>& rk_)
                     {
+                        // A level-trimmed key keeps only its leading
+                        // decomposition blocks, so only those are sampled
+                        // and generated.
+                        int d = rk_.d_;
+
                         DeviceVector<Data64> errors_a(
-                            2 * Q_prime_size_ * Q_size_ * n, options.stream_);
+                            2 * Q_prime_size_ * d * n, options.stream_);
                         Data64* error_poly = errors_a.data();
-                        Data64* a_poly =
-                            error_poly + (Q_prime_size_ * Q_size_ * n);
+                        Data64* a_poly = error_poly + (Q_prime_size_ * d * n);
 
                         RandomNumberGenerator::instance()
                             .modular_uniform_random_number_generation(
                                 a_poly, modulus_->data(), n_power,
-                                Q_prime_size_, Q_size_, options.stream_);
+                                Q_prime_size_, d, options.stream_);
 
                         RandomNumberGenerator::instance()
                             .modular_gaussian_random_number_generation(
                                 error_std_dev, error_poly, modulus_->data(),
-                                n_power, Q_prime_size_, Q_size_,
-                                options.stream_);
+                                n_power, Q_prime_size_, d, options.stream_);
 
                         gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
                             .n_power = n_power,
@@ -371,7 +491,7 @@ namespace heongpu
 
                         gpuntt::GPU_NTT_Inplace(
                             error_poly, ntt_table_->data(), modulus_->data(),
-                            cfg_ntt, Q_size_ * Q_prime_size_, Q_prime_size_);
+                            cfg_ntt, d * Q_prime_size_, Q_prime_size_);
                         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
                         DeviceVector<Data64> output_memory(rk_.relinkey_size_,
@@ -381,11 +501,16 @@ namespace heongpu
                                               256, 0, options.stream_>>>(
                             output_memory.data(), sk_.data(), error_poly,
                             a_poly, modulus_->data(), factor_->data(), n_power,
-                            Q_prime_size_);
+                            Q_prime_size_, d);
                         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
                         rk_.memory_set(std::move(output_memory));
 
+                        if (key_limb_type_ == limb_type::LIMB32)
+                        {
+                            rk_.compact_limbs(options.stream_);
+                        }
+
                         rk_.relin_key_generated_ = true;
                     },
                     options);
@@ -830,24 +955,7 @@ namespace heongpu
             }
         }
 
-        int dimension;
-        switch (static_cast<int>(rk.key_type))
-        {
-            case 1: // KEYSWITCHING_METHOD_I
-                dimension = rk.Q_size_;
-                break;
-            case 2: // KEYSWITCHING_METHOD_II
-                dimension = rk.d_;
-                break;
-            case 3: // KEYSWITCHING_METHOD_III
-                throw std::invalid_argument(
-                    "Key Switching Type III is not supported for multi "
-                    "party key generation.");
-                break;
-            default:
-                throw std::invalid_argument("Invalid Key Switching Type");
-                break;
-        }
+        int dimension = multi_party_decomp_count(rk.key_type, rk.d_);
 
         input_vector_storage_manager(
             all_rk,
@@ -860,25 +968,16 @@ namespace heongpu
                         DeviceVector<Data64> output_memory(rk_.relinkey_size_,
                                                            options.stream_);
 
-                        multi_party_relinkey_method_I_stage_I_kernel<<<
-                            dim3((n >> 8), Q_prime_size_, 1), 256, 0,
-                            options.stream_>>>(all_rk[0].data(),
-                                               output_memory.data(),
-                                               modulus_->data(), n_power,
-                                               Q_prime_size_, dimension, true);
-                        HEONGPU_CUDA_CHECK(cudaGetLastError());
-
-                        for (int i = 1; i < participant_count; i++)
+                        std::vector<Data64*> pieces;
+                        for (int i = 0; i < participant_count; i++)
                         {
-                            multi_party_relinkey_method_I_stage_I_kernel<<<
-                                dim3((n >> 8), Q_prime_size_, 1), 256, 0,
-                                options.stream_>>>(
-                                all_rk[i].data(), output_memory.data(),
-                                modulus_->data(), n_power, Q_prime_size_,
-                                dimension, false);
-                            HEONGPU_CUDA_CHECK(cudaGetLastError());
+                            pieces.push_back(all_rk_[i].data());
                         }
 
+                        tree_reduce_multi_party_key(
+                            pieces, output_memory.data(), rk_.relinkey_size_,
+                            dimension, true, options.stream_);
+
                         rk_.memory_set(std::move(output_memory));
 
                         rk_.relin_key_generated_ = true;
@@ -915,24 +1014,7 @@ namespace heongpu
             throw std::logic_error("Common Relinkey is not generated!");
         }
 
-        int dimension;
-        switch (static_cast<int>(rk.key_type))
-        {
-            case 1: // KEYSWITCHING_METHOD_I
-                dimension = rk.Q_size_;
-                break;
-            case 2: // KEYSWITCHING_METHOD_II
-                dimension = rk.d_;
-                break;
-            case 3: // KEYSWITCHING_METHOD_III
-                throw std::invalid_argument(
-                    "Key Switching Type III is not supported for multi "
-                    "party key generation.");
-                break;
-            default:
-                throw std::invalid_argument("Invalid Key Switching Type");
-                break;
-        }
+        int dimension = multi_party_decomp_count(rk.key_type, rk.d_);
 
         input_vector_storage_manager(
             all_rk,
@@ -949,27 +1031,180 @@ namespace heongpu
                                 DeviceVector<Data64> output_memory(
                                     rk_.relinkey_size_, options.stream_);
 
+                                std::vector<Data64*> pieces;
+                                for (int i = 0; i < participant_count; i++)
+                                {
+                                    pieces.push_back(all_rk_[i].data());
+                                }
+
+                                // Both components of the pieces are summed
+                                // first, then folded into the first component
+                                // next to the shared Stage 1 key.
+                                tree_reduce_multi_party_key(
+                                    pieces, output_memory.data(),
+                                    rk_.relinkey_size_, dimension, true,
+                                    options.stream_);
+
                                 multi_party_relinkey_method_I_stage_II_kernel<<<
                                     dim3((n >> 8), Q_prime_size_, 1), 256, 0,
                                     options.stream_>>>(
-                                    all_rk[0].data(), rk_common_stage1.data(),
+                                    output_memory.data(),
+                                    rk_common_stage1_.data(),
                                     output_memory.data(), modulus_->data(),
                                     n_power, Q_prime_size_, dimension);
                                 HEONGPU_CUDA_CHECK(cudaGetLastError());
 
-                                for (int i = 1; i < participant_count; i++)
+                                rk_.memory_set(std::move(output_memory));
+
+                                rk_.relin_key_generated_ = true;
+                            },
+                            options);
+                    },
+                    options, false);
+            },
+            options, false);
+    }
+
+    __host__ void
+    HEKeyGenerator<Scheme::CKKS>::accumulate_multi_party_relin_key(
+        MultipartyRelinkey<Scheme::CKKS>& rk_piece,
+        MultipartyRelinkey<Scheme::CKKS>& rk, bool first,
+        const ExecutionOptions& options)
+    {
+        if (!rk_piece.relin_key_generated_)
+        {
+            throw std::invalid_argument(
+                "MultipartyRelinkey is not generated!");
+        }
+
+        if (rk_piece.relinkey_size_ != rk.relinkey_size_)
+        {
+            throw std::invalid_argument(
+                "MultipartyRelinkey size is not valid!");
+        }
+
+        int dimension = multi_party_decomp_count(rk.key_type, rk.d_);
+
+        if (!first)
+        {
+            if (!rk.relin_key_generated_)
+            {
+                throw std::logic_error("Common Relinkey has no share yet!");
+            }
+
+            if (!rk.is_on_device())
+            {
+                rk.store_in_device(options.stream_);
+            }
+        }
+
+        input_storage_manager(
+            rk_piece,
+            [&](MultipartyRelinkey<Scheme::CKKS>& rk_piece_)
+            {
+                output_storage_manager(
+                    rk,
+                    [&](MultipartyRelinkey<Scheme::CKKS>& rk_)
+                    {
+                        if (first)
+                        {
+                            DeviceVector<Data64> output_memory(
+                                rk_.relinkey_size_, options.stream_);
+                            rk_.memory_set(std::move(output_memory));
+                        }
+
+                        multi_party_relinkey_method_I_stage_I_kernel<<<
+                            dim3((n >> 8), Q_prime_size_, 1), 256, 0,
+                            options.stream_>>>(rk_piece_.data(), rk_.data(),
+                                               modulus_->data(), n_power,
+                                               Q_prime_size_, dimension, first);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        rk_.relin_key_generated_ = true;
+                    },
+                    options);
+            },
+            options, false);
+    }
+
+    __host__ void
+    HEKeyGenerator<Scheme::CKKS>::accumulate_multi_party_relin_key(
+        MultipartyRelinkey<Scheme::CKKS>& rk_piece,
+        MultipartyRelinkey<Scheme::CKKS>& rk_common_stage1,
+        Relinkey<Scheme::CKKS>& rk, bool first,
+        const ExecutionOptions& options)
+    {
+        if (!rk_piece.relin_key_generated_)
+        {
+            throw std::invalid_argument(
+                "MultipartyRelinkey is not generated!");
+        }
+
+        if (!rk_common_stage1.relin_key_generated_)
+        {
+            throw std::logic_error("Common Relinkey is not generated!");
+        }
+
+        if (rk_piece.relinkey_size_ != rk.relinkey_size_)
+        {
+            throw std::invalid_argument(
+                "MultipartyRelinkey size is not valid!");
+        }
+
+        int dimension = multi_party_decomp_count(rk.key_type, rk.d_);
+
+        if (!first)
+        {
+            if (!rk.relin_key_generated_)
+            {
+                throw std::logic_error("Relinkey has no share yet!");
+            }
+
+            if (!rk.is_on_device())
+            {
+                rk.store_in_device(options.stream_);
+            }
+        }
+
+        input_storage_manager(
+            rk_piece,
+            [&](MultipartyRelinkey<Scheme::CKKS>& rk_piece_)
+            {
+                input_storage_manager(
+                    rk_common_stage1,
+                    [&](MultipartyRelinkey<Scheme::CKKS>& rk_common_stage1_)
+                    {
+                        output_storage_manager(
+                            rk,
+                            [&](Relinkey<Scheme::CKKS>& rk_)
+                            {
+                                if (first)
+                                {
+                                    DeviceVector<Data64> output_memory(
+                                        rk_.relinkey_size_, options.stream_);
+
+                                    multi_party_relinkey_method_I_stage_II_kernel<<<
+                                        dim3((n >> 8), Q_prime_size_, 1), 256,
+                                        0, options.stream_>>>(
+                                        rk_piece_.data(),
+                                        rk_common_stage1_.data(),
+                                        output_memory.data(), modulus_->data(),
+                                        n_power, Q_prime_size_, dimension);
+                                    HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                                    rk_.memory_set(std::move(output_memory));
+                                }
+                                else
                                 {
                                     multi_party_relinkey_method_I_stage_II_kernel<<<
                                         dim3((n >> 8), Q_prime_size_, 1), 256,
                                         0, options.stream_>>>(
-                                        all_rk[i].data(), output_memory.data(),
+                                        rk_piece_.data(), rk_.data(),
                                         modulus_->data(), n_power,
                                         Q_prime_size_, dimension);
                                     HEONGPU_CUDA_CHECK(cudaGetLastError());
                                 }
 
-                                rk_.memory_set(std::move(output_memory));
-
                                 rk_.relin_key_generated_ = true;
                             },
                             options);
@@ -1003,24 +1238,21 @@ namespace heongpu
                     [&](Relinkey<Scheme::CKKS>& rk_)
                     {
                         DeviceVector<Data64> errors_a(
-                            2 * Q_prime_size_ * d_leveled_->operator[](0) * n,
-                            options.stream_);
+                            2 * Q_prime_size_ * rk_.d_ * n, options.stream_);
                         Data64* error_poly = errors_a.data();
                         Data64* a_poly =
-                            error_poly +
-                            (Q_prime_size_ * d_leveled_->operator[](0) * n);
+                            error_poly + (Q_prime_size_ * rk_.d_ * n);
 
                         RandomNumberGenerator::instance()
                             .modular_uniform_random_number_generation(
                                 a_poly, modulus_->data(), n_power,
-                                Q_prime_size_, d_leveled_->operator[](0),
-                                options.stream_);
+                                Q_prime_size_, rk_.d_, options.stream_);
 
                         RandomNumberGenerator::instance()
                             .modular_gaussian_random_number_generation(
                                 error_std_dev, error_poly, modulus_->data(),
-                                n_power, Q_prime_size_,
-                                d_leveled_->operator[](0), options.stream_);
+                                n_power, Q_prime_size_, rk_.d_,
+                                options.stream_);
 
                         gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
                             .n_power = n_power,
@@ -1032,8 +1264,7 @@ namespace heongpu
 
                         gpuntt::GPU_NTT_Inplace(
                             error_poly, ntt_table_->data(), modulus_->data(),
-                            cfg_ntt, d_leveled_->operator[](0) * Q_prime_size_,
-                            Q_prime_size_);
+                            cfg_ntt, rk_.d_ * Q_prime_size_, Q_prime_size_);
                         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
                         DeviceVector<Data64> output_memory(rk_.relinkey_size_,
@@ -1045,8 +1276,7 @@ namespace heongpu
                             output_memory.data(), sk.data(), error_poly, a_poly,
                             modulus_->data(), factor_->data(),
                             Sk_pair_leveled_->operator[](0).data(), n_power,
-                            Q_prime_size_, d_leveled_->operator[](0), Q_size_,
-                            P_size_);
+                            Q_prime_size_, rk_.d_, Q_size_, P_size_);
                         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
                         rk_.memory_set(std::move(output_memory));
@@ -1220,229 +1450,264 @@ namespace heongpu
             sk,
             [&](Secretkey<Scheme::CKKS>& sk_)
             {
-                DeviceVector<Data64> errors_a(2 * Q_prime_size_ * Q_size_ * n,
-                                              options.stream_);
-                Data64* error_poly = errors_a.data();
-                Data64* a_poly = error_poly + (Q_prime_size_ * Q_size_ * n);
+                std::vector<int> storage_elts;
+                std::vector<int> kernel_elts;
+                galois_key_elements(gk, storage_elts, kernel_elts);
 
-                if (!gk.customized)
+                int key_count = kernel_elts.size();
+                int decomp_mod_count =
+                    gk.galoiskey_size_ / (2 * Q_prime_size_ * n);
+                int batch_count = galois_key_batch_count(decomp_mod_count);
+
+                for (int first = 0; first < key_count; first += batch_count)
                 {
-                    // Positive Row Shift
-                    for (auto& galois : gk.galois_elt)
+                    int count = std::min(batch_count, key_count - first);
+
+                    // Device keys are generated in place, host keys through
+                    // one staging buffer per batch.
+                    DeviceVector<Data64> staging;
+                    if (options.storage_ == storage_type::HOST)
                     {
-                        RandomNumberGenerator::instance()
-                            .modular_uniform_random_number_generation(
-                                a_poly, modulus_->data(), n_power,
-                                Q_prime_size_, Q_size_, options.stream_);
+                        staging.resize(count * gk.galoiskey_size_,
+                                       options.stream_);
+                    }
 
-                        RandomNumberGenerator::instance()
-                            .modular_gaussian_random_number_generation(
-                                error_std_dev, error_poly, modulus_->data(),
-                                n_power, Q_prime_size_, Q_size_,
-                                options.stream_);
-
-                        gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
-                            .n_power = n_power,
-                            .ntt_type = gpuntt::FORWARD,
-                            .reduction_poly =
-                                gpuntt::ReductionPolynomial::X_N_plus,
-                            .zero_padding = false,
-                            .stream = options.stream_};
-
-                        gpuntt::GPU_NTT_Inplace(
-                            error_poly, ntt_table_->data(), modulus_->data(),
-                            cfg_ntt, Q_size_ * Q_prime_size_, Q_prime_size_);
-                        HEONGPU_CUDA_CHECK(cudaGetLastError());
-
-                        int inv_galois = modInverse(galois.second, 2 * n);
-
-                        DeviceVector<Data64> output_memory(gk.galoiskey_size_,
-                                                           options.stream_);
-
-                        galoiskey_gen_kernel<<<dim3((n >> 8), Q_prime_size_, 1),
-                                               256, 0, options.stream_>>>(
-                            output_memory.data(), sk.data(), error_poly, a_poly,
-                            modulus_->data(), factor_->data(), inv_galois,
-                            n_power, Q_prime_size_);
-                        HEONGPU_CUDA_CHECK(cudaGetLastError());
-
-                        if (options.storage_ == storage_type::DEVICE)
+                    std::vector<Data64*> outputs(count);
+                    for (int i = 0; i < count; i++)
+                    {
+                        int key = first + i;
+                        if (options.storage_ == storage_type::HOST)
                         {
-                            gk.device_location_[galois.second] =
-                                std::move(output_memory);
+                            outputs[i] =
+                                staging.data() + (i * gk.galoiskey_size_);
+                        }
+                        else if (key == (key_count - 1))
+                        {
+                            gk.zero_device_location_ = DeviceVector<Data64>(
+                                gk.galoiskey_size_, options.stream_);
+                            outputs[i] = gk.zero_device_location_.data();
                         }
                         else
                         {
-                            gk.host_location_[galois.second] =
+                            gk.device_location_[storage_elts[key]] =
+                                DeviceVector<Data64>(gk.galoiskey_size_,
+                                                     options.stream_);
+                            outputs[i] =
+                                gk.device_location_[storage_elts[key]].data();
+                        }
+                    }
+
+                    std::vector<int> batch_elts(kernel_elts.begin() + first,
+                                                kernel_elts.begin() + first +
+                                                    count);
+                    generate_galois_key_batch(sk_, batch_elts, outputs,
+                                              decomp_mod_count,
+                                              options.stream_);
+
+                    if (options.storage_ == storage_type::HOST)
+                    {
+                        for (int i = 0; i < count; i++)
+                        {
+                            int key = first + i;
+                            HostVector<Data64>& host_location =
+                                (key == (key_count - 1))
+                                    ? gk.zero_host_location_
+                                    : gk.host_location_[storage_elts[key]];
+                            host_location =
                                 HostVector<Data64>(gk.galoiskey_size_);
-                            cudaMemcpyAsync(
-                                gk.host_location_[galois.second].data(),
-                                output_memory.data(),
-                                gk.galoiskey_size_ * sizeof(Data64),
-                                cudaMemcpyDeviceToHost, options.stream_);
+                            cudaMemcpyAsync(host_location.data(), outputs[i],
+                                            gk.galoiskey_size_ * sizeof(Data64),
+                                            cudaMemcpyDeviceToHost,
+                                            options.stream_);
                             HEONGPU_CUDA_CHECK(cudaGetLastError());
                         }
                     }
+                }
 
-                    // Columns Rotate
-                    RandomNumberGenerator::instance()
-                        .modular_uniform_random_number_generation(
-                            a_poly, modulus_->data(), n_power, Q_prime_size_,
-                            Q_size_, options.stream_);
+                gk.galois_key_generated_ = true;
+                gk.storage_type_ = options.storage_;
 
-                    RandomNumberGenerator::instance()
-                        .modular_gaussian_random_number_generation(
-                            error_std_dev, error_poly, modulus_->data(),
-                            n_power, Q_prime_size_, Q_size_, options.stream_);
+                if (key_limb_type_ == limb_type::LIMB32)
+                {
+                    gk.compact_limbs(options.stream_);
+                }
+            },
+            options, false);
+    }
 
-                    gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
-                        .n_power = n_power,
-                        .ntt_type = gpuntt::FORWARD,
-                        .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
-                        .zero_padding = false,
-                        .stream = options.stream_};
+    __host__ void HEKeyGenerator<Scheme::CKKS>::generate_galois_key(
+        Galoiskey<Scheme::CKKS>& gk, Secretkey<Scheme::CKKS>& sk,
+        std::ostream& os, const ExecutionOptions& options)
+    {
+        if (gk.key_type != keyswitching_type::KEYSWITCHING_METHOD_I)
+        {
+            throw std::invalid_argument(
+                "Streaming Galois key generation supports only "
+                "KEYSWITCHING_METHOD_I!");
+        }
 
-                    gpuntt::GPU_NTT_Inplace(
-                        error_poly, ntt_table_->data(), modulus_->data(),
-                        cfg_ntt, Q_size_ * Q_prime_size_, Q_prime_size_);
-                    HEONGPU_CUDA_CHECK(cudaGetLastError());
+        if (!sk.secret_key_generated_)
+        {
+            throw std::logic_error("Secretkey is not generated!");
+        }
 
-                    DeviceVector<Data64> output_memory(gk.galoiskey_size_,
-                                                       options.stream_);
+        if (gk.galois_key_generated_)
+        {
+            throw std::logic_error("Galoiskey is already generated!");
+        }
 
-                    galoiskey_gen_kernel<<<dim3((n >> 8), Q_prime_size_, 1),
-                                           256, 0, options.stream_>>>(
-                        output_memory.data(), sk.data(), error_poly, a_poly,
-                        modulus_->data(), factor_->data(), gk.galois_elt_zero,
-                        n_power, Q_prime_size_);
-                    HEONGPU_CUDA_CHECK(cudaGetLastError());
+        input_storage_manager(
+            sk,
+            [&](Secretkey<Scheme::CKKS>& sk_)
+            {
+                std::vector<int> storage_elts;
+                std::vector<int> kernel_elts;
+                galois_key_elements(gk, storage_elts, kernel_elts);
 
-                    if (options.storage_ == storage_type::DEVICE)
-                    {
-                        gk.zero_device_location_ = std::move(output_memory);
-                    }
-                    else
-                    {
-                        gk.zero_host_location_ =
-                            HostVector<Data64>(gk.galoiskey_size_);
-                        cudaMemcpyAsync(
-                            gk.zero_host_location_.data(), output_memory.data(),
-                            gk.galoiskey_size_ * sizeof(Data64),
-                            cudaMemcpyDeviceToHost, options.stream_);
-                        HEONGPU_CUDA_CHECK(cudaGetLastError());
-                    }
-                }
-                else
-                {
-                    for (auto& galois_ : gk.custom_galois_elt)
-                    {
-                        RandomNumberGenerator::instance()
-                            .modular_uniform_random_number_generation(
-                                a_poly, modulus_->data(), n_power,
-                                Q_prime_size_, Q_size_, options.stream_);
+                int key_count = kernel_elts.size();
+                int decomp_mod_count =
+                    gk.galoiskey_size_ / (2 * Q_prime_size_ * n);
+                int batch_count = galois_key_batch_count(decomp_mod_count);
 
-                        RandomNumberGenerator::instance()
-                            .modular_gaussian_random_number_generation(
-                                error_std_dev, error_poly, modulus_->data(),
-                                n_power, Q_prime_size_, Q_size_,
-                                options.stream_);
+                // The conjugation key is written last without its element.
+                gk.save_header(os, key_count - 1);
 
-                        gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
-                            .n_power = n_power,
-                            .ntt_type = gpuntt::FORWARD,
-                            .reduction_poly =
-                                gpuntt::ReductionPolynomial::X_N_plus,
-                            .zero_padding = false,
-                            .stream = options.stream_};
+                DeviceVector<Data64> staging(
+                    std::min(batch_count, key_count) * gk.galoiskey_size_,
+                    options.stream_);
+                HostVector<Data64> host_staging(
+                    std::min(batch_count, key_count) * gk.galoiskey_size_);
 
-                        gpuntt::GPU_NTT_Inplace(
-                            error_poly, ntt_table_->data(), modulus_->data(),
-                            cfg_ntt, Q_size_ * Q_prime_size_, Q_prime_size_);
-                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+                for (int first = 0; first < key_count; first += batch_count)
+                {
+                    int count = std::min(batch_count, key_count - first);
 
-                        int inv_galois = modInverse(galois_, 2 * n);
+                    std::vector<Data64*> outputs(count);
+                    for (int i = 0; i < count; i++)
+                    {
+                        outputs[i] = staging.data() + (i * gk.galoiskey_size_);
+                    }
 
-                        DeviceVector<Data64> output_memory(gk.galoiskey_size_,
-                                                           options.stream_);
+                    std::vector<int> batch_elts(kernel_elts.begin() + first,
+                                                kernel_elts.begin() + first +
+                                                    count);
+                    generate_galois_key_batch(sk_, batch_elts, outputs,
+                                              decomp_mod_count,
+                                              options.stream_);
 
-                        galoiskey_gen_kernel<<<dim3((n >> 8), Q_prime_size_, 1),
-                                               256, 0, options.stream_>>>(
-                            output_memory.data(), sk.data(), error_poly, a_poly,
-                            modulus_->data(), factor_->data(), inv_galois,
-                            n_power, Q_prime_size_);
-                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+                    cudaMemcpyAsync(host_staging.data(), staging.data(),
+                                    count * gk.galoiskey_size_ *
+                                        sizeof(Data64),
+                                    cudaMemcpyDeviceToHost, options.stream_);
+                    HEONGPU_CUDA_CHECK(cudaGetLastError());
+                    cudaStreamSynchronize(options.stream_);
 
-                        if (options.storage_ == storage_type::DEVICE)
+                    for (int i = 0; i < count; i++)
+                    {
+                        int key = first + i;
+                        if (key != (key_count - 1))
                         {
-                            gk.device_location_[galois_] =
-                                std::move(output_memory);
-                        }
-                        else
-                        {
-                            gk.host_location_[galois_] =
-                                HostVector<Data64>(gk.galoiskey_size_);
-                            cudaMemcpyAsync(gk.host_location_[galois_].data(),
-                                            output_memory.data(),
-                                            gk.galoiskey_size_ * sizeof(Data64),
-                                            cudaMemcpyDeviceToHost,
-                                            options.stream_);
-                            HEONGPU_CUDA_CHECK(cudaGetLastError());
+                            os.write((char*) &storage_elts[key],
+                                     sizeof(storage_elts[key]));
                         }
+                        os.write((char*) (host_staging.data() +
+                                          (i * gk.galoiskey_size_)),
+                                 sizeof(Data64) * gk.galoiskey_size_);
                     }
+                }
+            },
+            options, false);
+    }
 
-                    // Columns Rotate
-                    RandomNumberGenerator::instance()
-                        .modular_uniform_random_number_generation(
-                            a_poly, modulus_->data(), n_power, Q_prime_size_,
-                            Q_size_, options.stream_);
+    __host__ void HEKeyGenerator<Scheme::CKKS>::galois_key_elements(
+        Galoiskey<Scheme::CKKS>& gk, std::vector<int>& storage_elts,
+        std::vector<int>& kernel_elts) const
+    {
+        if (!gk.customized)
+        {
+            for (auto& galois : gk.galois_elt)
+            {
+                storage_elts.push_back(galois.second);
+                kernel_elts.push_back(modInverse(galois.second, 2 * n));
+            }
+        }
+        else
+        {
+            for (auto& galois_ : gk.custom_galois_elt)
+            {
+                storage_elts.push_back(galois_);
+                kernel_elts.push_back(modInverse(galois_, 2 * n));
+            }
+        }
 
-                    RandomNumberGenerator::instance()
-                        .modular_gaussian_random_number_generation(
-                            error_std_dev, error_poly, modulus_->data(),
-                            n_power, Q_prime_size_, Q_size_, options.stream_);
+        // Columns Rotate
+        storage_elts.push_back(gk.galois_elt_zero);
+        kernel_elts.push_back(gk.galois_elt_zero);
+    }
 
-                    gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
-                        .n_power = n_power,
-                        .ntt_type = gpuntt::FORWARD,
-                        .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
-                        .zero_padding = false,
-                        .stream = options.stream_};
+    __host__ int HEKeyGenerator<Scheme::CKKS>::galois_key_batch_count(
+        int decomp_mod_count) const
+    {
+        size_t key_bytes = static_cast<size_t>(2) * decomp_mod_count *
+                           Q_prime_size_ * n * sizeof(Data64);
 
-                    gpuntt::GPU_NTT_Inplace(
-                        error_poly, ntt_table_->data(), modulus_->data(),
-                        cfg_ntt, Q_size_ * Q_prime_size_, Q_prime_size_);
-                    HEONGPU_CUDA_CHECK(cudaGetLastError());
+        return std::max(static_cast<size_t>(1),
+                        galois_key_batch_bytes_ / key_bytes);
+    }
 
-                    DeviceVector<Data64> output_memory(gk.galoiskey_size_,
-                                                       options.stream_);
+    __host__ void HEKeyGenerator<Scheme::CKKS>::generate_galois_key_batch(
+        Secretkey<Scheme::CKKS>& sk, const std::vector<int>& galois_elts,
+        std::vector<Data64*>& outputs, int decomp_mod_count,
+        const cudaStream_t stream)
+    {
+        int count = galois_elts.size();
+        int poly_count = decomp_mod_count * count;
 
-                    galoiskey_gen_kernel<<<dim3((n >> 8), Q_prime_size_, 1),
-                                           256, 0, options.stream_>>>(
-                        output_memory.data(), sk.data(), error_poly, a_poly,
-                        modulus_->data(), factor_->data(), gk.galois_elt_zero,
-                        n_power, Q_prime_size_);
-                    HEONGPU_CUDA_CHECK(cudaGetLastError());
+        // Randomness of the whole batch is sampled with one call each.
+        DeviceVector<Data64> errors_a(2 * Q_prime_size_ * poly_count * n,
+                                      stream);
+        Data64* error_poly = errors_a.data();
+        Data64* a_poly = error_poly + (Q_prime_size_ * poly_count * n);
 
-                    if (options.storage_ == storage_type::DEVICE)
-                    {
-                        gk.zero_device_location_ = std::move(output_memory);
-                    }
-                    else
-                    {
-                        gk.zero_host_location_ =
-                            HostVector<Data64>(gk.galoiskey_size_);
-                        cudaMemcpyAsync(
-                            gk.zero_host_location_.data(), output_memory.data(),
-                            gk.galoiskey_size_ * sizeof(Data64),
-                            cudaMemcpyDeviceToHost, options.stream_);
-                        HEONGPU_CUDA_CHECK(cudaGetLastError());
-                    }
-                }
+        RandomNumberGenerator::instance()
+            .modular_uniform_random_number_generation(
+                a_poly, modulus_->data(), n_power, Q_prime_size_, poly_count,
+                stream);
 
-                gk.galois_key_generated_ = true;
-                gk.storage_type_ = options.storage_;
-            },
-            options, false);
+        RandomNumberGenerator::instance()
+            .modular_gaussian_random_number_generation(
+                error_std_dev, error_poly, modulus_->data(), n_power,
+                Q_prime_size_, poly_count, stream);
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::FORWARD,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .stream = stream};
+
+        gpuntt::GPU_NTT_Inplace(error_poly, ntt_table_->data(),
+                                modulus_->data(), cfg_ntt,
+                                poly_count * Q_prime_size_, Q_prime_size_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        DeviceVector<int> galois_elts_device(count, stream);
+        cudaMemcpyAsync(galois_elts_device.data(), galois_elts.data(),
+                        count * sizeof(int), cudaMemcpyHostToDevice, stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        DeviceVector<Data64*> output_pointers(count, stream);
+        cudaMemcpyAsync(output_pointers.data(), outputs.data(),
+                        count * sizeof(Data64*), cudaMemcpyHostToDevice,
+                        stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        galoiskey_gen_batch_kernel<<<dim3((n >> 8), Q_prime_size_, count),
+                                     256, 0, stream>>>(
+            output_pointers.data(), sk.data(), error_poly, a_poly,
+            modulus_->data(), factor_->data(), galois_elts_device.data(),
+            n_power, Q_prime_size_, decomp_mod_count);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
     }
 
     __host__ void
@@ -1464,12 +1729,10 @@ namespace heongpu
             sk,
             [&](Secretkey<Scheme::CKKS>& sk_)
             {
-                DeviceVector<Data64> errors_a(2 * Q_prime_size_ *
-                                                  d_leveled_->operator[](0) * n,
+                DeviceVector<Data64> errors_a(2 * Q_prime_size_ * gk.d_ * n,
                                               options.stream_);
                 Data64* error_poly = errors_a.data();
-                Data64* a_poly = error_poly + (Q_prime_size_ *
-                                               d_leveled_->operator[](0) * n);
+                Data64* a_poly = error_poly + (Q_prime_size_ * gk.d_ * n);
 
                 if (!gk.customized)
                 {
@@ -1479,14 +1742,12 @@ namespace heongpu
                         RandomNumberGenerator::instance()
                             .modular_uniform_random_number_generation(
                                 a_poly, modulus_->data(), n_power,
-                                Q_prime_size_, d_leveled_->operator[](0),
-                                options.stream_);
+                                Q_prime_size_, gk.d_, options.stream_);
 
                         RandomNumberGenerator::instance()
                             .modular_gaussian_random_number_generation(
                                 error_std_dev, error_poly, modulus_->data(),
-                                n_power, Q_prime_size_,
-                                d_leveled_->operator[](0), options.stream_);
+                                n_power, Q_prime_size_, gk.d_, options.stream_);
 
                         gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
                             .n_power = n_power,
@@ -1498,8 +1759,7 @@ namespace heongpu
 
                         gpuntt::GPU_NTT_Inplace(
                             error_poly, ntt_table_->data(), modulus_->data(),
-                            cfg_ntt, d_leveled_->operator[](0) * Q_prime_size_,
-                            Q_prime_size_);
+                            cfg_ntt, gk.d_ * Q_prime_size_, Q_prime_size_);
                         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
                         int inv_galois = modInverse(galois.second, 2 * n);
@@ -1513,8 +1773,7 @@ namespace heongpu
                             output_memory.data(), sk.data(), error_poly, a_poly,
                             modulus_->data(), factor_->data(), inv_galois,
                             Sk_pair_leveled_->operator[](0).data(), n_power,
-                            Q_prime_size_, d_leveled_->operator[](0), Q_size_,
-                            P_size_);
+                            Q_prime_size_, gk.d_, Q_size_, P_size_);
                         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
                         if (options.storage_ == storage_type::DEVICE)
@@ -1539,13 +1798,12 @@ namespace heongpu
                     RandomNumberGenerator::instance()
                         .modular_uniform_random_number_generation(
                             a_poly, modulus_->data(), n_power, Q_prime_size_,
-                            d_leveled_->operator[](0), options.stream_);
+                            gk.d_, options.stream_);
 
                     RandomNumberGenerator::instance()
                         .modular_gaussian_random_number_generation(
                             error_std_dev, error_poly, modulus_->data(),
-                            n_power, Q_prime_size_, d_leveled_->operator[](0),
-                            options.stream_);
+                            n_power, Q_prime_size_, gk.d_, options.stream_);
 
                     gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
                         .n_power = n_power,
@@ -1556,8 +1814,7 @@ namespace heongpu
 
                     gpuntt::GPU_NTT_Inplace(
                         error_poly, ntt_table_->data(), modulus_->data(),
-                        cfg_ntt, d_leveled_->operator[](0) * Q_prime_size_,
-                        Q_prime_size_);
+                        cfg_ntt, gk.d_ * Q_prime_size_, Q_prime_size_);
                     HEONGPU_CUDA_CHECK(cudaGetLastError());
 
                     DeviceVector<Data64> output_memory(gk.galoiskey_size_,
@@ -1568,8 +1825,7 @@ namespace heongpu
                         output_memory.data(), sk.data(), error_poly, a_poly,
                         modulus_->data(), factor_->data(), gk.galois_elt_zero,
                         Sk_pair_leveled_->operator[](0).data(), n_power,
-                        Q_prime_size_, d_leveled_->operator[](0), Q_size_,
-                        P_size_);
+                        Q_prime_size_, gk.d_, Q_size_, P_size_);
                     HEONGPU_CUDA_CHECK(cudaGetLastError());
 
                     if (options.storage_ == storage_type::DEVICE)
@@ -1594,14 +1850,12 @@ namespace heongpu
                         RandomNumberGenerator::instance()
                             .modular_uniform_random_number_generation(
                                 a_poly, modulus_->data(), n_power,
-                                Q_prime_size_, d_leveled_->operator[](0),
-                                options.stream_);
+                                Q_prime_size_, gk.d_, options.stream_);
 
                         RandomNumberGenerator::instance()
                             .modular_gaussian_random_number_generation(
                                 error_std_dev, error_poly, modulus_->data(),
-                                n_power, Q_prime_size_,
-                                d_leveled_->operator[](0), options.stream_);
+                                n_power, Q_prime_size_, gk.d_, options.stream_);
 
                         gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
                             .n_power = n_power,
@@ -1613,8 +1867,7 @@ namespace heongpu
 
                         gpuntt::GPU_NTT_Inplace(
                             error_poly, ntt_table_->data(), modulus_->data(),
-                            cfg_ntt, d_leveled_->operator[](0) * Q_prime_size_,
-                            Q_prime_size_);
+                            cfg_ntt, gk.d_ * Q_prime_size_, Q_prime_size_);
                         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
                         int inv_galois = modInverse(galois_, 2 * n);
@@ -1628,8 +1881,7 @@ namespace heongpu
                             output_memory.data(), sk.data(), error_poly, a_poly,
                             modulus_->data(), factor_->data(), inv_galois,
                             Sk_pair_leveled_->operator[](0).data(), n_power,
-                            Q_prime_size_, d_leveled_->operator[](0), Q_size_,
-                            P_size_);
+                            Q_prime_size_, gk.d_, Q_size_, P_size_);
                         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
                         if (options.storage_ == storage_type::DEVICE)
@@ -1654,13 +1906,12 @@ namespace heongpu
                     RandomNumberGenerator::instance()
                         .modular_uniform_random_number_generation(
                             a_poly, modulus_->data(), n_power, Q_prime_size_,
-                            d_leveled_->operator[](0), options.stream_);
+                            gk.d_, options.stream_);
 
                     RandomNumberGenerator::instance()
                         .modular_gaussian_random_number_generation(
                             error_std_dev, error_poly, modulus_->data(),
-                            n_power, Q_prime_size_, d_leveled_->operator[](0),
-                            options.stream_);
+                            n_power, Q_prime_size_, gk.d_, options.stream_);
 
                     gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
                         .n_power = n_power,
@@ -1671,8 +1922,7 @@ namespace heongpu
 
                     gpuntt::GPU_NTT_Inplace(
                         error_poly, ntt_table_->data(), modulus_->data(),
-                        cfg_ntt, d_leveled_->operator[](0) * Q_prime_size_,
-                        Q_prime_size_);
+                        cfg_ntt, gk.d_ * Q_prime_size_, Q_prime_size_);
                     HEONGPU_CUDA_CHECK(cudaGetLastError());
 
                     DeviceVector<Data64> output_memory(gk.galoiskey_size_,
@@ -1683,8 +1933,7 @@ namespace heongpu
                         output_memory.data(), sk.data(), error_poly, a_poly,
                         modulus_->data(), factor_->data(), gk.galois_elt_zero,
                         Sk_pair_leveled_->operator[](0).data(), n_power,
-                        Q_prime_size_, d_leveled_->operator[](0), Q_size_,
-                        P_size_);
+                        Q_prime_size_, gk.d_, Q_size_, P_size_);
                     HEONGPU_CUDA_CHECK(cudaGetLastError());
 
                     if (options.storage_ == storage_type::DEVICE)
@@ -2269,48 +2518,24 @@ namespace heongpu
             }
         }
 
-        int dimension;
-        switch (static_cast<int>(gk.key_type))
-        {
-            case 1: // KEYSWITCHING_METHOD_I
-                dimension = gk.Q_size_;
-                break;
-            case 2: // KEYSWITCHING_METHOD_II
-                dimension = gk.d_;
-                break;
-            case 3: // KEYSWITCHING_METHOD_III
-                throw std::invalid_argument(
-                    "Key Switching Type III is not supported for multi "
-                    "party key generation.");
-                break;
-            default:
-                throw std::invalid_argument("Invalid Key Switching Type");
-                break;
-        }
+        int dimension = multi_party_decomp_count(gk.key_type, gk.d_);
 
         for (auto& galois : gk.galois_elt)
         {
             DeviceVector<Data64> output_memory(gk.galoiskey_size_,
                                                options.stream_);
 
-            multi_party_galoiskey_gen_method_I_II_kernel<<<
-                dim3((n >> 8), Q_prime_size_, 1), 256, 0, options.stream_>>>(
-                output_memory.data(),
-                all_gk[0].device_location_[galois.second].data(),
-                modulus_->data(), n_power, Q_prime_size_, dimension, true);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
-
-            for (int i = 1; i < participant_count; i++)
+            std::vector<Data64*> pieces;
+            for (int i = 0; i < participant_count; i++)
             {
-                multi_party_galoiskey_gen_method_I_II_kernel<<<
-                    dim3((n >> 8), Q_prime_size_, 1), 256, 0,
-                    options.stream_>>>(
-                    output_memory.data(),
-                    all_gk[i].device_location_[galois.second].data(),
-                    modulus_->data(), n_power, Q_prime_size_, dimension, false);
-                HEONGPU_CUDA_CHECK(cudaGetLastError());
+                pieces.push_back(
+                    all_gk[i].device_location_[galois.second].data());
             }
 
+            tree_reduce_multi_party_key(pieces, output_memory.data(),
+                                        gk.galoiskey_size_, dimension, false,
+                                        options.stream_);
+
             if (options.storage_ == storage_type::DEVICE)
             {
                 gk.device_location_[galois.second] = std::move(output_memory);
@@ -2329,21 +2554,16 @@ namespace heongpu
 
         DeviceVector<Data64> output_memory(gk.galoiskey_size_, options.stream_);
 
-        multi_party_galoiskey_gen_method_I_II_kernel<<<
-            dim3((n >> 8), Q_prime_size_, 1), 256, 0, options.stream_>>>(
-            output_memory.data(), all_gk[0].zero_device_location_.data(),
-            modulus_->data(), n_power, Q_prime_size_, dimension, true);
-        HEONGPU_CUDA_CHECK(cudaGetLastError());
-
-        for (int i = 1; i < participant_count; i++)
+        std::vector<Data64*> pieces;
+        for (int i = 0; i < participant_count; i++)
         {
-            multi_party_galoiskey_gen_method_I_II_kernel<<<
-                dim3((n >> 8), Q_prime_size_, 1), 256, 0, options.stream_>>>(
-                output_memory.data(), all_gk[i].zero_device_location_.data(),
-                modulus_->data(), n_power, Q_prime_size_, dimension, false);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+            pieces.push_back(all_gk[i].zero_device_location_.data());
         }
 
+        tree_reduce_multi_party_key(pieces, output_memory.data(),
+                                    gk.galoiskey_size_, dimension, false,
+                                    options.stream_);
+
         if (options.storage_ == storage_type::DEVICE)
         {
             gk.zero_device_location_ = std::move(output_memory);
@@ -2372,9 +2592,158 @@ namespace heongpu
             }
         }
 
+        gk.galois_key_generated_ = true;
         gk.storage_type_ = options.storage_;
     }
 
+    __host__ void
+    HEKeyGenerator<Scheme::CKKS>::accumulate_multi_party_galois_key(
+        MultipartyGaloiskey<Scheme::CKKS>& gk_piece,
+        Galoiskey<Scheme::CKKS>& gk, bool first,
+        const ExecutionOptions& options)
+    {
+        if ((gk.customized != gk_piece.customized) ||
+            (gk.group_order_ != gk_piece.group_order_) ||
+            (gk.galoiskey_size_ != gk_piece.galoiskey_size_))
+        {
+            throw std::invalid_argument(
+                "MultipartyGaloiskey context is not valid!");
+        }
+
+        if (!gk_piece.galois_key_generated_)
+        {
+            throw std::invalid_argument(
+                "MultipartyGaloiskey is not generated!");
+        }
+
+        if (!first && !gk.galois_key_generated_)
+        {
+            throw std::logic_error("Common Galoiskey has no share yet!");
+        }
+
+        int dimension = multi_party_decomp_count(gk.key_type, gk.d_);
+
+        storage_type piece_storage_type = gk_piece.storage_type_;
+        gk_piece.store_in_device(options.stream_);
+
+        if (first)
+        {
+            for (auto& galois : gk.galois_elt)
+            {
+                gk.device_location_[galois.second] =
+                    DeviceVector<Data64>(gk.galoiskey_size_, options.stream_);
+            }
+            gk.zero_device_location_ =
+                DeviceVector<Data64>(gk.galoiskey_size_, options.stream_);
+
+            gk.host_location_.clear();
+            gk.zero_host_location_.resize(0);
+            gk.storage_type_ = storage_type::DEVICE;
+        }
+        else
+        {
+            gk.store_in_device(options.stream_);
+        }
+
+        for (auto& galois : gk.galois_elt)
+        {
+            multi_party_galoiskey_gen_method_I_II_kernel<<<
+                dim3((n >> 8), Q_prime_size_, 1), 256, 0, options.stream_>>>(
+                gk.device_location_[galois.second].data(),
+                gk_piece.device_location_[galois.second].data(),
+                modulus_->data(), n_power, Q_prime_size_, dimension, first);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        }
+
+        multi_party_galoiskey_gen_method_I_II_kernel<<<
+            dim3((n >> 8), Q_prime_size_, 1), 256, 0, options.stream_>>>(
+            gk.zero_device_location_.data(),
+            gk_piece.zero_device_location_.data(), modulus_->data(), n_power,
+            Q_prime_size_, dimension, first);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        gk.galois_key_generated_ = true;
+
+        if (options.storage_ == storage_type::HOST)
+        {
+            gk.store_in_host(options.stream_);
+        }
+
+        if (options.keep_initial_condition_ &&
+            (piece_storage_type == storage_type::HOST))
+        {
+            gk_piece.store_in_host(options.stream_);
+        }
+    }
+
+    __host__ int HEKeyGenerator<Scheme::CKKS>::multi_party_decomp_count(
+        keyswitching_type key_type, int d) const
+    {
+        switch (static_cast<int>(key_type))
+        {
+            case 1: // KEYSWITCHING_METHOD_I
+            case 2: // KEYSWITCHING_METHOD_II
+                return d;
+            case 3: // KEYSWITCHING_METHOD_III
+                throw std::invalid_argument(
+                    "Key Switching Type III is not supported for multi "
+                    "party key generation.");
+            default:
+                throw std::invalid_argument("Invalid Key Switching Type");
+        }
+    }
+
+    __host__ void HEKeyGenerator<Scheme::CKKS>::tree_reduce_multi_party_key(
+        std::vector<Data64*>& pieces, Data64* output, size_t key_size,
+        int decomp_mod_count, bool reduce_second, const cudaStream_t stream)
+    {
+        int count = pieces.size();
+
+        // The first level writes every even slot out of place (slot 0 is the
+        // output itself), later levels reduce those slots in place, so the
+        // pieces are never modified and log2(count) launches are needed.
+        int scratch_count = ((count + 1) >> 1) - 1;
+        DeviceVector<Data64> scratch_memory(scratch_count * key_size, stream);
+
+        std::vector<Data64*> outputs(count, nullptr);
+        outputs[0] = output;
+        for (int i = 1; i <= scratch_count; i++)
+        {
+            outputs[i << 1] = scratch_memory.data() + ((i - 1) * key_size);
+        }
+
+        DeviceVector<Data64*> input_pointers(count, stream);
+        cudaMemcpyAsync(input_pointers.data(), pieces.data(),
+                        count * sizeof(Data64*), cudaMemcpyHostToDevice,
+                        stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        DeviceVector<Data64*> output_pointers(count, stream);
+        cudaMemcpyAsync(output_pointers.data(), outputs.data(),
+                        count * sizeof(Data64*), cudaMemcpyHostToDevice,
+                        stream);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        Data64** level_input = input_pointers.data();
+        for (int stride = 1;; stride <<= 1)
+        {
+            int pair_count = (count + (2 * stride) - 1) / (2 * stride);
+
+            multi_party_key_tree_reduction_kernel<<<
+                dim3((n >> 8), Q_prime_size_, pair_count), 256, 0, stream>>>(
+                level_input, output_pointers.data(), modulus_->data(), n_power,
+                Q_prime_size_, decomp_mod_count, stride, count, reduce_second);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+            level_input = output_pointers.data();
+
+            if ((2 * stride) >= count)
+            {
+                break;
+            }
+        }
+    }
+
     __host__ void HEKeyGenerator<Scheme::CKKS>::generate_switch_key_method_I(
         Switchkey<Scheme::CKKS>& swk, Secretkey<Scheme::CKKS>& new_sk,
         Secretkey<Scheme::CKKS>& old_sk, const ExecutionOptions& options)
@@ -2561,4 +2930,166 @@ namespace heongpu
             options, false);
     }
 
+    __host__ void HEKeyGenerator<Scheme::CKKS>::generate_packing_key(
+        Packingkey<Scheme::CKKS>& pk, Secretkey<Scheme::CKKS>& sk,
+        Secretkey<Scheme::TFHE>& lwe_sk, const ExecutionOptions& options)
+    {
+        if (!sk.secret_key_generated_)
+        {
+            throw std::logic_error("Secretkey is not generated!");
+        }
+
+        if (!lwe_sk.secret_key_generated_)
+        {
+            throw std::logic_error("LWE Secretkey is not generated!");
+        }
+
+        if (pk.packing_key_generated_)
+        {
+            throw std::logic_error("Packingkey is already generated!");
+        }
+
+        if (lwe_sk.n_ != pk.lwe_n_)
+        {
+            throw std::invalid_argument(
+                "LWE Secretkey does not match the Packingkey!");
+        }
+
+        input_storage_manager(
+            lwe_sk,
+            [&](Secretkey<Scheme::TFHE>& lwe_sk_)
+            {
+                input_storage_manager(
+                    sk,
+                    [&](Secretkey<Scheme::CKKS>& sk_)
+                    {
+                        // LWE key as the first coefficients of a ring element.
+                        DeviceVector<int> embedded_key(n, options.stream_);
+                        cudaMemsetAsync(embedded_key.data(), 0,
+                                        n * sizeof(int), options.stream_);
+                        cudaMemcpyAsync(embedded_key.data(),
+                                        lwe_sk_.lwe_key_device_location_.data(),
+                                        pk.lwe_n_ * sizeof(int32_t),
+                                        cudaMemcpyDeviceToDevice,
+                                        options.stream_);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        DeviceVector<Data64> embedded_key_rns(
+                            Q_prime_size_ * n, options.stream_);
+                        secretkey_rns_kernel<<<dim3((n >> 8), 1, 1), 256, 0,
+                                               options.stream_>>>(
+                            embedded_key.data(), embedded_key_rns.data(),
+                            modulus_->data(), n_power, Q_prime_size_);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+                            .n_power = n_power,
+                            .ntt_type = gpuntt::FORWARD,
+                            .reduction_poly =
+                                gpuntt::ReductionPolynomial::X_N_plus,
+                            .zero_padding = false,
+                            .stream = options.stream_};
+
+                        gpuntt::GPU_NTT_Inplace(
+                            embedded_key_rns.data(), ntt_table_->data(),
+                            modulus_->data(), cfg_ntt, Q_prime_size_,
+                            Q_prime_size_);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        Secretkey<Scheme::CKKS> lwe_ring_key;
+                        lwe_ring_key.scheme_ = sk_.scheme_;
+                        lwe_ring_key.ring_size_ = n;
+                        lwe_ring_key.coeff_modulus_count_ = Q_prime_size_;
+                        lwe_ring_key.n_power_ = n_power;
+                        lwe_ring_key.hamming_weight_ = sk_.hamming_weight_;
+                        lwe_ring_key.in_ntt_domain_ = true;
+                        lwe_ring_key.storage_type_ = storage_type::DEVICE;
+                        lwe_ring_key.secret_key_generated_ = true;
+                        lwe_ring_key.memory_set(std::move(embedded_key_rns));
+
+                        generate_switch_key(pk.ring_key_, sk_, lwe_ring_key,
+                                            options);
+
+                        // Coefficients of the CKKS key, centered modulo q_0.
+                        DeviceVector<Data64> sk_coefficients(n,
+                                                             options.stream_);
+                        cudaMemcpyAsync(sk_coefficients.data(), sk_.data(),
+                                        n * sizeof(Data64),
+                                        cudaMemcpyDeviceToDevice,
+                                        options.stream_);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        gpuntt::ntt_rns_configuration<Data64> cfg_intt = {
+                            .n_power = n_power,
+                            .ntt_type = gpuntt::INVERSE,
+                            .reduction_poly =
+                                gpuntt::ReductionPolynomial::X_N_plus,
+                            .zero_padding = false,
+                            .mod_inverse = n_inverse_->data(),
+                            .stream = options.stream_};
+
+                        gpuntt::GPU_NTT_Inplace(
+                            sk_coefficients.data(), intt_table_->data(),
+                            modulus_->data(), cfg_intt, 1, 1);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        DeviceVector<int32_t> ring_key(n, options.stream_);
+                        tfhe_convert_rlwekey_from_rns_kernel<<<
+                            ((n + 511) >> 9), 512, 0, options.stream_>>>(
+                            ring_key.data(), sk_coefficients.data(),
+                            modulus_->data(), n);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        int ks_base = 1 << pk.ks_base_bit_;
+
+                        Data64 total_noise_size = (Data64) n *
+                                                  (Data64) pk.ks_length_ *
+                                                  (Data64) (ks_base - 1);
+                        DeviceVector<double> noise(total_noise_size,
+                                                   options.stream_);
+
+                        tfhe_generate_noise_kernel<<<
+                            ((total_noise_size + 511) >> 9), 512, 0,
+                            options.stream_>>>(noise.data(), offset_,
+                                               total_noise_size, pk.ks_stdev_);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        Data64 total_random_number_size =
+                            total_noise_size * pk.lwe_n_;
+                        pk.extraction_key_device_location_a_.resize(
+                            total_random_number_size, options.stream_);
+                        tfhe_generate_uniform_random_number_kernel<<<
+                            ((total_random_number_size + 511) >> 9), 512, 0,
+                            options.stream_>>>(
+                            pk.extraction_key_device_location_a_.data(), seed_,
+                            total_random_number_size);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        size_t smem = (512 / 32 + 1) * sizeof(uint32_t);
+
+                        pk.extraction_key_device_location_b_.resize(
+                            total_noise_size, options.stream_);
+                        tfhe_generate_switchkey_kernel<<<n, 512, smem,
+                                                         options.stream_>>>(
+                            ring_key.data(),
+                            lwe_sk_.lwe_key_device_location_.data(),
+                            noise.data(),
+                            pk.extraction_key_device_location_a_.data(),
+                            pk.extraction_key_device_location_b_.data(),
+                            pk.lwe_n_, pk.ks_base_bit_, pk.ks_length_);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        pk.storage_type_ = storage_type::DEVICE;
+                        pk.packing_key_generated_ = true;
+                    },
+                    options, false);
+            },
+            options, false);
+
+        if (options.storage_ == storage_type::HOST)
+        {
+            pk.store_in_host(options.stream_);
+        }
+    }
+
 } // namespace heongpu
\ No newline at end of file
@@ -5,6 +5,12 @@
 
 #include "ckks/operator.cuh"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <numeric>
+
 namespace heongpu
 {
     __host__
@@ -120,7 +126,10 @@ namespace heongpu
         log_slot_count_ = encoder.log_slot_count_;
         two_pow_64_ = encoder.two_pow_64;
         reverse_order_ = encoder.reverse_order;
+        sparse_reverse_order_ = encoder.sparse_reverse_order_;
         special_ifft_roots_table_ = encoder.special_ifft_roots_table_;
+
+        constant_cache_ = std::make_shared<ConstantCache<Scheme::CKKS>>();
     }
 
     __host__ void HEOperator<Scheme::CKKS>::add(
@@ -186,6 +195,8 @@ namespace heongpu
                                 output_.depth_ = input1_.depth_;
                                 output_.in_ntt_domain_ = input1_.in_ntt_domain_;
                                 output_.scale_ = input1_.scale_;
+                                output_.slot_count_ = std::max(
+                                    input1_.slot_count_, input2_.slot_count_);
                                 output_.rescale_required_ =
                                     (input1_.rescale_required_ ||
                                      input2_.rescale_required_);
@@ -266,6 +277,8 @@ namespace heongpu
                                 output_.depth_ = input1_.depth_;
                                 output_.in_ntt_domain_ = input1_.in_ntt_domain_;
                                 output_.scale_ = input1_.scale_;
+                                output_.slot_count_ = std::max(
+                                    input1_.slot_count_, input2_.slot_count_);
                                 output_.rescale_required_ =
                                     (input1_.rescale_required_ ||
                                      input2_.rescale_required_);
@@ -322,6 +335,7 @@ namespace heongpu
                         output_.depth_ = input1_.depth_;
                         output_.in_ntt_domain_ = input1_.in_ntt_domain_;
                         output_.scale_ = input1_.scale_;
+                        output_.slot_count_ = input1_.slot_count_;
                         output_.rescale_required_ = input1_.rescale_required_;
                         output_.relinearization_required_ =
                             input1_.relinearization_required_;
@@ -501,6 +515,7 @@ namespace heongpu
         {
             output.scale_ = input1.scale_ * input2.scale_;
         }
+        output.slot_count_ = std::max(input1.slot_count_, input2.slot_count_);
     }
 
     __host__ void HEOperator<Scheme::CKKS>::multiply_plain_ckks(
@@ -526,6 +541,7 @@ namespace heongpu
         {
             output.scale_ = input1.scale_ * input2.scale_;
         }
+        output.slot_count_ = std::max(input1.slot_count_, input2.slot_count_);
 
         output.memory_set(std::move(output_memory));
     }
@@ -535,6 +551,12 @@ namespace heongpu
         Ciphertext<Scheme::CKKS>& input1, Relinkey<Scheme::CKKS>& relin_key,
         const cudaStream_t stream)
     {
+        if (relin_key.d_ < (Q_size_ - input1.depth_))
+        {
+            throw std::invalid_argument(
+                "Relinkey is trimmed below the ciphertext level!");
+        }
+
         int first_rns_mod_count = Q_prime_size_;
         int current_rns_mod_count = Q_prime_size_ - input1.depth_;
 
@@ -589,20 +611,18 @@ namespace heongpu
         // TODO: make it efficient
         if (relin_key.storage_type_ == storage_type::DEVICE)
         {
-            multiply_accumulate_leveled_kernel<<<
-                dim3((n >> 8), current_rns_mod_count, 1), 256, 0, stream>>>(
-                temp1_relin, relin_key.data(), temp2_relin, modulus_->data(),
-                first_rns_mod_count, current_decomp_count, n_power);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+            multiply_accumulate_key(temp1_relin, relin_key.data(),
+                                    relin_key.limb_type_, temp2_relin,
+                                    first_rns_mod_count, current_decomp_count,
+                                    current_rns_mod_count, stream);
         }
         else
         {
             DeviceVector<Data64> key_location(relin_key.host_location_, stream);
-            multiply_accumulate_leveled_kernel<<<
-                dim3((n >> 8), current_rns_mod_count, 1), 256, 0, stream>>>(
-                temp1_relin, key_location.data(), temp2_relin, modulus_->data(),
-                first_rns_mod_count, current_decomp_count, n_power);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+            multiply_accumulate_key(temp1_relin, key_location.data(),
+                                    relin_key.limb_type_, temp2_relin,
+                                    first_rns_mod_count, current_decomp_count,
+                                    current_rns_mod_count, stream);
         }
 
         gpuntt::ntt_rns_configuration<Data64> cfg_intt2 = {
@@ -797,6 +817,12 @@ namespace heongpu
         Ciphertext<Scheme::CKKS>& input1, Relinkey<Scheme::CKKS>& relin_key,
         const cudaStream_t stream)
     {
+        if (relin_key.d_ < d_leveled_->operator[](input1.depth_))
+        {
+            throw std::invalid_argument(
+                "Relinkey is trimmed below the ciphertext level!");
+        }
+
         int first_rns_mod_count = Q_prime_size_;
         int current_rns_mod_count = Q_prime_size_ - input1.depth_;
 
@@ -1082,32 +1108,34 @@ namespace heongpu
         }
         else
         {
-            std::vector<int> required_galoiselt;
-            int shift_num = abs(shift);
-            int negative = (shift < 0) ? (-1) : 1;
-            while (shift_num != 0)
+            std::vector<int> available_shifts;
+            available_shifts.reserve(galois_key.galois_elt.size());
+            for (const auto& galois : galois_key.galois_elt)
             {
-                int power = int(log2(shift_num));
-                int power_2 = pow(2, power);
-                shift_num = shift_num - power_2;
+                available_shifts.push_back(galois.first);
+            }
 
-                int index_in = power_2 * negative;
+            std::vector<int> steps =
+                galois_key.rotation_plans_->plan(shift, available_shifts,
+                                                 (n >> 1));
 
-                if (!(galois_key.galois_elt.find(index_in) !=
-                      galois_key.galois_elt.end()))
-                {
-                    throw std::logic_error("Galois key not present!");
-                }
-                galoiselt = galois_key.galois_elt[index_in];
-                required_galoiselt.push_back(galoiselt);
+            if (steps.empty())
+            {
+                output = input1;
+                return;
             }
 
-            Ciphertext<Scheme::CKKS>& in_data = input1;
-            for (auto& galois_elt : required_galoiselt)
+            // The first step reads input1, the following ones rotate output
+            // in place, so neither the input nor the intermediate results are
+            // copied.
+            Ciphertext<Scheme::CKKS>* in_data = &input1;
+            for (int step : steps)
             {
-                apply_galois_ckks_method_I(in_data, output, galois_key,
-                                           galois_elt, stream);
-                in_data = output;
+                apply_galois_ckks_method_I(
+                    *in_data, output, galois_key, galois_key.galois_elt[step],
+                    stream);
+                output.depth_ = input1.depth_;
+                in_data = &output;
             }
         }
     }
@@ -1137,41 +1165,36 @@ namespace heongpu
         }
         else
         {
-            // std::cout << "[C++ DEBUG]                   - Galois key does not exist. Decomposing rotation." << std::endl;
-
-            std::vector<int> required_galoiselt;
-            int shift_num = abs(shift);
-            int negative = (shift < 0) ? (-1) : 1;
-            while (shift_num != 0)
+            std::vector<int> available_shifts;
+            available_shifts.reserve(galois_key.galois_elt.size());
+            for (const auto& galois : galois_key.galois_elt)
             {
-                int power = int(log2(shift_num));
-                int power_2 = pow(2, power);
-                shift_num = shift_num - power_2;
+                available_shifts.push_back(galois.first);
+            }
 
-                int index_in = power_2 * negative;
+            std::vector<int> steps =
+                galois_key.rotation_plans_->plan(shift, available_shifts,
+                                                 (n >> 1));
 
-                if (!(galois_key.galois_elt.find(index_in) !=
-                      galois_key.galois_elt.end()))
-                {
-                    throw std::logic_error("Galois key not present!");
-                }
-                galoiselt = galois_key.galois_elt[index_in];
-                required_galoiselt.push_back(galoiselt);
+            if (steps.empty())
+            {
+                output = input1;
+                return;
             }
 
-            Ciphertext<Scheme::CKKS>& in_data = input1;
-            for (auto& galois_elt : required_galoiselt)
+            // The first step reads input1, the following ones rotate output
+            // in place, so neither the input nor the intermediate results are
+            // copied.
+            Ciphertext<Scheme::CKKS>* in_data = &input1;
+            for (int step : steps)
             {
-                // std::cout << "[C++ DEBUG]                   - Decomposition step " <<  required_galoiselt.size() 
-                //       << ": Calling apply_galois_ckks_method_II." << std::endl;
-                // std::cout << "[C++ DEBUG]                     - galois_elt: " << galois_elt << std::endl;
-
-                apply_galois_ckks_method_II(in_data, output, galois_key,
-                                            galois_elt, stream);
-                in_data = output;
+                apply_galois_ckks_method_II(
+                    *in_data, output, galois_key, galois_key.galois_elt[step],
+                    stream);
+                output.depth_ = input1.depth_;
+                in_data = &output;
             }
         }
-        // std::cout << "[C++ DEBUG] <== <== <== <== Exiting rotate_ckks_method_II." << std::endl;
     }
 
     __host__ void HEOperator<Scheme::CKKS>::apply_galois_ckks_method_I(
@@ -1179,6 +1202,12 @@ namespace heongpu
         Galoiskey<Scheme::CKKS>& galois_key, int galois_elt,
         const cudaStream_t stream)
     {
+        if (galois_key.d_ < (Q_size_ - input1.depth_))
+        {
+            throw std::invalid_argument(
+                "Galoiskey is trimmed below the ciphertext level!");
+        }
+
         // std::cout << "[C++ DEBUG] ==> ==> ==> ==> ==> Entered apply_galois_ckks_method_I." << std::endl;
         // std::cout << "[C++ DEBUG]                       - Arg 'galois_elt': " << galois_elt << std::endl;
         // std::cout << "[C++ DEBUG]                       - Input 'input1' depth: " << input1.depth() << ", scale: " << input1.scale() << std::endl;
@@ -1259,23 +1288,19 @@ namespace heongpu
         // TODO: make it efficient
         if (galois_key.storage_type_ == storage_type::DEVICE)
         {
-            multiply_accumulate_leveled_kernel<<<
-                dim3((n >> 8), current_rns_mod_count, 1), 256, 0, stream>>>(
+            multiply_accumulate_key(
                 temp2_rotation, galois_key.device_location_[galois_elt].data(),
-                temp3_rotation, modulus_->data(), first_rns_mod_count,
-                current_decomp_count, n_power);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+                galois_key.limb_type_, temp3_rotation, first_rns_mod_count,
+                current_decomp_count, current_rns_mod_count, stream);
         }
         else
         {
             DeviceVector<Data64> key_location(
                 galois_key.host_location_[galois_elt], stream);
-            multiply_accumulate_leveled_kernel<<<
-                dim3((n >> 8), current_rns_mod_count, 1), 256, 0, stream>>>(
-                temp2_rotation, key_location.data(), temp3_rotation,
-                modulus_->data(), first_rns_mod_count, current_decomp_count,
-                n_power);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+            multiply_accumulate_key(temp2_rotation, key_location.data(),
+                                    galois_key.limb_type_, temp3_rotation,
+                                    first_rns_mod_count, current_decomp_count,
+                                    current_rns_mod_count, stream);
         }
         //std::cout << "[C++ DEBUG]                       - Step 5: Performing Inverse NTT on accumulated data." << std::endl;
 
@@ -1310,6 +1335,12 @@ namespace heongpu
         Galoiskey<Scheme::CKKS>& galois_key, int galois_elt,
         const cudaStream_t stream)
     {
+        if (galois_key.d_ < d_leveled_->operator[](input1.depth_))
+        {
+            throw std::invalid_argument(
+                "Galoiskey is trimmed below the ciphertext level!");
+        }
+
         int first_rns_mod_count = Q_prime_size_;
         int current_rns_mod_count = Q_prime_size_ - input1.depth_;
 
@@ -1693,6 +1724,12 @@ namespace heongpu
         Ciphertext<Scheme::CKKS>& input1, Ciphertext<Scheme::CKKS>& output,
         Galoiskey<Scheme::CKKS>& conjugate_key, const cudaStream_t stream)
     {
+        if (conjugate_key.d_ < (Q_size_ - input1.depth_))
+        {
+            throw std::invalid_argument(
+                "Galoiskey is trimmed below the ciphertext level!");
+        }
+
         int first_rns_mod_count = Q_prime_size_;
         int current_rns_mod_count = Q_prime_size_ - input1.depth_;
 
@@ -1756,23 +1793,19 @@ namespace heongpu
         // TODO: make it efficient
         if (conjugate_key.storage_type_ == storage_type::DEVICE)
         {
-            multiply_accumulate_leveled_kernel<<<
-                dim3((n >> 8), current_rns_mod_count, 1), 256, 0, stream>>>(
-                temp2_rotation, conjugate_key.c_data(), temp3_rotation,
-                modulus_->data(), first_rns_mod_count, current_decomp_count,
-                n_power);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+            multiply_accumulate_key(temp2_rotation, conjugate_key.c_data(),
+                                    conjugate_key.limb_type_, temp3_rotation,
+                                    first_rns_mod_count, current_decomp_count,
+                                    current_rns_mod_count, stream);
         }
         else
         {
             DeviceVector<Data64> key_location(conjugate_key.zero_host_location_,
                                               stream);
-            multiply_accumulate_leveled_kernel<<<
-                dim3((n >> 8), current_rns_mod_count, 1), 256, 0, stream>>>(
-                temp2_rotation, key_location.data(), temp3_rotation,
-                modulus_->data(), first_rns_mod_count, current_decomp_count,
-                n_power);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+            multiply_accumulate_key(temp2_rotation, key_location.data(),
+                                    conjugate_key.limb_type_, temp3_rotation,
+                                    first_rns_mod_count, current_decomp_count,
+                                    current_rns_mod_count, stream);
         }
 
         gpuntt::GPU_NTT_Modulus_Ordered_Inplace(
@@ -1801,6 +1834,12 @@ namespace heongpu
         Ciphertext<Scheme::CKKS>& input1, Ciphertext<Scheme::CKKS>& output,
         Galoiskey<Scheme::CKKS>& conjugate_key, const cudaStream_t stream)
     {
+        if (conjugate_key.d_ < d_leveled_->operator[](input1.depth_))
+        {
+            throw std::invalid_argument(
+                "Galoiskey is trimmed below the ciphertext level!");
+        }
+
         int first_rns_mod_count = Q_prime_size_;
         int current_rns_mod_count = Q_prime_size_ - input1.depth_;
 
@@ -1936,6 +1975,7 @@ namespace heongpu
         plain.plain_size_ = n * Q_size_; // n
         plain.depth_ = 0;
         plain.scale_ = 0;
+        plain.slot_count_ = slot_count_;
         plain.in_ntt_domain_ = true;
 
         plain.device_locations_ =
@@ -1954,6 +1994,7 @@ namespace heongpu
         plain.plain_size_ = input.plain_size_;
         plain.depth_ = input.depth_;
         plain.scale_ = input.scale_;
+        plain.slot_count_ = input.slot_count_;
         plain.in_ntt_domain_ = input.in_ntt_domain_;
 
         plain.storage_type_ = storage_type::DEVICE;
@@ -1981,6 +2022,7 @@ namespace heongpu
         cipher.rescale_required_ = false;
         cipher.relinearization_required_ = false;
         cipher.scale_ = scale;
+        cipher.slot_count_ = slot_count_;
         cipher.ciphertext_generated_ = true;
 
         int cipher_memory_size = 2 * (Q_size_ - cipher.depth_) * n;
@@ -2010,6 +2052,7 @@ namespace heongpu
         cipher.rescale_required_ = input.rescale_required_;
         cipher.relinearization_required_ = input.relinearization_required_;
         cipher.scale_ = input.scale_;
+        cipher.slot_count_ = input.slot_count_;
         cipher.ciphertext_generated_ = true;
 
         int cipher_memory_size = 2 * (Q_size_ - cipher.depth_) * n;
@@ -2022,14 +2065,26 @@ namespace heongpu
 
     __host__ void HEOperator<Scheme::CKKS>::quick_ckks_encoder_vec_complex(
         Complex64* input, Data64* output, const double scale,
-        bool use_all_bases)
+        const int log_slot_count, bool use_all_bases)
     {
         int rns_count = use_all_bases ? Q_prime_size_ : Q_size_;
 
-        double fix = scale / static_cast<double>(slot_count_);
+        int slot_count = 1 << log_slot_count;
+        int log_gap = (n_power - 1) - log_slot_count;
+        int thread_count = std::min(slot_count, 256);
+        int block_count = slot_count / thread_count;
+
+        if (log_gap != 0)
+        {
+            // Only every (1 << log_gap)-th coefficient is written below.
+            cudaMemset(output, 0, (rns_count << n_power) * sizeof(Data64));
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        }
+
+        double fix = scale / static_cast<double>(slot_count);
 
         gpufft::fft_configuration<Float64> cfg_ifft{};
-        cfg_ifft.n_power = log_slot_count_;
+        cfg_ifft.n_power = log_slot_count;
         cfg_ifft.fft_type = gpufft::type::INVERSE;
         cfg_ifft.mod_inverse = Complex64(fix, 0.0);
         cfg_ifft.stream = 0;
@@ -2037,10 +2092,10 @@ namespace heongpu
         gpufft::GPU_Special_FFT(input, special_ifft_roots_table_->data(),
                                 cfg_ifft, 1);
 
-        encode_kernel_ckks_conversion<<<dim3(((slot_count_) >> 8), 1, 1),
-                                        256>>>(output, input, modulus_->data(),
-                                               rns_count, two_pow_64_,
-                                               reverse_order_->data(), n_power);
+        encode_kernel_ckks_conversion<<<dim3(block_count, 1, 1),
+                                        thread_count>>>(
+            output, input, modulus_->data(), rns_count, two_pow_64_,
+            sparse_reverse_order_[log_slot_count]->data(), log_gap, n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
         gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
@@ -2082,7 +2137,7 @@ namespace heongpu
         encode_kernel_ckks_conversion<<<dim3(((slot_count_) >> 8), 1, 1),
                                         256>>>(
             output, message_gpu.data(), modulus_->data(), Q_size_, two_pow_64_,
-            reverse_order_->data(), n_power);
+            reverse_order_->data(), 0, n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
         gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
@@ -2117,6 +2172,285 @@ namespace heongpu
         HEONGPU_CUDA_CHECK(cudaGetLastError());
     }
 
+    __host__ void HEOperator<Scheme::CKKS>::add_constant(
+        Ciphertext<Scheme::CKKS>& input1, double value,
+        Ciphertext<Scheme::CKKS>& output, const ExecutionOptions& options)
+    {
+        add_constant(input1, Complex64(value, 0.0), output, options);
+    }
+
+    __host__ void HEOperator<Scheme::CKKS>::add_constant(
+        Ciphertext<Scheme::CKKS>& input1, Complex64 value,
+        Ciphertext<Scheme::CKKS>& output, const ExecutionOptions& options)
+    {
+        if (input1.relinearization_required_)
+        {
+            throw std::invalid_argument(
+                "Ciphertext and constant can not be added because "
+                "ciphertext has non-linear part!");
+        }
+
+        ConstantCache<Scheme::CKKS>::Entry constant =
+            encoded_constant(value, input1.depth_, input1.scale_, options);
+
+        // The cached plaintext is used in place and never moved by the
+        // storage managers.
+        input_storage_manager(
+            input1,
+            [&](Ciphertext<Scheme::CKKS>& input1_)
+            {
+                output_storage_manager(
+                    output,
+                    [&](Ciphertext<Scheme::CKKS>& output_)
+                    {
+                        add_plain_ckks(input1_, *constant, output_,
+                                       options.stream_);
+
+                        output_.scheme_ = scheme_;
+                        output_.ring_size_ = n;
+                        output_.coeff_modulus_count_ = Q_size_;
+                        output_.cipher_size_ = 2;
+                        output_.depth_ = input1_.depth_;
+                        output_.in_ntt_domain_ = input1_.in_ntt_domain_;
+                        output_.scale_ = input1_.scale_;
+                        output_.slot_count_ = input1_.slot_count_;
+                        output_.rescale_required_ = input1_.rescale_required_;
+                        output_.relinearization_required_ = false;
+                        output_.ciphertext_generated_ = true;
+                    },
+                    options);
+            },
+            options, (&input1 == &output));
+    }
+
+    __host__ void HEOperator<Scheme::CKKS>::multiply_constant(
+        Ciphertext<Scheme::CKKS>& input1, double value,
+        Ciphertext<Scheme::CKKS>& output, const ExecutionOptions& options)
+    {
+        multiply_constant(input1, Complex64(value, 0.0), output, options);
+    }
+
+    __host__ void HEOperator<Scheme::CKKS>::multiply_constant(
+        Ciphertext<Scheme::CKKS>& input1, Complex64 value,
+        Ciphertext<Scheme::CKKS>& output, const ExecutionOptions& options)
+    {
+        if (input1.relinearization_required_)
+        {
+            throw std::invalid_argument(
+                "Ciphertext and constant can not be multiplied because of "
+                "the non-linear part! Please use relinearization operation!");
+        }
+
+        if (input1.rescale_required_)
+        {
+            throw std::invalid_argument(
+                "Ciphertext has to be rescaled before a constant "
+                "multiplication!");
+        }
+
+        int current_decomp_count = Q_size_ - input1.depth_;
+        if (current_decomp_count < 2)
+        {
+            throw std::invalid_argument(
+                "Ciphertext has no level left for the constant!");
+        }
+
+        if (input1.memory_size() < (2 * n * current_decomp_count))
+        {
+            throw std::invalid_argument("Invalid Ciphertexts size!");
+        }
+
+        // Encoded at the prime the rescale drops, which restores the scale of
+        // input1 exactly.
+        double scale =
+            static_cast<double>(prime_vector_[current_decomp_count - 1].value);
+        ConstantCache<Scheme::CKKS>::Entry constant =
+            encoded_constant(value, input1.depth_, scale, options);
+
+        input_storage_manager(
+            input1,
+            [&](Ciphertext<Scheme::CKKS>& input1_)
+            {
+                output_storage_manager(
+                    output,
+                    [&](Ciphertext<Scheme::CKKS>& output_)
+                    {
+                        multiply_plain_ckks(input1_, *constant, output_,
+                                            options.stream_);
+                        output_.rescale_required_ = true;
+
+                        output_.scheme_ = scheme_;
+                        output_.ring_size_ = n;
+                        output_.coeff_modulus_count_ = Q_size_;
+                        output_.cipher_size_ = 2;
+                        output_.depth_ = input1_.depth_;
+                        output_.in_ntt_domain_ = input1_.in_ntt_domain_;
+                        output_.slot_count_ = input1_.slot_count_;
+                        output_.relinearization_required_ = false;
+                        output_.ciphertext_generated_ = true;
+                    },
+                    options);
+            },
+            options, (&input1 == &output));
+    }
+
+    __host__ ConstantCache<Scheme::CKKS>::Entry
+    HEOperator<Scheme::CKKS>::encoded_mask(std::uint64_t mask_id,
+                                           const std::vector<double>& mask,
+                                           int depth, double scale,
+                                           const ExecutionOptions& options)
+    {
+        if (mask.empty() || (static_cast<int>(mask.size()) > slot_count_))
+        {
+            throw std::invalid_argument("Invalid mask size!");
+        }
+
+        ConstantKey key{constant_kind::MASK, mask_id, 0, depth, scale};
+        std::vector<Complex64> values(slot_count_, Complex64(0.0, 0.0));
+        for (int i = 0; i < static_cast<int>(mask.size()); i++)
+        {
+            values[i] = Complex64(mask[i], 0.0);
+        }
+
+        return cached_encoding(key, values, slot_count_);
+    }
+
+    __host__ ConstantCache<Scheme::CKKS>::Entry
+    HEOperator<Scheme::CKKS>::encoded_constant(double value, int depth,
+                                               double scale,
+                                               const ExecutionOptions& options)
+    {
+        return encoded_constant(Complex64(value, 0.0), depth, scale, options);
+    }
+
+    __host__ ConstantCache<Scheme::CKKS>::Entry
+    HEOperator<Scheme::CKKS>::encoded_constant(Complex64 value, int depth,
+                                               double scale,
+                                               const ExecutionOptions& options)
+    {
+        double real = value.real();
+        double imag = value.imag();
+
+        ConstantKey key{(imag == 0.0) ? constant_kind::REAL
+                                      : constant_kind::COMPLEX,
+                        0, 0, depth, scale};
+        std::memcpy(&key.value1, &real, sizeof(double));
+        std::memcpy(&key.value2, &imag, sizeof(double));
+
+        return cached_encoding(key, {value}, slot_count_);
+    }
+
+    __host__ ConstantCache<Scheme::CKKS>::Entry
+    HEOperator<Scheme::CKKS>::cached_encoding(
+        const ConstantKey& key, const std::vector<Complex64>& values,
+        int slot_count)
+    {
+        if ((key.depth < 0) || (key.depth >= Q_size_))
+        {
+            throw std::invalid_argument("Invalid constant depth!");
+        }
+
+        if (key.scale <= 0.0)
+        {
+            throw std::invalid_argument("Scale has to be positive!");
+        }
+
+        ConstantCache<Scheme::CKKS>::Entry entry = constant_cache_->find(key);
+        if (entry)
+        {
+            return entry;
+        }
+
+        // The quick encoders work on the default stream, like the other
+        // precomputed encodings of the operator.
+        DeviceVector<Data64> encoded(Q_size_ << n_power);
+        if (values.size() == 1)
+        {
+            if (values[0].imag() == 0.0)
+            {
+                quick_ckks_encoder_constant_double(values[0].real(),
+                                                   encoded.data(), key.scale);
+            }
+            else
+            {
+                quick_ckks_encoder_constant_complex(values[0], encoded.data(),
+                                                    key.scale);
+            }
+        }
+        else
+        {
+            DeviceVector<Complex64> values_gpu(slot_count);
+            cudaMemcpy(values_gpu.data(), values.data(),
+                       slot_count * sizeof(Complex64), cudaMemcpyHostToDevice);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+            quick_ckks_encoder_vec_complex(values_gpu.data(), encoded.data(),
+                                           key.scale, int(log2(slot_count)));
+        }
+
+        Plaintext<Scheme::CKKS> plain =
+            trimmed_plaintext(encoded, key.depth, key.scale);
+        plain.slot_count_ = slot_count;
+
+        return constant_cache_->insert(key, std::move(plain));
+    }
+
+    __host__ Plaintext<Scheme::CKKS>
+    HEOperator<Scheme::CKKS>::trimmed_plaintext(DeviceVector<Data64>& encoded,
+                                                int depth, double scale)
+    {
+        Plaintext<Scheme::CKKS> plain;
+
+        plain.scheme_ = scheme_;
+        plain.plain_size_ = n * (Q_size_ - depth);
+        plain.depth_ = depth;
+        plain.scale_ = scale;
+        plain.slot_count_ = slot_count_;
+        plain.in_ntt_domain_ = true;
+        plain.storage_type_ = storage_type::DEVICE;
+        plain.plaintext_generated_ = true;
+
+        if (depth == 0)
+        {
+            plain.device_locations_ = std::move(encoded);
+        }
+        else
+        {
+            // Limbs are stored one after another, so the limbs of depth are a
+            // prefix of the full encoding.
+            plain.device_locations_ = DeviceVector<Data64>(plain.plain_size_);
+            cudaMemcpy(plain.device_locations_.data(), encoded.data(),
+                       plain.plain_size_ * sizeof(Data64),
+                       cudaMemcpyDeviceToDevice);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        }
+
+        return plain;
+    }
+
+    __host__ void HEOperator<Scheme::CKKS>::multiply_accumulate_key(
+        Data64* input, Data64* key, limb_type key_limb_type, Data64* output,
+        int first_rns_mod_count, int current_decomp_count,
+        int current_rns_mod_count, cudaStream_t stream)
+    {
+        if (key_limb_type == limb_type::LIMB32)
+        {
+            multiply_accumulate_leveled_kernel<<<
+                dim3((n >> 8), current_rns_mod_count, 1), 256, 0, stream>>>(
+                input, reinterpret_cast<Data32*>(key), output,
+                modulus_->data(), first_rns_mod_count, current_decomp_count,
+                n_power);
+        }
+        else
+        {
+            multiply_accumulate_leveled_kernel<<<
+                dim3((n >> 8), current_rns_mod_count, 1), 256, 0, stream>>>(
+                input, key, output, modulus_->data(), first_rns_mod_count,
+                current_decomp_count, n_power);
+        }
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+    }
+
     __host__ std::vector<heongpu::DeviceVector<Data64>>
     HEOperator<Scheme::CKKS>::encode_V_matrixs(Vandermonde& vandermonde,
                                                const double scale,
@@ -2130,18 +2464,17 @@ namespace heongpu
         {
             heongpu::DeviceVector<Data64> temp_encoded(
                 (vandermonde.V_matrixs_index_[m].size() * rns_count)
-                << (vandermonde.log_num_slots_ + 1));
+                << n_power);
 
             for (int i = 0; i < vandermonde.V_matrixs_index_[m].size(); i++)
             {
                 int matrix_location = (i << vandermonde.log_num_slots_);
-                int plaintext_location =
-                    ((i * rns_count) << (vandermonde.log_num_slots_ + 1));
+                int plaintext_location = (i * rns_count) << n_power;
 
                 quick_ckks_encoder_vec_complex(
                     vandermonde.V_matrixs_rotated_[m].data() + matrix_location,
                     temp_encoded.data() + plaintext_location, scale,
-                    use_all_bases);
+                    vandermonde.log_num_slots_, use_all_bases);
             }
 
             result.push_back(std::move(temp_encoded));
@@ -2159,23 +2492,30 @@ namespace heongpu
 
         int rns_count = use_all_bases ? Q_prime_size_ : Q_size_;
 
+        // With sparse packing the input of CoeffToSlot has been multiplied by
+        // the gap n / (2 * slot_count) in SubSum, so the first piece also
+        // divides by it.
+        double gap_inverse = static_cast<double>(vandermonde.num_slots_) /
+                             static_cast<double>(n >> 1);
+
         for (int m = 0; m < vandermonde.CtoS_piece_; m++)
         {
+            double piece_scale = (m == 0) ? (scale * gap_inverse) : scale;
+
             heongpu::DeviceVector<Data64> temp_encoded(
                 (vandermonde.V_inv_matrixs_index_[m].size() * rns_count)
-                << (vandermonde.log_num_slots_ + 1));
+                << n_power);
 
             for (int i = 0; i < vandermonde.V_inv_matrixs_index_[m].size(); i++)
             {
                 int matrix_location = (i << vandermonde.log_num_slots_);
-                int plaintext_location =
-                    ((i * rns_count) << (vandermonde.log_num_slots_ + 1));
+                int plaintext_location = (i * rns_count) << n_power;
 
                 quick_ckks_encoder_vec_complex(
                     vandermonde.V_inv_matrixs_rotated_[m].data() +
                         matrix_location,
-                    temp_encoded.data() + plaintext_location, scale,
-                    use_all_bases);
+                    temp_encoded.data() + plaintext_location, piece_scale,
+                    vandermonde.log_num_slots_, use_all_bases);
             }
 
             result.push_back(std::move(temp_encoded));
@@ -2256,6 +2596,7 @@ namespace heongpu
                 inner_sum.cipher_size_ = 2;
                 inner_sum.depth_ = result.depth_;
                 inner_sum.scale_ = result.scale_;
+                inner_sum.slot_count_ = result.slot_count_;
                 inner_sum.in_ntt_domain_ = result.in_ntt_domain_;
                 inner_sum.rescale_required_ = result.rescale_required_;
                 inner_sum.relinearization_required_ =
@@ -2348,6 +2689,7 @@ namespace heongpu
                 inner_sum.cipher_size_ = 2;
                 inner_sum.depth_ = result.depth_;
                 inner_sum.scale_ = result.scale_;
+                inner_sum.slot_count_ = result.slot_count_;
                 inner_sum.in_ntt_domain_ = result.in_ntt_domain_;
                 inner_sum.storage_type_ = result.storage_type_;
                 inner_sum.rescale_required_ = result.rescale_required_;
@@ -2430,7 +2772,7 @@ namespace heongpu
 
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            result0.data(), encoded_constant_1over2_.data(), result0.data(),
+            result0.data(), encoded_constant_1over2_->data(), result0.data(),
             modulus_->data(), n_power);
         result0.scale_ = result0.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -2446,7 +2788,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - result1.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            result1.data(), encoded_complex_minus_iover2_.data(),
+            result1.data(), encoded_complex_minus_iover2_->data(),
             result1.data(), modulus_->data(), n_power);
         result1.scale_ = result1.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -2492,7 +2834,7 @@ namespace heongpu
         int current_decomp_count = Q_size_ - result.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            result.data(), encoded_constant_1over2_.data(), result.data(),
+            result.data(), encoded_constant_1over2_->data(), result.data(),
             modulus_->data(), n_power);
         result.scale_ = result.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -2517,7 +2859,7 @@ namespace heongpu
         int current_decomp_count = Q_size_ - cipher1.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            result.data(), encoded_complex_i_.data(), result.data(),
+            result.data(), encoded_complex_i_->data(), result.data(),
             modulus_->data(), n_power);
         result.scale_ = result.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -2573,7 +2915,7 @@ namespace heongpu
         int current_decomp_count = Q_size_ - cipher.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            cipher.data(), encoded_complex_iscaleoverr_.data(), cipher.data(),
+            cipher.data(), encoded_complex_iscaleoverr_->data(), cipher.data(),
             modulus_->data(), n_power);
         cipher.scale_ = cipher.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -2647,7 +2989,7 @@ namespace heongpu
         int current_decomp_count = Q_size_ - third.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            third.data(), encoded_constant_1over2_.data(), third.data(),
+            third.data(), encoded_constant_1over2_->data(), third.data(),
             modulus_->data(), n_power);
         third.scale_ = third.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -2659,7 +3001,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - forth.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            forth.data(), encoded_constant_1over6_.data(), forth.data(),
+            forth.data(), encoded_constant_1over6_->data(), forth.data(),
             modulus_->data(), n_power);
         forth.scale_ = forth.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -2671,7 +3013,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - fifth.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            fifth.data(), encoded_constant_1over24_.data(), fifth.data(),
+            fifth.data(), encoded_constant_1over24_->data(), fifth.data(),
             modulus_->data(), n_power);
         fifth.scale_ = fifth.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -2683,7 +3025,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - sixth.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            sixth.data(), encoded_constant_1over120_.data(), sixth.data(),
+            sixth.data(), encoded_constant_1over120_->data(), sixth.data(),
             modulus_->data(), n_power);
         sixth.scale_ = sixth.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -2695,7 +3037,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - seventh.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            seventh.data(), encoded_constant_1over720_.data(), seventh.data(),
+            seventh.data(), encoded_constant_1over720_->data(), seventh.data(),
             modulus_->data(), n_power);
         seventh.scale_ = seventh.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -2707,7 +3049,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - eighth.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            eighth.data(), encoded_constant_1over5040_.data(), eighth.data(),
+            eighth.data(), encoded_constant_1over5040_->data(), eighth.data(),
             modulus_->data(), n_power);
         eighth.scale_ = eighth.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -2721,7 +3063,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - second.depth_;
         addition_plain_ckks_poly<<<dim3((n >> 8), current_decomp_count, 2), 256,
                                    0, options.stream_>>>(
-            second.data(), encoded_constant_1_.data(), result.data(),
+            second.data(), encoded_constant_1_->data(), result.data(),
             modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
@@ -2845,24 +3187,21 @@ namespace heongpu
             // TODO: make it efficient
             if (galois_key.storage_type_ == storage_type::DEVICE)
             {
-                multiply_accumulate_leveled_kernel<<<
-                    dim3((n >> 8), current_rns_mod_count, 1), 256, 0, stream>>>(
+                multiply_accumulate_key(
                     temp2_rotation,
                     galois_key.device_location_[galoiselt].data(),
-                    temp3_rotation, modulus_->data(), first_rns_mod_count,
-                    current_decomp_count, n_power);
-                HEONGPU_CUDA_CHECK(cudaGetLastError());
+                    galois_key.limb_type_, temp3_rotation, first_rns_mod_count,
+                    current_decomp_count, current_rns_mod_count, stream);
             }
             else
             {
                 DeviceVector<Data64> key_location(
                     galois_key.host_location_[galoiselt], stream);
-                multiply_accumulate_leveled_kernel<<<
-                    dim3((n >> 8), current_rns_mod_count, 1), 256, 0, stream>>>(
-                    temp2_rotation, key_location.data(), temp3_rotation,
-                    modulus_->data(), first_rns_mod_count, current_decomp_count,
-                    n_power);
-                HEONGPU_CUDA_CHECK(cudaGetLastError());
+                multiply_accumulate_key(temp2_rotation, key_location.data(),
+                                        galois_key.limb_type_, temp3_rotation,
+                                        first_rns_mod_count,
+                                        current_decomp_count,
+                                        current_rns_mod_count, stream);
             }
 
             gpuntt::GPU_NTT_Modulus_Ordered_Inplace(
@@ -3028,11 +3367,11 @@ namespace heongpu
     }
 
     __host__ HEOperator<Scheme::CKKS>::Vandermonde::Vandermonde(
-        const int poly_degree, const int CtoS_piece, const int StoC_piece,
-        const bool less_key_mode)
+        const int poly_degree, const int slot_count, const int CtoS_piece,
+        const int StoC_piece, const bool less_key_mode)
     {
         poly_degree_ = poly_degree;
-        num_slots_ = poly_degree_ >> 1;
+        num_slots_ = slot_count;
         log_num_slots_ = int(log2l(num_slots_));
 
         CtoS_piece_ = CtoS_piece;
@@ -3765,10 +4104,26 @@ namespace heongpu
             taylor_number_ = config.taylor_number_;
             less_key_mode_ = config.less_key_mode_;
 
+            boot_slot_count_ =
+                (config.slot_count_ == 0) ? (n >> 1) : config.slot_count_;
+            if (boot_slot_count_ > (n >> 1))
+            {
+                throw std::invalid_argument(
+                    "Bootstrapping slot count can not exceed n / 2!");
+            }
+            boot_log_slot_count_ = int(log2l(boot_slot_count_));
+            if (boot_log_slot_count_ < 2 * std::max(CtoS_piece_, StoC_piece_))
+            {
+                throw std::invalid_argument(
+                    "Bootstrapping slot count is too small for the requested "
+                    "CtoS and StoC pieces!");
+            }
+
             // TODO: remove it!
             bool use_all_bases = false; // Do not change it!
 
-            Vandermonde matrix_gen(n, CtoS_piece_, StoC_piece_, less_key_mode_);
+            Vandermonde matrix_gen(n, boot_slot_count_, CtoS_piece_,
+                                   StoC_piece_, less_key_mode_);
 
             V_matrixs_rotated_encoded_ =
                 encode_V_matrixs(matrix_gen, scale_boot_, use_all_bases);
@@ -3789,39 +4144,33 @@ namespace heongpu
 
             key_indexs_ = matrix_gen.key_indexs_;
 
+            // SubSum rotations that fold the n / 2 slots onto the sparse ones.
+            for (int i = boot_slot_count_; i < (n >> 1); i <<= 1)
+            {
+                key_indexs_.push_back(i);
+            }
+            key_indexs_ = unique_sort(key_indexs_);
+
             // Pre-computed encoded parameters
             // CtoS
             double constant_1over2 = 0.5;
-            encoded_constant_1over2_ = DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_1over2, encoded_constant_1over2_.data(), scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+            encoded_constant_1over2_ =
+                encoded_constant(constant_1over2, 0, scale_boot_);
 
             Complex64 complex_minus_iover2(0.0, -0.5);
             encoded_complex_minus_iover2_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_complex(
-                complex_minus_iover2, encoded_complex_minus_iover2_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+                encoded_constant(complex_minus_iover2, 0, scale_boot_);
 
             // StoC
             Complex64 complex_i(0, 1);
-            encoded_complex_i_ = DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_complex(
-                complex_i, encoded_complex_i_.data(), scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+            encoded_complex_i_ = encoded_constant(complex_i, 0, scale_boot_);
 
             // Scale part
             Complex64 complex_minus_iscale(
                 0.0, -(((static_cast<double>(prime_vector_[0].value) * 0.25) /
                         (scale_boot_ * M_PI))));
             encoded_complex_minus_iscale_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_complex(
-                complex_minus_iscale, encoded_complex_minus_iscale_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+                encoded_constant(complex_minus_iscale, 0, scale_boot_);
 
             // Exponentiate
             Complex64 complex_iscaleoverr(
@@ -3829,55 +4178,51 @@ namespace heongpu
                        static_cast<double>(prime_vector_[0].value))) /
                          static_cast<double>(1 << taylor_number_));
             encoded_complex_iscaleoverr_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_complex(
-                complex_iscaleoverr, encoded_complex_iscaleoverr_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+                encoded_constant(complex_iscaleoverr, 0, scale_boot_);
 
             // Sinus taylor
             double constant_1 = 1.0;
-            encoded_constant_1_ = DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_1, encoded_constant_1_.data(), scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+            encoded_constant_1_ = encoded_constant(constant_1, 0, scale_boot_);
 
             double constant_1over6 = 1.0 / 6.0;
-            encoded_constant_1over6_ = DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_1over6, encoded_constant_1over6_.data(), scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+            encoded_constant_1over6_ =
+                encoded_constant(constant_1over6, 0, scale_boot_);
 
             double constant_1over24 = 1.0 / 24.0;
             encoded_constant_1over24_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(constant_1over24,
-                                               encoded_constant_1over24_.data(),
-                                               scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+                encoded_constant(constant_1over24, 0, scale_boot_);
 
             double constant_1over120 = 1.0 / 120.0;
             encoded_constant_1over120_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_1over120, encoded_constant_1over120_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+                encoded_constant(constant_1over120, 0, scale_boot_);
 
             double constant_1over720 = 1.0 / 720.0;
             encoded_constant_1over720_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_1over720, encoded_constant_1over720_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+                encoded_constant(constant_1over720, 0, scale_boot_);
 
             double constant_1over5040 = 1.0 / 5040.0;
             encoded_constant_1over5040_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_1over5040, encoded_constant_1over5040_.data(),
-                scale_boot_);
+                encoded_constant(constant_1over5040, 0, scale_boot_);
+
+            // Real packing: X^(n/2) evaluates to i in every slot, so it
+            // multiplies a ciphertext by i without consuming a level.
+            std::vector<Data64> monomial_i(Q_size_ << n_power, 0ULL);
+            for (int i = 0; i < Q_size_; i++)
+            {
+                monomial_i[(i << n_power) + (n >> 1)] = 1ULL;
+            }
+            encoded_monomial_i_ = DeviceVector<Data64>(monomial_i);
+
+            gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+                .n_power = n_power,
+                .ntt_type = gpuntt::FORWARD,
+                .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+                .zero_padding = false,
+                .stream = 0};
+
+            gpuntt::GPU_NTT_Inplace(encoded_monomial_i_.data(),
+                                    ntt_table_->data(), modulus_->data(),
+                                    cfg_ntt, Q_size_, Q_size_);
             HEONGPU_CUDA_CHECK(cudaGetLastError());
             boot_context_generated_ = true;
         }
@@ -3890,6 +4235,26 @@ namespace heongpu
         cudaDeviceSynchronize();
     }
 
+    __host__ void HEArithmeticOperator<Scheme::CKKS>::sub_sum_inplace(
+        Ciphertext<Scheme::CKKS>& cipher, Galoiskey<Scheme::CKKS>& galois_key,
+        const ExecutionOptions& options)
+    {
+        // Trace onto the subring of the sparse slots: every step adds the
+        // ciphertext to its rotation by the current block size, which removes
+        // the coefficients off the sparse positions and multiplies the
+        // remaining ones by the gap n / (2 * boot_slot_count_). CoeffToSlot
+        // divides the gap back out.
+        for (int shift = boot_slot_count_; shift < (n >> 1); shift <<= 1)
+        {
+            Ciphertext<Scheme::CKKS> rotated =
+                operator_ciphertext(0, options.stream_);
+            rotate_rows(cipher, rotated, galois_key, shift, options);
+            add(cipher, rotated, cipher, options);
+        }
+
+        cipher.slot_count_ = boot_slot_count_;
+    }
+
     __host__ Ciphertext<Scheme::CKKS>
     HEArithmeticOperator<Scheme::CKKS>::regular_bootstrapping(
         Ciphertext<Scheme::CKKS>& input1, Galoiskey<Scheme::CKKS>& galois_key,
@@ -3903,6 +4268,13 @@ namespace heongpu
                 "generating Bootstrapping parameters!");
         }
 
+        if (input1.slot_count_ != boot_slot_count_)
+        {
+            throw std::invalid_argument(
+                "Ciphertext slot count does not match the bootstrapping slot "
+                "count!");
+        }
+
         // Raise modulus
         int current_decomp_count = Q_size_ - input1.depth_;
         if (current_decomp_count != 1)
@@ -3956,6 +4328,8 @@ namespace heongpu
                                 modulus_->data(), cfg_ntt, 2 * Q_size_,
                                 Q_size_);
 
+        sub_sum_inplace(c_raised, galois_key, options_inner);
+
         std::cout << "[C++ DEBUG] --> STAGE 2: CoeffToSlot Transformation <--" << std::endl;
 
         // Coeff to slot
@@ -3995,7 +4369,7 @@ namespace heongpu
         cipherplain_multiplication_kernel<<<dim3((n >> 8), current_decomp_count,
                                                  2),
                                             256, 0, options_inner.stream_>>>(
-            ciph_sin0.data(), encoded_complex_minus_iscale_.data(),
+            ciph_sin0.data(), encoded_complex_minus_iscale_->data(),
             ciph_sin0.data(), modulus_->data(), n_power);
         ciph_sin0.scale_ = ciph_sin0.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -4006,7 +4380,7 @@ namespace heongpu
         cipherplain_multiplication_kernel<<<dim3((n >> 8), current_decomp_count,
                                                  2),
                                             256, 0, options_inner.stream_>>>(
-            ciph_sin1.data(), encoded_complex_minus_iscale_.data(),
+            ciph_sin1.data(), encoded_complex_minus_iscale_->data(),
             ciph_sin1.data(), modulus_->data(), n_power);
         ciph_sin1.scale_ = ciph_sin1.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -4019,6 +4393,7 @@ namespace heongpu
         Ciphertext<Scheme::CKKS> StoC_results =
             slot_to_coeff(ciph_sin0, ciph_sin1, galois_key, options_inner);
         StoC_results.scale_ = scale_boot_;
+        StoC_results.slot_count_ = boot_slot_count_;
         
         std::cout << "[C++ DEBUG] Finished regular_bootstrapping successfully." << std::endl;
 
@@ -4037,6 +4412,13 @@ namespace heongpu
                 "generating Bootstrapping parameters!");
         }
 
+        if (input1.slot_count_ != boot_slot_count_)
+        {
+            throw std::invalid_argument(
+                "Ciphertext slot count does not match the bootstrapping slot "
+                "count!");
+        }
+
         // Raise modulus
         int current_decomp_count = Q_size_ - input1.depth_;
         if (current_decomp_count != (1 + StoC_piece_))
@@ -4091,6 +4473,8 @@ namespace heongpu
                                 modulus_->data(), cfg_ntt, 2 * Q_size_,
                                 Q_size_);
 
+        sub_sum_inplace(c_raised, galois_key, options_inner);
+
         // Coeff to slot
         Ciphertext<Scheme::CKKS> CtoS_results =
             solo_coeff_to_slot(c_raised, galois_key, options_inner);
@@ -4113,269 +4497,1330 @@ namespace heongpu
         cipherplain_multiplication_kernel<<<dim3((n >> 8), current_decomp_count,
                                                  2),
                                             256, 0, options_inner.stream_>>>(
-            ciph_sin.data(), encoded_complex_minus_iscale_.data(),
+            ciph_sin.data(), encoded_complex_minus_iscale_->data(),
             ciph_sin.data(), modulus_->data(), n_power);
         ciph_sin.scale_ = ciph_sin.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
         ciph_sin.rescale_required_ = true;
         rescale_inplace(ciph_sin, options_inner);
         ciph_sin.scale_ = scale_boot_;
+        ciph_sin.slot_count_ = boot_slot_count_;
 
         return ciph_sin;
     }
 
-    HELogicOperator<Scheme::CKKS>::HELogicOperator(
-        HEContext<Scheme::CKKS>& context, HEEncoder<Scheme::CKKS>& encoder,
-        double scale)
-        : HEOperator<Scheme::CKKS>(context, encoder)
+    __host__ void
+    HEArithmeticOperator<Scheme::CKKS>::regular_bootstrapping_real(
+        Ciphertext<Scheme::CKKS>& input1, Ciphertext<Scheme::CKKS>& input2,
+        Ciphertext<Scheme::CKKS>& output1, Ciphertext<Scheme::CKKS>& output2,
+        Galoiskey<Scheme::CKKS>& galois_key, Relinkey<Scheme::CKKS>& relin_key,
+        const ExecutionOptions& options)
     {
-        if (scale == 0.0)
+        if (!boot_context_generated_)
         {
             throw std::invalid_argument(
-                "Scale can not be zero for CKKS Scheme");
+                "Bootstrapping operation can not be performed before "
+                "generating Bootstrapping parameters!");
         }
 
-        double constant_1 = 1.0;
-        encoded_constant_one_ = DeviceVector<Data64>(Q_size_ << n_power);
-        quick_ckks_encoder_constant_double(constant_1,
-                                           encoded_constant_one_.data(), scale);
-        HEONGPU_CUDA_CHECK(cudaGetLastError());
+        Ciphertext<Scheme::CKKS> packed =
+            pack_real_pair(input1, input2, options);
+
+        Ciphertext<Scheme::CKKS> bootstrapped =
+            regular_bootstrapping(packed, galois_key, relin_key, options);
+
+        unpack_real_pair(bootstrapped, output1, &output2, galois_key, options);
     }
 
-    __host__ void HELogicOperator<Scheme::CKKS>::generate_bootstrapping_params(
-        const double scale, const BootstrappingConfig& config,
-        const logic_bootstrapping_type& boot_type)
+    __host__ void
+    HEArithmeticOperator<Scheme::CKKS>::regular_bootstrapping_real(
+        std::vector<Ciphertext<Scheme::CKKS>>& inputs,
+        std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+        Galoiskey<Scheme::CKKS>& galois_key, Relinkey<Scheme::CKKS>& relin_key,
+        const ExecutionOptions& options)
     {
-        if (!boot_context_generated_)
+        int count = inputs.size();
+        outputs.resize(count);
+
+        for (int i = 0; (i + 1) < count; i += 2)
         {
-            int division = static_cast<int>(
-                round(static_cast<double>(prime_vector_[0].value) / scale));
+            regular_bootstrapping_real(inputs[i], inputs[i + 1], outputs[i],
+                                       outputs[i + 1], galois_key, relin_key,
+                                       options);
+        }
 
-            switch (static_cast<int>(boot_type))
-            {
-                case 1: // BIT_BOOTSTRAPPING
-                    if ((division != 2))
-                    {
-                        throw std::invalid_argument(
-                            "Bootstrapping parameters can not be generated, "
-                            "because of context is not suitable for Bit "
-                            "Bootstrapping. Last modulus should be 2*scale!");
-                    }
-                    break;
-                case 2: // GATE_BOOTSTRAPPING
-                    if ((division != 3))
-                    {
-                        throw std::invalid_argument(
-                            "Bootstrapping parameters can not be generated, "
-                            "because of context is not suitable for Gate "
-                            "Bootstrapping. Last modulus should be 3*scale!");
-                    }
+        if (count % 2 == 1)
+        {
+            Ciphertext<Scheme::CKKS> bootstrapped = regular_bootstrapping(
+                inputs[count - 1], galois_key, relin_key, options);
 
-                    break;
-                default:
-                    throw std::invalid_argument("Invalid Key Switching Type");
-                    break;
-            }
+            unpack_real_pair(bootstrapped, outputs[count - 1], nullptr,
+                             galois_key, options);
+        }
+    }
 
-            /*
-            enum class logic_bootstrapping_type : std::uint8_t
-            {
-                NONE = 0x0,
-                BIT_BOOTSTRAPPING = 0x1, // scale = q0 / 2. More detail:
-                                        // https://eprint.iacr.org/2024/767.pdf
-                GATE_BOOTSTRAPPING = 0x2, // scale = q0 / 3. More detail:
-                                        // https://eprint.iacr.org/2024/767.pdf
-            };
-            */
+    __host__ void HEArithmeticOperator<Scheme::CKKS>::slim_bootstrapping_real(
+        Ciphertext<Scheme::CKKS>& input1, Ciphertext<Scheme::CKKS>& input2,
+        Ciphertext<Scheme::CKKS>& output1, Ciphertext<Scheme::CKKS>& output2,
+        Galoiskey<Scheme::CKKS>& galois_key, Relinkey<Scheme::CKKS>& relin_key,
+        const ExecutionOptions& options)
+    {
+        if (!boot_context_generated_)
+        {
+            throw std::invalid_argument(
+                "Bootstrapping operation can not be performed before "
+                "generating Bootstrapping parameters!");
+        }
 
-            scale_boot_ = scale;
-            CtoS_piece_ = config.CtoS_piece_;
-            StoC_piece_ = config.StoC_piece_;
-            taylor_number_ = config.taylor_number_;
-            less_key_mode_ = config.less_key_mode_;
+        Ciphertext<Scheme::CKKS> packed =
+            pack_real_pair(input1, input2, options);
 
-            // TODO: remove it!
-            bool use_all_bases = false; // Do not change it!
+        Ciphertext<Scheme::CKKS> bootstrapped =
+            slim_bootstrapping(packed, galois_key, relin_key, options);
 
-            Vandermonde matrix_gen(n, CtoS_piece_, StoC_piece_, less_key_mode_);
+        unpack_real_pair(bootstrapped, output1, &output2, galois_key, options);
+    }
 
-            V_matrixs_rotated_encoded_ =
-                encode_V_matrixs(matrix_gen, scale_boot_, use_all_bases);
-            V_inv_matrixs_rotated_encoded_ =
-                encode_V_inv_matrixs(matrix_gen, scale_boot_, use_all_bases);
+    __host__ void HEArithmeticOperator<Scheme::CKKS>::slim_bootstrapping_real(
+        std::vector<Ciphertext<Scheme::CKKS>>& inputs,
+        std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+        Galoiskey<Scheme::CKKS>& galois_key, Relinkey<Scheme::CKKS>& relin_key,
+        const ExecutionOptions& options)
+    {
+        int count = inputs.size();
+        outputs.resize(count);
 
-            V_matrixs_index_ = matrix_gen.V_matrixs_index_;
-            V_inv_matrixs_index_ = matrix_gen.V_inv_matrixs_index_;
+        for (int i = 0; (i + 1) < count; i += 2)
+        {
+            slim_bootstrapping_real(inputs[i], inputs[i + 1], outputs[i],
+                                    outputs[i + 1], galois_key, relin_key,
+                                    options);
+        }
 
-            diags_matrices_bsgs_ = matrix_gen.diags_matrices_bsgs_;
-            diags_matrices_inv_bsgs_ = matrix_gen.diags_matrices_inv_bsgs_;
+        if (count % 2 == 1)
+        {
+            Ciphertext<Scheme::CKKS> bootstrapped = slim_bootstrapping(
+                inputs[count - 1], galois_key, relin_key, options);
 
-            if (less_key_mode_)
-            {
-                real_shift_n2_bsgs_ = matrix_gen.real_shift_n2_bsgs_;
-                real_shift_n2_inv_bsgs_ = matrix_gen.real_shift_n2_inv_bsgs_;
-            }
+            unpack_real_pair(bootstrapped, outputs[count - 1], nullptr,
+                             galois_key, options);
+        }
+    }
 
-            key_indexs_ = matrix_gen.key_indexs_;
+    __host__ Ciphertext<Scheme::CKKS>
+    HEArithmeticOperator<Scheme::CKKS>::pack_real_pair(
+        Ciphertext<Scheme::CKKS>& input1, Ciphertext<Scheme::CKKS>& input2,
+        const ExecutionOptions& options)
+    {
+        if (input1.depth_ != input2.depth_)
+        {
+            throw std::invalid_argument(
+                "Ciphertexts packed into one bootstrapping should be at the "
+                "same level!");
+        }
 
-            // Pre-computed encoded parameters
-            // CtoS
-            double constant_1over2 = 0.5;
-            encoded_constant_1over2_ = DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_1over2, encoded_constant_1over2_.data(), scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        if (input1.scale_ != input2.scale_)
+        {
+            throw std::invalid_argument(
+                "Ciphertexts packed into one bootstrapping should have the "
+                "same scale!");
+        }
 
-            Complex64 complex_minus_iover2(0.0, -0.5);
-            encoded_complex_minus_iover2_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_complex(
-                complex_minus_iover2, encoded_complex_minus_iover2_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        if (input1.slot_count_ != input2.slot_count_)
+        {
+            throw std::invalid_argument(
+                "Ciphertexts packed into one bootstrapping should have the "
+                "same slot count!");
+        }
 
-            // StoC
-            Complex64 complex_i(0.0, 1.0);
-            encoded_complex_i_ = DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_complex(
-                complex_i, encoded_complex_i_.data(), scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        if (!input1.in_ntt_domain_ || !input2.in_ntt_domain_)
+        {
+            throw std::invalid_argument(
+                "Ciphertexts should be in the NTT domain!");
+        }
 
-            // Scale part
-            Complex64 complex_minus_iscale(
-                0.0, -(((static_cast<double>(prime_vector_[0].value) * 0.25) /
-                        (scale_boot_ * M_PI))));
-            encoded_complex_minus_iscale_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_complex(
-                complex_minus_iscale, encoded_complex_minus_iscale_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        ExecutionOptions options_inner =
+            ExecutionOptions()
+                .set_stream(options.stream_)
+                .set_storage_type(storage_type::DEVICE)
+                .set_initial_location(true);
 
-            // Exponentiate
-            Complex64 complex_iscaleoverr(
-                0.0, (((2 * M_PI * scale_boot_) /
-                       static_cast<double>(prime_vector_[0].value))) /
-                         static_cast<double>(1 << taylor_number_));
-            encoded_complex_iscaleoverr_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_complex(
-                complex_iscaleoverr, encoded_complex_iscaleoverr_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        // input1 + i * input2, where the multiplication by i is the monomial
+        // X^(n/2) and leaves the level and the scale unchanged.
+        int current_decomp_count = Q_size_ - input2.depth_;
+        Ciphertext<Scheme::CKKS> imaginary =
+            operator_from_ciphertext(input2, options.stream_);
+        input_storage_manager(
+            input2,
+            [&](Ciphertext<Scheme::CKKS>& input2_)
+            {
+                cipherplain_multiplication_kernel<<<
+                    dim3((n >> 8), current_decomp_count, 2), 256, 0,
+                    options.stream_>>>(input2_.data(),
+                                       encoded_monomial_i_.data(),
+                                       imaginary.data(), modulus_->data(),
+                                       n_power);
+                HEONGPU_CUDA_CHECK(cudaGetLastError());
+            },
+            options, false);
 
-            // Sinus taylor
-            double constant_1 = 1.0;
-            encoded_constant_1_ = DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_1, encoded_constant_1_.data(), scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        Ciphertext<Scheme::CKKS> packed =
+            operator_ciphertext(0, options_inner.stream_);
+        add(input1, imaginary, packed, options_inner);
 
-            double constant_1over6 = 1.0 / 6.0;
-            encoded_constant_1over6_ = DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_1over6, encoded_constant_1over6_.data(), scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        return packed;
+    }
 
-            double constant_1over24 = 1.0 / 24.0;
-            encoded_constant_1over24_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(constant_1over24,
-                                               encoded_constant_1over24_.data(),
-                                               scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+    __host__ void HEArithmeticOperator<Scheme::CKKS>::unpack_real_pair(
+        Ciphertext<Scheme::CKKS>& packed, Ciphertext<Scheme::CKKS>& output1,
+        Ciphertext<Scheme::CKKS>* output2, Galoiskey<Scheme::CKKS>& galois_key,
+        const ExecutionOptions& options)
+    {
+        ExecutionOptions options_inner =
+            ExecutionOptions()
+                .set_stream(options.stream_)
+                .set_storage_type(storage_type::DEVICE)
+                .set_initial_location(true);
 
-            double constant_1over120 = 1.0 / 120.0;
-            encoded_constant_1over120_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_1over120, encoded_constant_1over120_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        Ciphertext<Scheme::CKKS> packed_conjugate =
+            operator_ciphertext(0, options_inner.stream_);
+        conjugate(packed, packed_conjugate, galois_key, options_inner);
 
-            double constant_1over720 = 1.0 / 720.0;
-            encoded_constant_1over720_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_1over720, encoded_constant_1over720_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        // Real part: (c + conj(c)) / 2
+        Ciphertext<Scheme::CKKS> real_part =
+            operator_ciphertext(0, options_inner.stream_);
+        add(packed, packed_conjugate, real_part, options_inner);
+        multiply_encoded_constant(real_part, *encoded_constant_1over2_,
+                                  options_inner);
 
-            double constant_1over5040 = 1.0 / 5040.0;
-            encoded_constant_1over5040_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_1over5040, encoded_constant_1over5040_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        output_storage_manager(
+            output1,
+            [&](Ciphertext<Scheme::CKKS>& output1_)
+            { output1_ = std::move(real_part); },
+            options);
 
-            // Bit bootstrapping
-            double constant_minus_1over4 = -0.25;
-            encoded_constant_minus_1over4_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_minus_1over4, encoded_constant_minus_1over4_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        if (output2 != nullptr)
+        {
+            // Imaginary part: (c - conj(c)) * (-i / 2)
+            Ciphertext<Scheme::CKKS> imaginary_part =
+                operator_ciphertext(0, options_inner.stream_);
+            sub(packed, packed_conjugate, imaginary_part, options_inner);
+            multiply_encoded_constant(imaginary_part,
+                                      *encoded_complex_minus_iover2_,
+                                      options_inner);
+
+            output_storage_manager(
+                *output2,
+                [&](Ciphertext<Scheme::CKKS>& output2_)
+                { output2_ = std::move(imaginary_part); },
+                options);
+        }
+    }
 
-            // Gate bootstrapping
-            double constant_1over3_ = 1.0 / 3.0;
-            encoded_constant_1over3_ = DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_1over3_, encoded_constant_1over3_.data(), scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+    __host__ void HEArithmeticOperator<Scheme::CKKS>::multiply_encoded_constant(
+        Ciphertext<Scheme::CKKS>& cipher, Plaintext<Scheme::CKKS>& constant,
+        const ExecutionOptions& options)
+    {
+        double scale = cipher.scale_;
+        int current_decomp_count = Q_size_ - cipher.depth_;
 
-            double constant_2over3_ = 2.0 / 3.0;
-            encoded_constant_2over3_ = DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_2over3_, encoded_constant_2over3_.data(), scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        cipherplain_multiplication_kernel<<<dim3((n >> 8), current_decomp_count,
+                                                 2),
+                                            256, 0, options.stream_>>>(
+            cipher.data(), constant.data(), cipher.data(), modulus_->data(),
+            n_power);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
 
-            Complex64 complex_minus_2over6j_(0.0, (1.0 / 3.0));
-            encoded_complex_minus_2over6j_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_complex(
-                complex_minus_2over6j_, encoded_complex_minus_2over6j_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        cipher.scale_ = cipher.scale_ * scale_boot_;
+        cipher.rescale_required_ = true;
+        rescale_inplace(cipher, options);
+        cipher.scale_ = scale;
+    }
 
-            double constant_minus_2over6_ = -(1.0 / 3.0);
-            encoded_constant_minus_2over6_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_minus_2over6_, encoded_constant_minus_2over6_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+    __host__ std::vector<RepackPlacement>
+    HEArithmeticOperator<Scheme::CKKS>::plan_repack(
+        const std::vector<SlotRange>& ranges, int slot_count)
+    {
+        if (slot_count <= 0)
+        {
+            throw std::invalid_argument("Invalid slot count!");
+        }
 
-            Complex64 complex_2over6j_(0.0, (-1.0 / 3.0));
-            encoded_complex_2over6j_ = DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_complex(
-                complex_2over6j_, encoded_complex_2over6j_.data(), scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        for (const SlotRange& range : ranges)
+        {
+            if ((range.offset < 0) || (range.length <= 0) ||
+                (range.offset + range.length > slot_count))
+            {
+                throw std::invalid_argument("Invalid slot range!");
+            }
+        }
 
-            double constant_2over6_ = 1.0 / 3.0;
-            encoded_constant_2over6_ = DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_2over6_, encoded_constant_2over6_.data(), scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        std::vector<int> order(ranges.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                         [&](int i, int j)
+                         { return ranges[i].length > ranges[j].length; });
 
-            double constant_pioversome_ =
-                prime_vector_[0].value / (12.0 * scale_boot_);
-            encoded_constant_pioversome_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_pioversome_, encoded_constant_pioversome_.data(),
-                scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        // Number of slots filled in every packed ciphertext.
+        std::vector<int> filled;
+        std::vector<RepackPlacement> layout(ranges.size());
+        for (int i : order)
+        {
+            int output = 0;
+            while ((output < static_cast<int>(filled.size())) &&
+                   (filled[output] + ranges[i].length > slot_count))
+            {
+                output++;
+            }
 
-            double constant_minus_pioversome_ =
-                -((prime_vector_[0].value) / (12.0 * scale_boot_));
-            encoded_constant_minus_pioversome_ =
-                DeviceVector<Data64>(Q_size_ << n_power);
-            quick_ckks_encoder_constant_double(
-                constant_minus_pioversome_,
-                encoded_constant_minus_pioversome_.data(), scale_boot_);
-            HEONGPU_CUDA_CHECK(cudaGetLastError());
+            if (output == static_cast<int>(filled.size()))
+            {
+                filled.push_back(0);
+            }
+
+            layout[i] = RepackPlacement{ranges[i], output, filled[output]};
+            filled[output] += ranges[i].length;
+        }
+
+        return layout;
+    }
+
+    __host__ std::vector<int>
+    HEArithmeticOperator<Scheme::CKKS>::repack_rotation_steps(
+        const std::vector<RepackPlacement>& layout, int slot_count)
+    {
+        std::vector<int> steps;
+        for (const RepackPlacement& placement : layout)
+        {
+            int shift = (placement.source.offset - placement.target_offset) %
+                        slot_count;
+            if (shift == 0)
+            {
+                continue;
+            }
+
+            shift = (shift + slot_count) % slot_count;
+            steps.push_back(shift); // repack
+            steps.push_back(slot_count - shift); // unpack
+        }
+
+        std::sort(steps.begin(), steps.end());
+        steps.erase(std::unique(steps.begin(), steps.end()), steps.end());
+
+        return steps;
+    }
+
+    __host__ void HEArithmeticOperator<Scheme::CKKS>::repack(
+        std::vector<Ciphertext<Scheme::CKKS>>& inputs,
+        const std::vector<RepackPlacement>& layout,
+        std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+        Galoiskey<Scheme::CKKS>& galois_key, const ExecutionOptions& options)
+    {
+        check_repack_ciphertexts(inputs, layout, false);
+
+        int slot_count = inputs[0].slot_count_;
+        int depth = inputs[0].depth_;
+
+        int output_count = 0;
+        for (const RepackPlacement& placement : layout)
+        {
+            output_count = std::max(output_count, placement.output + 1);
+        }
+
+        std::vector<bool> output_used(output_count, false);
+        for (const RepackPlacement& placement : layout)
+        {
+            output_used[placement.output] = true;
+        }
+
+        if (std::find(output_used.begin(), output_used.end(), false) !=
+            output_used.end())
+        {
+            throw std::invalid_argument(
+                "Layout leaves a packed ciphertext empty!");
+        }
+
+        ExecutionOptions options_inner =
+            ExecutionOptions()
+                .set_stream(options.stream_)
+                .set_storage_type(storage_type::DEVICE)
+                .set_initial_location(true);
+
+        // Inputs with the same occupied slots share their mask, and inputs
+        // moved by the same rotation into the same packed ciphertext are
+        // summed first and rotated once.
+        std::map<std::pair<int, int>, ConstantCache<Scheme::CKKS>::Entry>
+            masks;
+        std::map<std::pair<int, int>, std::vector<int>> groups;
+        for (int i = 0; i < static_cast<int>(layout.size()); i++)
+        {
+            const RepackPlacement& placement = layout[i];
+            std::pair<int, int> range(placement.source.offset,
+                                      placement.source.length);
+            if (masks.find(range) == masks.end())
+            {
+                masks.emplace(range, encode_slot_mask(placement.source,
+                                                      slot_count, depth));
+            }
+
+            int shift = placement.source.offset - placement.target_offset;
+            shift = ((shift % slot_count) + slot_count) % slot_count;
+            groups[{placement.output, shift}].push_back(i);
+        }
+
+        std::vector<Ciphertext<Scheme::CKKS>> packed(output_count);
+        std::vector<bool> packed_generated(output_count, false);
+        for (auto& group : groups)
+        {
+            int output = group.first.first;
+            int shift = group.first.second;
+
+            Ciphertext<Scheme::CKKS> sum;
+            bool sum_generated = false;
+            for (int i : group.second)
+            {
+                std::pair<int, int> range(layout[i].source.offset,
+                                          layout[i].source.length);
+                Ciphertext<Scheme::CKKS> masked = multiply_slot_mask(
+                    inputs[i], *masks.at(range), options_inner);
+
+                if (sum_generated)
+                {
+                    add_inplace(sum, masked, options_inner);
+                }
+                else
+                {
+                    sum = std::move(masked);
+                    sum_generated = true;
+                }
+            }
+
+            rotate_rows_inplace(sum, galois_key, shift, options_inner);
+
+            if (packed_generated[output])
+            {
+                add_inplace(packed[output], sum, options_inner);
+            }
+            else
+            {
+                packed[output] = std::move(sum);
+                packed_generated[output] = true;
+            }
+        }
+
+        outputs.resize(output_count);
+        for (int i = 0; i < output_count; i++)
+        {
+            output_storage_manager(
+                outputs[i],
+                [&](Ciphertext<Scheme::CKKS>& output_)
+                { output_ = std::move(packed[i]); },
+                options);
+        }
+    }
+
+    __host__ void HEArithmeticOperator<Scheme::CKKS>::unpack(
+        std::vector<Ciphertext<Scheme::CKKS>>& packed,
+        const std::vector<RepackPlacement>& layout,
+        std::vector<Ciphertext<Scheme::CKKS>>& outputs,
+        Galoiskey<Scheme::CKKS>& galois_key, const ExecutionOptions& options)
+    {
+        check_repack_ciphertexts(packed, layout, true);
+
+        int slot_count = packed[0].slot_count_;
+        int depth = packed[0].depth_;
+        int current_decomp_count = Q_size_ - depth;
+        int cipher_memory_size = (2 * current_decomp_count) << n_power;
+
+        ExecutionOptions options_inner =
+            ExecutionOptions()
+                .set_stream(options.stream_)
+                .set_storage_type(storage_type::DEVICE)
+                .set_initial_location(true);
+
+        std::map<std::pair<int, int>, ConstantCache<Scheme::CKKS>::Entry>
+            masks;
+        for (const RepackPlacement& placement : layout)
+        {
+            std::pair<int, int> range(placement.source.offset,
+                                      placement.source.length);
+            if (masks.find(range) == masks.end())
+            {
+                masks.emplace(range, encode_slot_mask(placement.source,
+                                                      slot_count, depth));
+            }
+        }
+
+        outputs.resize(layout.size());
+        for (int j = 0; j < static_cast<int>(packed.size()); j++)
+        {
+            // Placements of this ciphertext grouped by rotation.
+            std::map<int, std::vector<int>> groups;
+            for (int i = 0; i < static_cast<int>(layout.size()); i++)
+            {
+                if (layout[i].output != j)
+                {
+                    continue;
+                }
+
+                int shift = layout[i].target_offset - layout[i].source.offset;
+                shift = ((shift % slot_count) + slot_count) % slot_count;
+                groups[shift].push_back(i);
+            }
+
+            // Index 0 stands for the unrotated ciphertext, as in the hoisted
+            // rotation.
+            std::vector<int> shifts = {0};
+            for (auto& group : groups)
+            {
+                if (group.first != 0)
+                {
+                    shifts.push_back(group.first);
+                }
+            }
+
+            // Hoisting shares the decomposition of the ciphertext between its
+            // rotations, but needs a key for every rotation.
+            bool hoisting = (shifts.size() > 2) &&
+                            (galois_key.key_type !=
+                             keyswitching_type::KEYSWITCHING_METHOD_III);
+            for (int k = 1; hoisting && (k < static_cast<int>(shifts.size()));
+                 k++)
+            {
+                int galoiselt =
+                    steps_to_galois_elt(shifts[k], n, galois_key.group_order_);
+                hoisting =
+                    (galois_key.storage_type_ == storage_type::DEVICE)
+                        ? (galois_key.device_location_.find(galoiselt) !=
+                           galois_key.device_location_.end())
+                        : (galois_key.host_location_.find(galoiselt) !=
+                           galois_key.host_location_.end());
+            }
+
+            std::map<int, Ciphertext<Scheme::CKKS>> rotated;
+            if (hoisting)
+            {
+                input_storage_manager(
+                    packed[j],
+                    [&](Ciphertext<Scheme::CKKS>& packed_)
+                    {
+                        DeviceVector<Data64> rotations =
+                            fast_single_hoisting_rotation_ckks(
+                                packed_, shifts, shifts.size(), galois_key,
+                                options.stream_);
+
+                        for (int k = 1; k < static_cast<int>(shifts.size());
+                             k++)
+                        {
+                            Ciphertext<Scheme::CKKS> rotation =
+                                operator_from_ciphertext(packed_,
+                                                         options.stream_);
+                            cudaMemcpyAsync(
+                                rotation.data(),
+                                rotations.data() + (k * cipher_memory_size),
+                                cipher_memory_size * sizeof(Data64),
+                                cudaMemcpyDeviceToDevice, options.stream_);
+                            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                            rotated.emplace(shifts[k], std::move(rotation));
+                        }
+                    },
+                    options, false);
+            }
+            else
+            {
+                for (int k = 1; k < static_cast<int>(shifts.size()); k++)
+                {
+                    Ciphertext<Scheme::CKKS> rotation =
+                        operator_ciphertext(0, options_inner.stream_);
+                    rotate_rows(packed[j], rotation, galois_key, shifts[k],
+                                options_inner);
+
+                    rotated.emplace(shifts[k], std::move(rotation));
+                }
+            }
+
+            for (auto& group : groups)
+            {
+                Ciphertext<Scheme::CKKS>& source =
+                    (group.first == 0) ? packed[j] : rotated.at(group.first);
+
+                for (int i : group.second)
+                {
+                    std::pair<int, int> range(layout[i].source.offset,
+                                              layout[i].source.length);
+                    Ciphertext<Scheme::CKKS> masked = multiply_slot_mask(
+                        source, *masks.at(range), options_inner);
+
+                    output_storage_manager(
+                        outputs[i],
+                        [&](Ciphertext<Scheme::CKKS>& output_)
+                        { output_ = std::move(masked); },
+                        options);
+                }
+            }
+        }
+    }
+
+    __host__ void HEArithmeticOperator<Scheme::CKKS>::check_repack_ciphertexts(
+        std::vector<Ciphertext<Scheme::CKKS>>& ciphers,
+        const std::vector<RepackPlacement>& layout, bool packed)
+    {
+        if (ciphers.empty())
+        {
+            throw std::invalid_argument("Ciphertext vector is empty!");
+        }
+
+        if (!packed && (layout.size() != ciphers.size()))
+        {
+            throw std::invalid_argument(
+                "Layout should have one placement per ciphertext!");
+        }
+
+        const Ciphertext<Scheme::CKKS>& first = ciphers[0];
+        for (const Ciphertext<Scheme::CKKS>& cipher : ciphers)
+        {
+            if ((cipher.depth_ != first.depth_) ||
+                (cipher.scale_ != first.scale_) ||
+                (cipher.slot_count_ != first.slot_count_))
+            {
+                throw std::invalid_argument(
+                    "Ciphertexts should have the same level, scale and slot "
+                    "count!");
+            }
+
+            if (cipher.rescale_required_ || cipher.relinearization_required_)
+            {
+                throw std::invalid_argument(
+                    "Ciphertexts should be rescaled and relinearized!");
+            }
+
+            if (!cipher.in_ntt_domain_)
+            {
+                throw std::invalid_argument(
+                    "Ciphertexts should be in the NTT domain!");
+            }
+        }
+
+        if ((Q_size_ - first.depth_) < 2)
+        {
+            throw std::invalid_argument(
+                "Ciphertexts have no level left for the slot masks!");
+        }
+
+        int slot_count = first.slot_count_;
+        for (const RepackPlacement& placement : layout)
+        {
+            const SlotRange& source = placement.source;
+            if ((source.offset < 0) || (source.length <= 0) ||
+                (source.offset + source.length > slot_count) ||
+                (placement.target_offset < 0) ||
+                (placement.target_offset + source.length > slot_count) ||
+                (placement.output < 0))
+            {
+                throw std::invalid_argument("Invalid repack placement!");
+            }
+
+            if (packed &&
+                (placement.output >= static_cast<int>(ciphers.size())))
+            {
+                throw std::invalid_argument(
+                    "Placement refers to a missing packed ciphertext!");
+            }
+        }
+    }
+
+    __host__ ConstantCache<Scheme::CKKS>::Entry
+    HEArithmeticOperator<Scheme::CKKS>::encode_slot_mask(const SlotRange& range,
+                                                         int slot_count,
+                                                         int depth)
+    {
+        std::vector<Complex64> mask(slot_count, Complex64(0.0, 0.0));
+        for (int i = 0; i < range.length; i++)
+        {
+            mask[range.offset + i] = Complex64(1.0, 0.0);
+        }
+
+        // The rescale after the product divides by exactly this prime.
+        double scale =
+            static_cast<double>(prime_vector_[Q_size_ - depth - 1].value);
+
+        ConstantKey key{constant_kind::SLOT_RANGE,
+                        static_cast<std::uint64_t>(range.offset),
+                        (static_cast<std::uint64_t>(slot_count) << 32) |
+                            static_cast<std::uint64_t>(range.length),
+                        depth, scale};
+
+        return cached_encoding(key, mask, slot_count);
+    }
+
+    __host__ Ciphertext<Scheme::CKKS>
+    HEArithmeticOperator<Scheme::CKKS>::multiply_slot_mask(
+        Ciphertext<Scheme::CKKS>& cipher, Plaintext<Scheme::CKKS>& mask,
+        const ExecutionOptions& options)
+    {
+        int current_decomp_count = Q_size_ - cipher.depth_;
+        Ciphertext<Scheme::CKKS> masked =
+            operator_from_ciphertext(cipher, options.stream_);
+
+        input_storage_manager(
+            cipher,
+            [&](Ciphertext<Scheme::CKKS>& cipher_)
+            {
+                cipherplain_multiplication_kernel<<<
+                    dim3((n >> 8), current_decomp_count, 2), 256, 0,
+                    options.stream_>>>(cipher_.data(), mask.data(),
+                                       masked.data(), modulus_->data(),
+                                       n_power);
+                HEONGPU_CUDA_CHECK(cudaGetLastError());
+            },
+            options, false);
+
+        masked.scale_ =
+            cipher.scale_ *
+            static_cast<double>(prime_vector_[current_decomp_count - 1].value);
+        masked.rescale_required_ = true;
+        rescale_inplace(masked, options);
+        masked.scale_ = cipher.scale_;
+
+        return masked;
+    }
+
+    __host__ void HEArithmeticOperator<Scheme::CKKS>::pack_lwe_ciphertexts(
+        Ciphertext<Scheme::TFHE>& input, Ciphertext<Scheme::CKKS>& output,
+        Packingkey<Scheme::CKKS>& packing_key,
+        Galoiskey<Scheme::CKKS>& galois_key, int depth,
+        const ExecutionOptions& options)
+    {
+        if (!packing_key.packing_key_generated_)
+        {
+            throw std::invalid_argument("Packingkey is not generated!");
+        }
+
+        if (!input.ciphertext_generated_)
+        {
+            throw std::invalid_argument("Ciphertext is not generated!");
+        }
+
+        if (input.n_ != packing_key.lwe_n_)
+        {
+            throw std::invalid_argument(
+                "Ciphertext does not match the Packingkey!");
+        }
+
+        int count = input.shape_;
+        if ((count < 1) || (count > n))
+        {
+            throw std::invalid_argument(
+                "Sample count should be between 1 and the ring size!");
+        }
+
+        if ((depth < 0) || (depth >= Q_size_))
+        {
+            throw std::invalid_argument("Invalid depth!");
+        }
+
+        for (uint32_t galois_elt : lwe_packing_galois_elements())
+        {
+            bool key_exist =
+                (galois_key.storage_type_ == storage_type::DEVICE)
+                    ? (galois_key.device_location_.find(galois_elt) !=
+                       galois_key.device_location_.end())
+                    : (galois_key.host_location_.find(galois_elt) !=
+                       galois_key.host_location_.end());
+            if (!key_exist)
+            {
+                throw std::invalid_argument(
+                    "Galois key is not generated for the packing elements!");
+            }
+        }
+
+        int current_decomp_count = Q_size_ - depth;
+
+        // Q of the output level is the scale of the packed messages.
+        uint32_t torus_remainder = 1;
+        double scale = 1.0;
+        for (int i = 0; i < current_decomp_count; i++)
+        {
+            torus_remainder *= static_cast<uint32_t>(prime_vector_[i].value);
+            scale *= static_cast<double>(prime_vector_[i].value);
+        }
+
+        if (!std::isfinite(scale))
+        {
+            throw std::invalid_argument(
+                "Ciphertext modulus of the depth does not fit in a double!");
+        }
+
+        // floor(Q / 2^32) = (Q - (Q mod 2^32)) / 2^32, divided by N to cancel
+        // the factor N the tree and the trace multiply the messages with.
+        std::vector<Data64> lift_factors(2 * current_decomp_count);
+        for (int i = 0; i < current_decomp_count; i++)
+        {
+            Modulus64 prime = prime_vector_[i];
+            Data64 n_inverse =
+                OPERATOR64::modinv(static_cast<Data64>(n) % prime.value, prime);
+            Data64 power_inverse = OPERATOR64::modinv(
+                (Data64(1) << 32) % prime.value, prime);
+            Data64 remainder =
+                static_cast<Data64>(torus_remainder) % prime.value;
+            Data64 quotient = (prime.value - remainder) % prime.value;
+            quotient = OPERATOR64::mult(quotient, power_inverse, prime);
+
+            lift_factors[i] = OPERATOR64::mult(quotient, n_inverse, prime);
+            lift_factors[current_decomp_count + i] = n_inverse;
+        }
+        DeviceVector<Data64> lift_factors_device(lift_factors, options.stream_);
+
+        gpuntt::ntt_rns_configuration<Data64> cfg_ntt = {
+            .n_power = n_power,
+            .ntt_type = gpuntt::FORWARD,
+            .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+            .zero_padding = false,
+            .stream = options.stream_};
+
+        int tree_height = 0;
+        while ((1 << tree_height) < count)
+        {
+            tree_height++;
+        }
+
+        // NTT(X^(N / 2^h)) for every merge height h.
+        std::vector<DeviceVector<Data64>> monomials;
+        for (int h = 1; h <= tree_height; h++)
+        {
+            std::vector<Data64> monomial(current_decomp_count * n, 0);
+            for (int i = 0; i < current_decomp_count; i++)
+            {
+                monomial[(i * n) + (n >> h)] = 1;
+            }
+
+            DeviceVector<Data64> monomial_device(monomial, options.stream_);
+            gpuntt::GPU_NTT_Inplace(monomial_device.data(), ntt_table_->data(),
+                                    modulus_->data(), cfg_ntt,
+                                    current_decomp_count, current_decomp_count);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+            monomials.push_back(std::move(monomial_device));
+        }
+
+        // Binary counter over the leaves. Leaf p holds sample bitrev(p), so
+        // merging the even and odd halves at every node places sample j in
+        // coefficient j * N / 2^tree_height.
+        struct PackedNode
+        {
+            int height;
+            bool empty;
+            Ciphertext<Scheme::CKKS> cipher;
+        };
+        std::vector<PackedNode> stack;
+
+        input_storage_manager(
+            input,
+            [&](Ciphertext<Scheme::TFHE>& input_)
+            {
+                for (int p = 0; p < (1 << tree_height); p++)
+                {
+                    int index = 0;
+                    for (int b = 0; b < tree_height; b++)
+                    {
+                        index |= ((p >> b) & 1) << (tree_height - 1 - b);
+                    }
+
+                    PackedNode leaf{0, (index >= count),
+                                    Ciphertext<Scheme::CKKS>()};
+                    if (!leaf.empty)
+                    {
+                        leaf.cipher = lwe_packing_ciphertext(depth, scale,
+                                                             options.stream_);
+
+                        tfhe_lwe_to_rlwe_kernel<<<dim3((n >> 8),
+                                                       current_decomp_count, 2),
+                                                  256, 0, options.stream_>>>(
+                            input_.a_device_location_.data(),
+                            input_.b_device_location_.data(),
+                            leaf.cipher.data(), modulus_->data(),
+                            lift_factors_device.data(), torus_remainder, index,
+                            input_.n_, n_power, current_decomp_count);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        gpuntt::GPU_NTT_Inplace(
+                            leaf.cipher.data(), ntt_table_->data(),
+                            modulus_->data(), cfg_ntt, 2 * current_decomp_count,
+                            current_decomp_count);
+                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+                        keyswitch(leaf.cipher, leaf.cipher,
+                                  packing_key.ring_key_, options);
+                    }
+                    stack.push_back(std::move(leaf));
+
+                    while ((stack.size() > 1) &&
+                           (stack[stack.size() - 1].height ==
+                            stack[stack.size() - 2].height))
+                    {
+                        PackedNode odd = std::move(stack.back());
+                        stack.pop_back();
+                        PackedNode& even = stack.back();
+                        int height = even.height + 1;
+
+                        if (even.empty && !odd.empty)
+                        {
+                            even.cipher = lwe_packing_ciphertext(
+                                depth, scale, options.stream_);
+                            cudaMemsetAsync(even.cipher.data(), 0,
+                                            even.cipher.memory_size() *
+                                                sizeof(Data64),
+                                            options.stream_);
+                            HEONGPU_CUDA_CHECK(cudaGetLastError());
+                            even.empty = false;
+                        }
+
+                        if (!even.empty)
+                        {
+                            even.cipher = merge_packed_lwes(
+                                even.cipher, odd.empty ? nullptr : &odd.cipher,
+                                monomials[height - 1], galois_key, height,
+                                options);
+                        }
+                        even.height = height;
+                    }
+                }
+            },
+            options, false);
+
+        Ciphertext<Scheme::CKKS> result = std::move(stack.back().cipher);
+
+        // Field trace: clears every coefficient that is not a multiple of
+        // N / 2^tree_height.
+        for (int h = tree_height + 1; h <= n_power; h++)
+        {
+            Ciphertext<Scheme::CKKS> rotated =
+                lwe_packing_ciphertext(depth, scale, options.stream_);
+            apply_galois(result, rotated, galois_key, (1 << h) + 1, options);
+            add_inplace(result, rotated, options);
+        }
+
+        output = std::move(result);
+
+        if (options.storage_ == storage_type::HOST)
+        {
+            output.store_in_host(options.stream_);
+        }
+    }
+
+    __host__ void HEArithmeticOperator<Scheme::CKKS>::extract_lwe_ciphertexts(
+        Ciphertext<Scheme::CKKS>& input, Ciphertext<Scheme::TFHE>& output,
+        Packingkey<Scheme::CKKS>& packing_key, int count,
+        const ExecutionOptions& options)
+    {
+        if (!packing_key.packing_key_generated_)
+        {
+            throw std::invalid_argument("Packingkey is not generated!");
+        }
+
+        if (!input.ciphertext_generated_)
+        {
+            throw std::invalid_argument("Ciphertext is not generated!");
+        }
+
+        if (input.rescale_required_ || input.relinearization_required_)
+        {
+            throw std::invalid_argument(
+                "Ciphertext can not be extracted before rescale and "
+                "relinearization!");
+        }
+
+        if (output.n_ != packing_key.lwe_n_)
+        {
+            throw std::invalid_argument(
+                "Ciphertext does not match the Packingkey!");
+        }
+
+        if ((count < 1) || (count > n))
+        {
+            throw std::invalid_argument(
+                "Sample count should be between 1 and the ring size!");
+        }
+
+        int current_decomp_count = Q_size_ - input.depth_;
+
+        int tree_height = 0;
+        while ((1 << tree_height) < count)
+        {
+            tree_height++;
+        }
+        int stride = n >> tree_height;
+
+        // ((Q / q_i) mod q_i)^-1
+        std::vector<Data64> crt_inverse(current_decomp_count);
+        for (int i = 0; i < current_decomp_count; i++)
+        {
+            Modulus64 prime = prime_vector_[i];
+            Data64 partial = 1;
+            for (int j = 0; j < current_decomp_count; j++)
+            {
+                if (j != i)
+                {
+                    partial = OPERATOR64::mult(
+                        partial, prime_vector_[j].value % prime.value, prime);
+                }
+            }
+            crt_inverse[i] = OPERATOR64::modinv(partial, prime);
+        }
+        DeviceVector<Data64> crt_inverse_device(crt_inverse, options.stream_);
+
+        DeviceVector<int32_t> torus_cipher(2 * n, options.stream_);
+
+        input_storage_manager(
+            input,
+            [&](Ciphertext<Scheme::CKKS>& input_)
+            {
+                DeviceVector<Data64> coefficients(2 * current_decomp_count * n,
+                                                  options.stream_);
+                if (input_.in_ntt_domain_)
+                {
+                    gpuntt::ntt_rns_configuration<Data64> cfg_intt = {
+                        .n_power = n_power,
+                        .ntt_type = gpuntt::INVERSE,
+                        .reduction_poly = gpuntt::ReductionPolynomial::X_N_plus,
+                        .zero_padding = false,
+                        .mod_inverse = n_inverse_->data(),
+                        .stream = options.stream_};
+
+                    gpuntt::GPU_NTT(input_.data(), coefficients.data(),
+                                    intt_table_->data(), modulus_->data(),
+                                    cfg_intt, 2 * current_decomp_count,
+                                    current_decomp_count);
+                    HEONGPU_CUDA_CHECK(cudaGetLastError());
+                }
+                else
+                {
+                    cudaMemcpyAsync(coefficients.data(), input_.data(),
+                                    coefficients.size() * sizeof(Data64),
+                                    cudaMemcpyDeviceToDevice, options.stream_);
+                    HEONGPU_CUDA_CHECK(cudaGetLastError());
+                }
+
+                rlwe_to_torus_kernel<<<dim3((n >> 8), 2, 1), 256, 0,
+                                       options.stream_>>>(
+                    coefficients.data(), torus_cipher.data(), modulus_->data(),
+                    crt_inverse_device.data(), n_power, current_decomp_count);
+                HEONGPU_CUDA_CHECK(cudaGetLastError());
+            },
+            options, false);
+
+        DeviceVector<int32_t> extracted_a(count * n, options.stream_);
+        DeviceVector<int32_t> extracted_b(count, options.stream_);
+        tfhe_strided_sample_extraction_kernel<<<count, 512, 0,
+                                                options.stream_>>>(
+            torus_cipher.data(), extracted_a.data(), extracted_b.data(), n,
+            stride);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        DeviceVector<int32_t> key_a;
+        DeviceVector<int32_t> key_b;
+        if (packing_key.storage_type_ == storage_type::HOST)
+        {
+            key_a = DeviceVector<int32_t>(
+                packing_key.extraction_key_host_location_a_, options.stream_);
+            key_b = DeviceVector<int32_t>(
+                packing_key.extraction_key_host_location_b_, options.stream_);
+        }
+        const int32_t* key_a_data =
+            (packing_key.storage_type_ == storage_type::HOST)
+                ? key_a.data()
+                : packing_key.extraction_key_device_location_a_.data();
+        const int32_t* key_b_data =
+            (packing_key.storage_type_ == storage_type::HOST)
+                ? key_b.data()
+                : packing_key.extraction_key_device_location_b_.data();
+
+        int lwe_n = packing_key.lwe_n_;
+        output.a_device_location_.resize(count * lwe_n, options.stream_);
+        output.b_device_location_.resize(count, options.stream_);
+
+        tfhe_key_switching_kernel<<<count, 512, 0, options.stream_>>>(
+            extracted_a.data(), extracted_b.data(),
+            output.a_device_location_.data(), output.b_device_location_.data(),
+            key_a_data, key_b_data, packing_key.ks_base_bit_,
+            packing_key.ks_length_, lwe_n, n, 1);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        double ks_variance = packing_key.ks_stdev_ * packing_key.ks_stdev_;
+        output.shape_ = count;
+        output.variances_ = std::vector<double>(
+            count, (n * packing_key.ks_length_ *
+                    ((1 << packing_key.ks_base_bit_) - 1)) *
+                       ks_variance);
+        output.storage_type_ = storage_type::DEVICE;
+        output.ciphertext_generated_ = true;
+
+        if (options.storage_ == storage_type::HOST)
+        {
+            output.store_in_host(options.stream_);
+        }
+    }
+
+    __host__ Ciphertext<Scheme::CKKS>
+    HEArithmeticOperator<Scheme::CKKS>::lwe_packing_ciphertext(
+        int depth, double scale, cudaStream_t stream)
+    {
+        Ciphertext<Scheme::CKKS> cipher;
+
+        cipher.coeff_modulus_count_ = Q_size_;
+        cipher.cipher_size_ = 2;
+        cipher.ring_size_ = n;
+        cipher.depth_ = depth;
+
+        cipher.scheme_ = scheme_;
+        cipher.in_ntt_domain_ = true;
+        cipher.storage_type_ = storage_type::DEVICE;
+
+        cipher.rescale_required_ = false;
+        cipher.relinearization_required_ = false;
+        cipher.scale_ = scale;
+        cipher.slot_count_ = slot_count_;
+        cipher.ciphertext_generated_ = true;
+
+        cipher.device_locations_ =
+            DeviceVector<Data64>(2 * (Q_size_ - depth) * n, stream);
+
+        return cipher;
+    }
+
+    __host__ Ciphertext<Scheme::CKKS>
+    HEArithmeticOperator<Scheme::CKKS>::merge_packed_lwes(
+        Ciphertext<Scheme::CKKS>& even, Ciphertext<Scheme::CKKS>* odd,
+        DeviceVector<Data64>& monomial, Galoiskey<Scheme::CKKS>& galois_key,
+        int height, const ExecutionOptions& options)
+    {
+        int galois_elt = (1 << height) + 1;
+
+        // (even + X^k * odd) + tau(even - X^k * odd) with k = N / 2^height;
+        // an empty odd side leaves even + tau(even).
+        Ciphertext<Scheme::CKKS> sum =
+            lwe_packing_ciphertext(even.depth_, even.scale_, options.stream_);
+        Ciphertext<Scheme::CKKS> difference =
+            lwe_packing_ciphertext(even.depth_, even.scale_, options.stream_);
+
+        if (odd == nullptr)
+        {
+            apply_galois(even, difference, galois_key, galois_elt, options);
+            add(even, difference, sum, options);
+
+            return sum;
+        }
+
+        int current_decomp_count = Q_size_ - even.depth_;
+        lwe_packing_butterfly_kernel<<<dim3((n >> 8), current_decomp_count, 2),
+                                       256, 0, options.stream_>>>(
+            even.data(), odd->data(), monomial.data(), sum.data(),
+            difference.data(), modulus_->data(), n_power,
+            current_decomp_count);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        Ciphertext<Scheme::CKKS> rotated =
+            lwe_packing_ciphertext(even.depth_, even.scale_, options.stream_);
+        apply_galois(difference, rotated, galois_key, galois_elt, options);
+        add_inplace(sum, rotated, options);
+
+        return sum;
+    }
+
+    HELogicOperator<Scheme::CKKS>::HELogicOperator(
+        HEContext<Scheme::CKKS>& context, HEEncoder<Scheme::CKKS>& encoder,
+        double scale)
+        : HEOperator<Scheme::CKKS>(context, encoder)
+    {
+        if (scale == 0.0)
+        {
+            throw std::invalid_argument(
+                "Scale can not be zero for CKKS Scheme");
+        }
+
+        double constant_1 = 1.0;
+        encoded_constant_one_ = encoded_constant(constant_1, 0, scale);
+    }
+
+    __host__ void HELogicOperator<Scheme::CKKS>::generate_bootstrapping_params(
+        const double scale, const BootstrappingConfig& config,
+        const logic_bootstrapping_type& boot_type)
+    {
+        if (!boot_context_generated_)
+        {
+            int division = static_cast<int>(
+                round(static_cast<double>(prime_vector_[0].value) / scale));
+
+            switch (static_cast<int>(boot_type))
+            {
+                case 1: // BIT_BOOTSTRAPPING
+                    if ((division != 2))
+                    {
+                        throw std::invalid_argument(
+                            "Bootstrapping parameters can not be generated, "
+                            "because of context is not suitable for Bit "
+                            "Bootstrapping. Last modulus should be 2*scale!");
+                    }
+                    break;
+                case 2: // GATE_BOOTSTRAPPING
+                    if ((division != 3))
+                    {
+                        throw std::invalid_argument(
+                            "Bootstrapping parameters can not be generated, "
+                            "because of context is not suitable for Gate "
+                            "Bootstrapping. Last modulus should be 3*scale!");
+                    }
+
+                    break;
+                default:
+                    throw std::invalid_argument("Invalid Key Switching Type");
+                    break;
+            }
+
+            /*
+            enum class logic_bootstrapping_type : std::uint8_t
+            {
+                NONE = 0x0,
+                BIT_BOOTSTRAPPING = 0x1, // scale = q0 / 2. More detail:
+                                        // https://eprint.iacr.org/2024/767.pdf
+                GATE_BOOTSTRAPPING = 0x2, // scale = q0 / 3. More detail:
+                                        // https://eprint.iacr.org/2024/767.pdf
+            };
+            */
+
+            scale_boot_ = scale;
+            CtoS_piece_ = config.CtoS_piece_;
+            StoC_piece_ = config.StoC_piece_;
+            taylor_number_ = config.taylor_number_;
+            less_key_mode_ = config.less_key_mode_;
+
+            if ((config.slot_count_ != 0) && (config.slot_count_ != (n >> 1)))
+            {
+                throw std::invalid_argument(
+                    "Sparse slot packing is not supported by logic "
+                    "bootstrapping!");
+            }
+            boot_slot_count_ = n >> 1;
+            boot_log_slot_count_ = log_slot_count_;
+
+            // TODO: remove it!
+            bool use_all_bases = false; // Do not change it!
+
+            Vandermonde matrix_gen(n, boot_slot_count_, CtoS_piece_,
+                                   StoC_piece_, less_key_mode_);
+
+            V_matrixs_rotated_encoded_ =
+                encode_V_matrixs(matrix_gen, scale_boot_, use_all_bases);
+            V_inv_matrixs_rotated_encoded_ =
+                encode_V_inv_matrixs(matrix_gen, scale_boot_, use_all_bases);
+
+            V_matrixs_index_ = matrix_gen.V_matrixs_index_;
+            V_inv_matrixs_index_ = matrix_gen.V_inv_matrixs_index_;
+
+            diags_matrices_bsgs_ = matrix_gen.diags_matrices_bsgs_;
+            diags_matrices_inv_bsgs_ = matrix_gen.diags_matrices_inv_bsgs_;
+
+            if (less_key_mode_)
+            {
+                real_shift_n2_bsgs_ = matrix_gen.real_shift_n2_bsgs_;
+                real_shift_n2_inv_bsgs_ = matrix_gen.real_shift_n2_inv_bsgs_;
+            }
+
+            key_indexs_ = matrix_gen.key_indexs_;
+
+            // Pre-computed encoded parameters
+            // CtoS
+            double constant_1over2 = 0.5;
+            encoded_constant_1over2_ =
+                encoded_constant(constant_1over2, 0, scale_boot_);
+
+            Complex64 complex_minus_iover2(0.0, -0.5);
+            encoded_complex_minus_iover2_ =
+                encoded_constant(complex_minus_iover2, 0, scale_boot_);
+
+            // StoC
+            Complex64 complex_i(0.0, 1.0);
+            encoded_complex_i_ = encoded_constant(complex_i, 0, scale_boot_);
+
+            // Scale part
+            Complex64 complex_minus_iscale(
+                0.0, -(((static_cast<double>(prime_vector_[0].value) * 0.25) /
+                        (scale_boot_ * M_PI))));
+            encoded_complex_minus_iscale_ =
+                encoded_constant(complex_minus_iscale, 0, scale_boot_);
+
+            // Exponentiate
+            Complex64 complex_iscaleoverr(
+                0.0, (((2 * M_PI * scale_boot_) /
+                       static_cast<double>(prime_vector_[0].value))) /
+                         static_cast<double>(1 << taylor_number_));
+            encoded_complex_iscaleoverr_ =
+                encoded_constant(complex_iscaleoverr, 0, scale_boot_);
+
+            // Sinus taylor
+            double constant_1 = 1.0;
+            encoded_constant_1_ = encoded_constant(constant_1, 0, scale_boot_);
+
+            double constant_1over6 = 1.0 / 6.0;
+            encoded_constant_1over6_ =
+                encoded_constant(constant_1over6, 0, scale_boot_);
+
+            double constant_1over24 = 1.0 / 24.0;
+            encoded_constant_1over24_ =
+                encoded_constant(constant_1over24, 0, scale_boot_);
+
+            double constant_1over120 = 1.0 / 120.0;
+            encoded_constant_1over120_ =
+                encoded_constant(constant_1over120, 0, scale_boot_);
+
+            double constant_1over720 = 1.0 / 720.0;
+            encoded_constant_1over720_ =
+                encoded_constant(constant_1over720, 0, scale_boot_);
+
+            double constant_1over5040 = 1.0 / 5040.0;
+            encoded_constant_1over5040_ =
+                encoded_constant(constant_1over5040, 0, scale_boot_);
+
+            // Bit bootstrapping
+            double constant_minus_1over4 = -0.25;
+            encoded_constant_minus_1over4_ =
+                encoded_constant(constant_minus_1over4, 0, scale_boot_);
+
+            // Gate bootstrapping
+            double constant_1over3_ = 1.0 / 3.0;
+            encoded_constant_1over3_ =
+                encoded_constant(constant_1over3_, 0, scale_boot_);
+
+            double constant_2over3_ = 2.0 / 3.0;
+            encoded_constant_2over3_ =
+                encoded_constant(constant_2over3_, 0, scale_boot_);
+
+            Complex64 complex_minus_2over6j_(0.0, (1.0 / 3.0));
+            encoded_complex_minus_2over6j_ =
+                encoded_constant(complex_minus_2over6j_, 0, scale_boot_);
+
+            double constant_minus_2over6_ = -(1.0 / 3.0);
+            encoded_constant_minus_2over6_ =
+                encoded_constant(constant_minus_2over6_, 0, scale_boot_);
+
+            Complex64 complex_2over6j_(0.0, (-1.0 / 3.0));
+            encoded_complex_2over6j_ =
+                encoded_constant(complex_2over6j_, 0, scale_boot_);
+
+            double constant_2over6_ = 1.0 / 3.0;
+            encoded_constant_2over6_ =
+                encoded_constant(constant_2over6_, 0, scale_boot_);
+
+            double constant_pioversome_ =
+                prime_vector_[0].value / (12.0 * scale_boot_);
+            encoded_constant_pioversome_ =
+                encoded_constant(constant_pioversome_, 0, scale_boot_);
+
+            double constant_minus_pioversome_ =
+                -((prime_vector_[0].value) / (12.0 * scale_boot_));
+            encoded_constant_minus_pioversome_ =
+                encoded_constant(constant_minus_pioversome_, 0, scale_boot_);
 
             boot_context_generated_ = true;
         }
@@ -4476,7 +5921,7 @@ namespace heongpu
         cipherplain_multiplication_kernel<<<dim3((n >> 8), current_decomp_count,
                                                  2),
                                             256, 0, options_inner.stream_>>>(
-            ciph_cos.data(), encoded_constant_minus_1over4_.data(),
+            ciph_cos.data(), encoded_constant_minus_1over4_->data(),
             ciph_cos.data(), modulus_->data(), n_power);
         ciph_cos.scale_ = ciph_cos.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -4490,7 +5935,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - ciph_cos.depth_;
         addition_plain_ckks_poly<<<dim3((n >> 8), current_decomp_count, 2), 256,
                                    0, options_inner.stream_>>>(
-            ciph_cos.data(), encoded_constant_1over2_.data(), result.data(),
+            ciph_cos.data(), encoded_constant_1over2_->data(), result.data(),
             modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
@@ -4639,7 +6084,7 @@ namespace heongpu
         int current_decomp_count = Q_size_ - cipher.depth_;
         addition_plain_ckks_poly<<<dim3((n >> 8), current_decomp_count, 2), 256,
                                    0, options.stream_>>>(
-            cipher.data(), encoded_constant_pioversome_.data(),
+            cipher.data(), encoded_constant_pioversome_->data(),
             cipher_add.data(), modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
@@ -4671,7 +6116,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - ciph_sin.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            ciph_sin.data(), encoded_complex_minus_2over6j_.data(),
+            ciph_sin.data(), encoded_complex_minus_2over6j_->data(),
             ciph_sin.data(), modulus_->data(), n_power);
         ciph_sin.scale_ = ciph_sin.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -4685,7 +6130,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - ciph_sin.depth_;
         addition_plain_ckks_poly<<<dim3((n >> 8), current_decomp_count, 2), 256,
                                    0, options.stream_>>>(
-            ciph_sin.data(), encoded_constant_1over3_.data(), result.data(),
+            ciph_sin.data(), encoded_constant_1over3_->data(), result.data(),
             modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
@@ -4725,7 +6170,7 @@ namespace heongpu
         int current_decomp_count = Q_size_ - ciph_sin.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            ciph_sin.data(), encoded_constant_minus_2over6_.data(),
+            ciph_sin.data(), encoded_constant_minus_2over6_->data(),
             ciph_sin.data(), modulus_->data(), n_power);
         ciph_sin.scale_ = ciph_sin.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -4739,7 +6184,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - ciph_sin.depth_;
         addition_plain_ckks_poly<<<dim3((n >> 8), current_decomp_count, 2), 256,
                                    0, options.stream_>>>(
-            ciph_sin.data(), encoded_constant_2over3_.data(), result.data(),
+            ciph_sin.data(), encoded_constant_2over3_->data(), result.data(),
             modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
@@ -4770,7 +6215,7 @@ namespace heongpu
         int current_decomp_count = Q_size_ - cipher.depth_;
         addition_plain_ckks_poly<<<dim3((n >> 8), current_decomp_count, 2), 256,
                                    0, options.stream_>>>(
-            cipher.data(), encoded_constant_minus_pioversome_.data(),
+            cipher.data(), encoded_constant_minus_pioversome_->data(),
             cipher_add.data(), modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
@@ -4802,7 +6247,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - ciph_sin.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            ciph_sin.data(), encoded_complex_2over6j_.data(), ciph_sin.data(),
+            ciph_sin.data(), encoded_complex_2over6j_->data(), ciph_sin.data(),
             modulus_->data(), n_power);
         ciph_sin.scale_ = ciph_sin.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -4816,7 +6261,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - ciph_sin.depth_;
         addition_plain_ckks_poly<<<dim3((n >> 8), current_decomp_count, 2), 256,
                                    0, options.stream_>>>(
-            ciph_sin.data(), encoded_constant_1over3_.data(), result.data(),
+            ciph_sin.data(), encoded_constant_1over3_->data(), result.data(),
             modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
@@ -4847,7 +6292,7 @@ namespace heongpu
         int current_decomp_count = Q_size_ - cipher.depth_;
         addition_plain_ckks_poly<<<dim3((n >> 8), current_decomp_count, 2), 256,
                                    0, options.stream_>>>(
-            cipher.data(), encoded_constant_pioversome_.data(),
+            cipher.data(), encoded_constant_pioversome_->data(),
             cipher_add.data(), modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
@@ -4879,7 +6324,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - ciph_sin.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            ciph_sin.data(), encoded_complex_2over6j_.data(), ciph_sin.data(),
+            ciph_sin.data(), encoded_complex_2over6j_->data(), ciph_sin.data(),
             modulus_->data(), n_power);
         ciph_sin.scale_ = ciph_sin.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -4893,7 +6338,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - ciph_sin.depth_;
         addition_plain_ckks_poly<<<dim3((n >> 8), current_decomp_count, 2), 256,
                                    0, options.stream_>>>(
-            ciph_sin.data(), encoded_constant_2over3_.data(), result.data(),
+            ciph_sin.data(), encoded_constant_2over3_->data(), result.data(),
             modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
@@ -4933,7 +6378,7 @@ namespace heongpu
         int current_decomp_count = Q_size_ - ciph_sin.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            ciph_sin.data(), encoded_constant_2over6_.data(), ciph_sin.data(),
+            ciph_sin.data(), encoded_constant_2over6_->data(), ciph_sin.data(),
             modulus_->data(), n_power);
         ciph_sin.scale_ = ciph_sin.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -4947,7 +6392,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - ciph_sin.depth_;
         addition_plain_ckks_poly<<<dim3((n >> 8), current_decomp_count, 2), 256,
                                    0, options.stream_>>>(
-            ciph_sin.data(), encoded_constant_1over3_.data(), result.data(),
+            ciph_sin.data(), encoded_constant_1over3_->data(), result.data(),
             modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
@@ -4978,7 +6423,7 @@ namespace heongpu
         int current_decomp_count = Q_size_ - cipher.depth_;
         addition_plain_ckks_poly<<<dim3((n >> 8), current_decomp_count, 2), 256,
                                    0, options.stream_>>>(
-            cipher.data(), encoded_constant_minus_pioversome_.data(),
+            cipher.data(), encoded_constant_minus_pioversome_->data(),
             cipher_add.data(), modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
@@ -5010,7 +6455,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - ciph_sin.depth_;
         cipherplain_multiplication_kernel<<<
             dim3((n >> 8), current_decomp_count, 2), 256, 0, options.stream_>>>(
-            ciph_sin.data(), encoded_complex_minus_2over6j_.data(),
+            ciph_sin.data(), encoded_complex_minus_2over6j_->data(),
             ciph_sin.data(), modulus_->data(), n_power);
         ciph_sin.scale_ = ciph_sin.scale_ * scale_boot_;
         HEONGPU_CUDA_CHECK(cudaGetLastError());
@@ -5024,7 +6469,7 @@ namespace heongpu
         current_decomp_count = Q_size_ - ciph_sin.depth_;
         addition_plain_ckks_poly<<<dim3((n >> 8), current_decomp_count, 2), 256,
                                    0, options.stream_>>>(
-            ciph_sin.data(), encoded_constant_2over3_.data(), result.data(),
+            ciph_sin.data(), encoded_constant_2over3_->data(), result.data(),
             modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
@@ -5054,7 +6499,7 @@ namespace heongpu
 
         addition_plain_ckks_poly<<<dim3((n >> 8), current_decomp_count, 2), 256,
                                    0, options.stream_>>>(
-            input1.data(), encoded_constant_one_.data(), output.data(),
+            input1.data(), encoded_constant_one_->data(), output.data(),
             modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
     }
@@ -5069,7 +6514,7 @@ namespace heongpu
 
         addition<<<dim3((n >> 8), current_decomp_count, 1), 256, 0,
                    options.stream_>>>(input1.data(),
-                                      encoded_constant_one_.data(),
+                                      encoded_constant_one_->data(),
                                       input1.data(), modulus_->data(), n_power);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
     }
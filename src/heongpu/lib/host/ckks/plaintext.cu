@@ -20,6 +20,7 @@ namespace heongpu
         plain_size_ = context.n;
         depth_ = 0;
         scale_ = 0;
+        slot_count_ = context.n >> 1;
         storage_type_ = options.storage_;
     }
 
@@ -92,7 +93,7 @@ namespace heongpu
     {
         if (plaintext_generated_)
         {
-            os.write((char*) &scheme_, sizeof(scheme_));
+            serialformat::write_header(os, scheme_);
 
             os.write((char*) &plain_size_, sizeof(plain_size_));
 
@@ -100,6 +101,8 @@ namespace heongpu
 
             os.write((char*) &scale_, sizeof(scale_));
 
+            os.write((char*) &slot_count_, sizeof(slot_count_));
+
             os.write((char*) &in_ntt_domain_, sizeof(in_ntt_domain_));
 
             os.write((char*) &plaintext_generated_,
@@ -138,7 +141,7 @@ namespace heongpu
     {
         if ((!plaintext_generated_))
         {
-            is.read((char*) &scheme_, sizeof(scheme_));
+            uint32_t version = serialformat::read_header(is, scheme_);
 
             if (scheme_ != scheme_type::ckks)
             {
@@ -151,6 +154,15 @@ namespace heongpu
 
             is.read((char*) &scale_, sizeof(scale_));
 
+            // Legacy streams predate sparse packing and carry no ring size,
+            // so they keep the n / 2 slots set by the context constructor. A
+            // default-constructed plaintext stays at 0, which the encoder and
+            // encryptor read as fully packed.
+            if (version >= 1)
+            {
+                is.read((char*) &slot_count_, sizeof(slot_count_));
+            }
+
             is.read((char*) &in_ntt_domain_, sizeof(in_ntt_domain_));
 
             is.read((char*) &plaintext_generated_,
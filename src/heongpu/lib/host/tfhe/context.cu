@@ -8,12 +8,171 @@
 namespace heongpu
 {
     HEContext<Scheme::TFHE>::HEContext()
+        : HEContext(tfhe_parameter_set::LWE512_K1,
+                    tfhe_decomposition_profile::THROUGHPUT)
+    {
+        sec_level_ = sec_level_type::sec128;
+    }
+
+    HEContext<Scheme::TFHE>::HEContext(
+        const tfhe_parameter_set parameter_set,
+        const tfhe_decomposition_profile profile,
+        const tfhe_blind_rotation_type blind_rotation)
+        : HEContext(get_parameter_set(parameter_set, profile, blind_rotation))
+    {
+        decomposition_profile_ = profile;
+    }
+
+    HEContext<Scheme::TFHE>::HEContext(const TFHEParameters& parameters)
     {
         // Memory pool initialization
         MemoryPool::instance().initialize();
         MemoryPool::instance().use_memory_pool(true);
         cudaDeviceSynchronize();
 
+        decomposition_profile_ = tfhe_decomposition_profile::NONE;
+        set_parameters(parameters);
+    }
+
+    TFHEParameters
+    HEContext<Scheme::TFHE>::get_parameter_set(
+        const tfhe_parameter_set parameter_set,
+        const tfhe_decomposition_profile profile,
+        const tfhe_blind_rotation_type blind_rotation)
+    {
+        if ((profile != tfhe_decomposition_profile::BALANCED) &&
+            (profile != tfhe_decomposition_profile::THROUGHPUT))
+        {
+            throw std::invalid_argument(
+                "Invalid TFHE decomposition profile!");
+        }
+
+        bool throughput = (profile == tfhe_decomposition_profile::THROUGHPUT);
+        double sqrt_two_over_pi = std::sqrt(2.0 / M_PI);
+
+        TFHEParameters parameters;
+        // No estimator output backs these sets, so no level is claimed.
+        parameters.sec_level = sec_level_type::none;
+        parameters.N = 1024;
+        parameters.max_stdev = (1.0 / 64.0) * sqrt_two_over_pi;
+        parameters.blind_rotation = blind_rotation;
+
+        switch (parameter_set)
+        {
+            case tfhe_parameter_set::LWE512_K1:
+                parameters.n = 512;
+                parameters.k = 1;
+                parameters.bk_l = throughput ? 2 : 3;
+                parameters.bk_bg_bit = throughput ? 10 : 7;
+                parameters.ks_base_bit = 2;
+                parameters.ks_length = 8;
+                parameters.ks_stdev = std::pow(2.0, -15) * sqrt_two_over_pi;
+                parameters.bk_stdev = (9e-9) * sqrt_two_over_pi;
+                break;
+            case tfhe_parameter_set::LWE768_K2:
+                parameters.n = 768;
+                parameters.k = 2;
+                parameters.bk_l = throughput ? 2 : 3;
+                parameters.bk_bg_bit = throughput ? 11 : 8;
+                parameters.ks_base_bit = 2;
+                parameters.ks_length = 9;
+                parameters.ks_stdev = std::pow(2.0, -17) * sqrt_two_over_pi;
+                parameters.bk_stdev = std::pow(2.0, -28) * sqrt_two_over_pi;
+                break;
+            case tfhe_parameter_set::LWE1024_K2:
+                parameters.n = 1024;
+                parameters.k = 2;
+                parameters.bk_l = throughput ? 2 : 3;
+                parameters.bk_bg_bit = throughput ? 11 : 8;
+                parameters.ks_base_bit = 2;
+                parameters.ks_length = 10;
+                parameters.ks_stdev = std::pow(2.0, -20) * sqrt_two_over_pi;
+                parameters.bk_stdev = std::pow(2.0, -31) * sqrt_two_over_pi;
+                break;
+            default:
+                throw std::invalid_argument(
+                    "Invalid TFHE parameter set; use TFHEParameters for "
+                    "custom parameters!");
+        }
+
+        return parameters;
+    }
+
+    TFHEParameters HEContext<Scheme::TFHE>::get_parameters() const
+    {
+        TFHEParameters parameters;
+        parameters.sec_level = sec_level_;
+        parameters.n = n_;
+        parameters.N = N_;
+        parameters.k = k_;
+        parameters.bk_l = bk_l_;
+        parameters.bk_bg_bit = bk_bg_bit_;
+        parameters.ks_base_bit = ks_base_bit_;
+        parameters.ks_length = ks_length_;
+        parameters.ks_stdev = ks_stdev_;
+        parameters.bk_stdev = bk_stdev_;
+        parameters.max_stdev = max_stdev_;
+        parameters.blind_rotation = blind_rotation_;
+
+        return parameters;
+    }
+
+    void HEContext<Scheme::TFHE>::check_parameters(
+        const TFHEParameters& parameters) const
+    {
+        if (parameters.N != 1024)
+        {
+            throw std::invalid_argument(
+                "TFHE polynomial degree N has to be 1024!");
+        }
+
+        if ((parameters.n < 1) || (parameters.n > 1024))
+        {
+            throw std::invalid_argument(
+                "TFHE LWE dimension n has to be in [1, 1024]!");
+        }
+
+        if (parameters.k < 1)
+        {
+            throw std::invalid_argument(
+                "TFHE mask size k has to be at least 1!");
+        }
+
+        if ((parameters.bk_l < 1) || (parameters.bk_bg_bit < 1) ||
+            ((parameters.bk_l * parameters.bk_bg_bit) > 32))
+        {
+            throw std::invalid_argument(
+                "TFHE bootstrapping key decomposition has to fit in 32 bits!");
+        }
+
+        if ((parameters.ks_base_bit < 1) || (parameters.ks_length < 1) ||
+            ((parameters.ks_base_bit * parameters.ks_length) > 31))
+        {
+            throw std::invalid_argument(
+                "TFHE key switching decomposition has to fit in 31 bits!");
+        }
+
+        if ((parameters.ks_stdev <= 0.0) || (parameters.bk_stdev <= 0.0) ||
+            (parameters.max_stdev <= 0.0))
+        {
+            throw std::invalid_argument(
+                "TFHE standard deviations have to be positive!");
+        }
+
+        if ((parameters.blind_rotation != tfhe_blind_rotation_type::NTT) &&
+            (parameters.blind_rotation != tfhe_blind_rotation_type::FFT))
+        {
+            throw std::invalid_argument("Invalid TFHE blind rotation type!");
+        }
+    }
+
+    void
+    HEContext<Scheme::TFHE>::set_parameters(const TFHEParameters& parameters)
+    {
+        check_parameters(parameters);
+
+        sec_level_ = parameters.sec_level;
+
         prime_ = Modulus64(1152921504606877697ULL);
         Data64 psi = 1689264667710614ULL;
         Data64 psi_inv = OPERATOR64::modinv(psi, prime_);
@@ -27,21 +186,36 @@ namespace heongpu
 
         n_inverse_ = OPERATOR64::modinv(1024, prime_);
 
-        ks_base_bit_ = 2;
-        ks_length_ = 8;
+        blind_rotation_ = parameters.blind_rotation;
 
-        double sqrt_two_over_pi = std::sqrt(2.0 / M_PI);
-        ks_stdev_ = (1.0 / 32768.0) * sqrt_two_over_pi;
-        bk_stdev_ = (9e-9) * sqrt_two_over_pi;
-        max_stdev_ = (1.0 / 64.0) * sqrt_two_over_pi;
+        if (blind_rotation_ == tfhe_blind_rotation_type::FFT)
+        {
+            TorusFFT fft(parameters.N);
+            fft_root_table_ =
+                std::make_shared<DeviceVector<double>>(fft.root_table());
+            fft_twist_table_ =
+                std::make_shared<DeviceVector<double>>(fft.twist_table());
+        }
+        else
+        {
+            fft_root_table_.reset();
+            fft_twist_table_.reset();
+        }
 
-        n_ = 512;
+        ks_base_bit_ = parameters.ks_base_bit;
+        ks_length_ = parameters.ks_length;
 
-        N_ = 1024;
-        k_ = 1;
+        ks_stdev_ = parameters.ks_stdev;
+        bk_stdev_ = parameters.bk_stdev;
+        max_stdev_ = parameters.max_stdev;
 
-        bk_l_ = 2;
-        bk_bg_bit_ = 10;
+        n_ = parameters.n;
+
+        N_ = parameters.N;
+        k_ = parameters.k;
+
+        bk_l_ = parameters.bk_l;
+        bk_bg_bit_ = parameters.bk_bg_bit;
         bg_ = 1 << bk_bg_bit_;
         half_bg_ = bg_ >> 1;
         mask_mod_ = bg_ - 1;
@@ -50,6 +224,99 @@ namespace heongpu
         offset_ = compute_offset(bk_l_, bk_bg_bit_, half_bg_);
     }
 
+    void HEContext<Scheme::TFHE>::save(std::ostream& os) const
+    {
+        TFHEParameters parameters = get_parameters();
+
+        serialformat::write_header(os, scheme_);
+
+        os.write((char*) &decomposition_profile_,
+                 sizeof(decomposition_profile_));
+
+        os.write((char*) &parameters.sec_level, sizeof(parameters.sec_level));
+
+        os.write((char*) &parameters.n, sizeof(parameters.n));
+
+        os.write((char*) &parameters.N, sizeof(parameters.N));
+
+        os.write((char*) &parameters.k, sizeof(parameters.k));
+
+        os.write((char*) &parameters.bk_l, sizeof(parameters.bk_l));
+
+        os.write((char*) &parameters.bk_bg_bit, sizeof(parameters.bk_bg_bit));
+
+        os.write((char*) &parameters.ks_base_bit,
+                 sizeof(parameters.ks_base_bit));
+
+        os.write((char*) &parameters.ks_length, sizeof(parameters.ks_length));
+
+        os.write((char*) &parameters.ks_stdev, sizeof(parameters.ks_stdev));
+
+        os.write((char*) &parameters.bk_stdev, sizeof(parameters.bk_stdev));
+
+        os.write((char*) &parameters.max_stdev, sizeof(parameters.max_stdev));
+
+        os.write((char*) &parameters.blind_rotation,
+                 sizeof(parameters.blind_rotation));
+    }
+
+    void HEContext<Scheme::TFHE>::load(std::istream& is)
+    {
+        scheme_type scheme;
+        uint32_t version = serialformat::read_header(is, scheme);
+
+        if (scheme != scheme_type::tfhe)
+        {
+            throw std::runtime_error("Stream does not hold a TFHE context!");
+        }
+
+        tfhe_decomposition_profile profile;
+        is.read((char*) &profile, sizeof(profile));
+
+        TFHEParameters parameters;
+
+        is.read((char*) &parameters.sec_level, sizeof(parameters.sec_level));
+
+        is.read((char*) &parameters.n, sizeof(parameters.n));
+
+        is.read((char*) &parameters.N, sizeof(parameters.N));
+
+        is.read((char*) &parameters.k, sizeof(parameters.k));
+
+        is.read((char*) &parameters.bk_l, sizeof(parameters.bk_l));
+
+        is.read((char*) &parameters.bk_bg_bit, sizeof(parameters.bk_bg_bit));
+
+        is.read((char*) &parameters.ks_base_bit,
+                sizeof(parameters.ks_base_bit));
+
+        is.read((char*) &parameters.ks_length, sizeof(parameters.ks_length));
+
+        is.read((char*) &parameters.ks_stdev, sizeof(parameters.ks_stdev));
+
+        is.read((char*) &parameters.bk_stdev, sizeof(parameters.bk_stdev));
+
+        is.read((char*) &parameters.max_stdev, sizeof(parameters.max_stdev));
+
+        if (version >= 1)
+        {
+            is.read((char*) &parameters.blind_rotation,
+                    sizeof(parameters.blind_rotation));
+        }
+        else
+        {
+            parameters.blind_rotation = tfhe_blind_rotation_type::NTT;
+        }
+
+        if (!is)
+        {
+            throw std::runtime_error("Failed to read the TFHE context!");
+        }
+
+        set_parameters(parameters);
+        decomposition_profile_ = profile;
+    }
+
     std::vector<int> HEContext<Scheme::TFHE>::compute_h(int l, int bg_bit)
     {
         std::vector<int> h(l);
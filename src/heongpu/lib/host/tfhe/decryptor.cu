@@ -20,6 +20,19 @@ namespace heongpu
     HEDecryptor<Scheme::TFHE>::decrypt_lwe(std::vector<bool>& messages,
                                            Ciphertext<Scheme::TFHE>& ciphertext,
                                            const cudaStream_t stream)
+    {
+        std::vector<int32_t> messages_encoded =
+            decrypt_lwe_phase(ciphertext, stream);
+
+        messages.resize(ciphertext.shape_);
+        for (int i = 0; i < ciphertext.shape_; i++)
+        {
+            messages[i] = (messages_encoded[i] > 0);
+        }
+    }
+
+    __host__ std::vector<int32_t> HEDecryptor<Scheme::TFHE>::decrypt_lwe_phase(
+        Ciphertext<Scheme::TFHE>& ciphertext, const cudaStream_t stream)
     {
         const int THREADS = 512;
         int block_count = ciphertext.shape_;
@@ -39,11 +52,7 @@ namespace heongpu
                    ciphertext.shape_ * sizeof(int32_t), cudaMemcpyDeviceToHost);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
-        messages.resize(ciphertext.shape_);
-        for (int i = 0; i < ciphertext.shape_; i++)
-        {
-            messages[i] = (messages_encoded[i] > 0);
-        }
+        return messages_encoded;
     }
 
 } // namespace heongpu
\ No newline at end of file
@@ -14,6 +14,7 @@ namespace heongpu
         bk_base_bit_ = context.bk_bg_bit_;
         bk_length_ = context.bk_l_;
         bk_stdev_ = context.bk_stdev_;
+        blind_rotation_ = context.blind_rotation_;
 
         ks_length_ = context.ks_length_;
         ks_base_bit_ = context.ks_base_bit_;
@@ -21,6 +21,9 @@ namespace heongpu
         intt_table_ = context.intt_table_;
         n_inverse_ = context.n_inverse_;
 
+        fft_root_table_ = context.fft_root_table_;
+        fft_twist_table_ = context.fft_twist_table_;
+
         ks_base_bit_ = context.ks_base_bit_;
         ks_length_ = context.ks_length_;
 
@@ -57,7 +60,8 @@ namespace heongpu
             {
                 sk.lwe_key_device_location_.resize(n_);
 
-                tfhe_secretkey_gen_kernel<<<1, 512, 0, options.stream_>>>(
+                tfhe_secretkey_gen_kernel<<<((n_ + 511) >> 9), 512, 0,
+                                            options.stream_>>>(
                     sk.lwe_key_device_location_.data(), n_, rng_seed_);
                 HEONGPU_CUDA_CHECK(cudaGetLastError());
 
@@ -65,7 +69,7 @@ namespace heongpu
 
                 tfhe_secretkey_gen_kernel<<<(k_ * (N_ >> 9)), 512, 0,
                                             options.stream_>>>(
-                    sk.tlwe_key_device_location_.data(), n_, rng_seed_);
+                    sk.tlwe_key_device_location_.data(), k_ * N_, rng_seed_);
                 HEONGPU_CUDA_CHECK(cudaGetLastError());
                 sk.storage_type_ = storage_type::DEVICE;
             },
@@ -88,6 +92,14 @@ namespace heongpu
             throw std::logic_error("Bootkey is already generated!");
         }
 
+        if ((bk.blind_rotation_ == tfhe_blind_rotation_type::FFT) &&
+            !fft_root_table_)
+        {
+            throw std::invalid_argument(
+                "FFT bootstrapping key needs a context with FFT blind "
+                "rotation!");
+        }
+
         input_storage_manager(
             sk,
             [&](Secretkey<Scheme::TFHE>& sk_)
@@ -139,13 +151,27 @@ namespace heongpu
 
                         bk.boot_key_device_location_.resize(total_bootkey_size,
                                                             options.stream_);
-                        tfhe_convert_bootkey_ntt_domain_kernel<<<
-                            bk_n, 512, sizeof(Data64) * bk_N,
-                            options.stream_>>>(
-                            bk.boot_key_device_location_.data(),
-                            temp_boot_key.data(), ntt_table_->data(), prime_,
-                            bk_N, bk_k, bk_length);
-                        HEONGPU_CUDA_CHECK(cudaGetLastError());
+                        if (bk.blind_rotation_ == tfhe_blind_rotation_type::FFT)
+                        {
+                            tfhe_convert_bootkey_fft_domain_kernel<<<
+                                bk_n, 512, 0, options.stream_>>>(
+                                reinterpret_cast<double*>(
+                                    bk.boot_key_device_location_.data()),
+                                temp_boot_key.data(), fft_root_table_->data(),
+                                fft_twist_table_->data(), bk_N, bk_k,
+                                bk_length);
+                            HEONGPU_CUDA_CHECK(cudaGetLastError());
+                        }
+                        else
+                        {
+                            tfhe_convert_bootkey_ntt_domain_kernel<<<
+                                bk_n, 512, sizeof(Data64) * bk_N,
+                                options.stream_>>>(
+                                bk.boot_key_device_location_.data(),
+                                temp_boot_key.data(), ntt_table_->data(),
+                                prime_, bk_N, bk_k, bk_length);
+                            HEONGPU_CUDA_CHECK(cudaGetLastError());
+                        }
 
                         bk.switch_key_variances_ =
                             std::vector<double>(bk_n * (bk_k + 1) * bk_length,
@@ -15,6 +15,9 @@ namespace heongpu
         intt_table_ = context.intt_table_;
         n_inverse_ = context.n_inverse_;
 
+        fft_root_table_ = context.fft_root_table_;
+        fft_twist_table_ = context.fft_twist_table_;
+
         ks_base_bit_ = context.ks_base_bit_;
         ks_length_ = context.ks_length_;
 
@@ -223,6 +226,137 @@ namespace heongpu
     {
         int shape_ = input.shape_;
 
+        DeviceVector<int32_t> accumulator =
+            blind_rotation(input, boot_key, nullptr, stream);
+
+        for (size_t i = 0; i < shape_; i++)
+        {
+            output.variances_[i] =
+                output.variances_[i] + (n_ * input.variances_[i]);
+        }
+
+        tfhe_sample_extraction_kernel<<<dim3(shape_, k_), 512, 0, stream>>>(
+            accumulator.data(), output.a_device_location_.data(),
+            output.b_device_location_.data(), N_, k_, 0);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+    }
+
+    __host__ void
+    HELogicOperator<Scheme::TFHE>::programmable_bootstrapping_computation(
+        Ciphertext<Scheme::TFHE>& input, Ciphertext<Scheme::TFHE>& output,
+        const std::vector<uint32_t>& lut,
+        Bootstrappingkey<Scheme::TFHE>& boot_key, cudaStream_t stream)
+    {
+        int shape_ = input.shape_;
+
+        DeviceVector<int32_t> test_vector(generate_test_vector(lut), stream);
+
+        DeviceVector<int32_t> accumulator =
+            blind_rotation(input, boot_key, test_vector.data(), stream);
+
+        for (size_t i = 0; i < shape_; i++)
+        {
+            output.variances_[i] =
+                output.variances_[i] + (n_ * input.variances_[i]);
+        }
+
+        tfhe_sample_extraction_kernel<<<dim3(shape_, k_), 512, 0, stream>>>(
+            accumulator.data(), output.a_device_location_.data(),
+            output.b_device_location_.data(), N_, k_, 0);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+    }
+
+    __host__ void
+    HELogicOperator<Scheme::TFHE>::multi_value_bootstrapping_computation(
+        Ciphertext<Scheme::TFHE>& input,
+        std::vector<Ciphertext<Scheme::TFHE>>& outputs,
+        const std::vector<std::vector<uint32_t>>& luts,
+        Bootstrappingkey<Scheme::TFHE>& boot_key, cudaStream_t stream)
+    {
+        int shape_ = input.shape_;
+        int lut_count = luts.size();
+        int lut_size = luts[0].size();
+
+        // Every test polynomial factors into the shared box polynomial, the
+        // test polynomial of the lookup table {1, 0, ..., 0}, times
+        // sum_m lut[m] * X^(m * N / lut_size). Only the shared part is blind
+        // rotated.
+        std::vector<uint32_t> unit_lut(lut_size, 0);
+        unit_lut[0] = 1;
+        DeviceVector<int32_t> test_vector(generate_test_vector(unit_lut),
+                                          stream);
+
+        DeviceVector<int32_t> accumulator =
+            blind_rotation(input, boot_key, test_vector.data(), stream);
+
+        std::vector<int32_t> flat_luts;
+        flat_luts.reserve(lut_count * lut_size);
+        for (const std::vector<uint32_t>& lut : luts)
+        {
+            flat_luts.insert(flat_luts.end(), lut.begin(), lut.end());
+        }
+        DeviceVector<int32_t> luts_device(flat_luts, stream);
+
+        Data64 accumulator_size =
+            (Data64) shape_ * (Data64) (k_ + 1) * (Data64) N_;
+        DeviceVector<int32_t> products(lut_count * accumulator_size, stream);
+
+        tfhe_lut_multiplication_kernel<<<dim3(shape_, (k_ + 1), lut_count),
+                                         512, 0, stream>>>(
+            accumulator.data(), products.data(), luts_device.data(), lut_size,
+            shape_, N_, k_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        for (int j = 0; j < lut_count; j++)
+        {
+            // The product scales the noise by the norm of the lookup table.
+            double lut_norm = 0.0;
+            for (uint32_t value : luts[j])
+            {
+                lut_norm += static_cast<double>(value) * value;
+            }
+
+            for (size_t i = 0; i < shape_; i++)
+            {
+                outputs[j].variances_[i] =
+                    outputs[j].variances_[i] +
+                    (lut_norm * n_ * input.variances_[i]);
+            }
+
+            tfhe_sample_extraction_kernel<<<dim3(shape_, k_), 512, 0,
+                                            stream>>>(
+                products.data() + (j * accumulator_size),
+                outputs[j].a_device_location_.data(),
+                outputs[j].b_device_location_.data(), N_, k_, 0);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+        }
+    }
+
+    __host__ DeviceVector<int32_t>
+    HELogicOperator<Scheme::TFHE>::blind_rotation(
+        Ciphertext<Scheme::TFHE>& input,
+        Bootstrappingkey<Scheme::TFHE>& boot_key, const int32_t* test_vector,
+        cudaStream_t stream)
+    {
+        int shape_ = input.shape_;
+
+        if (boot_key.blind_rotation_ == tfhe_blind_rotation_type::FFT)
+        {
+            if (!fft_root_table_)
+            {
+                throw std::invalid_argument(
+                    "FFT bootstrapping key needs a context with FFT blind "
+                    "rotation!");
+            }
+
+            Data64 accumulator_size =
+                (Data64) shape_ * (Data64) (k_ + 1) * (Data64) N_;
+            DeviceVector<int32_t> accumulator(accumulator_size, stream);
+            blind_rotation_fft(input, boot_key, test_vector, accumulator,
+                               stream);
+            return accumulator;
+        }
+
         Data64 total_temp_boot_size = (Data64) shape_ * (Data64) (k_ + 1) *
                                       (Data64) (bk_l_ + 1) * (Data64) (k_ + 1) *
                                       (Data64) N_;
@@ -236,15 +370,15 @@ namespace heongpu
                                                  512, 0, stream>>>(
             input.a_device_location_.data(), input.b_device_location_.data(),
             temp_boot.data(), boot_key.boot_key_device_location_.data(),
-            ntt_table_->data(), prime_, encode_mu, bk_offset_, bk_mask_,
-            bk_half_, n_, N_, Npower_, k_, bk_bg_bit_, bk_l_);
+            ntt_table_->data(), prime_, encode_mu, test_vector, bk_offset_,
+            bk_mask_, bk_half_, n_, N_, Npower_, k_, bk_bg_bit_, bk_l_);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
         tfhe_bootstrapping_kernel_unique_step2<<<dim3(shape_, (k_ + 1)), 512, 0,
                                                  stream>>>(
             temp_boot.data(), input.b_device_location_.data(),
             temp_boot2.data(), intt_table_->data(), n_inverse_, prime_,
-            encode_mu, n_, N_, Npower_, k_, bk_l_);
+            encode_mu, test_vector, n_, N_, Npower_, k_, bk_l_);
         HEONGPU_CUDA_CHECK(cudaGetLastError());
 
         for (int i = 1; i < n_; i++)
@@ -265,16 +399,102 @@ namespace heongpu
             HEONGPU_CUDA_CHECK(cudaGetLastError());
         }
 
-        for (size_t i = 0; i < shape_; i++)
+        return temp_boot2;
+    }
+
+    __host__ void HELogicOperator<Scheme::TFHE>::blind_rotation_fft(
+        Ciphertext<Scheme::TFHE>& input,
+        Bootstrappingkey<Scheme::TFHE>& boot_key, const int32_t* test_vector,
+        DeviceVector<int32_t>& accumulator, cudaStream_t stream)
+    {
+        int shape_ = input.shape_;
+
+        const double* boot_key_fft = reinterpret_cast<const double*>(
+            boot_key.boot_key_device_location_.data());
+
+        Data64 total_temp_boot_size = (Data64) shape_ * (Data64) (k_ + 1) *
+                                      (Data64) bk_l_ * (Data64) (k_ + 1) *
+                                      (Data64) N_;
+        DeviceVector<double> temp_boot(total_temp_boot_size, stream);
+
+        tfhe_bootstrapping_fft_kernel_unique_step1<<<
+            dim3(shape_, (k_ + 1), bk_l_), 512, 0, stream>>>(
+            input.a_device_location_.data(), input.b_device_location_.data(),
+            temp_boot.data(), boot_key_fft, fft_root_table_->data(),
+            fft_twist_table_->data(), encode_mu, test_vector, bk_offset_,
+            bk_mask_, bk_half_, n_, N_, Npower_, k_, bk_bg_bit_, bk_l_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        tfhe_bootstrapping_fft_kernel_unique_step2<<<dim3(shape_, (k_ + 1)),
+                                                     512, 0, stream>>>(
+            temp_boot.data(), input.b_device_location_.data(),
+            accumulator.data(), fft_root_table_->data(),
+            fft_twist_table_->data(), encode_mu, test_vector, N_, Npower_, k_,
+            bk_l_);
+        HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+        for (int i = 1; i < n_; i++)
         {
-            output.variances_[i] =
-                output.variances_[i] + (n_ * input.variances_[i]);
+            tfhe_bootstrapping_fft_kernel_regular_step1<<<
+                dim3(shape_, (k_ + 1), bk_l_), 512, 0, stream>>>(
+                input.a_device_location_.data(), accumulator.data(),
+                temp_boot.data(), boot_key_fft, i, fft_root_table_->data(),
+                fft_twist_table_->data(), bk_offset_, bk_mask_, bk_half_, n_,
+                N_, Npower_, k_, bk_bg_bit_, bk_l_);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
+
+            tfhe_bootstrapping_fft_kernel_regular_step2<<<
+                dim3(shape_, (k_ + 1)), 512, 0, stream>>>(
+                temp_boot.data(), accumulator.data(), fft_root_table_->data(),
+                fft_twist_table_->data(), N_, k_, bk_l_);
+            HEONGPU_CUDA_CHECK(cudaGetLastError());
         }
+    }
 
-        tfhe_sample_extraction_kernel<<<dim3(shape_, k_), 512, 0, stream>>>(
-            temp_boot2.data(), output.a_device_location_.data(),
-            output.b_device_location_.data(), N_, k_, 0);
-        HEONGPU_CUDA_CHECK(cudaGetLastError());
+    __host__ void HELogicOperator<Scheme::TFHE>::check_lookup_table(
+        const std::vector<uint32_t>& lut)
+    {
+        int lut_size = lut.size();
+        if ((lut_size < 2) || ((lut_size & (lut_size - 1)) != 0) ||
+            (lut_size > (N_ >> 1)))
+        {
+            throw std::invalid_argument(
+                "Lookup table size should be a power of two between 2 and "
+                "N / 2!");
+        }
+
+        for (uint32_t value : lut)
+        {
+            if (value >= static_cast<uint32_t>(lut_size))
+            {
+                throw std::invalid_argument(
+                    "Lookup table values should be in the message space!");
+            }
+        }
+    }
+
+    __host__ std::vector<int32_t>
+    HELogicOperator<Scheme::TFHE>::generate_test_vector(
+        const std::vector<uint32_t>& lut)
+    {
+        // Messages m are encoded as m / (2 * p) on the torus, so the
+        // modulus-switched phase of m is m * N / p. Coefficient i answers the
+        // phases rounding to it; the top half box belongs to m = 0 and picks
+        // up the sign of the negacyclic wrap.
+        uint32_t lut_size = lut.size();
+        int box_size = N_ / lut_size;
+
+        std::vector<int32_t> test_vector(N_);
+        for (int i = 0; i < N_; i++)
+        {
+            uint32_t message = (i + (box_size >> 1)) / box_size;
+            test_vector[i] =
+                (message < lut_size)
+                    ? encode_to_torus32(lut[message], 2 * lut_size)
+                    : -encode_to_torus32(lut[0], 2 * lut_size);
+        }
+
+        return test_vector;
     }
 
     __host__ void HELogicOperator<Scheme::TFHE>::key_switching(
@@ -300,6 +520,21 @@ namespace heongpu
         }
     }
 
+    __host__ void HELogicOperator<Scheme::TFHE>::set_output_ciphertext(
+        Ciphertext<Scheme::TFHE>& output, Ciphertext<Scheme::TFHE>& input,
+        cudaStream_t stream)
+    {
+        output.a_device_location_.resize(input.shape_ * n_, stream);
+        output.b_device_location_.resize(input.shape_, stream);
+        output.n_ = input.n_;
+        output.shape_ = input.shape_;
+        output.variances_ = input.variances_;
+        output.alpha_min_ = input.alpha_min_;
+        output.alpha_max_ = input.alpha_max_;
+        output.ciphertext_generated_ = true;
+        output.storage_type_ = storage_type::DEVICE;
+    }
+
     __host__ Ciphertext<Scheme::TFHE>
     HELogicOperator<Scheme::TFHE>::generate_empty_ciphertext(
         int n, int shape, cudaStream_t stream)
@@ -0,0 +1,147 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "tfhe/torusfft.cuh"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace heongpu
+{
+    TorusFFT::TorusFFT(int N) : N_(N), M_(N >> 1)
+    {
+        if ((N < 4) || ((N & (N - 1)) != 0))
+        {
+            throw std::invalid_argument(
+                "TorusFFT degree has to be a power of two!");
+        }
+
+        int half = M_ >> 1;
+
+        root_table_.resize(M_);
+        for (int j = 0; j < half; j++)
+        {
+            double angle = (2.0 * M_PI * j) / static_cast<double>(M_);
+            root_table_[j] = std::cos(angle);
+            root_table_[half + j] = std::sin(angle);
+        }
+
+        twist_table_.resize(N_);
+        for (int j = 0; j < M_; j++)
+        {
+            double angle = (M_PI * j) / static_cast<double>(N_);
+            twist_table_[j] = std::cos(angle);
+            twist_table_[M_ + j] = std::sin(angle);
+        }
+    }
+
+    void TorusFFT::forward(const std::vector<int32_t>& input,
+                           std::vector<std::complex<double>>& output) const
+    {
+        if (static_cast<int>(input.size()) != N_)
+        {
+            throw std::invalid_argument("Invalid polynomial size!");
+        }
+
+        output.resize(M_);
+        for (int j = 0; j < M_; j++)
+        {
+            std::complex<double> folded(static_cast<double>(input[j]),
+                                        static_cast<double>(input[j + M_]));
+            std::complex<double> twist(twist_table_[j], twist_table_[M_ + j]);
+            output[j] = folded * twist;
+        }
+
+        // Decimation in frequency: natural order in, bit-reversed order out.
+        int half = M_ >> 1;
+        for (int length = half; length >= 1; length >>= 1)
+        {
+            int root_stride = half / length;
+            for (int butterfly = 0; butterfly < half; butterfly++)
+            {
+                int position = butterfly & (length - 1);
+                int address0 = ((butterfly - position) << 1) + position;
+                int address1 = address0 + length;
+
+                std::complex<double> root(
+                    root_table_[position * root_stride],
+                    root_table_[half + (position * root_stride)]);
+
+                std::complex<double> u = output[address0];
+                std::complex<double> v = output[address1];
+                output[address0] = u + v;
+                output[address1] = (u - v) * root;
+            }
+        }
+    }
+
+    void TorusFFT::inverse(const std::vector<std::complex<double>>& input,
+                           std::vector<int32_t>& output) const
+    {
+        if (static_cast<int>(input.size()) != M_)
+        {
+            throw std::invalid_argument("Invalid FFT domain size!");
+        }
+
+        std::vector<std::complex<double>> values = input;
+
+        // Decimation in time: bit-reversed order in, natural order out.
+        int half = M_ >> 1;
+        for (int length = 1; length < M_; length <<= 1)
+        {
+            int root_stride = half / length;
+            for (int butterfly = 0; butterfly < half; butterfly++)
+            {
+                int position = butterfly & (length - 1);
+                int address0 = ((butterfly - position) << 1) + position;
+                int address1 = address0 + length;
+
+                std::complex<double> root(
+                    root_table_[position * root_stride],
+                    -root_table_[half + (position * root_stride)]);
+
+                std::complex<double> u = values[address0];
+                std::complex<double> v = values[address1] * root;
+                values[address0] = u + v;
+                values[address1] = u - v;
+            }
+        }
+
+        output.resize(N_);
+        double scale = 1.0 / static_cast<double>(M_);
+        for (int j = 0; j < M_; j++)
+        {
+            std::complex<double> twist(twist_table_[j],
+                                       -twist_table_[M_ + j]);
+            std::complex<double> folded = values[j] * twist * scale;
+
+            output[j] = static_cast<int32_t>(
+                static_cast<uint32_t>(std::llround(folded.real())));
+            output[j + M_] = static_cast<int32_t>(
+                static_cast<uint32_t>(std::llround(folded.imag())));
+        }
+    }
+
+    std::vector<int32_t>
+    TorusFFT::multiply(const std::vector<int32_t>& input1,
+                       const std::vector<int32_t>& input2) const
+    {
+        std::vector<std::complex<double>> fft1;
+        std::vector<std::complex<double>> fft2;
+        forward(input1, fft1);
+        forward(input2, fft2);
+
+        for (int j = 0; j < M_; j++)
+        {
+            fft1[j] = fft1[j] * fft2[j];
+        }
+
+        std::vector<int32_t> result;
+        inverse(fft1, result);
+
+        return result;
+    }
+
+} // namespace heongpu
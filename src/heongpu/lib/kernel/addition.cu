@@ -217,4 +217,74 @@ namespace heongpu
         }
     }
 
+    __global__ void addition_plain_bgv_poly(
+        Data64* cipher, Data64* plain, Data64* output, Modulus64* modulus,
+        Modulus64 plain_mod, Data64 correction, Data64 upper_threshold,
+        Data64* upper_halfincrement, int n_power)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // ring size
+        int block_y = blockIdx.y; // rns count
+        int block_z = blockIdx.z; // cipher size
+
+        int location =
+            idx + (block_y << n_power) + ((gridDim.y * block_z) << n_power);
+
+        if (block_z == 0)
+        {
+            // The message is scaled by the correction factor of the
+            // ciphertext and lifted to its centered representative.
+            Data64 message =
+                OPERATOR_GPU_64::mult(plain[idx], correction, plain_mod);
+            if (message >= upper_threshold)
+            {
+                message = OPERATOR_GPU_64::add(
+                    message, upper_halfincrement[block_y], modulus[block_y]);
+            }
+
+            Data64 ciphertext = cipher[location];
+            output[location] =
+                OPERATOR_GPU_64::add(ciphertext, message, modulus[block_y]);
+        }
+        else
+        {
+            Data64 ciphertext = cipher[location];
+            output[location] = ciphertext;
+        }
+    }
+
+    __global__ void substraction_plain_bgv_poly(
+        Data64* cipher, Data64* plain, Data64* output, Modulus64* modulus,
+        Modulus64 plain_mod, Data64 correction, Data64 upper_threshold,
+        Data64* upper_halfincrement, int n_power)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // ring size
+        int block_y = blockIdx.y; // rns count
+        int block_z = blockIdx.z; // cipher size
+
+        int location =
+            idx + (block_y << n_power) + ((gridDim.y * block_z) << n_power);
+
+        if (block_z == 0)
+        {
+            // The message is scaled by the correction factor of the
+            // ciphertext and lifted to its centered representative.
+            Data64 message =
+                OPERATOR_GPU_64::mult(plain[idx], correction, plain_mod);
+            if (message >= upper_threshold)
+            {
+                message = OPERATOR_GPU_64::add(
+                    message, upper_halfincrement[block_y], modulus[block_y]);
+            }
+
+            Data64 ciphertext = cipher[location];
+            output[location] =
+                OPERATOR_GPU_64::sub(ciphertext, message, modulus[block_y]);
+        }
+        else
+        {
+            Data64 ciphertext = cipher[location];
+            output[location] = ciphertext;
+        }
+    }
+
 } // namespace heongpu
\ No newline at end of file
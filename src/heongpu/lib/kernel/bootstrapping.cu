@@ -639,6 +639,31 @@ namespace heongpu
         return result;
     }
 
+    __device__ int32_t tfhe_rotated_test_vector(const int32_t* test_vector,
+                                                int32_t encoded, int index,
+                                                int rotation, int N)
+    {
+        // X^rotation with rotation in [0, 2N], X^N = -1.
+        bool negate = false;
+        if (rotation >= N)
+        {
+            rotation = rotation - N;
+            negate = true;
+        }
+
+        int source = index - rotation;
+        if (source < 0)
+        {
+            source = source + N;
+            negate = !negate;
+        }
+
+        int32_t value =
+            (test_vector == nullptr) ? encoded : test_vector[source];
+
+        return negate ? -value : value;
+    }
+
     __global__ void tfhe_bootstrapping_kernel(
         const int32_t* input_a, const int32_t* input_b, int32_t* output,
         const Data64* boot_key,
@@ -842,7 +867,8 @@ namespace heongpu
         const int32_t* input_a, const int32_t* input_b, Data64* output,
         const Data64* boot_key,
         const Root64* __restrict__ forward_root_of_unity_table,
-        const Modulus64 modulus, const int32_t encoded, const int32_t bk_offset,
+        const Modulus64 modulus, const int32_t encoded,
+        const int32_t* test_vector, const int32_t bk_offset,
         const int32_t bk_mask, const int32_t bk_half, int n, int N, int N_power,
         int k, int bk_bit, int bk_length)
     {
@@ -879,23 +905,10 @@ namespace heongpu
 
         if (block_y == k)
         {
-            if (input_b_reg_N < N)
-            {
-                temp.value[0] =
-                    (idx_x < input_b_reg_N) ? (-encoded_reg) : encoded_reg;
-                temp.value[1] = ((idx_x + blockDim.x) < input_b_reg_N)
-                                    ? (-encoded_reg)
-                                    : encoded_reg;
-            }
-            else
-            {
-                int32_t input_b_reg_N_minus = input_b_reg_N - N;
-                temp.value[0] = (idx_x < input_b_reg_N_minus) ? encoded_reg
-                                                              : (-encoded_reg);
-                temp.value[1] = ((idx_x + blockDim.x) < input_b_reg_N_minus)
-                                    ? encoded_reg
-                                    : (-encoded_reg);
-            }
+            temp.value[0] = tfhe_rotated_test_vector(
+                test_vector, encoded_reg, idx_x, input_b_reg_N, N);
+            temp.value[1] = tfhe_rotated_test_vector(
+                test_vector, encoded_reg, idx_x + blockDim.x, input_b_reg_N, N);
         }
 
         int32_t input_a_reg = input_a[offset_lwe]; // + 0
@@ -1109,7 +1122,8 @@ namespace heongpu
         const Data64* input, const int32_t* input_b, int32_t* output,
         const Root64* __restrict__ inverse_root_of_unity_table,
         const Ninverse64 n_inverse, const Modulus64 modulus,
-        const int32_t encoded, int n, int N, int N_power, int k, int bk_length)
+        const int32_t encoded, const int32_t* test_vector, int n, int N,
+        int N_power, int k, int bk_length)
     {
         __shared__ Data64 shared_data64[1024];
 
@@ -1180,23 +1194,10 @@ namespace heongpu
 
         if (block_y == k)
         {
-            if (input_b_reg_N < N)
-            {
-                temp.value[0] =
-                    (idx_x < input_b_reg_N) ? (-encoded_reg) : encoded_reg;
-                temp.value[1] = ((idx_x + blockDim.x) < input_b_reg_N)
-                                    ? (-encoded_reg)
-                                    : encoded_reg;
-            }
-            else
-            {
-                int32_t input_b_reg_N_minus = input_b_reg_N - N;
-                temp.value[0] = (idx_x < input_b_reg_N_minus) ? encoded_reg
-                                                              : (-encoded_reg);
-                temp.value[1] = ((idx_x + blockDim.x) < input_b_reg_N_minus)
-                                    ? encoded_reg
-                                    : (-encoded_reg);
-            }
+            temp.value[0] = tfhe_rotated_test_vector(
+                test_vector, encoded_reg, idx_x, input_b_reg_N, N);
+            temp.value[1] = tfhe_rotated_test_vector(
+                test_vector, encoded_reg, idx_x + blockDim.x, input_b_reg_N, N);
 
             post_accum0 = post_accum0 + temp.value[0];
             post_accum1 = post_accum1 + temp.value[1];
@@ -1277,6 +1278,324 @@ namespace heongpu
             output[offset_o + idx_x + blockDim.x] + post_accum1;
     }
 
+    __device__ int32_t2 tfhe_rotation_difference(const uint32_t* polynomial,
+                                                 int rotation, int N)
+    {
+        int32_t2 result;
+
+#pragma unroll
+        for (int i = 0; i < 2; i++)
+        {
+            int index = threadIdx.x + (i * blockDim.x);
+
+            // X^rotation with X^N = -1.
+            int source_rotation = rotation;
+            bool negate = false;
+            if (source_rotation >= N)
+            {
+                source_rotation = source_rotation - N;
+                negate = true;
+            }
+
+            int source = index - source_rotation;
+            if (source < 0)
+            {
+                source = source + N;
+                negate = !negate;
+            }
+
+            uint32_t value = polynomial[source];
+            value = negate ? -value : value;
+
+            result.value[i] = static_cast<int32_t>(value - polynomial[index]);
+        }
+
+        return result;
+    }
+
+    __global__ void tfhe_bootstrapping_fft_kernel_unique_step1(
+        const int32_t* input_a, const int32_t* input_b, double* output,
+        const double* boot_key, const double* fft_root_table,
+        const double* fft_twist_table, const int32_t encoded,
+        const int32_t* test_vector, const int32_t bk_offset,
+        const int32_t bk_mask, const int32_t bk_half, int n, int N, int N_power,
+        int k, int bk_bit, int bk_length)
+    {
+        __shared__ uint32_t shared_data32[1024];
+        __shared__ double shared_real[512];
+        __shared__ double shared_imag[512];
+
+        int idx_x = threadIdx.x;
+        int block_x = blockIdx.x; // cipher size
+        int block_y = blockIdx.y; // k
+        int block_z = blockIdx.z; // l
+
+        int32_t encoded_reg = encoded;
+
+        int offset_lwe = block_x * n;
+
+        Data64 offset_i2 = block_y * ((Data64) bk_length * (k + 1) * N);
+        Data64 offset_i3 = offset_i2 + (block_z * ((Data64) (k + 1) * N));
+
+        Data64 offset_o =
+            block_x * (Data64) (k + 1) * ((Data64) bk_length * (k + 1) * N);
+        Data64 offset_o2 = block_y * ((Data64) bk_length * (k + 1) * N);
+        Data64 offset_o3 =
+            (offset_o + offset_o2) + (block_z * ((Data64) (k + 1) * N));
+
+        int32_t input_b_reg = input_b[block_x];
+        int32_t input_b_reg_N = torus_modulus_switch_log(input_b_reg, N_power);
+        input_b_reg_N = static_cast<int32_t>(N << 1) - input_b_reg_N;
+
+        int32_t2 temp;
+        if (block_y == k)
+        {
+            temp.value[0] = tfhe_rotated_test_vector(
+                test_vector, encoded_reg, idx_x, input_b_reg_N, N);
+            temp.value[1] = tfhe_rotated_test_vector(
+                test_vector, encoded_reg, idx_x + blockDim.x, input_b_reg_N, N);
+        }
+
+        int32_t input_a_reg = input_a[offset_lwe]; // + 0
+        int32_t input_a_reg_N = torus_modulus_switch_log(input_a_reg, N_power);
+
+        shared_data32[idx_x] = temp.value[0];
+        shared_data32[idx_x + blockDim.x] = temp.value[1];
+        __syncthreads();
+
+        int32_t2 temp2 =
+            tfhe_rotation_difference(shared_data32, input_a_reg_N, N);
+
+        int shift = 32 - (bk_bit * (block_z + 1));
+        temp2.value[0] =
+            (((temp2.value[0] + bk_offset) >> shift) & bk_mask) - bk_half;
+        temp2.value[1] =
+            (((temp2.value[1] + bk_offset) >> shift) & bk_mask) - bk_half;
+
+        shared_real[idx_x] = static_cast<double>(temp2.value[0]);
+        shared_imag[idx_x] = static_cast<double>(temp2.value[1]);
+        __syncthreads();
+
+        SmallForwardFFT(shared_real, shared_imag, fft_root_table,
+                        fft_twist_table);
+
+        double fft_real = shared_real[idx_x];
+        double fft_imag = shared_imag[idx_x];
+
+#pragma unroll
+        for (int i = 0; i < (k + 1); i++)
+        {
+            double bk_real = boot_key[offset_i3 + (i * N) + idx_x];
+            double bk_imag = boot_key[offset_i3 + (i * N) + idx_x + blockDim.x];
+
+            output[offset_o3 + (i * N) + idx_x] =
+                (fft_real * bk_real) - (fft_imag * bk_imag);
+            output[offset_o3 + (i * N) + idx_x + blockDim.x] =
+                (fft_real * bk_imag) + (fft_imag * bk_real);
+        }
+    }
+
+    __global__ void tfhe_bootstrapping_fft_kernel_regular_step1(
+        const int32_t* input_a, const int32_t* input_c, double* output,
+        const double* boot_key, int boot_index, const double* fft_root_table,
+        const double* fft_twist_table, const int32_t bk_offset,
+        const int32_t bk_mask, const int32_t bk_half, int n, int N, int N_power,
+        int k, int bk_bit, int bk_length)
+    {
+        __shared__ uint32_t shared_data32[1024];
+        __shared__ double shared_real[512];
+        __shared__ double shared_imag[512];
+
+        int idx_x = threadIdx.x;
+        int block_x = blockIdx.x; // cipher size
+        int block_y = blockIdx.y; // k
+        int block_z = blockIdx.z; // l
+
+        int offset_lwe = block_x * n;
+
+        Data64 offset_i =
+            boot_index * (Data64) (k + 1) * ((Data64) bk_length * (k + 1) * N);
+        Data64 offset_i2 = block_y * ((Data64) bk_length * (k + 1) * N);
+        Data64 offset_i3 =
+            (offset_i + offset_i2) + (block_z * ((Data64) (k + 1) * N));
+
+        Data64 offset_o =
+            block_x * (Data64) (k + 1) * ((Data64) bk_length * (k + 1) * N);
+        Data64 offset_o2 = block_y * ((Data64) bk_length * (k + 1) * N);
+        Data64 offset_o3 =
+            (offset_o + offset_o2) + (block_z * ((Data64) (k + 1) * N));
+
+        int32_t input_a_reg = input_a[offset_lwe + boot_index];
+        int32_t input_a_reg_N = torus_modulus_switch_log(input_a_reg, N_power);
+
+        int offset_acc = block_x * (k + 1) * N;
+        int offset_acc2 = block_y * N;
+        offset_acc = offset_acc + offset_acc2 + idx_x;
+
+        shared_data32[idx_x] = input_c[offset_acc];
+        shared_data32[idx_x + blockDim.x] = input_c[offset_acc + blockDim.x];
+        __syncthreads();
+
+        int32_t2 temp2 =
+            tfhe_rotation_difference(shared_data32, input_a_reg_N, N);
+
+        int shift = 32 - (bk_bit * (block_z + 1));
+        temp2.value[0] =
+            (((temp2.value[0] + bk_offset) >> shift) & bk_mask) - bk_half;
+        temp2.value[1] =
+            (((temp2.value[1] + bk_offset) >> shift) & bk_mask) - bk_half;
+
+        shared_real[idx_x] = static_cast<double>(temp2.value[0]);
+        shared_imag[idx_x] = static_cast<double>(temp2.value[1]);
+        __syncthreads();
+
+        SmallForwardFFT(shared_real, shared_imag, fft_root_table,
+                        fft_twist_table);
+
+        double fft_real = shared_real[idx_x];
+        double fft_imag = shared_imag[idx_x];
+
+#pragma unroll
+        for (int i = 0; i < (k + 1); i++)
+        {
+            double bk_real = boot_key[offset_i3 + (i * N) + idx_x];
+            double bk_imag = boot_key[offset_i3 + (i * N) + idx_x + blockDim.x];
+
+            output[offset_o3 + (i * N) + idx_x] =
+                (fft_real * bk_real) - (fft_imag * bk_imag);
+            output[offset_o3 + (i * N) + idx_x + blockDim.x] =
+                (fft_real * bk_imag) + (fft_imag * bk_real);
+        }
+    }
+
+    __global__ void tfhe_bootstrapping_fft_kernel_unique_step2(
+        const double* input, const int32_t* input_b, int32_t* output,
+        const double* fft_root_table, const double* fft_twist_table,
+        const int32_t encoded, const int32_t* test_vector, int N, int N_power,
+        int k, int bk_length)
+    {
+        __shared__ double shared_real[512];
+        __shared__ double shared_imag[512];
+
+        int idx_x = threadIdx.x;
+        int block_x = blockIdx.x; // cipher size
+        int block_y = blockIdx.y; // k
+
+        Data64 offset_i =
+            block_x * (Data64) (k + 1) * ((Data64) bk_length * (k + 1) * N);
+
+        int32_t encoded_reg = encoded;
+
+        double accum_real = 0.0;
+        double accum_imag = 0.0;
+
+        for (int i = 0; i < (k + 1); i++)
+        {
+            Data64 offset_i2 = i * ((Data64) bk_length * (k + 1) * N);
+
+#pragma unroll
+            for (int j = 0; j < bk_length; j++)
+            {
+                Data64 offset_i3 =
+                    (offset_i + offset_i2) + (j * ((Data64) (k + 1) * N));
+                offset_i3 = offset_i3 + (block_y * N);
+
+                accum_real = accum_real + input[offset_i3 + idx_x];
+                accum_imag = accum_imag + input[offset_i3 + idx_x + blockDim.x];
+            }
+        }
+
+        shared_real[idx_x] = accum_real;
+        shared_imag[idx_x] = accum_imag;
+        __syncthreads();
+
+        SmallInverseFFT(shared_real, shared_imag, fft_root_table,
+                        fft_twist_table);
+
+        // POST PROCESS
+        int32_t post_accum0 = static_cast<int32_t>(
+            static_cast<uint32_t>(__double2ll_rn(shared_real[idx_x])));
+        int32_t post_accum1 = static_cast<int32_t>(
+            static_cast<uint32_t>(__double2ll_rn(shared_imag[idx_x])));
+
+        Data64 offset_o = block_x * (Data64) (k + 1) * N;
+        offset_o = offset_o + (block_y * N);
+
+        int32_t input_b_reg = input_b[block_x];
+        int32_t input_b_reg_N = torus_modulus_switch_log(input_b_reg, N_power);
+        input_b_reg_N = static_cast<int32_t>(N << 1) - input_b_reg_N;
+
+        if (block_y == k)
+        {
+            post_accum0 = post_accum0 +
+                          tfhe_rotated_test_vector(test_vector, encoded_reg,
+                                                   idx_x, input_b_reg_N, N);
+            post_accum1 = post_accum1 + tfhe_rotated_test_vector(
+                                            test_vector, encoded_reg,
+                                            idx_x + blockDim.x, input_b_reg_N,
+                                            N);
+        }
+
+        output[offset_o + idx_x] = post_accum0;
+        output[offset_o + idx_x + blockDim.x] = post_accum1;
+    }
+
+    __global__ void tfhe_bootstrapping_fft_kernel_regular_step2(
+        const double* input, int32_t* output, const double* fft_root_table,
+        const double* fft_twist_table, int N, int k, int bk_length)
+    {
+        __shared__ double shared_real[512];
+        __shared__ double shared_imag[512];
+
+        int idx_x = threadIdx.x;
+        int block_x = blockIdx.x; // cipher size
+        int block_y = blockIdx.y; // k
+
+        Data64 offset_i =
+            block_x * (Data64) (k + 1) * ((Data64) bk_length * (k + 1) * N);
+
+        double accum_real = 0.0;
+        double accum_imag = 0.0;
+
+        for (int i = 0; i < (k + 1); i++)
+        {
+            Data64 offset_i2 = i * ((Data64) bk_length * (k + 1) * N);
+
+#pragma unroll
+            for (int j = 0; j < bk_length; j++)
+            {
+                Data64 offset_i3 =
+                    (offset_i + offset_i2) + (j * ((Data64) (k + 1) * N));
+                offset_i3 = offset_i3 + (block_y * N);
+
+                accum_real = accum_real + input[offset_i3 + idx_x];
+                accum_imag = accum_imag + input[offset_i3 + idx_x + blockDim.x];
+            }
+        }
+
+        shared_real[idx_x] = accum_real;
+        shared_imag[idx_x] = accum_imag;
+        __syncthreads();
+
+        SmallInverseFFT(shared_real, shared_imag, fft_root_table,
+                        fft_twist_table);
+
+        // POST PROCESS
+        uint32_t post_accum0 =
+            static_cast<uint32_t>(__double2ll_rn(shared_real[idx_x]));
+        uint32_t post_accum1 =
+            static_cast<uint32_t>(__double2ll_rn(shared_imag[idx_x]));
+
+        Data64 offset_o = block_x * (Data64) (k + 1) * N;
+        offset_o = offset_o + (block_y * N);
+
+        output[offset_o + idx_x] = static_cast<int32_t>(
+            static_cast<uint32_t>(output[offset_o + idx_x]) + post_accum0);
+        output[offset_o + idx_x + blockDim.x] = static_cast<int32_t>(
+            static_cast<uint32_t>(output[offset_o + idx_x + blockDim.x]) +
+            post_accum1);
+    }
+
     __global__ void tfhe_sample_extraction_kernel(const int32_t* input,
                                                   int32_t* output_a,
                                                   int32_t* output_b, int N,
@@ -1313,6 +1632,43 @@ namespace heongpu
         }
     }
 
+    __global__ void tfhe_lut_multiplication_kernel(const int32_t* input,
+                                                   int32_t* output,
+                                                   const int32_t* lut,
+                                                   int lut_size, int shape,
+                                                   int N, int k)
+    {
+        int idx_x = threadIdx.x;
+        int block_x = blockIdx.x; // cipher size
+        int block_y = blockIdx.y; // k
+        int block_z = blockIdx.z; // lut
+
+        Data64 offset_i = block_x * (Data64) (k + 1) * N + (block_y * N);
+        Data64 offset_o =
+            (block_z * (Data64) shape * (k + 1) * N) + offset_i;
+
+        const int32_t* lut_reg = lut + (block_z * lut_size);
+        int box_size = N / lut_size;
+
+        for (int i = idx_x; i < N; i += blockDim.x)
+        {
+            // sum_m lut[m] * X^(m * box_size) * input
+            uint32_t sum = 0;
+            for (int m = 0; m < lut_size; m++)
+            {
+                int rotation = m * box_size;
+                uint32_t value =
+                    (i >= rotation)
+                        ? static_cast<uint32_t>(input[offset_i + i - rotation])
+                        : -static_cast<uint32_t>(
+                              input[offset_i + N + i - rotation]);
+                sum = sum + static_cast<uint32_t>(lut_reg[m]) * value;
+            }
+
+            output[offset_o + i] = static_cast<int32_t>(sum);
+        }
+    }
+
     // It will be more efficient!
     __global__ void tfhe_key_switching_kernel(
         const int32_t* input_a, const int32_t* input_b, int32_t* output_a,
@@ -1401,4 +1757,153 @@ namespace heongpu
         }
     }
 
+    __global__ void tfhe_lwe_to_rlwe_kernel(
+        const int32_t* input_a, const int32_t* input_b, Data64* output,
+        Modulus64* modulus, const Data64* lift_factors, Data64 torus_remainder,
+        int lwe_index, int lwe_n, int n_power, int rns_mod_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // ring size
+        int block_y = blockIdx.y; // rns count
+        int block_z = blockIdx.z; // cipher size
+
+        int N = 1 << n_power;
+        Data64 offset_a = (Data64) lwe_index * lwe_n;
+
+        // c0 = b, c1 = -a_0 + sum a_t * X^(N - t)
+        bool occupied = false;
+        bool negate = false;
+        uint32_t input_reg = 0;
+        if (block_z == 0)
+        {
+            if (idx == 0)
+            {
+                input_reg = input_b[lwe_index];
+                occupied = true;
+            }
+        }
+        else
+        {
+            if (idx == 0)
+            {
+                input_reg = input_a[offset_a];
+                occupied = true;
+                negate = true;
+            }
+            else if ((N - idx) < lwe_n)
+            {
+                input_reg = input_a[offset_a + (N - idx)];
+                occupied = true;
+            }
+        }
+
+        Data64 result = 0;
+        if (occupied)
+        {
+            Modulus64 modulus_reg = modulus[block_y];
+
+            // round(u * Q / 2^32)
+            //   = u * floor(Q / 2^32) + round(u * (Q mod 2^32) / 2^32)
+            Data64 high = static_cast<Data64>(input_reg);
+            Data64 low = ((high * torus_remainder) + (1ULL << 31)) >> 32;
+
+            high = OPERATOR_GPU_64::reduce_forced(high, modulus_reg);
+            high = OPERATOR_GPU_64::mult(high, lift_factors[block_y],
+                                         modulus_reg);
+
+            low = OPERATOR_GPU_64::reduce_forced(low, modulus_reg);
+            low = OPERATOR_GPU_64::mult(
+                low, lift_factors[rns_mod_count + block_y], modulus_reg);
+
+            result = OPERATOR_GPU_64::add(high, low, modulus_reg);
+
+            if (negate)
+            {
+                Data64 zero = 0;
+                result = OPERATOR_GPU_64::sub(zero, result, modulus_reg);
+            }
+        }
+
+        output[idx + (block_y << n_power) +
+               ((rns_mod_count * block_z) << n_power)] = result;
+    }
+
+    __global__ void lwe_packing_butterfly_kernel(
+        const Data64* even, const Data64* odd, const Data64* monomial,
+        Data64* sum, Data64* difference, Modulus64* modulus, int n_power,
+        int rns_mod_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // ring size
+        int block_y = blockIdx.y; // rns count
+        int block_z = blockIdx.z; // cipher size
+
+        int location = idx + (block_y << n_power) +
+                       ((rns_mod_count * block_z) << n_power);
+
+        Modulus64 modulus_reg = modulus[block_y];
+
+        Data64 even_reg = even[location];
+        Data64 odd_reg = OPERATOR_GPU_64::mult(
+            odd[location], monomial[idx + (block_y << n_power)], modulus_reg);
+
+        sum[location] = OPERATOR_GPU_64::add(even_reg, odd_reg, modulus_reg);
+        difference[location] =
+            OPERATOR_GPU_64::sub(even_reg, odd_reg, modulus_reg);
+    }
+
+    __global__ void rlwe_to_torus_kernel(const Data64* input, int32_t* output,
+                                         Modulus64* modulus,
+                                         const Data64* crt_inverse,
+                                         int n_power, int rns_mod_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // ring size
+        int block_y = blockIdx.y; // cipher size
+
+        // x / Q = sum_i [x_i * (Q / q_i)^-1]_q_i / q_i mod 1
+        uint32_t result = 0;
+        for (int i = 0; i < rns_mod_count; i++)
+        {
+            Data64 input_reg = input[idx + (i << n_power) +
+                                     ((rns_mod_count * block_y) << n_power)];
+            input_reg =
+                OPERATOR_GPU_64::mult(input_reg, crt_inverse[i], modulus[i]);
+
+            double fraction = static_cast<double>(input_reg) /
+                              static_cast<double>(modulus[i].value);
+            result += static_cast<uint32_t>(
+                __double2ull_rn(fraction * 4294967296.0));
+        }
+
+        int N = 1 << n_power;
+        if (block_y == 0)
+        {
+            output[N + idx] = static_cast<int32_t>(result);
+        }
+        else
+        {
+            output[idx] = static_cast<int32_t>(0u - result);
+        }
+    }
+
+    __global__ void tfhe_strided_sample_extraction_kernel(
+        const int32_t* input, int32_t* output_a, int32_t* output_b, int N,
+        int stride)
+    {
+        int idx_x = threadIdx.x;
+        int block_x = blockIdx.x; // cipher size
+
+        int index = block_x * stride;
+        Data64 offset_o = (Data64) block_x * N;
+
+        for (int i = idx_x; i < N; i += blockDim.x)
+        {
+            output_a[offset_o + i] =
+                (i <= index) ? input[index - i] : -input[N + index - i];
+        }
+
+        if (idx_x == 0)
+        {
+            output_b[block_x] = input[N + index];
+        }
+    }
+
 } // namespace heongpu
\ No newline at end of file
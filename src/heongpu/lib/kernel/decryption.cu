@@ -366,47 +366,86 @@ namespace heongpu
         plaintext[index] = ct_0;
     }
 
-    //////////////////
-    //////////////////
-
-    __global__ void decryption_fusion_bfv_kernel(
-        Data64* ct, Data64* plain, Modulus64* modulus, Modulus64 plain_mod,
-        Modulus64 gamma, Data64* Qi_t, Data64* Qi_gamma, Data64* Qi_inverse,
-        Data64 mulq_inv_t, Data64 mulq_inv_gamma, Data64 inv_gamma, int n_power,
+    __global__ void partial_decrypt_ckks_batch_kernel(
+        Data64** ciphertexts, Data64** partial_ciphertexts, Data64* sk,
+        Data64* error_poly, Modulus64* modulus, int n_power,
         int decomp_mod_count)
     {
         int idx = blockIdx.x * blockDim.x + threadIdx.x; // ring_size
+        int block_y = blockIdx.y; // decomp_mod_count
+        int block_z = blockIdx.z; // cipher_count
 
-        Data64 sum_t = 0;
-        Data64 sum_gamma = 0;
+        int index = idx + (block_y << n_power);
+        int offset = decomp_mod_count << n_power;
 
-#pragma unroll
-        for (int i = 0; i < decomp_mod_count; i++)
+        Data64* ciphertext = ciphertexts[block_z];
+        Data64* partial_ciphertext = partial_ciphertexts[block_z];
+
+        Data64 ct_0 = ciphertext[index];
+        Data64 ct_1 = ciphertext[index + offset];
+        Data64 sk_ = sk[index];
+        Data64 error = error_poly[index + (block_z * offset)];
+
+        ct_1 = OPERATOR_GPU_64::mult(ct_1, sk_, modulus[block_y]);
+        ct_1 = OPERATOR_GPU_64::add(ct_1, error, modulus[block_y]);
+
+        partial_ciphertext[index] = ct_0;
+        partial_ciphertext[index + offset] = ct_1;
+    }
+
+    __global__ void decrypt_fusion_ckks_batch_kernel(
+        Data64** partial_ciphertexts, Data64** plaintexts, Modulus64* modulus,
+        int n_power, int decomp_mod_count, int party_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // ring_size
+        int block_y = blockIdx.y; // decomp_mod_count
+        int block_z = blockIdx.z; // cipher_count
+
+        int index = idx + (block_y << n_power);
+        int offset = decomp_mod_count << n_power;
+
+        Data64** shares = partial_ciphertexts + (block_z * party_count);
+
+        Data64 result = shares[0][index];
+        for (int i = 0; i < party_count; i++)
         {
-            int location = idx + (i << n_power);
+            result = OPERATOR_GPU_64::add(result, shares[i][index + offset],
+                                          modulus[block_y]);
+        }
+
+        plaintexts[block_z][index] = result;
+    }
 
-            Data64 mt = ct[location];
+    //////////////////
+    //////////////////
 
-            Data64 gamma_ =
-                OPERATOR_GPU_64::reduce_forced(gamma.value, modulus[i]);
+    __device__ void decryption_fusion_bfv_accumulate(
+        Data64 mt, Modulus64 modulus, Modulus64 plain_mod, Modulus64 gamma,
+        Data64 Qi_t, Data64 Qi_gamma, Data64 Qi_inverse, Data64& sum_t,
+        Data64& sum_gamma)
+    {
+        Data64 gamma_ = OPERATOR_GPU_64::reduce_forced(gamma.value, modulus);
 
-            mt = OPERATOR_GPU_64::mult(mt, plain_mod.value, modulus[i]);
+        mt = OPERATOR_GPU_64::mult(mt, plain_mod.value, modulus);
 
-            mt = OPERATOR_GPU_64::mult(mt, gamma_, modulus[i]);
+        mt = OPERATOR_GPU_64::mult(mt, gamma_, modulus);
 
-            mt = OPERATOR_GPU_64::mult(mt, Qi_inverse[i], modulus[i]);
+        mt = OPERATOR_GPU_64::mult(mt, Qi_inverse, modulus);
 
-            Data64 mt_in_t = OPERATOR_GPU_64::reduce_forced(mt, plain_mod);
-            Data64 mt_in_gamma = OPERATOR_GPU_64::reduce_forced(mt, gamma);
+        Data64 mt_in_t = OPERATOR_GPU_64::reduce_forced(mt, plain_mod);
+        Data64 mt_in_gamma = OPERATOR_GPU_64::reduce_forced(mt, gamma);
 
-            mt_in_t = OPERATOR_GPU_64::mult(mt_in_t, Qi_t[i], plain_mod);
-            mt_in_gamma =
-                OPERATOR_GPU_64::mult(mt_in_gamma, Qi_gamma[i], gamma);
+        mt_in_t = OPERATOR_GPU_64::mult(mt_in_t, Qi_t, plain_mod);
+        mt_in_gamma = OPERATOR_GPU_64::mult(mt_in_gamma, Qi_gamma, gamma);
 
-            sum_t = OPERATOR_GPU_64::add(sum_t, mt_in_t, plain_mod);
-            sum_gamma = OPERATOR_GPU_64::add(sum_gamma, mt_in_gamma, gamma);
-        }
+        sum_t = OPERATOR_GPU_64::add(sum_t, mt_in_t, plain_mod);
+        sum_gamma = OPERATOR_GPU_64::add(sum_gamma, mt_in_gamma, gamma);
+    }
 
+    __device__ Data64 decryption_fusion_bfv_round(
+        Data64 sum_t, Data64 sum_gamma, Modulus64 plain_mod, Modulus64 gamma,
+        Data64 mulq_inv_t, Data64 mulq_inv_gamma, Data64 inv_gamma)
+    {
         sum_t = OPERATOR_GPU_64::mult(sum_t, mulq_inv_t, plain_mod);
         sum_gamma = OPERATOR_GPU_64::mult(sum_gamma, mulq_inv_gamma, gamma);
 
@@ -421,9 +460,7 @@ namespace heongpu
 
             Data64 result = OPERATOR_GPU_64::sub(gamma_, sum_gamma_, plain_mod);
             result = OPERATOR_GPU_64::add(sum_t, result, plain_mod);
-            result = OPERATOR_GPU_64::mult(result, inv_gamma, plain_mod);
-
-            plain[idx] = result;
+            return OPERATOR_GPU_64::mult(result, inv_gamma, plain_mod);
         }
         else
         {
@@ -432,10 +469,108 @@ namespace heongpu
                 OPERATOR_GPU_64::reduce_forced(sum_gamma, plain_mod);
 
             Data64 result = OPERATOR_GPU_64::sub(sum_t_, sum_gamma_, plain_mod);
-            result = OPERATOR_GPU_64::mult(result, inv_gamma, plain_mod);
+            return OPERATOR_GPU_64::mult(result, inv_gamma, plain_mod);
+        }
+    }
 
-            plain[idx] = result;
+    __global__ void decryption_fusion_bfv_kernel(
+        Data64* ct, Data64* plain, Modulus64* modulus, Modulus64 plain_mod,
+        Modulus64 gamma, Data64* Qi_t, Data64* Qi_gamma, Data64* Qi_inverse,
+        Data64 mulq_inv_t, Data64 mulq_inv_gamma, Data64 inv_gamma, int n_power,
+        int decomp_mod_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // ring_size
+
+        Data64 sum_t = 0;
+        Data64 sum_gamma = 0;
+
+#pragma unroll
+        for (int i = 0; i < decomp_mod_count; i++)
+        {
+            int location = idx + (i << n_power);
+
+            decryption_fusion_bfv_accumulate(
+                ct[location], modulus[i], plain_mod, gamma, Qi_t[i],
+                Qi_gamma[i], Qi_inverse[i], sum_t, sum_gamma);
         }
+
+        plain[idx] =
+            decryption_fusion_bfv_round(sum_t, sum_gamma, plain_mod, gamma,
+                                        mulq_inv_t, mulq_inv_gamma, inv_gamma);
+    }
+
+    __global__ void sk_multiplication_bfv_batch_kernel(Data64* ct1, Data64* sk,
+                                                       Modulus64* modulus,
+                                                       int n_power,
+                                                       int decomp_mod_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // ring_size
+        int block_y = blockIdx.y; // decomp_mod_count
+        int block_z = blockIdx.z; // cipher_count
+
+        int index = idx + (block_y << n_power);
+        int location = index + ((block_z * decomp_mod_count) << n_power);
+
+        ct1[location] =
+            OPERATOR_GPU_64::mult(ct1[location], sk[index], modulus[block_y]);
+    }
+
+    __global__ void partial_decrypt_bfv_batch_kernel(
+        Data64** ciphertexts, Data64** partial_ciphertexts, Data64* ct1_sk,
+        Data64* error_poly, Modulus64* modulus, int n_power,
+        int decomp_mod_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // ring_size
+        int block_y = blockIdx.y; // decomp_mod_count
+        int block_z = blockIdx.z; // cipher_count
+
+        int index = idx + (block_y << n_power);
+        int offset = decomp_mod_count << n_power;
+        int location = index + (block_z * offset);
+
+        Data64* ciphertext = ciphertexts[block_z];
+        Data64* partial_ciphertext = partial_ciphertexts[block_z];
+
+        partial_ciphertext[index] = ciphertext[index];
+        partial_ciphertext[index + offset] = OPERATOR_GPU_64::add(
+            ct1_sk[location], error_poly[location], modulus[block_y]);
+    }
+
+    __global__ void decrypt_fusion_bfv_batch_kernel(
+        Data64** partial_ciphertexts, Data64** plaintexts, Modulus64* modulus,
+        Modulus64 plain_mod, Modulus64 gamma, Data64* Qi_t, Data64* Qi_gamma,
+        Data64* Qi_inverse, Data64 mulq_inv_t, Data64 mulq_inv_gamma,
+        Data64 inv_gamma, int n_power, int decomp_mod_count, int party_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // ring_size
+        int block_z = blockIdx.z; // cipher_count
+
+        int offset = decomp_mod_count << n_power;
+
+        Data64** shares = partial_ciphertexts + (block_z * party_count);
+
+        Data64 sum_t = 0;
+        Data64 sum_gamma = 0;
+
+        for (int i = 0; i < decomp_mod_count; i++)
+        {
+            int location = idx + (i << n_power);
+
+            Data64 mt = shares[0][location];
+            for (int j = 0; j < party_count; j++)
+            {
+                mt = OPERATOR_GPU_64::add(mt, shares[j][location + offset],
+                                          modulus[i]);
+            }
+
+            decryption_fusion_bfv_accumulate(mt, modulus[i], plain_mod, gamma,
+                                             Qi_t[i], Qi_gamma[i],
+                                             Qi_inverse[i], sum_t, sum_gamma);
+        }
+
+        plaintexts[block_z][idx] =
+            decryption_fusion_bfv_round(sum_t, sum_gamma, plain_mod, gamma,
+                                        mulq_inv_t, mulq_inv_gamma, inv_gamma);
     }
 
     __global__ void decrypt_lwe_kernel(int32_t* sk, int32_t* input_a,
@@ -477,4 +612,30 @@ namespace heongpu
         }
     }
 
+    __global__ void decryption_bgv_kernel(Data64* ct0, Data64* ct1s,
+                                          Data64* plain, Modulus64* modulus,
+                                          Modulus64 plain_mod,
+                                          Data64 correction_inv, int n_power)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // ring_size
+
+        Modulus64 q0 = modulus[0];
+        Data64 value = OPERATOR_GPU_64::add(ct0[idx], ct1s[idx], q0);
+
+        Data64 message;
+        if (value > (q0.value >> 1))
+        {
+            // Negative coefficient: -(q0 - value) mod t
+            Data64 negative =
+                OPERATOR_GPU_64::reduce_forced(q0.value - value, plain_mod);
+            message = OPERATOR_GPU_64::sub(0, negative, plain_mod);
+        }
+        else
+        {
+            message = OPERATOR_GPU_64::reduce_forced(value, plain_mod);
+        }
+
+        plain[idx] = OPERATOR_GPU_64::mult(message, correction_inv, plain_mod);
+    }
+
 } // namespace heongpu
\ No newline at end of file
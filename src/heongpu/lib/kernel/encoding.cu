@@ -133,9 +133,10 @@ namespace heongpu
     encode_kernel_ckks_conversion(Data64* plaintext, Complex64* complex_message,
                                   Modulus64* modulus, int coeff_modulus_count,
                                   double two_pow_64, int* reverse_order,
-                                  int n_power)
+                                  int log_gap, int n_power)
     {
         int idx = blockIdx.x * blockDim.x + threadIdx.x; // slot_count
+        int location = idx << log_gap;
 
         int order = reverse_order[idx];
         Complex64 partial_message = complex_message[order];
@@ -154,7 +155,7 @@ namespace heongpu
             for (int i = 0; i < coeff_modulus_count; i++)
             {
                 Data64 temp = OPERATOR_GPU_64::reduce(coeff, modulus[i]);
-                plaintext[idx + (i << n_power)] =
+                plaintext[location + (i << n_power)] =
                     OPERATOR_GPU_64::sub(modulus[i].value, temp, modulus[i]);
             }
         }
@@ -162,7 +163,7 @@ namespace heongpu
         {
             for (int i = 0; i < coeff_modulus_count; i++)
             {
-                plaintext[idx + (i << n_power)] =
+                plaintext[location + (i << n_power)] =
                     OPERATOR_GPU_64::reduce(coeff, modulus[i]);
             }
         }
@@ -184,7 +185,7 @@ namespace heongpu
             for (int i = 0; i < coeff_modulus_count; i++)
             {
                 Data64 temp = OPERATOR_GPU_64::reduce(coeff2, modulus[i]);
-                plaintext[idx + offset + (i << n_power)] =
+                plaintext[location + offset + (i << n_power)] =
                     OPERATOR_GPU_64::sub(modulus[i].value, temp, modulus[i]);
             }
         }
@@ -192,7 +193,7 @@ namespace heongpu
         {
             for (int i = 0; i < coeff_modulus_count; i++)
             {
-                plaintext[idx + offset + (i << n_power)] =
+                plaintext[location + offset + (i << n_power)] =
                     OPERATOR_GPU_64::reduce(coeff2, modulus[i]);
             }
         }
@@ -202,9 +203,10 @@ namespace heongpu
         Complex64* complex_message, Data64* plaintext, Modulus64* modulus,
         Data64* Mi_inv, Data64* Mi, Data64* upper_half_threshold,
         Data64* decryption_modulus, int coeff_modulus_count, double scale,
-        double two_pow_64, int* reverse_order, int n_power)
+        double two_pow_64, int* reverse_order, int log_gap, int n_power)
     {
         int idx = blockIdx.x * blockDim.x + threadIdx.x; // slot_count
+        int location = idx << log_gap;
         double inv_scale = double(1.0) / scale;
         double two_pow_64_reg = two_pow_64;
         int offset = 1 << (n_power - 1);
@@ -217,7 +219,7 @@ namespace heongpu
 #pragma unroll
         for (int i = 0; i < coeff_modulus_count; i++)
         {
-            Data64 base = plaintext[idx + (i << n_power)];
+            Data64 base = plaintext[location + (i << n_power)];
             Data64 temp = OPERATOR_GPU_64::mult(base, Mi_inv[i], modulus[i]);
 
             biginteger::multiply(Mi + (i * coeff_modulus_count),
@@ -285,7 +287,7 @@ namespace heongpu
 #pragma unroll
         for (int i = 0; i < coeff_modulus_count; i++)
         {
-            Data64 base = plaintext[idx + offset + (i << n_power)];
+            Data64 base = plaintext[location + offset + (i << n_power)];
             Data64 temp = OPERATOR_GPU_64::mult(base, Mi_inv[i], modulus[i]);
 
             biginteger::multiply(Mi + (i * coeff_modulus_count),
@@ -4,6 +4,7 @@
 // Developer: Alişah Özcan
 
 #include "encryption.cuh"
+#include "switchkey.cuh"
 
 namespace heongpu
 {
@@ -266,6 +267,140 @@ namespace heongpu
         ciphertext[idx + (block_y << n_power)] = ct_0;
     }
 
+    __global__ void pk_u_batch_kernel(Data64* pk, Data64* u, Data64* pk_u,
+                                      Modulus64* modulus, int n_power,
+                                      int rns_mod_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
+        int block_y = blockIdx.y; // rns_mod_count
+        int block_z = blockIdx.z; // 2 x Encryption Count
+
+        int index = block_z >> 1;
+        int component = block_z & 1;
+
+        Data64 pk_ = pk[idx + (block_y << n_power) +
+                        ((rns_mod_count << n_power) * component)];
+        Data64 u_ = u[idx + (block_y << n_power) +
+                      ((rns_mod_count << n_power) * index)];
+
+        Data64 pk_u_ = OPERATOR_GPU_64::mult(pk_, u_, modulus[block_y]);
+
+        pk_u[idx + (block_y << n_power) +
+             ((rns_mod_count << n_power) * block_z)] = pk_u_;
+    }
+
+    __global__ void enc_div_lastq_bfv_batch_kernel(
+        Data64* pk, Data64* e, Data64** plain, Data64** ct, Modulus64* modulus,
+        Data64* half, Data64* half_mod, Data64* last_q_modinv,
+        Modulus64 plain_mod, Data64 Q_mod_t, Data64 upper_threshold,
+        Data64* coeffdiv_plain, int n_power, int Q_prime_size, int Q_size,
+        int P_size)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
+        int block_y = blockIdx.y; // Decomposition Modulus Count (Q_size)
+        int block_z = blockIdx.z; // 2 x Encryption Count
+
+        int index = block_z >> 1;
+        int component = block_z & 1;
+
+        // Max P size is 15.
+        Data64 last_pk[15];
+        for (int i = 0; i < P_size; i++)
+        {
+            Data64 last_pk_ = pk[idx + ((Q_size + i) << n_power) +
+                                 ((Q_prime_size << n_power) * block_z)];
+            Data64 last_e_ = e[idx + ((Q_size + i) << n_power) +
+                               ((Q_prime_size << n_power) * block_z)];
+            last_pk[i] =
+                OPERATOR_GPU_64::add(last_pk_, last_e_, modulus[Q_size + i]);
+        }
+
+        Data64 input_ = pk[idx + (block_y << n_power) +
+                           ((Q_prime_size << n_power) * block_z)];
+        Data64 e_ = e[idx + (block_y << n_power) +
+                      ((Q_prime_size << n_power) * block_z)];
+        input_ = OPERATOR_GPU_64::add(input_, e_, modulus[block_y]);
+
+        Data64 zero_ = 0;
+        int location_ = 0;
+        for (int i = 0; i < P_size; i++)
+        {
+            Data64 last_pk_add_half_ = last_pk[(P_size - 1 - i)];
+            last_pk_add_half_ = OPERATOR_GPU_64::add(
+                last_pk_add_half_, half[i], modulus[(Q_prime_size - 1 - i)]);
+            for (int j = 0; j < (P_size - 1 - i); j++)
+            {
+                Data64 temp1 = OPERATOR_GPU_64::add(last_pk_add_half_, zero_,
+                                                    modulus[Q_size + j]);
+                temp1 = OPERATOR_GPU_64::sub(temp1,
+                                             half_mod[location_ + Q_size + j],
+                                             modulus[Q_size + j]);
+
+                temp1 = OPERATOR_GPU_64::sub(last_pk[j], temp1,
+                                             modulus[Q_size + j]);
+
+                last_pk[j] = OPERATOR_GPU_64::mult(
+                    temp1, last_q_modinv[location_ + Q_size + j],
+                    modulus[Q_size + j]);
+            }
+
+            Data64 temp1 = OPERATOR_GPU_64::add(last_pk_add_half_, zero_,
+                                                modulus[block_y]);
+            temp1 = OPERATOR_GPU_64::sub(temp1, half_mod[location_ + block_y],
+                                         modulus[block_y]);
+
+            temp1 = OPERATOR_GPU_64::sub(input_, temp1, modulus[block_y]);
+
+            input_ = OPERATOR_GPU_64::mult(
+                temp1, last_q_modinv[location_ + block_y], modulus[block_y]);
+
+            location_ = location_ + (Q_prime_size - 1 - i);
+        }
+
+        if (component == 0)
+        {
+            Data64 message = plain[index][idx];
+            Data64 fix = message * Q_mod_t;
+            fix = fix + upper_threshold;
+            fix = int(fix / plain_mod.value);
+
+            Data64 ct_0 = OPERATOR_GPU_64::mult(
+                message, coeffdiv_plain[block_y], modulus[block_y]);
+            ct_0 = OPERATOR_GPU_64::add(ct_0, fix, modulus[block_y]);
+
+            input_ = OPERATOR_GPU_64::add(input_, ct_0, modulus[block_y]);
+        }
+
+        ct[index][idx + (block_y << n_power) +
+                  (((Q_size) << n_power) * component)] = input_;
+    }
+
+    __global__ void cipher_message_add_batch_kernel(Data64* ciphertext,
+                                                    Data64** plaintext,
+                                                    Data64** output,
+                                                    Modulus64* modulus,
+                                                    int n_power, int Q_size)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
+        int block_y = blockIdx.y; // Decomposition Modulus Count (Q_size)
+        int block_z = blockIdx.z; // 2 x Encryption Count
+
+        int index = block_z >> 1;
+        int component = block_z & 1;
+
+        Data64 ct_ = ciphertext[idx + (block_y << n_power) +
+                                ((Q_size << n_power) * block_z)];
+
+        if (component == 0)
+        {
+            Data64 plaintext_ = plaintext[index][idx + (block_y << n_power)];
+            ct_ = OPERATOR_GPU_64::add(ct_, plaintext_, modulus[block_y]);
+        }
+
+        output[index][idx + (block_y << n_power) +
+                      ((Q_size << n_power) * component)] = ct_;
+    }
+
     __global__ void initialize_random_states_kernel(curandState* states,
                                                     Data64 seed,
                                                     int total_threads)
@@ -326,4 +461,55 @@ namespace heongpu
         states[g_idx] = local_state;
     }
 
+    __global__ void enc_div_lastq_bgv_kernel(
+        Data64* pk, Data64* e, Data64* plain, Data64* ct, Modulus64* modulus,
+        Data64* last_q_modinv, Data64 plain_mod, Data64 plain_inv,
+        Data64 upper_threshold, Data64* upper_halfincrement, int n_power,
+        int Q_prime_size, int Q_size)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
+        int block_y = blockIdx.y; // Decomposition Modulus Count (Q_size)
+        int block_z = blockIdx.z; // Cipher Size (2)
+
+        int poly_offset = (Q_prime_size << n_power) * block_z;
+
+        // P limb of pk * u + t * e
+        Modulus64 last_modulus = modulus[Q_size];
+        Data64 last_pk = pk[idx + (Q_size << n_power) + poly_offset];
+        Data64 last_e = e[idx + (Q_size << n_power) + poly_offset];
+        Data64 plain_mod_last =
+            OPERATOR_GPU_64::reduce_forced(plain_mod, last_modulus);
+        last_e = OPERATOR_GPU_64::mult(last_e, plain_mod_last, last_modulus);
+        last_pk = OPERATOR_GPU_64::add(last_pk, last_e, last_modulus);
+
+        Data64 correction = bgv_divisibility_correction(
+            last_pk, last_modulus, plain_inv, plain_mod, modulus[block_y]);
+
+        Data64 input_ = pk[idx + (block_y << n_power) + poly_offset];
+        Data64 e_ = e[idx + (block_y << n_power) + poly_offset];
+        Data64 plain_mod_ =
+            OPERATOR_GPU_64::reduce_forced(plain_mod, modulus[block_y]);
+        e_ = OPERATOR_GPU_64::mult(e_, plain_mod_, modulus[block_y]);
+        input_ = OPERATOR_GPU_64::add(input_, e_, modulus[block_y]);
+
+        input_ = OPERATOR_GPU_64::sub(input_, correction, modulus[block_y]);
+        input_ = OPERATOR_GPU_64::mult(input_, last_q_modinv[block_y],
+                                       modulus[block_y]);
+
+        if (block_z == 0)
+        {
+            Data64 message = plain[idx];
+            if (message >= upper_threshold)
+            {
+                message = OPERATOR_GPU_64::add(
+                    message, upper_halfincrement[block_y], modulus[block_y]);
+            }
+
+            input_ = OPERATOR_GPU_64::add(input_, message, modulus[block_y]);
+        }
+
+        ct[idx + (block_y << n_power) + ((Q_size << n_power) * block_z)] =
+            input_;
+    }
+
 } // namespace heongpu
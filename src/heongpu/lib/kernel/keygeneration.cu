@@ -114,7 +114,8 @@ namespace heongpu
     __global__ void relinkey_gen_kernel(Data64* relin_key, Data64* secret_key,
                                         Data64* error_poly, Data64* a_poly,
                                         Modulus64* modulus, Data64* factor,
-                                        int n_power, int rns_mod_count)
+                                        int n_power, int rns_mod_count,
+                                        int decomp_mod_count)
     {
         int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
         int block_y = blockIdx.y; // rns_mod_count
@@ -123,8 +124,7 @@ namespace heongpu
 
         Data64 sk = secret_key[idx + (block_y << n_power)];
 
-#pragma unroll
-        for (int i = 0; i < rns_mod_count - 1; i++)
+        for (int i = 0; i < decomp_mod_count; i++)
         {
             Data64 e = error_poly[idx + (block_y << n_power) +
                                   ((rns_mod_count * i) << n_power)];
@@ -773,6 +773,59 @@ namespace heongpu
         }
     }
 
+    __global__ void galoiskey_gen_batch_kernel(
+        Data64** galois_keys, Data64* secret_key, Data64* error_poly,
+        Data64* a_poly, Modulus64* modulus, Data64* factor, int* galois_elts,
+        int n_power, int rns_mod_count, int decomp_mod_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
+        int block_y = blockIdx.y; // rns_mod_count
+        int block_z = blockIdx.z; // key count
+
+        int location1 = block_y << n_power;
+        int coeff_count = 1 << n_power;
+
+        Data64* galois_key = galois_keys[block_z];
+        int key_offset = (rns_mod_count * decomp_mod_count * block_z)
+                         << n_power;
+
+        int permutation_location =
+            permutation(idx, galois_elts[block_z], coeff_count, n_power);
+        Data64 sk_permutation =
+            secret_key[(block_y << n_power) + permutation_location];
+
+        for (int i = 0; i < decomp_mod_count; i++)
+        {
+            Data64 e = error_poly[key_offset + idx + (block_y << n_power) +
+                                  ((rns_mod_count * i) << n_power)];
+            Data64 a = a_poly[key_offset + idx + (block_y << n_power) +
+                              ((rns_mod_count * i) << n_power)];
+
+            Data64 gk_0 =
+                OPERATOR_GPU_64::mult(sk_permutation, a, modulus[block_y]);
+            gk_0 = OPERATOR_GPU_64::add(gk_0, e, modulus[block_y]);
+            Data64 zero = 0;
+
+            gk_0 = OPERATOR_GPU_64::sub(zero, gk_0, modulus[block_y]);
+
+            if (i == block_y)
+            {
+                Data64 sk = secret_key[idx + (block_y << n_power)];
+
+                sk = OPERATOR_GPU_64::mult(sk, factor[block_y],
+                                           modulus[block_y]);
+
+                gk_0 = OPERATOR_GPU_64::add(gk_0, sk, modulus[block_y]);
+            }
+
+            galois_key[idx + location1 +
+                       ((rns_mod_count * i) << (n_power + 1))] = gk_0;
+            galois_key[idx + location1 +
+                       ((rns_mod_count * i) << (n_power + 1)) +
+                       (rns_mod_count << n_power)] = a;
+        }
+    }
+
     __global__ void galoiskey_gen_II_kernel(
         Data64* galois_key_temp, Data64* secret_key, Data64* error_poly,
         Data64* a_poly, Modulus64* modulus, Data64* factor, int galois_elt,
@@ -860,6 +913,67 @@ namespace heongpu
         }
     }
 
+    __global__ void multi_party_key_tree_reduction_kernel(
+        Data64** input, Data64** output, Modulus64* modulus, int n_power,
+        int rns_mod_count, int decomp_mod_count, int stride, int count,
+        bool reduce_second)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
+        int block_y = blockIdx.y; // rns_mod_count
+        int block_z = blockIdx.z; // pair count
+
+        int left = (block_z * stride) << 1;
+        int right = left + stride;
+
+        if ((right >= count) && (input == output))
+        {
+            return;
+        }
+
+        Data64* left_key = input[left];
+        Data64* right_key = (right < count) ? input[right] : nullptr;
+        Data64* output_key = output[left];
+
+        int location = idx + (block_y << n_power);
+        int offset = (rns_mod_count << n_power);
+
+#pragma unroll
+        for (int i = 0; i < decomp_mod_count; i++)
+        {
+            int inner_location =
+                location + ((rns_mod_count * i) << (n_power + 1));
+
+            Data64 key_0 = left_key[inner_location];
+            Data64 key_1 = left_key[inner_location + offset];
+
+            if (right_key != nullptr)
+            {
+                key_0 = OPERATOR_GPU_64::add(key_0, right_key[inner_location],
+                                             modulus[block_y]);
+                if (reduce_second)
+                {
+                    key_1 = OPERATOR_GPU_64::add(
+                        key_1, right_key[inner_location + offset],
+                        modulus[block_y]);
+                }
+            }
+
+            output_key[inner_location] = key_0;
+            output_key[inner_location + offset] = key_1;
+        }
+    }
+
+    __global__ void compact_key_limbs_kernel(Data64* input, Data32* output,
+                                             Data64 size)
+    {
+        Data64 idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+        if (idx < size)
+        {
+            output[idx] = static_cast<Data32>(input[idx]);
+        }
+    }
+
     /////////////////////
 
     __global__ void switchkey_gen_kernel(Data64* switch_key,
@@ -1214,6 +1328,23 @@ namespace heongpu
             shared_memory_poly1[idx_x + blockDim.x];
     }
 
+    __global__ void tfhe_convert_rlwekey_from_rns_kernel(
+        int32_t* key_out, const Data64* key_in, const Modulus64* modulus,
+        int N)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+        if (idx < N)
+        {
+            Data64 key_reg = key_in[idx];
+            Data64 modulus_reg = modulus[0].value;
+
+            key_out[idx] = (key_reg > (modulus_reg >> 1))
+                               ? -static_cast<int32_t>(modulus_reg - key_reg)
+                               : static_cast<int32_t>(key_reg);
+        }
+    }
+
     // Should Perform 512 Threads !
     __global__ void tfhe_generate_bootkey_kernel(
         const Data64* sk_rlwe, const int32_t* sk_lwe, int32_t* boot_key,
@@ -1414,4 +1545,39 @@ namespace heongpu
         }
     }
 
+    __global__ void tfhe_convert_bootkey_fft_domain_kernel(
+        double* key_out, const int32_t* key_in, const double* fft_root_table,
+        const double* fft_twist_table, int N, int k, int bk_length)
+    {
+        __shared__ double shared_real[512];
+        __shared__ double shared_imag[512];
+
+        const int idx_x = threadIdx.x;
+        const int block_x = blockIdx.x;
+
+        const int N_reg = N;
+        const int k_reg = k;
+        const int length_reg = bk_length;
+
+        Data64 offset_block = block_x * (Data64) (k_reg + 1) *
+                              ((Data64) length_reg * (k_reg + 1) * N_reg);
+
+        int polynomial_count = (k_reg + 1) * length_reg * (k_reg + 1);
+        for (int loop = 0; loop < polynomial_count; loop++)
+        {
+            Data64 offset = offset_block + ((Data64) loop * N_reg);
+
+            shared_real[idx_x] = static_cast<double>(key_in[offset + idx_x]);
+            shared_imag[idx_x] =
+                static_cast<double>(key_in[offset + idx_x + blockDim.x]);
+            __syncthreads();
+
+            SmallForwardFFT(shared_real, shared_imag, fft_root_table,
+                            fft_twist_table);
+
+            key_out[offset + idx_x] = shared_real[idx_x];
+            key_out[offset + idx_x + blockDim.x] = shared_imag[idx_x];
+        }
+    }
+
 } // namespace heongpu
\ No newline at end of file
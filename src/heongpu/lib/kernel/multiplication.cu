@@ -360,4 +360,24 @@ namespace heongpu
         out[location_ct] = sum_ctpt;
     }
 
+    __global__ void cipher_scalar_multiplication_kernel(Data64* input,
+                                                        Data64 scalar,
+                                                        Data64* output,
+                                                        Modulus64* modulus,
+                                                        int n_power)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // ring size
+        int block_y = blockIdx.y; // rns count
+        int block_z = blockIdx.z; // poly count
+
+        int location =
+            idx + (block_y << n_power) + ((gridDim.y * block_z) << n_power);
+
+        Data64 scalar_ =
+            OPERATOR_GPU_64::reduce_forced(scalar, modulus[block_y]);
+
+        output[location] =
+            OPERATOR_GPU_64::mult(input[location], scalar_, modulus[block_y]);
+    }
+
 } // namespace heongpu
\ No newline at end of file
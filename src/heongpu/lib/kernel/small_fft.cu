@@ -0,0 +1,116 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "small_fft.cuh"
+
+namespace heongpu
+{
+    __device__ void SmallForwardFFT(double* real_in_shared,
+                                    double* imag_in_shared,
+                                    const double* root_table,
+                                    const double* twist_table)
+    {
+        const int idx_x = threadIdx.x;
+        const int M = 512;
+        const int half = 256;
+
+        // Twist: (a_j + i * a_{j + 512}) * psi^j
+        double twist_real = twist_table[idx_x];
+        double twist_imag = twist_table[idx_x + M];
+        double value_real = real_in_shared[idx_x];
+        double value_imag = imag_in_shared[idx_x];
+        real_in_shared[idx_x] =
+            (value_real * twist_real) - (value_imag * twist_imag);
+        imag_in_shared[idx_x] =
+            (value_real * twist_imag) + (value_imag * twist_real);
+        __syncthreads();
+
+#pragma unroll
+        for (int t_ = 8; t_ >= 0; t_--)
+        {
+            if (idx_x < half)
+            {
+                int t = 1 << t_;
+                int position = idx_x & (t - 1);
+                int address0 = ((idx_x - position) << 1) + position;
+                int address1 = address0 + t;
+                int root_index = position << (8 - t_);
+
+                double root_real = root_table[root_index];
+                double root_imag = root_table[half + root_index];
+
+                double u_real = real_in_shared[address0];
+                double u_imag = imag_in_shared[address0];
+                double v_real = real_in_shared[address1];
+                double v_imag = imag_in_shared[address1];
+
+                real_in_shared[address0] = u_real + v_real;
+                imag_in_shared[address0] = u_imag + v_imag;
+
+                double d_real = u_real - v_real;
+                double d_imag = u_imag - v_imag;
+                real_in_shared[address1] =
+                    (d_real * root_real) - (d_imag * root_imag);
+                imag_in_shared[address1] =
+                    (d_real * root_imag) + (d_imag * root_real);
+            }
+            __syncthreads();
+        }
+    }
+
+    __device__ void SmallInverseFFT(double* real_in_shared,
+                                    double* imag_in_shared,
+                                    const double* root_table,
+                                    const double* twist_table)
+    {
+        const int idx_x = threadIdx.x;
+        const int M = 512;
+        const int half = 256;
+
+#pragma unroll
+        for (int t_ = 0; t_ <= 8; t_++)
+        {
+            if (idx_x < half)
+            {
+                int t = 1 << t_;
+                int position = idx_x & (t - 1);
+                int address0 = ((idx_x - position) << 1) + position;
+                int address1 = address0 + t;
+                int root_index = position << (8 - t_);
+
+                // Conjugate root
+                double root_real = root_table[root_index];
+                double root_imag = root_table[half + root_index];
+
+                double u_real = real_in_shared[address0];
+                double u_imag = imag_in_shared[address0];
+                double x_real = real_in_shared[address1];
+                double x_imag = imag_in_shared[address1];
+
+                double v_real = (x_real * root_real) + (x_imag * root_imag);
+                double v_imag = (x_imag * root_real) - (x_real * root_imag);
+
+                real_in_shared[address0] = u_real + v_real;
+                imag_in_shared[address0] = u_imag + v_imag;
+                real_in_shared[address1] = u_real - v_real;
+                imag_in_shared[address1] = u_imag - v_imag;
+            }
+            __syncthreads();
+        }
+
+        // Untwist by psi^-j and scale by 1/512
+        const double scale = 1.0 / static_cast<double>(M);
+        double twist_real = twist_table[idx_x] * scale;
+        double twist_imag = twist_table[idx_x + M] * scale;
+        double value_real = real_in_shared[idx_x];
+        double value_imag = imag_in_shared[idx_x];
+        real_in_shared[idx_x] =
+            (value_real * twist_real) + (value_imag * twist_imag);
+        imag_in_shared[idx_x] =
+            (value_imag * twist_real) - (value_real * twist_imag);
+        __syncthreads();
+    }
+
+} // namespace heongpu
@@ -132,8 +132,9 @@ namespace heongpu
         output[idx + (block_y << n_power) + key_offset1] = ct_1_sum;
     }
 
+    template <typename T>
     __global__ void multiply_accumulate_leveled_kernel(
-        Data64* input, Data64* relinkey, Data64* output, Modulus64* modulus,
+        Data64* input, T* relinkey, Data64* output, Modulus64* modulus,
         int first_rns_mod_count, int current_decomp_mod_count, int n_power)
     {
         int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
@@ -155,10 +156,11 @@ namespace heongpu
                 input[idx + (block_y << n_power) +
                       ((i * (current_decomp_mod_count + 1)) << n_power)];
 
-            Data64 rk0 =
-                relinkey[idx + (key_index << n_power) + (key_offset2 * i)];
-            Data64 rk1 = relinkey[idx + (key_index << n_power) +
-                                  (key_offset2 * i) + key_offset1];
+            Data64 rk0 = static_cast<Data64>(
+                relinkey[idx + (key_index << n_power) + (key_offset2 * i)]);
+            Data64 rk1 =
+                static_cast<Data64>(relinkey[idx + (key_index << n_power) +
+                                             (key_offset2 * i) + key_offset1]);
 
             Data64 mult0 =
                 OPERATOR_GPU_64::mult(in_piece, rk0, modulus[key_index]);
@@ -176,6 +178,14 @@ namespace heongpu
                ((current_decomp_mod_count + 1) << n_power)] = ct_1_sum;
     }
 
+    template __global__ void multiply_accumulate_leveled_kernel<Data64>(
+        Data64* input, Data64* relinkey, Data64* output, Modulus64* modulus,
+        int first_rns_mod_count, int current_decomp_mod_count, int n_power);
+
+    template __global__ void multiply_accumulate_leveled_kernel<Data32>(
+        Data64* input, Data32* relinkey, Data64* output, Modulus64* modulus,
+        int first_rns_mod_count, int current_decomp_mod_count, int n_power);
+
     __global__ void multiply_accumulate_leveled_method_II_kernel(
         Data64* input, Data64* relinkey, Data64* output, Modulus64* modulus,
         int first_rns_mod_count, int current_decomp_mod_count,
@@ -1558,4 +1568,293 @@ namespace heongpu
         }
     }
 
+    __global__ void cipher_broadcast_batch_kernel(Data64* input, Data64* output,
+                                                  Modulus64* modulus,
+                                                  int n_power, int Q_size,
+                                                  int rns_mod_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
+        int block_y = blockIdx.y; // Decomposition Modulus Count (Q_size)
+        int block_z = blockIdx.z; // Cipher Count
+
+        // Second polynomial of the block_z-th ciphertext.
+        Data64 result_value =
+            input[idx + (block_y << n_power) +
+                  ((((block_z << 1) + 1) * Q_size) << n_power)];
+
+        int location = ((rns_mod_count * block_y) +
+                        (rns_mod_count * Q_size * block_z))
+                       << n_power;
+
+        for (int i = 0; i < rns_mod_count; i++)
+        {
+            Data64 reduced_result =
+                OPERATOR_GPU_64::reduce_forced(result_value, modulus[i]);
+
+            output[idx + (i << n_power) + location] = reduced_result;
+        }
+    }
+
+    __global__ void multiply_accumulate_batch_kernel(Data64* input,
+                                                     Data64* relinkey,
+                                                     Data64* output,
+                                                     Modulus64* modulus,
+                                                     int n_power,
+                                                     int decomp_mod_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
+        int block_y = blockIdx.y; // RNS Modulus Count
+        int block_z = blockIdx.z; // Cipher Count
+
+        int key_offset1 = (decomp_mod_count + 1) << n_power;
+        int key_offset2 = (decomp_mod_count + 1) << (n_power + 1);
+
+        input = input +
+                ((decomp_mod_count * (decomp_mod_count + 1) * block_z)
+                 << n_power);
+        output = output + (key_offset2 * block_z);
+
+        Data64 ct_0_sum = 0;
+        Data64 ct_1_sum = 0;
+#pragma unroll
+        for (int i = 0; i < decomp_mod_count; i++)
+        {
+            Data64 in_piece = input[idx + (block_y << n_power) +
+                                    ((i * (decomp_mod_count + 1)) << n_power)];
+
+            Data64 rk0 =
+                relinkey[idx + (block_y << n_power) + (key_offset2 * i)];
+            Data64 rk1 = relinkey[idx + (block_y << n_power) +
+                                  (key_offset2 * i) + key_offset1];
+
+            Data64 mult0 =
+                OPERATOR_GPU_64::mult(in_piece, rk0, modulus[block_y]);
+            Data64 mult1 =
+                OPERATOR_GPU_64::mult(in_piece, rk1, modulus[block_y]);
+
+            ct_0_sum = OPERATOR_GPU_64::add(ct_0_sum, mult0, modulus[block_y]);
+            ct_1_sum = OPERATOR_GPU_64::add(ct_1_sum, mult1, modulus[block_y]);
+        }
+
+        output[idx + (block_y << n_power)] = ct_0_sum;
+        output[idx + (block_y << n_power) + key_offset1] = ct_1_sum;
+    }
+
+    __global__ void divide_round_lastq_permute_add_bfv_kernel(
+        Data64* input, Data64* ct, Data64* output, Modulus64* modulus,
+        Data64* half, Data64* half_mod, Data64* last_q_modinv, int galois_elt,
+        int n_power, int Q_prime_size, int Q_size, int P_size)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
+        int block_y = blockIdx.y; // Decomposition Modulus Count (Q_size)
+        int block_z = blockIdx.z; // Cipher Count * Cipher Size (2)
+
+        // Max P size is 15.
+        Data64 last_ct[15];
+        for (int i = 0; i < P_size; i++)
+        {
+            last_ct[i] = input[idx + ((Q_size + i) << n_power) +
+                               ((Q_prime_size << n_power) * block_z)];
+        }
+
+        Data64 input_ = input[idx + (block_y << n_power) +
+                              ((Q_prime_size << n_power) * block_z)];
+
+        Data64 zero_ = 0;
+        int location_ = 0;
+        for (int i = 0; i < P_size; i++)
+        {
+            Data64 last_ct_add_half_ = last_ct[(P_size - 1 - i)];
+            last_ct_add_half_ = OPERATOR_GPU_64::add(
+                last_ct_add_half_, half[i], modulus[(Q_prime_size - 1 - i)]);
+            for (int j = 0; j < (P_size - 1 - i); j++)
+            {
+                Data64 temp1 = OPERATOR_GPU_64::add(last_ct_add_half_, zero_,
+                                                    modulus[Q_size + j]);
+                temp1 = OPERATOR_GPU_64::sub(temp1,
+                                             half_mod[location_ + Q_size + j],
+                                             modulus[Q_size + j]);
+
+                temp1 = OPERATOR_GPU_64::sub(last_ct[j], temp1,
+                                             modulus[Q_size + j]);
+
+                last_ct[j] = OPERATOR_GPU_64::mult(
+                    temp1, last_q_modinv[location_ + Q_size + j],
+                    modulus[Q_size + j]);
+            }
+
+            Data64 temp1 = OPERATOR_GPU_64::add(last_ct_add_half_, zero_,
+                                                modulus[block_y]);
+            temp1 = OPERATOR_GPU_64::sub(temp1, half_mod[location_ + block_y],
+                                         modulus[block_y]);
+
+            temp1 = OPERATOR_GPU_64::sub(input_, temp1, modulus[block_y]);
+
+            input_ = OPERATOR_GPU_64::mult(
+                temp1, last_q_modinv[location_ + block_y], modulus[block_y]);
+
+            location_ = location_ + (Q_prime_size - 1 - i);
+        }
+
+        int ct_location =
+            (block_y << n_power) + ((Q_size << n_power) * block_z);
+
+        if ((block_z & 1) == 0)
+        {
+            input_ = OPERATOR_GPU_64::add(ct[idx + ct_location], input_,
+                                          modulus[block_y]);
+        }
+
+        int coeff_count_minus_one = (1 << n_power) - 1;
+
+        int index_raw = idx * galois_elt;
+        int index = index_raw & coeff_count_minus_one;
+
+        if ((index_raw >> n_power) & 1)
+        {
+            input_ = OPERATOR_GPU_64::sub(zero_, input_, modulus[block_y]);
+        }
+
+        // Galois image plus the original ciphertext.
+        output[index + ct_location] = OPERATOR_GPU_64::add(
+            ct[index + ct_location], input_, modulus[block_y]);
+    }
+
+    __device__ Data64 bgv_divisibility_correction(Data64 last_ct,
+                                                  Modulus64 last_modulus,
+                                                  Data64 plain_inv,
+                                                  Data64 plain_mod,
+                                                  Modulus64 modulus)
+    {
+        Data64 w = OPERATOR_GPU_64::mult(last_ct, plain_inv, last_modulus);
+
+        Data64 w_mod;
+        if (w > (last_modulus.value >> 1))
+        {
+            // w is negative: reduce |w| and negate it.
+            Data64 zero = 0;
+            Data64 w_abs = last_modulus.value - w;
+            w_mod = OPERATOR_GPU_64::reduce_forced(w_abs, modulus);
+            w_mod = OPERATOR_GPU_64::sub(zero, w_mod, modulus);
+        }
+        else
+        {
+            w_mod = OPERATOR_GPU_64::reduce_forced(w, modulus);
+        }
+
+        Data64 plain_mod_ = OPERATOR_GPU_64::reduce_forced(plain_mod, modulus);
+
+        return OPERATOR_GPU_64::mult(w_mod, plain_mod_, modulus);
+    }
+
+    __global__ void bgv_mod_switch_kernel(Data64* input, Data64* output,
+                                          Modulus64* modulus,
+                                          Data64* last_q_modinv,
+                                          Data64 plain_inv, Data64 plain_mod,
+                                          int n_power,
+                                          int current_decomp_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
+        int block_y = blockIdx.y; // Remaining Modulus Count
+        int block_z = blockIdx.z; // Cipher Size
+
+        int last_index = current_decomp_count - 1;
+
+        Data64 last_ct =
+            input[idx + (last_index << n_power) +
+                  ((current_decomp_count << n_power) * block_z)];
+
+        Data64 correction = bgv_divisibility_correction(
+            last_ct, modulus[last_index], plain_inv, plain_mod,
+            modulus[block_y]);
+
+        Data64 input_ = input[idx + (block_y << n_power) +
+                              ((current_decomp_count << n_power) * block_z)];
+
+        input_ = OPERATOR_GPU_64::sub(input_, correction, modulus[block_y]);
+        input_ = OPERATOR_GPU_64::mult(input_, last_q_modinv[block_y],
+                                       modulus[block_y]);
+
+        output[idx + (block_y << n_power) +
+               ((last_index << n_power) * block_z)] = input_;
+    }
+
+    __global__ void bgv_divide_lastq_kernel(
+        Data64* input, Data64* ct, Data64* output, Modulus64* modulus,
+        Data64* last_q_modinv, Data64 plain_inv, Data64 plain_mod, int n_power,
+        int current_decomp_count, int first_decomp_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
+        int block_y = blockIdx.y; // Current Decomposition Modulus Count
+        int block_z = blockIdx.z; // Cipher Size (2)
+
+        int input_offset = (current_decomp_count + 1) << n_power;
+
+        Data64 last_ct = input[idx + (current_decomp_count << n_power) +
+                               (input_offset * block_z)];
+
+        Data64 correction = bgv_divisibility_correction(
+            last_ct, modulus[first_decomp_count], plain_inv, plain_mod,
+            modulus[block_y]);
+
+        Data64 input_ =
+            input[idx + (block_y << n_power) + (input_offset * block_z)];
+
+        input_ = OPERATOR_GPU_64::sub(input_, correction, modulus[block_y]);
+        input_ = OPERATOR_GPU_64::mult(input_, last_q_modinv[block_y],
+                                       modulus[block_y]);
+
+        int ct_location = idx + (block_y << n_power) +
+                          ((current_decomp_count << n_power) * block_z);
+
+        output[ct_location] =
+            OPERATOR_GPU_64::add(ct[ct_location], input_, modulus[block_y]);
+    }
+
+    __global__ void bgv_divide_lastq_permute_kernel(
+        Data64* input, Data64* ct, Data64* output, Modulus64* modulus,
+        Data64* last_q_modinv, Data64 plain_inv, Data64 plain_mod,
+        int galois_elt, int n_power, int current_decomp_count,
+        int first_decomp_count)
+    {
+        int idx = blockIdx.x * blockDim.x + threadIdx.x; // Ring Sizes
+        int block_y = blockIdx.y; // Current Decomposition Modulus Count
+        int block_z = blockIdx.z; // Cipher Size (2)
+
+        int input_offset = (current_decomp_count + 1) << n_power;
+
+        Data64 last_ct = input[idx + (current_decomp_count << n_power) +
+                               (input_offset * block_z)];
+
+        Data64 correction = bgv_divisibility_correction(
+            last_ct, modulus[first_decomp_count], plain_inv, plain_mod,
+            modulus[block_y]);
+
+        Data64 input_ =
+            input[idx + (block_y << n_power) + (input_offset * block_z)];
+
+        input_ = OPERATOR_GPU_64::sub(input_, correction, modulus[block_y]);
+        input_ = OPERATOR_GPU_64::mult(input_, last_q_modinv[block_y],
+                                       modulus[block_y]);
+
+        if (block_z == 0)
+        {
+            input_ = OPERATOR_GPU_64::add(ct[idx + (block_y << n_power)],
+                                          input_, modulus[block_y]);
+        }
+
+        int coeff_count_minus_one = (1 << n_power) - 1;
+
+        long long index_raw = static_cast<long long>(idx) * galois_elt;
+        int index = static_cast<int>(index_raw & coeff_count_minus_one);
+
+        if (((index_raw >> n_power) & 1) && (input_ != 0))
+        {
+            input_ = (modulus[block_y].value - input_);
+        }
+
+        output[index + (block_y << n_power) +
+               ((current_decomp_count << n_power) * block_z)] = input_;
+    }
+
 } // namespace heongpu
\ No newline at end of file
@@ -0,0 +1,160 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "util.cuh"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace heongpu
+{
+    struct Completion::State
+    {
+        cudaEvent_t event_;
+
+        explicit State(cudaStream_t stream)
+        {
+            HEONGPU_CUDA_CHECK(cudaEventCreateWithFlags(
+                &event_, cudaEventDisableTiming | cudaEventBlockingSync));
+            HEONGPU_CUDA_CHECK(cudaEventRecord(event_, stream));
+        }
+
+        ~State() { cudaEventDestroy(event_); }
+
+        State(const State&) = delete;
+        State& operator=(const State&) = delete;
+    };
+
+    namespace
+    {
+        // Single thread that runs the continuations in submission order once
+        // their events complete.
+        class ContinuationExecutor
+        {
+          public:
+            static ContinuationExecutor& instance()
+            {
+                static ContinuationExecutor instance;
+                return instance;
+            }
+
+            void submit(const Completion& completion,
+                        std::packaged_task<void()> task)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    queue_.emplace_back(completion, std::move(task));
+                }
+                condition_.notify_one();
+            }
+
+            ~ContinuationExecutor()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stop_ = true;
+                }
+                condition_.notify_one();
+                worker_.join();
+            }
+
+          private:
+            ContinuationExecutor() : worker_([this]() { run(); }) {}
+
+            void run()
+            {
+                while (true)
+                {
+                    std::pair<Completion, std::packaged_task<void()>> item;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        condition_.wait(lock, [this]()
+                                        { return stop_ || !queue_.empty(); });
+                        if (queue_.empty())
+                        {
+                            return;
+                        }
+                        item = std::move(queue_.front());
+                        queue_.pop_front();
+                    }
+
+                    // Errors of the recorded work are left to the next CUDA
+                    // call of the caller; the continuation still runs.
+                    try
+                    {
+                        item.first.wait();
+                    }
+                    catch (...)
+                    {
+                    }
+
+                    item.second();
+                }
+            }
+
+            std::mutex mutex_;
+            std::condition_variable condition_;
+            std::deque<std::pair<Completion, std::packaged_task<void()>>>
+                queue_;
+            bool stop_ = false;
+
+            std::thread worker_;
+        };
+    } // namespace
+
+    Completion Completion::record(cudaStream_t stream)
+    {
+        Completion completion;
+        completion.state_ = std::make_shared<State>(stream);
+
+        return completion;
+    }
+
+    bool Completion::ready() const
+    {
+        if (!state_)
+        {
+            return true;
+        }
+
+        cudaError_t status = cudaEventQuery(state_->event_);
+        if (status == cudaErrorNotReady)
+        {
+            return false;
+        }
+        HEONGPU_CUDA_CHECK(status);
+
+        return true;
+    }
+
+    void Completion::wait() const
+    {
+        if (state_)
+        {
+            HEONGPU_CUDA_CHECK(cudaEventSynchronize(state_->event_));
+        }
+    }
+
+    void Completion::wait_on(cudaStream_t stream) const
+    {
+        if (state_)
+        {
+            HEONGPU_CUDA_CHECK(cudaStreamWaitEvent(stream, state_->event_, 0));
+        }
+    }
+
+    std::future<void> Completion::then(std::function<void()> callback) const
+    {
+        std::packaged_task<void()> task(std::move(callback));
+        std::future<void> result = task.get_future();
+
+        ContinuationExecutor::instance().submit(*this, std::move(task));
+
+        return result;
+    }
+
+} // namespace heongpu
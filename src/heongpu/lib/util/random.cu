@@ -4,13 +4,28 @@
 // Developer: Alişah Özcan
 
 #include "random.cuh"
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
 
 namespace heongpu
 {
-    std::shared_ptr<rngongpu::RNG<rngongpu::Mode::AES>>
-        RandomNumberGenerator::generator_ = nullptr;
     bool RandomNumberGenerator::initialized_ = false;
     std::mutex RandomNumberGenerator::mutex_;
+    std::vector<unsigned char> RandomNumberGenerator::master_key_;
+    std::vector<unsigned char> RandomNumberGenerator::master_nonce_;
+    std::vector<unsigned char>
+        RandomNumberGenerator::master_personalization_string_;
+    rngongpu::SecurityLevel RandomNumberGenerator::security_level_ =
+        rngongpu::SecurityLevel::AES128;
+    bool RandomNumberGenerator::prediction_resistance_enabled_ = false;
+    Data64 RandomNumberGenerator::instance_count_ = 0;
+
+    // DRBG instance of the calling thread. It is keyed by thread only, so
+    // the number of instances is bounded by the number of threads and each
+    // one is released when its thread exits; streams only select where the
+    // generation kernels run.
+    static thread_local std::unique_ptr<rngongpu::RNG<rngongpu::Mode::AES>>
+        thread_generator_;
 
     RandomNumberGenerator& RandomNumberGenerator::instance()
     {
@@ -28,29 +43,93 @@ namespace heongpu
         std::lock_guard<std::mutex> guard(mutex_);
         if (!initialized_)
         {
-            generator_ = std::make_shared<rngongpu::RNG<rngongpu::Mode::AES>>(
-                key, nonce, personalization_string, security_level,
-                prediction_resistance_enabled);
+            master_key_ = key;
+            master_nonce_ = nonce;
+            master_personalization_string_ = personalization_string;
+            security_level_ = security_level;
+            prediction_resistance_enabled_ = prediction_resistance_enabled;
 
             initialized_ = true;
         }
     }
 
+    RandomNumberGenerator::DRBG* RandomNumberGenerator::generator()
+    {
+        if (thread_generator_)
+        {
+            return thread_generator_.get();
+        }
+
+        std::vector<unsigned char> key;
+        std::vector<unsigned char> nonce;
+        std::vector<unsigned char> personalization_string;
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            if (!initialized_)
+            {
+                throw std::logic_error(
+                    "RandomNumberGenerator is not initialized!");
+            }
+
+            // HMAC-SHA256 keyed with the master key over (label, master
+            // nonce, instance index); the key and the nonce use different
+            // labels.
+            Data64 index = instance_count_++;
+            auto derive = [&](unsigned char label, size_t size)
+            {
+                std::vector<unsigned char> message;
+                message.push_back(label);
+                message.insert(message.end(), master_nonce_.begin(),
+                               master_nonce_.end());
+                for (size_t i = 0; i < sizeof(Data64); i++)
+                {
+                    message.push_back(
+                        static_cast<unsigned char>(index >> (8 * i)));
+                }
+
+                unsigned char digest[EVP_MAX_MD_SIZE];
+                unsigned int digest_size = 0;
+                if (HMAC(EVP_sha256(), master_key_.data(),
+                         static_cast<int>(master_key_.size()), message.data(),
+                         message.size(), digest, &digest_size) == nullptr)
+                {
+                    throw std::runtime_error("HMAC failed");
+                }
+
+                if (size > digest_size)
+                {
+                    throw std::invalid_argument("Invalid master key size!");
+                }
+
+                std::vector<unsigned char> output(digest, digest + size);
+
+                return output;
+            };
+
+            key = derive(0x01, master_key_.size());
+            nonce = derive(0x02, master_nonce_.size());
+            personalization_string = master_personalization_string_;
+        }
+
+        thread_generator_ = std::make_unique<DRBG>(
+            key, nonce, personalization_string, security_level_,
+            prediction_resistance_enabled_);
+
+        return thread_generator_.get();
+    }
+
     void RandomNumberGenerator::set(
         const std::vector<unsigned char>& entropy_input,
         const std::vector<unsigned char>& nonce,
         const std::vector<unsigned char>& personalization_string,
         cudaStream_t stream)
     {
-        generator_->set(entropy_input, nonce, personalization_string, stream);
+        generator()->set(entropy_input, nonce, personalization_string, stream);
     }
 
     RandomNumberGenerator::RandomNumberGenerator() = default;
 
-    RandomNumberGenerator::~RandomNumberGenerator()
-    {
-        generator_.reset();
-    }
+    RandomNumberGenerator::~RandomNumberGenerator() = default;
 
     __host__ void
     RandomNumberGenerator::modular_uniform_random_number_generation(
@@ -58,9 +137,9 @@ namespace heongpu
         int repeat_count, cudaStream_t stream)
     {
         std::vector<unsigned char> additional_input = {};
-        generator_->modular_uniform_random_number(pointer, modulus, log_size,
-                                                  mod_count, repeat_count,
-                                                  additional_input, stream);
+        generator()->modular_uniform_random_number(
+            pointer, modulus, log_size, mod_count, repeat_count,
+            additional_input, stream);
     }
 
     __host__ void
@@ -69,7 +148,7 @@ namespace heongpu
         int repeat_count, std::vector<unsigned char>& entropy_input,
         std::vector<unsigned char> additional_input, cudaStream_t stream)
     {
-        generator_->modular_uniform_random_number(
+        generator()->modular_uniform_random_number(
             pointer, modulus, log_size, mod_count, repeat_count, entropy_input,
             additional_input, stream);
     }
@@ -80,7 +159,7 @@ namespace heongpu
         int* mod_index, int repeat_count, cudaStream_t stream)
     {
         std::vector<unsigned char> additional_input = {};
-        generator_->modular_uniform_random_number(
+        generator()->modular_uniform_random_number(
             pointer, modulus, log_size, mod_count, mod_index, repeat_count,
             additional_input, stream);
     }
@@ -92,7 +171,7 @@ namespace heongpu
         std::vector<unsigned char>& entropy_input,
         std::vector<unsigned char> additional_input, cudaStream_t stream)
     {
-        generator_->modular_uniform_random_number(
+        generator()->modular_uniform_random_number(
             pointer, modulus, log_size, mod_count, mod_index, repeat_count,
             entropy_input, additional_input, stream);
     }
@@ -103,7 +182,7 @@ namespace heongpu
         int mod_count, int repeat_count, cudaStream_t stream)
     {
         std::vector<unsigned char> additional_input = {};
-        generator_->modular_normal_random_number(
+        generator()->modular_normal_random_number(
             std_dev, pointer, modulus, log_size, mod_count, repeat_count,
             additional_input, stream);
     }
@@ -115,7 +194,7 @@ namespace heongpu
         std::vector<unsigned char>& entropy_input,
         std::vector<unsigned char> additional_input, cudaStream_t stream)
     {
-        generator_->modular_normal_random_number(
+        generator()->modular_normal_random_number(
             std_dev, pointer, modulus, log_size, mod_count, repeat_count,
             entropy_input, additional_input, stream);
     }
@@ -126,7 +205,7 @@ namespace heongpu
         int mod_count, int* mod_index, int repeat_count, cudaStream_t stream)
     {
         std::vector<unsigned char> additional_input = {};
-        generator_->modular_normal_random_number(
+        generator()->modular_normal_random_number(
             std_dev, pointer, modulus, log_size, mod_count, mod_index,
             repeat_count, additional_input, stream);
     }
@@ -138,7 +217,7 @@ namespace heongpu
         std::vector<unsigned char>& entropy_input,
         std::vector<unsigned char> additional_input, cudaStream_t stream)
     {
-        generator_->modular_normal_random_number(
+        generator()->modular_normal_random_number(
             std_dev, pointer, modulus, log_size, mod_count, mod_index,
             repeat_count, entropy_input, additional_input, stream);
     }
@@ -149,9 +228,9 @@ namespace heongpu
         int repeat_count, cudaStream_t stream)
     {
         std::vector<unsigned char> additional_input = {};
-        generator_->modular_ternary_random_number(pointer, modulus, log_size,
-                                                  mod_count, repeat_count,
-                                                  additional_input, stream);
+        generator()->modular_ternary_random_number(
+            pointer, modulus, log_size, mod_count, repeat_count,
+            additional_input, stream);
     }
 
     __host__ void
@@ -160,7 +239,7 @@ namespace heongpu
         int repeat_count, std::vector<unsigned char>& entropy_input,
         std::vector<unsigned char> additional_input, cudaStream_t stream)
     {
-        generator_->modular_ternary_random_number(
+        generator()->modular_ternary_random_number(
             pointer, modulus, log_size, mod_count, repeat_count, entropy_input,
             additional_input, stream);
     }
@@ -171,7 +250,7 @@ namespace heongpu
         int* mod_index, int repeat_count, cudaStream_t stream)
     {
         std::vector<unsigned char> additional_input = {};
-        generator_->modular_ternary_random_number(
+        generator()->modular_ternary_random_number(
             pointer, modulus, log_size, mod_count, mod_index, repeat_count,
             additional_input, stream);
     }
@@ -183,7 +262,7 @@ namespace heongpu
         std::vector<unsigned char>& entropy_input,
         std::vector<unsigned char> additional_input, cudaStream_t stream)
     {
-        generator_->modular_ternary_random_number(
+        generator()->modular_ternary_random_number(
             pointer, modulus, log_size, mod_count, mod_index, repeat_count,
             entropy_input, additional_input, stream);
     }
@@ -0,0 +1,387 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "rotationplanner.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+
+namespace heongpu
+{
+    namespace
+    {
+        int normalize_shift(int shift, int slot_count)
+        {
+            int result = shift % slot_count;
+            return (result < 0) ? (result + slot_count) : result;
+        }
+
+        // Signed representative of a normalized rotation with the fewest NAF
+        // digits (ties go to the smaller absolute value).
+        int best_representative(int normalized, int slot_count)
+        {
+            int negative = normalized - slot_count;
+            size_t positive_cost = naf_decomposition(normalized).size();
+            size_t negative_cost = naf_decomposition(negative).size();
+            if (negative_cost < positive_cost)
+            {
+                return negative;
+            }
+            if ((negative_cost == positive_cost) && (-negative < normalized))
+            {
+                return negative;
+            }
+            return normalized;
+        }
+    } // namespace
+
+    std::vector<int> naf_decomposition(int value)
+    {
+        std::vector<int> digits;
+        int sign = (value < 0) ? -1 : 1;
+        int64_t remaining = static_cast<int64_t>(value) * sign;
+        int64_t power = 1;
+
+        while (remaining > 0)
+        {
+            if (remaining & 1)
+            {
+                int64_t digit = 2 - (remaining & 3); // 1 or -1
+                remaining -= digit;
+                digits.push_back(static_cast<int>(digit * power * sign));
+            }
+            remaining >>= 1;
+            power <<= 1;
+        }
+
+        return digits;
+    }
+
+    std::vector<int>
+    plan_rotation_steps(int shift, const std::vector<int>& available_shifts,
+                        int slot_count)
+    {
+        if (slot_count <= 0)
+        {
+            throw std::invalid_argument("Slot count must be positive!");
+        }
+
+        int target = normalize_shift(shift, slot_count);
+        if (target == 0)
+        {
+            return {};
+        }
+
+        // Normalized rotation -> rotation as stored in the key.
+        std::map<int, int> keys;
+        for (int available : available_shifts)
+        {
+            int normalized = normalize_shift(available, slot_count);
+            if (normalized != 0)
+            {
+                keys.emplace(normalized, available);
+            }
+        }
+
+        auto direct = keys.find(target);
+        if (direct != keys.end())
+        {
+            return {direct->second};
+        }
+
+        std::vector<int> best;
+        for (int representative : {target, target - slot_count})
+        {
+            std::vector<int> digits = naf_decomposition(representative);
+            std::vector<int> steps;
+            for (int digit : digits)
+            {
+                int normalized = normalize_shift(digit, slot_count);
+                if (normalized == 0)
+                {
+                    continue;
+                }
+                auto it = keys.find(normalized);
+                if (it == keys.end())
+                {
+                    steps.clear();
+                    break;
+                }
+                steps.push_back(it->second);
+            }
+
+            if (!steps.empty() && (best.empty() || steps.size() < best.size()))
+            {
+                best = std::move(steps);
+            }
+        }
+
+        // Breadth-first search over Z_slot_count, bounded by the signed-digit
+        // solution, to find a shorter composition of the available keys.
+        size_t depth_limit =
+            best.empty() ? static_cast<size_t>(slot_count) : (best.size() - 1);
+        if (depth_limit < 2)
+        {
+            return best;
+        }
+
+        std::vector<int> parent(slot_count, -1);
+        std::vector<int> parent_key(slot_count, 0);
+        std::vector<int> frontier = {0};
+        parent[0] = 0;
+
+        for (size_t depth = 1; depth <= depth_limit && !frontier.empty();
+             depth++)
+        {
+            std::vector<int> next;
+            for (int node : frontier)
+            {
+                for (const auto& [normalized, original] : keys)
+                {
+                    int child = (node + normalized) % slot_count;
+                    if (parent[child] != -1)
+                    {
+                        continue;
+                    }
+                    parent[child] = node;
+                    parent_key[child] = original;
+
+                    if (child == target)
+                    {
+                        std::vector<int> steps;
+                        for (int at = target; at != 0; at = parent[at])
+                        {
+                            steps.push_back(parent_key[at]);
+                        }
+                        std::reverse(steps.begin(), steps.end());
+                        return steps;
+                    }
+                    next.push_back(child);
+                }
+            }
+            frontier = std::move(next);
+        }
+
+        if (best.empty())
+        {
+            throw std::logic_error("Galois key not present!");
+        }
+
+        return best;
+    }
+
+    std::vector<int>
+    RotationPlanCache::plan(int shift, const std::vector<int>& available_shifts,
+                            int slot_count)
+    {
+        if (slot_count <= 0)
+        {
+            throw std::invalid_argument("Slot count must be positive!");
+        }
+
+        int target = normalize_shift(shift, slot_count);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = plans_.find(target);
+        if (it == plans_.end())
+        {
+            it = plans_
+                     .emplace(target, plan_rotation_steps(
+                                          target, available_shifts, slot_count))
+                     .first;
+        }
+
+        return it->second;
+    }
+
+    std::vector<int> select_rotation_keys(const std::vector<int>& rotations,
+                                          int slot_count,
+                                          std::size_t max_key_count)
+    {
+        if (slot_count <= 0)
+        {
+            throw std::invalid_argument("Slot count must be positive!");
+        }
+
+        // Normalized rotation -> number of occurrences in the workload.
+        std::map<int, size_t> weights;
+        for (int rotation : rotations)
+        {
+            int normalized = normalize_shift(rotation, slot_count);
+            if (normalized != 0)
+            {
+                weights[normalized]++;
+            }
+        }
+
+        std::vector<int> selected;
+        if (weights.size() <= max_key_count)
+        {
+            for (const auto& [normalized, weight] : weights)
+            {
+                selected.push_back(best_representative(normalized, slot_count));
+            }
+            return selected;
+        }
+
+        if (max_key_count == 0)
+        {
+            throw std::invalid_argument(
+                "Memory budget is too small for the requested rotations!");
+        }
+
+        // Candidate keys: the signed-digit powers of two used by the workload
+        // and the workload rotations themselves.
+        std::map<int, int> candidates; // normalized -> signed representative
+        std::map<int, int> digits;
+        int smallest_power = slot_count;
+        for (const auto& [normalized, weight] : weights)
+        {
+            int representative = best_representative(normalized, slot_count);
+            for (int digit : naf_decomposition(representative))
+            {
+                int digit_normalized = normalize_shift(digit, slot_count);
+                if (digit_normalized != 0)
+                {
+                    digits.emplace(digit_normalized, digit);
+                    candidates.emplace(digit_normalized, digit);
+                }
+            }
+            candidates.emplace(normalized, representative);
+            smallest_power =
+                std::min(smallest_power, normalized & (-normalized));
+        }
+
+        // Start from the signed-digit base if it fits. Otherwise start from
+        // the smallest power of two dividing every rotation, which keeps all
+        // of them reachable.
+        std::map<int, int> key_set;
+        if (digits.size() <= max_key_count)
+        {
+            key_set = digits;
+        }
+        else
+        {
+            key_set.emplace(smallest_power, smallest_power);
+        }
+
+        // Distance in key-switches from rotation 0 to every rotation with the
+        // current key set. Adding a key of step s only shortens paths that end
+        // with copies of s, so the new distances are relaxed along each cycle
+        // x, x + s, x + 2s, ... starting from its closest node, instead of
+        // searching the whole graph again for every candidate.
+        const int unreachable = std::numeric_limits<int>::max() / 2;
+        auto relax = [&](const std::vector<int>& distance, int step)
+        {
+            std::vector<int> result = distance;
+            std::vector<bool> visited(slot_count, false);
+            for (int start = 0; start < slot_count; start++)
+            {
+                if (visited[start])
+                {
+                    continue;
+                }
+
+                int origin = start;
+                int node = start;
+                do
+                {
+                    visited[node] = true;
+                    if (result[node] < result[origin])
+                    {
+                        origin = node;
+                    }
+                    node = (node + step) % slot_count;
+                } while (node != start);
+
+                node = origin;
+                do
+                {
+                    int next = (node + step) % slot_count;
+                    result[next] = std::min(result[next], result[node] + 1);
+                    node = next;
+                } while (node != origin);
+            }
+            return result;
+        };
+
+        // Weighted number of key-switches of the workload.
+        auto workload_cost = [&](const std::vector<int>& distance)
+        {
+            size_t cost = 0;
+            for (const auto& [normalized, weight] : weights)
+            {
+                cost += weight * static_cast<size_t>(distance[normalized]);
+            }
+            return cost;
+        };
+
+        std::vector<int> distance(slot_count, unreachable);
+        distance[0] = 0;
+        for (const auto& key : key_set)
+        {
+            distance = relax(distance, key.first);
+        }
+
+        // Greedily add the candidate that saves the most key-switches.
+        size_t current_cost = workload_cost(distance);
+        while (key_set.size() < max_key_count)
+        {
+            size_t best_cost = current_cost;
+            auto best_candidate = candidates.end();
+            std::vector<int> best_distance;
+            for (auto it = candidates.begin(); it != candidates.end(); ++it)
+            {
+                if (key_set.count(it->first))
+                {
+                    continue;
+                }
+                std::vector<int> trial = relax(distance, it->first);
+                size_t cost = workload_cost(trial);
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best_candidate = it;
+                    best_distance = std::move(trial);
+                }
+            }
+
+            if (best_candidate == candidates.end())
+            {
+                break;
+            }
+
+            key_set.emplace(best_candidate->first, best_candidate->second);
+            distance = std::move(best_distance);
+            current_cost = best_cost;
+        }
+
+        // Drop keys that none of the planned rotations use.
+        std::vector<int> keys;
+        for (const auto& entry : key_set)
+        {
+            keys.push_back(entry.second);
+        }
+
+        std::map<int, int> used;
+        for (const auto& [normalized, weight] : weights)
+        {
+            for (int step : plan_rotation_steps(normalized, keys, slot_count))
+            {
+                used.emplace(normalize_shift(step, slot_count), step);
+            }
+        }
+
+        for (const auto& entry : used)
+        {
+            selected.push_back(entry.second);
+        }
+
+        return selected;
+    }
+
+} // namespace heongpu
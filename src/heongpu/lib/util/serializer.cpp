@@ -48,5 +48,44 @@ namespace heongpu
             return out;
         }
 
+        size_t compress_bound(size_t size)
+        {
+            return compressBound(size);
+        }
+
+        size_t compress(const uint8_t* data, size_t size, uint8_t* output,
+                        size_t capacity)
+        {
+            uLongf output_size = capacity;
+            int result = ::compress(output, &output_size, data, size);
+            if (result == Z_BUF_ERROR)
+            {
+                throw std::length_error("Output buffer is too small");
+            }
+            if (result != Z_OK)
+            {
+                throw std::runtime_error("Zlib compression failed");
+            }
+
+            return output_size;
+        }
+
+        size_t decompress(const uint8_t* data, size_t size, uint8_t* output,
+                          size_t capacity)
+        {
+            uLongf output_size = capacity;
+            int result = ::uncompress(output, &output_size, data, size);
+            if (result == Z_BUF_ERROR)
+            {
+                throw std::length_error("Output buffer is too small");
+            }
+            if (result != Z_OK)
+            {
+                throw std::runtime_error("Zlib decompression failed");
+            }
+
+            return output_size;
+        }
+
     } // namespace serializer
 } // namespace heongpu
\ No newline at end of file
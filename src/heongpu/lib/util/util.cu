@@ -565,9 +565,9 @@ namespace heongpu
     }
 
     BootstrappingConfig::BootstrappingConfig(int CtoS, int StoC, int taylor,
-                                             bool less_key_mode)
+                                             bool less_key_mode, int slot_count)
         : CtoS_piece_(CtoS), StoC_piece_(StoC), taylor_number_(taylor),
-          less_key_mode_(less_key_mode)
+          less_key_mode_(less_key_mode), slot_count_(slot_count)
     {
         validate();
     }
@@ -587,6 +587,12 @@ namespace heongpu
         {
             throw std::out_of_range("taylor_number must be in range [6, 15]");
         }
+        if (slot_count_ < 0 ||
+            (slot_count_ != 0 && !is_power_of_two(slot_count_)))
+        {
+            throw std::out_of_range(
+                "slot_count must be 0 or a positive power of two");
+        }
     }
 
     //////////////////////////
@@ -0,0 +1,104 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_CLIENT_CONTEXT_H
+#define HEONGPU_CLIENT_CONTEXT_H
+
+#include "client/modarith.h"
+#include "schemes.h"
+
+#include <istream>
+#include <vector>
+
+namespace heongpu
+{
+    namespace client
+    {
+        /**
+         * @brief Context is the host-only counterpart of
+         * HEContext<Scheme::CKKS> for client machines without a GPU.
+         *
+         * It is loaded from the stream written by HEContext::save on the
+         * server, so both sides use the same primes, and it rebuilds the NTT
+         * tables on the CPU. Only the parameters needed for encoding,
+         * encryption and decryption are kept.
+         */
+        class Context
+        {
+          public:
+            Context() = default;
+
+            /**
+             * @brief Reads a context serialized with
+             * HEContext<Scheme::CKKS>::save and generates the NTT tables.
+             *
+             * @param is Input stream.
+             * @throws std::runtime_error if the stream does not hold a CKKS
+             * context or the context is already loaded.
+             */
+            void load(std::istream& is);
+
+            inline bool is_loaded() const noexcept { return context_loaded_; }
+
+            inline int poly_modulus_degree() const noexcept { return n; }
+
+            inline int log_poly_modulus_degree() const noexcept
+            {
+                return n_power;
+            }
+
+            inline int Q_size() const noexcept { return Q_size_; }
+
+            inline int P_size() const noexcept { return P_size_; }
+
+            inline int Q_prime_size() const noexcept { return Q_prime_size_; }
+
+            inline int total_coeff_bit_count() const noexcept
+            {
+                return total_coeff_bit_count_;
+            }
+
+            inline keyswitching_type get_keyswitching_type() const noexcept
+            {
+                return keyswitching_type_;
+            }
+
+            /**
+             * @brief Returns the Q primes followed by the P primes, in the
+             * order of HEContext.
+             */
+            inline const std::vector<Modulus>& primes() const noexcept
+            {
+                return primes_;
+            }
+
+            inline const std::vector<NTTTable>& ntt_tables() const noexcept
+            {
+                return ntt_tables_;
+            }
+
+          private:
+            bool context_loaded_ = false;
+
+            scheme_type scheme_ = scheme_type::none;
+            sec_level_type sec_level_ = sec_level_type::none;
+            keyswitching_type keyswitching_type_ = keyswitching_type::NONE;
+
+            int n = 0;
+            int n_power = 0;
+            int coeff_modulus_ = 0;
+            int total_coeff_bit_count_ = 0;
+
+            int Q_prime_size_ = 0;
+            int Q_size_ = 0;
+            int P_size_ = 0;
+
+            std::vector<Modulus> primes_;
+            std::vector<NTTTable> ntt_tables_;
+        };
+
+    } // namespace client
+} // namespace heongpu
+#endif // HEONGPU_CLIENT_CONTEXT_H
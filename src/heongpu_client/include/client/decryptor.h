@@ -0,0 +1,54 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_CLIENT_DECRYPTOR_H
+#define HEONGPU_CLIENT_DECRYPTOR_H
+
+#include "client/objects.h"
+
+namespace heongpu
+{
+    namespace client
+    {
+        /**
+         * @brief Decryptor is the host-only counterpart of
+         * HEDecryptor<Scheme::CKKS>. It decrypts two-component ciphertexts at
+         * any depth, e.g. results computed and saved by a GPU server.
+         */
+        class Decryptor
+        {
+          public:
+            /**
+             * @brief Constructs a decryptor.
+             *
+             * @throws std::invalid_argument if the context is not loaded or
+             * the key does not match it.
+             */
+            Decryptor(const Context& context, const Secretkey& secret_key);
+
+            /**
+             * @brief Decrypts a ciphertext into a plaintext with the depth and
+             * scale of the ciphertext.
+             *
+             * @param plaintext Output plaintext.
+             * @param ciphertext Ciphertext to decrypt.
+             * @throws std::invalid_argument if the ciphertext is not a
+             * relinearized ciphertext of this context.
+             */
+            void decrypt(Plaintext& plaintext,
+                         const Ciphertext& ciphertext) const;
+
+          private:
+            const Context* context_;
+
+            int n;
+            int Q_size_;
+
+            std::vector<Data64> secret_key_;
+        };
+
+    } // namespace client
+} // namespace heongpu
+#endif // HEONGPU_CLIENT_DECRYPTOR_H
@@ -0,0 +1,125 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_CLIENT_ENCODER_H
+#define HEONGPU_CLIENT_ENCODER_H
+
+#include "client/objects.h"
+
+#include <complex>
+#include <vector>
+
+namespace heongpu
+{
+    namespace client
+    {
+        typedef std::complex<double> Complex64;
+
+        /**
+         * @brief Encoder is the host-only counterpart of
+         * HEEncoder<Scheme::CKKS>.
+         *
+         * The special FFT root tables are built exactly as in the HEEncoder
+         * constructor, so a message encoded here decodes to the same values on
+         * the GPU and vice versa. The FFT keeps real and imaginary parts in
+         * separate arrays, which lets the compiler vectorise the butterflies.
+         */
+        class Encoder
+        {
+          public:
+            /**
+             * @brief Constructs an encoder for a loaded context.
+             *
+             * @param context Client context.
+             * @throws std::invalid_argument if the context is not loaded.
+             */
+            explicit Encoder(const Context& context);
+
+            /**
+             * @brief Encodes real values into a plaintext at depth 0.
+             *
+             * @param plain Output plaintext.
+             * @param message Values; at most slot_count() of them.
+             * @param scale Scaling factor.
+             */
+            void encode(Plaintext& plain, const std::vector<double>& message,
+                        double scale) const;
+
+            /**
+             * @brief Encodes complex values into a plaintext at depth 0.
+             */
+            void encode(Plaintext& plain,
+                        const std::vector<Complex64>& message,
+                        double scale) const;
+
+            /**
+             * @brief Decodes the real parts of the slots of a plaintext.
+             *
+             * A sparsely packed plaintext decodes to its slot_count() values.
+             */
+            void decode(std::vector<double>& message,
+                        const Plaintext& plain) const;
+
+            /**
+             * @brief Decodes the slots of a plaintext.
+             */
+            void decode(std::vector<Complex64>& message,
+                        const Plaintext& plain) const;
+
+            inline int slot_count() const noexcept { return slot_count_; }
+
+          private:
+            /**
+             * @brief CRT reconstruction constants of one level (the first
+             * coeff_count Q primes), as multi-word integers.
+             */
+            struct LevelComposer
+            {
+                int coeff_count;
+                std::vector<Data64> modulus; // Q_l
+                std::vector<Data64> half_modulus; // floor(Q_l / 2)
+                std::vector<Data64> punctured; // Q_l / q_i, i = 0..l-1
+                std::vector<Data64> punctured_inverse; // (Q_l / q_i)^-1 mod q_i
+            };
+
+            void check_scale(double scale) const;
+
+            void encode_slots(Plaintext& plain, std::vector<double>& real,
+                              std::vector<double>& imag, double scale) const;
+
+            void decode_slots(std::vector<double>& real,
+                              std::vector<double>& imag,
+                              const Plaintext& plain) const;
+
+            void special_ifft(double* real, double* imag) const;
+
+            // The root tables do not depend on the transform length, so a
+            // length-s transform decodes a plaintext with s sparse slots.
+            void special_fft(double* real, double* imag, int length) const;
+
+            double compose(const LevelComposer& level, const Data64* residues,
+                           int stride, Data64* workspace) const;
+
+            const Context* context_;
+
+            int n;
+            int n_power;
+            int slot_count_;
+            int log_slot_count_;
+            int Q_size_;
+            int total_coeff_bit_count_;
+
+            std::vector<double> fft_root_real_;
+            std::vector<double> fft_root_imag_;
+            std::vector<double> ifft_root_real_;
+            std::vector<double> ifft_root_imag_;
+            std::vector<int> reverse_order_;
+
+            std::vector<LevelComposer> composers_; // indexed by depth
+        };
+
+    } // namespace client
+} // namespace heongpu
+#endif // HEONGPU_CLIENT_ENCODER_H
@@ -0,0 +1,76 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_CLIENT_ENCRYPTOR_H
+#define HEONGPU_CLIENT_ENCRYPTOR_H
+
+#include "client/objects.h"
+
+namespace heongpu
+{
+    namespace client
+    {
+        /**
+         * @brief Encryptor is the host-only counterpart of
+         * HEEncryptor<Scheme::CKKS>.
+         *
+         * With a public key it follows the GPU encryptor: (pk * u + e) is
+         * computed over QP and divided by P with rounding. With a secret key
+         * it produces (-a * s + e + m, a) directly over Q. Ciphertexts are
+         * at depth 0 and in the NTT domain, ready to be saved and sent to a
+         * GPU server. Randomness is drawn from std::random_device.
+         */
+        class Encryptor
+        {
+          public:
+            /**
+             * @brief Constructs a public-key encryptor.
+             *
+             * @throws std::invalid_argument if the context is not loaded or
+             * the key does not match it.
+             */
+            Encryptor(const Context& context, const Publickey& public_key);
+
+            /**
+             * @brief Constructs a secret-key encryptor.
+             *
+             * @throws std::invalid_argument if the context is not loaded or
+             * the key does not match it.
+             */
+            Encryptor(const Context& context, const Secretkey& secret_key);
+
+            /**
+             * @brief Encrypts a depth 0 plaintext.
+             *
+             * @param ciphertext Output ciphertext.
+             * @param plaintext Plaintext to encrypt.
+             */
+            void encrypt(Ciphertext& ciphertext,
+                         const Plaintext& plaintext) const;
+
+          private:
+            void set_context(const Context& context);
+
+            std::vector<Data64>
+            encrypt_public_key(const Plaintext& plaintext) const;
+
+            std::vector<Data64>
+            encrypt_secret_key(const Plaintext& plaintext) const;
+
+            const Context* context_;
+
+            int n;
+            int n_power;
+            int Q_size_;
+            int P_size_;
+            int Q_prime_size_;
+
+            bool public_key_mode_;
+            std::vector<Data64> key_;
+        };
+
+    } // namespace client
+} // namespace heongpu
+#endif // HEONGPU_CLIENT_ENCRYPTOR_H
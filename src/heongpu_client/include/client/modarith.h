@@ -0,0 +1,123 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_CLIENT_MODARITH_H
+#define HEONGPU_CLIENT_MODARITH_H
+
+#include <cstdint>
+#include <vector>
+
+namespace heongpu
+{
+    namespace client
+    {
+        typedef std::uint64_t Data64;
+        typedef unsigned __int128 Data128;
+
+        /**
+         * @brief RNS prime with the same memory layout as Modulus64 of the GPU
+         * library, so the prime vector of a serialized HEContext can be read
+         * as is. Only value is used by the client; bit and mu are kept for
+         * layout compatibility.
+         */
+        struct Modulus
+        {
+            Data64 value;
+            Data64 bit;
+            Data64 mu;
+        };
+
+        static_assert(sizeof(Modulus) == 3 * sizeof(Data64),
+                      "Modulus must match the Modulus64 layout!");
+
+        inline Data64 add_mod(Data64 a, Data64 b, Data64 q)
+        {
+            Data64 sum = a + b;
+            return (sum >= q) ? (sum - q) : sum;
+        }
+
+        inline Data64 sub_mod(Data64 a, Data64 b, Data64 q)
+        {
+            return (a >= b) ? (a - b) : (a + q - b);
+        }
+
+        inline Data64 mult_mod(Data64 a, Data64 b, Data64 q)
+        {
+            return static_cast<Data64>((static_cast<Data128>(a) * b) % q);
+        }
+
+        inline Data64 reduce_mod(Data64 high, Data64 low, Data64 q)
+        {
+            return static_cast<Data64>(
+                ((static_cast<Data128>(high) << 64) | low) % q);
+        }
+
+        Data64 exp_mod(Data64 base, Data64 exponent, Data64 q);
+
+        Data64 inverse_mod(Data64 a, Data64 q);
+
+        /**
+         * @brief Precomputed operand for Shoup's modular multiplication,
+         * floor(w * 2^64 / q).
+         */
+        inline Data64 shoup_precompute(Data64 w, Data64 q)
+        {
+            return static_cast<Data64>((static_cast<Data128>(w) << 64) / q);
+        }
+
+        /**
+         * @brief Computes a * w mod q with the precomputed w_shoup. Valid for
+         * q < 2^63; replaces the 128-bit division of mult_mod on the NTT path.
+         */
+        inline Data64 mult_shoup(Data64 a, Data64 w, Data64 w_shoup, Data64 q)
+        {
+            Data64 quotient =
+                static_cast<Data64>((static_cast<Data128>(a) * w_shoup) >> 64);
+            Data64 result = a * w - quotient * q;
+            return (result >= q) ? (result - q) : result;
+        }
+
+        /**
+         * @brief Finds the smallest primitive 2n-th root of unity modulo q.
+         *
+         * Matches find_minimal_primitive_root of the GPU library, which makes
+         * the client NTT tables identical to the ones of HEContext.
+         */
+        Data64 find_minimal_primitive_root(Data64 degree, Data64 q);
+
+        /**
+         * @brief NTT tables of one prime, with the same bit-reversed root
+         * ordering as generate_ntt_table / generate_intt_table.
+         */
+        struct NTTTable
+        {
+            std::vector<Data64> forward_root;
+            std::vector<Data64> forward_root_shoup;
+            std::vector<Data64> inverse_root;
+            std::vector<Data64> inverse_root_shoup;
+            Data64 n_inverse;
+            Data64 n_inverse_shoup;
+        };
+
+        NTTTable generate_ntt_table(Data64 q, int n_power);
+
+        /**
+         * @brief In-place negacyclic forward NTT (merged Cooley-Tukey). The
+         * output is in the same bit-reversed order as GPU_NTT_Inplace, so NTT
+         * domain data can be exchanged with the GPU library.
+         */
+        void forward_ntt(Data64* data, const NTTTable& table, Data64 q,
+                         int n_power);
+
+        /**
+         * @brief In-place negacyclic inverse NTT (merged Gentleman-Sande),
+         * including the multiplication with n^-1.
+         */
+        void inverse_ntt(Data64* data, const NTTTable& table, Data64 q,
+                         int n_power);
+
+    } // namespace client
+} // namespace heongpu
+#endif // HEONGPU_CLIENT_MODARITH_H
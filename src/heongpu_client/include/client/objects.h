@@ -0,0 +1,198 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_CLIENT_OBJECTS_H
+#define HEONGPU_CLIENT_OBJECTS_H
+
+#include "client/context.h"
+
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace heongpu
+{
+    namespace client
+    {
+        class Encoder;
+        class Encryptor;
+        class Decryptor;
+
+        /**
+         * @brief Storage tag written by the serializers. Client objects always
+         * live in host memory; the GPU library moves loaded objects to the
+         * device regardless of the tag.
+         */
+        enum class storage_tag : std::uint8_t
+        {
+            HOST = 0x1,
+            DEVICE = 0x2
+        };
+
+        /**
+         * @brief Host-only CKKS plaintext. save/load use the byte layout of
+         * Plaintext<Scheme::CKKS>, so plaintexts can be exchanged with the GPU
+         * library.
+         */
+        class Plaintext
+        {
+            friend class Encoder;
+            friend class Encryptor;
+            friend class Decryptor;
+
+          public:
+            Plaintext() = default;
+
+            explicit Plaintext(const Context& context);
+
+            inline int depth() const noexcept { return depth_; }
+
+            inline double scale() const noexcept { return scale_; }
+
+            inline int slot_count() const noexcept { return slot_count_; }
+
+            inline bool is_generated() const noexcept
+            {
+                return plaintext_generated_;
+            }
+
+            inline const std::vector<Data64>& data() const noexcept
+            {
+                return data_;
+            }
+
+            void save(std::ostream& os) const;
+
+            void load(std::istream& is);
+
+          private:
+            scheme_type scheme_ = scheme_type::ckks;
+            int plain_size_ = 0;
+            int depth_ = 0;
+            double scale_ = 0;
+            int slot_count_ = 0;
+            bool in_ntt_domain_ = true;
+            bool plaintext_generated_ = false;
+
+            std::vector<Data64> data_;
+        };
+
+        /**
+         * @brief Host-only CKKS ciphertext with the byte layout of
+         * Ciphertext<Scheme::CKKS>.
+         */
+        class Ciphertext
+        {
+            friend class Encryptor;
+            friend class Decryptor;
+
+          public:
+            Ciphertext() = default;
+
+            explicit Ciphertext(const Context& context);
+
+            inline int depth() const noexcept { return depth_; }
+
+            inline double scale() const noexcept { return scale_; }
+
+            inline int slot_count() const noexcept { return slot_count_; }
+
+            inline bool is_generated() const noexcept
+            {
+                return ciphertext_generated_;
+            }
+
+            inline const std::vector<Data64>& data() const noexcept
+            {
+                return data_;
+            }
+
+            void save(std::ostream& os) const;
+
+            void load(std::istream& is);
+
+          private:
+            scheme_type scheme_ = scheme_type::ckks;
+            int ring_size_ = 0;
+            int coeff_modulus_count_ = 0;
+            int cipher_size_ = 2;
+            int depth_ = 0;
+            bool in_ntt_domain_ = true;
+            double scale_ = 0;
+            int slot_count_ = 0;
+            bool rescale_required_ = false;
+            bool relinearization_required_ = false;
+            bool ciphertext_generated_ = false;
+
+            std::vector<Data64> data_;
+        };
+
+        /**
+         * @brief Host-only CKKS public key with the byte layout of
+         * Publickey<Scheme::CKKS>. Keys are generated by HEKeyGenerator and
+         * loaded here.
+         */
+        class Publickey
+        {
+            friend class Encryptor;
+
+          public:
+            Publickey() = default;
+
+            inline bool is_generated() const noexcept
+            {
+                return public_key_generated_;
+            }
+
+            void save(std::ostream& os) const;
+
+            void load(std::istream& is);
+
+          private:
+            scheme_type scheme_ = scheme_type::ckks;
+            int ring_size_ = 0;
+            int coeff_modulus_count_ = 0;
+            bool in_ntt_domain_ = true;
+            bool public_key_generated_ = false;
+
+            std::vector<Data64> data_;
+        };
+
+        /**
+         * @brief Host-only CKKS secret key with the byte layout of
+         * Secretkey<Scheme::CKKS>.
+         */
+        class Secretkey
+        {
+            friend class Encryptor;
+            friend class Decryptor;
+
+          public:
+            Secretkey() = default;
+
+            inline bool is_generated() const noexcept
+            {
+                return secret_key_generated_;
+            }
+
+            void save(std::ostream& os) const;
+
+            void load(std::istream& is);
+
+          private:
+            scheme_type scheme_ = scheme_type::ckks;
+            int ring_size_ = 0;
+            int coeff_modulus_count_ = 0;
+            int n_power_ = 0;
+            int hamming_weight_ = 0;
+            bool in_ntt_domain_ = true;
+            bool secret_key_generated_ = false;
+
+            std::vector<Data64> data_;
+        };
+
+    } // namespace client
+} // namespace heongpu
+#endif // HEONGPU_CLIENT_OBJECTS_H
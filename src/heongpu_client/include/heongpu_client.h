@@ -0,0 +1,18 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#ifndef HEONGPU_CLIENT_H
+#define HEONGPU_CLIENT_H
+
+// Host-only CKKS client: encoding, encryption and decryption without CUDA.
+// Objects are byte-compatible with the serializers of the GPU library.
+
+#include "client/context.h"
+#include "client/objects.h"
+#include "client/encoder.h"
+#include "client/encryptor.h"
+#include "client/decryptor.h"
+
+#endif // HEONGPU_CLIENT_H
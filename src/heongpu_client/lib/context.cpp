@@ -0,0 +1,97 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "client/context.h"
+#include "serialformat.h"
+
+#include <stdexcept>
+
+namespace heongpu
+{
+    namespace client
+    {
+        namespace
+        {
+            template <typename T>
+            void read_vector(std::istream& is, std::vector<T>& output)
+            {
+                uint32_t count;
+                is.read((char*) &count, sizeof(count));
+                output.resize(count);
+                is.read((char*) output.data(), sizeof(T) * count);
+            }
+        } // namespace
+
+        void Context::load(std::istream& is)
+        {
+            if (context_loaded_)
+            {
+                throw std::runtime_error("Context has been already exist!");
+            }
+
+            uint32_t version = serialformat::read_header(is, scheme_);
+
+            if (scheme_ != scheme_type::ckks)
+            {
+                throw std::runtime_error("Invalid scheme binary!");
+            }
+
+            is.read((char*) &sec_level_, sizeof(sec_level_));
+
+            is.read((char*) &keyswitching_type_, sizeof(keyswitching_type_));
+
+            // The evaluation key limb layout does not concern the client.
+            if (version >= 1)
+            {
+                limb_type key_limb_type;
+                is.read((char*) &key_limb_type, sizeof(key_limb_type));
+            }
+
+            is.read((char*) &n, sizeof(n));
+
+            is.read((char*) &n_power, sizeof(n_power));
+
+            is.read((char*) &coeff_modulus_, sizeof(coeff_modulus_));
+
+            is.read((char*) &total_coeff_bit_count_,
+                    sizeof(total_coeff_bit_count_));
+
+            is.read((char*) &Q_prime_size_, sizeof(Q_prime_size_));
+
+            is.read((char*) &Q_size_, sizeof(Q_size_));
+
+            is.read((char*) &P_size_, sizeof(P_size_));
+
+            read_vector(is, primes_);
+
+            // base_q and the bit sizes are not needed on the client; they are
+            // read only to consume the stream.
+            std::vector<Data64> base_q;
+            read_vector(is, base_q);
+
+            std::vector<int> bit_sizes;
+            read_vector(is, bit_sizes); // Qprime_mod_bit_sizes
+            read_vector(is, bit_sizes); // Q_mod_bit_sizes
+            read_vector(is, bit_sizes); // P_mod_bit_sizes
+
+            if (!is || (n != (1 << n_power)) ||
+                (static_cast<int>(primes_.size()) != Q_prime_size_) ||
+                (Q_prime_size_ != (Q_size_ + P_size_)))
+            {
+                throw std::runtime_error("Invalid context binary!");
+            }
+
+            ntt_tables_.clear();
+            ntt_tables_.reserve(Q_prime_size_);
+            for (const Modulus& prime : primes_)
+            {
+                ntt_tables_.push_back(generate_ntt_table(prime.value, n_power));
+            }
+
+            context_loaded_ = true;
+        }
+
+    } // namespace client
+} // namespace heongpu
@@ -0,0 +1,97 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "client/decryptor.h"
+
+#include <stdexcept>
+
+namespace heongpu
+{
+    namespace client
+    {
+        Decryptor::Decryptor(const Context& context,
+                             const Secretkey& secret_key)
+        {
+            if (!context.is_loaded())
+            {
+                throw std::invalid_argument("Context is not loaded!");
+            }
+
+            if (!secret_key.secret_key_generated_ ||
+                (secret_key.ring_size_ != context.poly_modulus_degree()) ||
+                (secret_key.coeff_modulus_count_ != context.Q_prime_size()))
+            {
+                throw std::invalid_argument(
+                    "Secretkey does not match the context!");
+            }
+
+            context_ = &context;
+
+            n = context.poly_modulus_degree();
+            Q_size_ = context.Q_size();
+
+            secret_key_ = secret_key.data_;
+        }
+
+        void Decryptor::decrypt(Plaintext& plaintext,
+                                const Ciphertext& ciphertext) const
+        {
+            if (!ciphertext.ciphertext_generated_)
+            {
+                throw std::invalid_argument("No ciphertext to decrypt!");
+            }
+
+            if ((ciphertext.ring_size_ != n) ||
+                (ciphertext.coeff_modulus_count_ != Q_size_) ||
+                (ciphertext.depth_ < 0) || (ciphertext.depth_ >= Q_size_))
+            {
+                throw std::invalid_argument(
+                    "Ciphertext does not match the context!");
+            }
+
+            if ((ciphertext.cipher_size_ != 2) ||
+                ciphertext.relinearization_required_)
+            {
+                throw std::invalid_argument(
+                    "Ciphertext should be relinearized!");
+            }
+
+            if (!ciphertext.in_ntt_domain_)
+            {
+                throw std::invalid_argument(
+                    "Ciphertext should be in NTT domain!");
+            }
+
+            const std::vector<Modulus>& primes = context_->primes();
+            int current_decomp_count = Q_size_ - ciphertext.depth_;
+            size_t block = static_cast<size_t>(n);
+            size_t size = block * current_decomp_count;
+
+            const Data64* ct0 = ciphertext.data_.data();
+            const Data64* ct1 = ct0 + size;
+
+            std::vector<Data64> output(size);
+            for (int i = 0; i < current_decomp_count; i++)
+            {
+                Data64 q = primes[i].value;
+                for (size_t j = i * block; j < (i + 1) * block; j++)
+                {
+                    output[j] =
+                        add_mod(ct0[j], mult_mod(ct1[j], secret_key_[j], q), q);
+                }
+            }
+
+            plaintext.scheme_ = scheme_type::ckks;
+            plaintext.plain_size_ = static_cast<int>(size);
+            plaintext.depth_ = ciphertext.depth_;
+            plaintext.scale_ = ciphertext.scale_;
+            plaintext.slot_count_ = ciphertext.slot_count_;
+            plaintext.in_ntt_domain_ = true;
+            plaintext.plaintext_generated_ = true;
+            plaintext.data_ = std::move(output);
+        }
+
+    } // namespace client
+} // namespace heongpu
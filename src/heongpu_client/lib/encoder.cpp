@@ -0,0 +1,520 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "client/encoder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace heongpu
+{
+    namespace client
+    {
+        namespace
+        {
+            const double two_pow_64 = std::pow(2.0, 64);
+
+            int bitreverse(int index, int bit_count)
+            {
+                int result = 0;
+                for (int i = 0; i < bit_count; i++)
+                {
+                    result = (result << 1) | (index & 1);
+                    index >>= 1;
+                }
+                return result;
+            }
+
+            // Multi-word helpers for the CRT reconstruction. Numbers are
+            // little-endian arrays of size words.
+
+            void multiply_word(const Data64* a, Data64 b, Data64* result,
+                               int size)
+            {
+                Data64 carry = 0;
+                for (int i = 0; i < size; i++)
+                {
+                    Data128 product = static_cast<Data128>(a[i]) * b + carry;
+                    result[i] = static_cast<Data64>(product);
+                    carry = static_cast<Data64>(product >> 64);
+                }
+            }
+
+            void add_inplace(Data64* a, const Data64* b, int size)
+            {
+                Data64 carry = 0;
+                for (int i = 0; i < size; i++)
+                {
+                    Data128 sum = static_cast<Data128>(a[i]) + b[i] + carry;
+                    a[i] = static_cast<Data64>(sum);
+                    carry = static_cast<Data64>(sum >> 64);
+                }
+            }
+
+            void sub(const Data64* a, const Data64* b, Data64* result,
+                     int size)
+            {
+                Data64 borrow = 0;
+                for (int i = 0; i < size; i++)
+                {
+                    Data64 difference = a[i] - b[i] - borrow;
+                    borrow = (a[i] < b[i]) || ((a[i] == b[i]) && borrow);
+                    result[i] = difference;
+                }
+            }
+
+            bool is_greater(const Data64* a, const Data64* b, int size)
+            {
+                for (int i = size - 1; i >= 0; i--)
+                {
+                    if (a[i] != b[i])
+                    {
+                        return a[i] > b[i];
+                    }
+                }
+                return false;
+            }
+
+            double to_double(const Data64* a, int size)
+            {
+                double result = 0.0;
+                double power = 1.0;
+                for (int i = 0; i < size; i++, power *= two_pow_64)
+                {
+                    result += static_cast<double>(a[i]) * power;
+                }
+                return result;
+            }
+
+            // Rounds value and writes it modulo each of the first count
+            // primes, stride words apart.
+            void double_to_rns(double value, const std::vector<Modulus>& primes,
+                               int count, Data64* output, int stride)
+            {
+                double coeff_double = std::round(value);
+                bool is_negative = std::signbit(coeff_double);
+                coeff_double = std::fabs(coeff_double);
+
+                Data64 low =
+                    static_cast<Data64>(std::fmod(coeff_double, two_pow_64));
+                Data64 high = static_cast<Data64>(coeff_double / two_pow_64);
+
+                for (int i = 0; i < count; i++)
+                {
+                    Data64 q = primes[i].value;
+                    Data64 residue = reduce_mod(high, low, q);
+                    output[i * stride] =
+                        (is_negative && residue) ? (q - residue) : residue;
+                }
+            }
+        } // namespace
+
+        Encoder::Encoder(const Context& context)
+        {
+            if (!context.is_loaded())
+            {
+                throw std::invalid_argument("Context is not loaded!");
+            }
+
+            context_ = &context;
+
+            n = context.poly_modulus_degree();
+            n_power = context.log_poly_modulus_degree();
+
+            slot_count_ = n >> 1;
+            log_slot_count_ = n_power - 1;
+            int fft_length = n * 2;
+
+            Q_size_ = context.Q_size();
+            total_coeff_bit_count_ = context.total_coeff_bit_count();
+
+            // Same construction as the HEEncoder constructor.
+            double special_root = 2.0 * M_PI / static_cast<double>(fft_length);
+
+            std::vector<Complex64> special_root_tables;
+            std::vector<Complex64> special_inverse_root_tables;
+            for (int i = 0; i < fft_length; i++)
+            {
+                Complex64 element =
+                    std::exp(Complex64(0.0, static_cast<double>(i)) *
+                             special_root);
+                special_root_tables.push_back(element);
+                special_inverse_root_tables.push_back(Complex64(1.0) /
+                                                      element);
+            }
+
+            std::vector<int> rot_group;
+            rot_group.push_back(1);
+            for (int i = 1; i < slot_count_; i++)
+            {
+                rot_group.push_back((5 * rot_group[i - 1]) % fft_length);
+            }
+
+            fft_root_real_.assign(slot_count_, 0.0);
+            fft_root_imag_.assign(slot_count_, 0.0);
+            ifft_root_real_.assign(slot_count_, 0.0);
+            ifft_root_imag_.assign(slot_count_, 0.0);
+            for (int logm = 1; logm <= log_slot_count_; ++logm)
+            {
+                int idx_mod = 1 << (logm + 2);
+                int gap = fft_length / idx_mod;
+
+                int offset = 1 << (logm - 1);
+                for (int i = 0; i < (1 << (logm - 1)); ++i)
+                {
+                    int rou_idx = (rot_group[i] % idx_mod) * gap;
+                    fft_root_real_[offset + i] =
+                        special_root_tables[rou_idx].real();
+                    fft_root_imag_[offset + i] =
+                        special_root_tables[rou_idx].imag();
+                    ifft_root_real_[offset + i] =
+                        special_inverse_root_tables[rou_idx].real();
+                    ifft_root_imag_[offset + i] =
+                        special_inverse_root_tables[rou_idx].imag();
+                }
+            }
+
+            reverse_order_.resize(slot_count_);
+            for (int i = 0; i < slot_count_; i++)
+            {
+                reverse_order_[i] = bitreverse(i, log_slot_count_);
+            }
+
+            const std::vector<Modulus>& primes = context.primes();
+            for (int depth = 0; depth < Q_size_; depth++)
+            {
+                LevelComposer level;
+                int count = Q_size_ - depth;
+                level.coeff_count = count;
+
+                level.modulus.assign(count, 0);
+                level.modulus[0] = 1;
+                std::vector<Data64> temp(count);
+                for (int i = 0; i < count; i++)
+                {
+                    multiply_word(level.modulus.data(), primes[i].value,
+                                  temp.data(), count);
+                    level.modulus = temp;
+                }
+
+                level.half_modulus.assign(count, 0);
+                for (int i = 0; i < count; i++)
+                {
+                    level.half_modulus[i] = level.modulus[i] >> 1;
+                    if ((i + 1) < count)
+                    {
+                        level.half_modulus[i] |= level.modulus[i + 1] << 63;
+                    }
+                }
+
+                level.punctured.assign(count * count, 0);
+                level.punctured_inverse.assign(count, 0);
+                for (int i = 0; i < count; i++)
+                {
+                    Data64* punctured = level.punctured.data() + (i * count);
+                    punctured[0] = 1;
+                    Data64 punctured_mod_qi = 1;
+                    for (int j = 0; j < count; j++)
+                    {
+                        if (j == i)
+                        {
+                            continue;
+                        }
+                        multiply_word(punctured, primes[j].value, temp.data(),
+                                      count);
+                        std::copy(temp.begin(), temp.end(), punctured);
+                        punctured_mod_qi =
+                            mult_mod(punctured_mod_qi,
+                                     primes[j].value % primes[i].value,
+                                     primes[i].value);
+                    }
+                    level.punctured_inverse[i] =
+                        inverse_mod(punctured_mod_qi, primes[i].value);
+                }
+
+                composers_.push_back(std::move(level));
+            }
+        }
+
+        void Encoder::check_scale(double scale) const
+        {
+            if ((scale <= 0) ||
+                (static_cast<int>(log2(scale)) >= total_coeff_bit_count_))
+            {
+                throw std::invalid_argument("Scale out of bounds");
+            }
+        }
+
+        void Encoder::encode(Plaintext& plain,
+                             const std::vector<double>& message,
+                             double scale) const
+        {
+            check_scale(scale);
+
+            if (message.size() > static_cast<size_t>(slot_count_))
+            {
+                throw std::invalid_argument(
+                    "Vector size can not be higher than slot count!");
+            }
+
+            std::vector<double> real(slot_count_, 0.0);
+            std::vector<double> imag(slot_count_, 0.0);
+            std::copy(message.begin(), message.end(), real.begin());
+
+            encode_slots(plain, real, imag, scale);
+        }
+
+        void Encoder::encode(Plaintext& plain,
+                             const std::vector<Complex64>& message,
+                             double scale) const
+        {
+            check_scale(scale);
+
+            if (message.size() > static_cast<size_t>(slot_count_))
+            {
+                throw std::invalid_argument(
+                    "Vector size can not be higher than slot count!");
+            }
+
+            std::vector<double> real(slot_count_, 0.0);
+            std::vector<double> imag(slot_count_, 0.0);
+            for (size_t i = 0; i < message.size(); i++)
+            {
+                real[i] = message[i].real();
+                imag[i] = message[i].imag();
+            }
+
+            encode_slots(plain, real, imag, scale);
+        }
+
+        void Encoder::decode(std::vector<double>& message,
+                             const Plaintext& plain) const
+        {
+            std::vector<double> real;
+            std::vector<double> imag;
+            decode_slots(real, imag, plain);
+
+            message = std::move(real);
+        }
+
+        void Encoder::decode(std::vector<Complex64>& message,
+                             const Plaintext& plain) const
+        {
+            std::vector<double> real;
+            std::vector<double> imag;
+            decode_slots(real, imag, plain);
+
+            message.resize(real.size());
+            for (size_t i = 0; i < real.size(); i++)
+            {
+                message[i] = Complex64(real[i], imag[i]);
+            }
+        }
+
+        void Encoder::encode_slots(Plaintext& plain, std::vector<double>& real,
+                                   std::vector<double>& imag,
+                                   double scale) const
+        {
+            special_ifft(real.data(), imag.data());
+
+            double fix = scale / static_cast<double>(slot_count_);
+
+            const std::vector<Modulus>& primes = context_->primes();
+            std::vector<Data64> output(static_cast<size_t>(n) * Q_size_);
+            for (int idx = 0; idx < slot_count_; idx++)
+            {
+                int order = reverse_order_[idx];
+                double_to_rns(real[order] * fix, primes, Q_size_,
+                              output.data() + idx, n);
+                double_to_rns(imag[order] * fix, primes, Q_size_,
+                              output.data() + idx + slot_count_, n);
+            }
+
+            const std::vector<NTTTable>& tables = context_->ntt_tables();
+            for (int i = 0; i < Q_size_; i++)
+            {
+                forward_ntt(output.data() + (static_cast<size_t>(i) * n),
+                            tables[i], primes[i].value, n_power);
+            }
+
+            plain.scheme_ = scheme_type::ckks;
+            plain.plain_size_ = n * Q_size_;
+            plain.depth_ = 0;
+            plain.scale_ = scale;
+            plain.slot_count_ = slot_count_;
+            plain.in_ntt_domain_ = true;
+            plain.plaintext_generated_ = true;
+            plain.data_ = std::move(output);
+        }
+
+        void Encoder::decode_slots(std::vector<double>& real,
+                                   std::vector<double>& imag,
+                                   const Plaintext& plain) const
+        {
+            if (!plain.plaintext_generated_)
+            {
+                throw std::invalid_argument("Plaintext is not generated!");
+            }
+
+            if ((plain.depth_ < 0) || (plain.depth_ >= Q_size_))
+            {
+                throw std::invalid_argument("Invalid plaintext depth!");
+            }
+
+            int slot_count =
+                (plain.slot_count_ == 0) ? slot_count_ : plain.slot_count_;
+            if ((slot_count <= 0) || (slot_count > slot_count_) ||
+                ((slot_count & (slot_count - 1)) != 0))
+            {
+                throw std::invalid_argument("Invalid plaintext slot count!");
+            }
+
+            // A sparse plaintext holds its slots in every (n / 2s)-th
+            // coefficient, as written by the GPU encoder.
+            int log_slot_count = 0;
+            while ((1 << log_slot_count) < slot_count)
+            {
+                log_slot_count++;
+            }
+            int log_gap = log_slot_count_ - log_slot_count;
+
+            const LevelComposer& level = composers_[plain.depth_];
+            int count = level.coeff_count;
+            size_t size = static_cast<size_t>(n) * count;
+
+            if (plain.data_.size() < size)
+            {
+                throw std::invalid_argument("Invalid plaintext size!");
+            }
+
+            const std::vector<Modulus>& primes = context_->primes();
+            const std::vector<NTTTable>& tables = context_->ntt_tables();
+            std::vector<Data64> coefficients(plain.data_.begin(),
+                                             plain.data_.begin() + size);
+            for (int i = 0; i < count; i++)
+            {
+                inverse_ntt(coefficients.data() + (static_cast<size_t>(i) * n),
+                            tables[i], primes[i].value, n_power);
+            }
+
+            double inv_scale = 1.0 / plain.scale_;
+
+            real.assign(slot_count, 0.0);
+            imag.assign(slot_count, 0.0);
+            std::vector<Data64> workspace(2 * count);
+            for (int idx = 0; idx < slot_count; idx++)
+            {
+                int order = (log_gap == 0) ? reverse_order_[idx]
+                                           : bitreverse(idx, log_slot_count);
+                const Data64* location = coefficients.data() + (idx << log_gap);
+                real[order] =
+                    compose(level, location, n, workspace.data()) * inv_scale;
+                imag[order] = compose(level, location + slot_count_, n,
+                                      workspace.data()) *
+                              inv_scale;
+            }
+
+            special_fft(real.data(), imag.data(), slot_count);
+        }
+
+        double Encoder::compose(const LevelComposer& level,
+                                const Data64* residues, int stride,
+                                Data64* workspace) const
+        {
+            int count = level.coeff_count;
+            const std::vector<Modulus>& primes = context_->primes();
+
+            Data64* result = workspace;
+            Data64* product = workspace + count;
+            std::fill(result, result + count, 0);
+
+            for (int i = 0; i < count; i++)
+            {
+                Data64 base = mult_mod(residues[i * stride],
+                                       level.punctured_inverse[i],
+                                       primes[i].value);
+                multiply_word(level.punctured.data() + (i * count), base,
+                              product, count);
+                add_inplace(result, product, count);
+
+                if (!is_greater(level.modulus.data(), result, count))
+                {
+                    sub(result, level.modulus.data(), result, count);
+                }
+            }
+
+            if (is_greater(result, level.half_modulus.data(), count))
+            {
+                sub(level.modulus.data(), result, result, count);
+                return -to_double(result, count);
+            }
+
+            return to_double(result, count);
+        }
+
+        void Encoder::special_ifft(double* real, double* imag) const
+        {
+            for (int len = slot_count_; len >= 2; len >>= 1)
+            {
+                int lenh = len >> 1;
+                const double* root_real = ifft_root_real_.data() + lenh;
+                const double* root_imag = ifft_root_imag_.data() + lenh;
+                for (int i = 0; i < slot_count_; i += len)
+                {
+                    double* x_real = real + i;
+                    double* x_imag = imag + i;
+                    double* y_real = x_real + lenh;
+                    double* y_imag = x_imag + lenh;
+                    for (int j = 0; j < lenh; j++)
+                    {
+                        double u_real = x_real[j] + y_real[j];
+                        double u_imag = x_imag[j] + y_imag[j];
+                        double v_real = x_real[j] - y_real[j];
+                        double v_imag = x_imag[j] - y_imag[j];
+                        x_real[j] = u_real;
+                        x_imag[j] = u_imag;
+                        y_real[j] =
+                            v_real * root_real[j] - v_imag * root_imag[j];
+                        y_imag[j] =
+                            v_real * root_imag[j] + v_imag * root_real[j];
+                    }
+                }
+            }
+        }
+
+        void Encoder::special_fft(double* real, double* imag,
+                                  int length) const
+        {
+            for (int len = 2; len <= length; len <<= 1)
+            {
+                int lenh = len >> 1;
+                const double* root_real = fft_root_real_.data() + lenh;
+                const double* root_imag = fft_root_imag_.data() + lenh;
+                for (int i = 0; i < length; i += len)
+                {
+                    double* x_real = real + i;
+                    double* x_imag = imag + i;
+                    double* y_real = x_real + lenh;
+                    double* y_imag = x_imag + lenh;
+                    for (int j = 0; j < lenh; j++)
+                    {
+                        double v_real =
+                            y_real[j] * root_real[j] - y_imag[j] * root_imag[j];
+                        double v_imag =
+                            y_real[j] * root_imag[j] + y_imag[j] * root_real[j];
+                        double u_real = x_real[j];
+                        double u_imag = x_imag[j];
+                        x_real[j] = u_real + v_real;
+                        x_imag[j] = u_imag + v_imag;
+                        y_real[j] = u_real - v_real;
+                        y_imag[j] = u_imag - v_imag;
+                    }
+                }
+            }
+        }
+
+    } // namespace client
+} // namespace heongpu
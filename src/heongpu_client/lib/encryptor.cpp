@@ -0,0 +1,314 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "client/encryptor.h"
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+namespace heongpu
+{
+    namespace client
+    {
+        namespace
+        {
+            // Standard deviation of the error distribution, as in
+            // secstdparams.h of the GPU library.
+            constexpr double error_std_dev = 3.2;
+
+            class Sampler
+            {
+              public:
+                Data64 uniform(Data64 q)
+                {
+                    // Rejection sampling avoids the modulo bias.
+                    Data64 limit = ~Data64(0) - (~Data64(0) % q);
+                    Data64 value;
+                    do
+                    {
+                        value = (static_cast<Data64>(device_()) << 32) |
+                                static_cast<Data64>(device_());
+                    } while (value >= limit);
+                    return value % q;
+                }
+
+                int ternary()
+                {
+                    unsigned int value;
+                    do
+                    {
+                        value = device_();
+                    } while (value == 0xFFFFFFFFu);
+                    return static_cast<int>(value % 3) - 1;
+                }
+
+                std::int64_t gaussian()
+                {
+                    return static_cast<std::int64_t>(
+                        std::round(normal_(device_)));
+                }
+
+              private:
+                std::random_device device_;
+                std::normal_distribution<double> normal_{0.0, error_std_dev};
+            };
+
+            // Writes the small signed polynomial into count RNS blocks.
+            void signed_to_rns(const std::vector<std::int64_t>& input,
+                               const std::vector<Modulus>& primes, int count,
+                               Data64* output)
+            {
+                size_t n = input.size();
+                for (int i = 0; i < count; i++)
+                {
+                    Data64 q = primes[i].value;
+                    Data64* block = output + (i * n);
+                    for (size_t j = 0; j < n; j++)
+                    {
+                        std::int64_t value = input[j];
+                        block[j] = (value < 0)
+                                       ? (q - static_cast<Data64>(-value))
+                                       : static_cast<Data64>(value);
+                    }
+                }
+            }
+        } // namespace
+
+        Encryptor::Encryptor(const Context& context,
+                             const Publickey& public_key)
+        {
+            set_context(context);
+
+            if (!public_key.public_key_generated_ ||
+                (public_key.ring_size_ != n) ||
+                (public_key.coeff_modulus_count_ != Q_prime_size_))
+            {
+                throw std::invalid_argument(
+                    "Publickey does not match the context!");
+            }
+
+            public_key_mode_ = true;
+            key_ = public_key.data_;
+        }
+
+        Encryptor::Encryptor(const Context& context,
+                             const Secretkey& secret_key)
+        {
+            set_context(context);
+
+            if (!secret_key.secret_key_generated_ ||
+                (secret_key.ring_size_ != n) ||
+                (secret_key.coeff_modulus_count_ != Q_prime_size_))
+            {
+                throw std::invalid_argument(
+                    "Secretkey does not match the context!");
+            }
+
+            public_key_mode_ = false;
+            key_ = secret_key.data_;
+        }
+
+        void Encryptor::set_context(const Context& context)
+        {
+            if (!context.is_loaded())
+            {
+                throw std::invalid_argument("Context is not loaded!");
+            }
+
+            context_ = &context;
+
+            n = context.poly_modulus_degree();
+            n_power = context.log_poly_modulus_degree();
+
+            Q_size_ = context.Q_size();
+            P_size_ = context.P_size();
+            Q_prime_size_ = context.Q_prime_size();
+        }
+
+        void Encryptor::encrypt(Ciphertext& ciphertext,
+                                const Plaintext& plaintext) const
+        {
+            if (plaintext.data_.size() < (static_cast<size_t>(n) * Q_size_))
+            {
+                throw std::invalid_argument("Invalid plaintext size.");
+            }
+
+            if (plaintext.depth_ != 0)
+            {
+                throw std::invalid_argument(
+                    "Invalid plaintext depth must be zero.");
+            }
+
+            std::vector<Data64> output = public_key_mode_
+                                             ? encrypt_public_key(plaintext)
+                                             : encrypt_secret_key(plaintext);
+
+            ciphertext.scheme_ = scheme_type::ckks;
+            ciphertext.ring_size_ = n;
+            ciphertext.coeff_modulus_count_ = Q_size_;
+            ciphertext.cipher_size_ = 2;
+            ciphertext.depth_ = 0;
+            ciphertext.in_ntt_domain_ = true;
+            ciphertext.scale_ = plaintext.scale_;
+            ciphertext.slot_count_ =
+                (plaintext.slot_count_ == 0) ? (n >> 1) : plaintext.slot_count_;
+            ciphertext.rescale_required_ = false;
+            ciphertext.relinearization_required_ = false;
+            ciphertext.ciphertext_generated_ = true;
+            ciphertext.data_ = std::move(output);
+        }
+
+        std::vector<Data64>
+        Encryptor::encrypt_public_key(const Plaintext& plaintext) const
+        {
+            const std::vector<Modulus>& primes = context_->primes();
+            const std::vector<NTTTable>& tables = context_->ntt_tables();
+            size_t block = static_cast<size_t>(n);
+            size_t qp_size = block * Q_prime_size_;
+
+            Sampler sampler;
+
+            std::vector<std::int64_t> small(n);
+            for (int i = 0; i < n; i++)
+            {
+                small[i] = sampler.ternary();
+            }
+
+            std::vector<Data64> u_poly(qp_size);
+            signed_to_rns(small, primes, Q_prime_size_, u_poly.data());
+            for (int i = 0; i < Q_prime_size_; i++)
+            {
+                forward_ntt(u_poly.data() + (i * block), tables[i],
+                            primes[i].value, n_power);
+            }
+
+            // (pk_0 * u + e_0, pk_1 * u + e_1) over QP in coefficient form.
+            std::vector<Data64> pk_u_poly(2 * qp_size);
+            std::vector<Data64> error_poly(qp_size);
+            for (int k = 0; k < 2; k++)
+            {
+                Data64* pk_u = pk_u_poly.data() + (k * qp_size);
+                const Data64* pk = key_.data() + (k * qp_size);
+                for (int i = 0; i < Q_prime_size_; i++)
+                {
+                    Data64 q = primes[i].value;
+                    for (size_t j = i * block; j < (i + 1) * block; j++)
+                    {
+                        pk_u[j] = mult_mod(pk[j], u_poly[j], q);
+                    }
+                    inverse_ntt(pk_u + (i * block), tables[i], q, n_power);
+                }
+
+                for (int i = 0; i < n; i++)
+                {
+                    small[i] = sampler.gaussian();
+                }
+                signed_to_rns(small, primes, Q_prime_size_, error_poly.data());
+
+                for (int i = 0; i < Q_prime_size_; i++)
+                {
+                    Data64 q = primes[i].value;
+                    for (size_t j = i * block; j < (i + 1) * block; j++)
+                    {
+                        pk_u[j] = add_mod(pk_u[j], error_poly[j], q);
+                    }
+                }
+            }
+
+            // Divide by the P primes one at a time with rounding:
+            // x_j <- (x_j - ((x_p + p / 2) mod p - p / 2)) * p^-1 mod q_j.
+            for (int p_index = Q_prime_size_ - 1; p_index >= Q_size_;
+                 p_index--)
+            {
+                Data64 p = primes[p_index].value;
+                Data64 half = p >> 1;
+                for (int k = 0; k < 2; k++)
+                {
+                    Data64* poly = pk_u_poly.data() + (k * qp_size);
+                    const Data64* last = poly + (p_index * block);
+                    for (int i = 0; i < p_index; i++)
+                    {
+                        Data64 q = primes[i].value;
+                        Data64 half_mod = half % q;
+                        Data64 p_inverse = inverse_mod(p % q, q);
+                        Data64* current = poly + (i * block);
+                        for (size_t j = 0; j < block; j++)
+                        {
+                            Data64 rounded = add_mod(last[j], half, p) % q;
+                            rounded = sub_mod(rounded, half_mod, q);
+                            current[j] = mult_mod(
+                                sub_mod(current[j], rounded, q), p_inverse, q);
+                        }
+                    }
+                }
+            }
+
+            std::vector<Data64> output(2 * block * Q_size_);
+            for (int k = 0; k < 2; k++)
+            {
+                const Data64* poly = pk_u_poly.data() + (k * qp_size);
+                Data64* ct = output.data() + (k * block * Q_size_);
+                std::copy(poly, poly + (block * Q_size_), ct);
+                for (int i = 0; i < Q_size_; i++)
+                {
+                    forward_ntt(ct + (i * block), tables[i], primes[i].value,
+                                n_power);
+                }
+            }
+
+            for (int i = 0; i < Q_size_; i++)
+            {
+                Data64 q = primes[i].value;
+                for (size_t j = i * block; j < (i + 1) * block; j++)
+                {
+                    output[j] = add_mod(output[j], plaintext.data_[j], q);
+                }
+            }
+
+            return output;
+        }
+
+        std::vector<Data64>
+        Encryptor::encrypt_secret_key(const Plaintext& plaintext) const
+        {
+            const std::vector<Modulus>& primes = context_->primes();
+            const std::vector<NTTTable>& tables = context_->ntt_tables();
+            size_t block = static_cast<size_t>(n);
+            size_t q_size = block * Q_size_;
+
+            Sampler sampler;
+
+            std::vector<Data64> output(2 * q_size);
+            Data64* c0 = output.data();
+            Data64* c1 = output.data() + q_size;
+
+            std::vector<std::int64_t> error(n);
+            for (int i = 0; i < n; i++)
+            {
+                error[i] = sampler.gaussian();
+            }
+            signed_to_rns(error, primes, Q_size_, c0);
+
+            for (int i = 0; i < Q_size_; i++)
+            {
+                Data64 q = primes[i].value;
+                forward_ntt(c0 + (i * block), tables[i], q, n_power);
+                for (size_t j = i * block; j < (i + 1) * block; j++)
+                {
+                    // The secret key has Q' blocks; the first Q_size of them
+                    // are the Q residues.
+                    c1[j] = sampler.uniform(q);
+                    Data64 as = mult_mod(c1[j], key_[j], q);
+                    c0[j] = add_mod(sub_mod(c0[j], as, q), plaintext.data_[j],
+                                    q);
+                }
+            }
+
+            return output;
+        }
+
+    } // namespace client
+} // namespace heongpu
@@ -0,0 +1,190 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "client/modarith.h"
+
+#include <stdexcept>
+
+namespace heongpu
+{
+    namespace client
+    {
+        namespace
+        {
+            int bitreverse(int index, int n_power)
+            {
+                int result = 0;
+                for (int i = 0; i < n_power; i++)
+                {
+                    result = (result << 1) | (index & 1);
+                    index >>= 1;
+                }
+                return result;
+            }
+        } // namespace
+
+        Data64 exp_mod(Data64 base, Data64 exponent, Data64 q)
+        {
+            Data64 result = 1 % q;
+            base = base % q;
+            while (exponent > 0)
+            {
+                if (exponent & 1)
+                {
+                    result = mult_mod(result, base, q);
+                }
+                base = mult_mod(base, base, q);
+                exponent >>= 1;
+            }
+            return result;
+        }
+
+        Data64 inverse_mod(Data64 a, Data64 q)
+        {
+            // q is prime.
+            return exp_mod(a, q - 2, q);
+        }
+
+        Data64 find_minimal_primitive_root(Data64 degree, Data64 q)
+        {
+            if (((q - 1) % degree) != 0)
+            {
+                throw std::logic_error("no sufficient root unity");
+            }
+
+            Data64 quotient = (q - 1) / degree;
+
+            // Any primitive root works as a starting point: the primitive
+            // degree-th roots are exactly its odd powers, and the smallest of
+            // them is taken below.
+            Data64 root = 0;
+            for (Data64 candidate = 2; candidate < q; candidate++)
+            {
+                Data64 power = exp_mod(candidate, quotient, q);
+                if (exp_mod(power, degree >> 1, q) == (q - 1))
+                {
+                    root = power;
+                    break;
+                }
+            }
+
+            if (root == 0)
+            {
+                throw std::logic_error("no sufficient root unity");
+            }
+
+            Data64 generator_sq = mult_mod(root, root, q);
+            Data64 current_generator = root;
+            for (Data64 i = 0; i < degree; i += 2)
+            {
+                if (current_generator < root)
+                {
+                    root = current_generator;
+                }
+                current_generator =
+                    mult_mod(current_generator, generator_sq, q);
+            }
+
+            return root;
+        }
+
+        NTTTable generate_ntt_table(Data64 q, int n_power)
+        {
+            int n = 1 << n_power;
+            Data64 psi = find_minimal_primitive_root(2 * n, q);
+            Data64 inverse_psi = inverse_mod(psi, q);
+
+            std::vector<Data64> forward_powers(n);
+            std::vector<Data64> inverse_powers(n);
+            forward_powers[0] = 1;
+            inverse_powers[0] = 1;
+            for (int i = 1; i < n; i++)
+            {
+                forward_powers[i] = mult_mod(forward_powers[i - 1], psi, q);
+                inverse_powers[i] =
+                    mult_mod(inverse_powers[i - 1], inverse_psi, q);
+            }
+
+            NTTTable table;
+            table.forward_root.resize(n);
+            table.forward_root_shoup.resize(n);
+            table.inverse_root.resize(n);
+            table.inverse_root_shoup.resize(n);
+            for (int i = 0; i < n; i++)
+            {
+                int index = bitreverse(i, n_power);
+                table.forward_root[i] = forward_powers[index];
+                table.forward_root_shoup[i] =
+                    shoup_precompute(forward_powers[index], q);
+                table.inverse_root[i] = inverse_powers[index];
+                table.inverse_root_shoup[i] =
+                    shoup_precompute(inverse_powers[index], q);
+            }
+
+            table.n_inverse = inverse_mod(static_cast<Data64>(n), q);
+            table.n_inverse_shoup = shoup_precompute(table.n_inverse, q);
+
+            return table;
+        }
+
+        void forward_ntt(Data64* data, const NTTTable& table, Data64 q,
+                         int n_power)
+        {
+            int n = 1 << n_power;
+            int t = n;
+            for (int m = 1; m < n; m <<= 1)
+            {
+                t >>= 1;
+                for (int i = 0; i < m; i++)
+                {
+                    Data64 w = table.forward_root[m + i];
+                    Data64 w_shoup = table.forward_root_shoup[m + i];
+                    Data64* x = data + (2 * i * t);
+                    Data64* y = x + t;
+                    for (int j = 0; j < t; j++)
+                    {
+                        Data64 u = x[j];
+                        Data64 v = mult_shoup(y[j], w, w_shoup, q);
+                        x[j] = add_mod(u, v, q);
+                        y[j] = sub_mod(u, v, q);
+                    }
+                }
+            }
+        }
+
+        void inverse_ntt(Data64* data, const NTTTable& table, Data64 q,
+                         int n_power)
+        {
+            int n = 1 << n_power;
+            int t = 1;
+            for (int m = n; m > 1; m >>= 1)
+            {
+                int h = m >> 1;
+                for (int i = 0; i < h; i++)
+                {
+                    Data64 w = table.inverse_root[h + i];
+                    Data64 w_shoup = table.inverse_root_shoup[h + i];
+                    Data64* x = data + (2 * i * t);
+                    Data64* y = x + t;
+                    for (int j = 0; j < t; j++)
+                    {
+                        Data64 u = x[j];
+                        Data64 v = y[j];
+                        x[j] = add_mod(u, v, q);
+                        y[j] = mult_shoup(sub_mod(u, v, q), w, w_shoup, q);
+                    }
+                }
+                t <<= 1;
+            }
+
+            for (int i = 0; i < n; i++)
+            {
+                data[i] = mult_shoup(data[i], table.n_inverse,
+                                     table.n_inverse_shoup, q);
+            }
+        }
+
+    } // namespace client
+} // namespace heongpu
@@ -0,0 +1,354 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "client/objects.h"
+#include "serialformat.h"
+
+#include <stdexcept>
+
+namespace heongpu
+{
+    namespace client
+    {
+        namespace
+        {
+            const storage_tag host_storage = storage_tag::HOST;
+
+            void write_data(std::ostream& os, const std::vector<Data64>& data)
+            {
+                uint32_t memory_size = data.size();
+                os.write((char*) &memory_size, sizeof(memory_size));
+                os.write((char*) data.data(), sizeof(Data64) * memory_size);
+            }
+
+            void read_data(std::istream& is, std::vector<Data64>& data,
+                           size_t expected_size, const char* error)
+            {
+                uint32_t memory_size;
+                is.read((char*) &memory_size, sizeof(memory_size));
+
+                if (memory_size != expected_size)
+                {
+                    throw std::runtime_error(error);
+                }
+
+                data.resize(memory_size);
+                is.read((char*) data.data(), sizeof(Data64) * memory_size);
+
+                if (!is)
+                {
+                    throw std::runtime_error(error);
+                }
+            }
+
+            void read_scheme(std::istream& is, scheme_type& scheme)
+            {
+                is.read((char*) &scheme, sizeof(scheme));
+
+                if (scheme != scheme_type::ckks)
+                {
+                    throw std::runtime_error("Invalid scheme binary!");
+                }
+            }
+
+            uint32_t read_versioned_scheme(std::istream& is,
+                                           scheme_type& scheme)
+            {
+                uint32_t version = serialformat::read_header(is, scheme);
+
+                if (scheme != scheme_type::ckks)
+                {
+                    throw std::runtime_error("Invalid scheme binary!");
+                }
+
+                return version;
+            }
+        } // namespace
+
+        Plaintext::Plaintext(const Context& context)
+        {
+            plain_size_ = context.poly_modulus_degree();
+            slot_count_ = context.poly_modulus_degree() >> 1;
+        }
+
+        void Plaintext::save(std::ostream& os) const
+        {
+            if (!plaintext_generated_)
+            {
+                throw std::runtime_error(
+                    "Plaintext is not generated so can not be serialized!");
+            }
+
+            serialformat::write_header(os, scheme_);
+
+            os.write((char*) &plain_size_, sizeof(plain_size_));
+
+            os.write((char*) &depth_, sizeof(depth_));
+
+            os.write((char*) &scale_, sizeof(scale_));
+
+            os.write((char*) &slot_count_, sizeof(slot_count_));
+
+            os.write((char*) &in_ntt_domain_, sizeof(in_ntt_domain_));
+
+            os.write((char*) &plaintext_generated_,
+                     sizeof(plaintext_generated_));
+
+            os.write((char*) &host_storage, sizeof(host_storage));
+
+            write_data(os, data_);
+        }
+
+        void Plaintext::load(std::istream& is)
+        {
+            if (plaintext_generated_)
+            {
+                throw std::runtime_error("Plaintext has been already exist!");
+            }
+
+            uint32_t version = read_versioned_scheme(is, scheme_);
+
+            is.read((char*) &plain_size_, sizeof(plain_size_));
+
+            is.read((char*) &depth_, sizeof(depth_));
+
+            is.read((char*) &scale_, sizeof(scale_));
+
+            // Legacy streams predate sparse packing and carry no ring size,
+            // so they keep the n / 2 slots set by the context constructor; a
+            // default-constructed plaintext stays at 0, meaning full slots.
+            if (version >= 1)
+            {
+                is.read((char*) &slot_count_, sizeof(slot_count_));
+            }
+
+            is.read((char*) &in_ntt_domain_, sizeof(in_ntt_domain_));
+
+            is.read((char*) &plaintext_generated_,
+                    sizeof(plaintext_generated_));
+
+            storage_tag storage;
+            is.read((char*) &storage, sizeof(storage));
+
+            read_data(is, data_, plain_size_, "Invalid plaintext size!");
+
+            plaintext_generated_ = true;
+        }
+
+        Ciphertext::Ciphertext(const Context& context)
+        {
+            ring_size_ = context.poly_modulus_degree();
+            coeff_modulus_count_ = context.Q_size();
+            slot_count_ = context.poly_modulus_degree() >> 1;
+        }
+
+        void Ciphertext::save(std::ostream& os) const
+        {
+            if (!ciphertext_generated_)
+            {
+                throw std::runtime_error(
+                    "Ciphertext is not generated so can not be serialized!");
+            }
+
+            serialformat::write_header(os, scheme_);
+
+            os.write((char*) &ring_size_, sizeof(ring_size_));
+
+            os.write((char*) &coeff_modulus_count_,
+                     sizeof(coeff_modulus_count_));
+
+            os.write((char*) &cipher_size_, sizeof(cipher_size_));
+
+            os.write((char*) &depth_, sizeof(depth_));
+
+            os.write((char*) &in_ntt_domain_, sizeof(in_ntt_domain_));
+
+            os.write((char*) &host_storage, sizeof(host_storage));
+
+            os.write((char*) &scale_, sizeof(scale_));
+
+            os.write((char*) &slot_count_, sizeof(slot_count_));
+
+            os.write((char*) &rescale_required_, sizeof(rescale_required_));
+
+            os.write((char*) &relinearization_required_,
+                     sizeof(relinearization_required_));
+
+            os.write((char*) &ciphertext_generated_,
+                     sizeof(ciphertext_generated_));
+
+            write_data(os, data_);
+        }
+
+        void Ciphertext::load(std::istream& is)
+        {
+            if (ciphertext_generated_)
+            {
+                throw std::runtime_error("Ciphertext has been already exist!");
+            }
+
+            uint32_t version = read_versioned_scheme(is, scheme_);
+
+            is.read((char*) &ring_size_, sizeof(ring_size_));
+
+            is.read((char*) &coeff_modulus_count_,
+                    sizeof(coeff_modulus_count_));
+
+            is.read((char*) &cipher_size_, sizeof(cipher_size_));
+
+            is.read((char*) &depth_, sizeof(depth_));
+
+            is.read((char*) &in_ntt_domain_, sizeof(in_ntt_domain_));
+
+            storage_tag storage;
+            is.read((char*) &storage, sizeof(storage));
+
+            is.read((char*) &scale_, sizeof(scale_));
+
+            if (version >= 1)
+            {
+                is.read((char*) &slot_count_, sizeof(slot_count_));
+            }
+            else
+            {
+                // Legacy streams predate sparse packing.
+                slot_count_ = ring_size_ >> 1;
+            }
+
+            is.read((char*) &rescale_required_, sizeof(rescale_required_));
+
+            is.read((char*) &relinearization_required_,
+                    sizeof(relinearization_required_));
+
+            is.read((char*) &ciphertext_generated_,
+                    sizeof(ciphertext_generated_));
+
+            read_data(is, data_,
+                      static_cast<size_t>(cipher_size_) * ring_size_ *
+                          (coeff_modulus_count_ - depth_),
+                      "Invalid ciphertext size!");
+
+            ciphertext_generated_ = true;
+        }
+
+        void Publickey::save(std::ostream& os) const
+        {
+            if (!public_key_generated_)
+            {
+                throw std::runtime_error(
+                    "Publickey is not generated so can not be serialized!");
+            }
+
+            os.write((char*) &scheme_, sizeof(scheme_));
+
+            os.write((char*) &ring_size_, sizeof(ring_size_));
+
+            os.write((char*) &coeff_modulus_count_,
+                     sizeof(coeff_modulus_count_));
+
+            os.write((char*) &in_ntt_domain_, sizeof(in_ntt_domain_));
+
+            os.write((char*) &public_key_generated_,
+                     sizeof(public_key_generated_));
+
+            os.write((char*) &host_storage, sizeof(host_storage));
+
+            write_data(os, data_);
+        }
+
+        void Publickey::load(std::istream& is)
+        {
+            if (public_key_generated_)
+            {
+                throw std::runtime_error("Publickey has been already exist!");
+            }
+
+            read_scheme(is, scheme_);
+
+            is.read((char*) &ring_size_, sizeof(ring_size_));
+
+            is.read((char*) &coeff_modulus_count_,
+                    sizeof(coeff_modulus_count_));
+
+            is.read((char*) &in_ntt_domain_, sizeof(in_ntt_domain_));
+
+            is.read((char*) &public_key_generated_,
+                    sizeof(public_key_generated_));
+
+            storage_tag storage;
+            is.read((char*) &storage, sizeof(storage));
+
+            read_data(is, data_,
+                      2 * static_cast<size_t>(coeff_modulus_count_) *
+                          ring_size_,
+                      "Invalid publickey size!");
+
+            public_key_generated_ = true;
+        }
+
+        void Secretkey::save(std::ostream& os) const
+        {
+            if (!secret_key_generated_)
+            {
+                throw std::runtime_error(
+                    "Secretkey is not generated so can not be serialized!");
+            }
+
+            os.write((char*) &scheme_, sizeof(scheme_));
+
+            os.write((char*) &ring_size_, sizeof(ring_size_));
+
+            os.write((char*) &coeff_modulus_count_,
+                     sizeof(coeff_modulus_count_));
+
+            os.write((char*) &n_power_, sizeof(n_power_));
+
+            os.write((char*) &hamming_weight_, sizeof(hamming_weight_));
+
+            os.write((char*) &in_ntt_domain_, sizeof(in_ntt_domain_));
+
+            os.write((char*) &secret_key_generated_,
+                     sizeof(secret_key_generated_));
+
+            os.write((char*) &host_storage, sizeof(host_storage));
+
+            write_data(os, data_);
+        }
+
+        void Secretkey::load(std::istream& is)
+        {
+            if (secret_key_generated_)
+            {
+                throw std::runtime_error("Secretkey has been already exist!");
+            }
+
+            read_scheme(is, scheme_);
+
+            is.read((char*) &ring_size_, sizeof(ring_size_));
+
+            is.read((char*) &coeff_modulus_count_,
+                    sizeof(coeff_modulus_count_));
+
+            is.read((char*) &n_power_, sizeof(n_power_));
+
+            is.read((char*) &hamming_weight_, sizeof(hamming_weight_));
+
+            is.read((char*) &in_ntt_domain_, sizeof(in_ntt_domain_));
+
+            is.read((char*) &secret_key_generated_,
+                    sizeof(secret_key_generated_));
+
+            storage_tag storage;
+            is.read((char*) &storage, sizeof(storage));
+
+            read_data(is, data_,
+                      static_cast<size_t>(coeff_modulus_count_) * ring_size_,
+                      "Invalid secretkey size!");
+
+            secret_key_generated_ = true;
+        }
+
+    } // namespace client
+} // namespace heongpu
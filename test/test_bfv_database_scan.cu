@@ -0,0 +1,149 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+
+TEST(HEonGPU, BFV_Database_Scan)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 4096;
+        int plain_modulus = 1032193;
+        heongpu::HEContext<heongpu::Scheme::BFV> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({40, 40}, {40});
+        context.set_plain_modulus(plain_modulus);
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::BFV> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::BFV> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::BFV> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::BFV> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::BFV> encryptor(context,
+                                                             public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::BFV> decryptor(context,
+                                                             secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::BFV> operators(context,
+                                                                      encoder);
+
+        // Five rows streamed in chunks of two, so the last chunk is partial.
+        const int row_count = 5;
+        const int column_count = 3;
+        const int chunk_row_count = 2;
+        const std::string filename = "bfv_database_scan_test.db";
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<uint64_t> dis(0, plain_modulus - 1);
+        Modulus64 plaintex_modulus(plain_modulus);
+
+        std::vector<std::vector<uint64_t>> query_messages(column_count);
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::BFV>> query;
+        for (int c = 0; c < column_count; c++)
+        {
+            query_messages[c].resize(poly_modulus_degree);
+            for (int i = 0; i < poly_modulus_degree; i++)
+            {
+                query_messages[c][i] = dis(gen);
+            }
+
+            heongpu::Plaintext<heongpu::Scheme::BFV> P1(context);
+            encoder.encode(P1, query_messages[c]);
+
+            heongpu::Ciphertext<heongpu::Scheme::BFV> C1(context);
+            encryptor.encrypt(C1, P1);
+            query.push_back(C1);
+        }
+
+        std::vector<std::vector<uint64_t>> expected(
+            row_count, std::vector<uint64_t>(poly_modulus_degree, 0ULL));
+        {
+            std::ofstream database(filename, std::ios::binary);
+            heongpu::HEDatabaseScanner<heongpu::Scheme::BFV>::save_header(
+                database, context, row_count, column_count);
+
+            for (int r = 0; r < row_count; r++)
+            {
+                std::vector<heongpu::Plaintext<heongpu::Scheme::BFV>> row;
+                for (int c = 0; c < column_count; c++)
+                {
+                    std::vector<uint64_t> message(poly_modulus_degree);
+                    for (int i = 0; i < poly_modulus_degree; i++)
+                    {
+                        message[i] = dis(gen);
+
+                        Data64 input1 = query_messages[c][i];
+                        Data64 input2 = message[i];
+                        Data64 sum = expected[r][i];
+                        Data64 product =
+                            OPERATOR64::mult(input1, input2, plaintex_modulus);
+                        expected[r][i] =
+                            OPERATOR64::add(sum, product, plaintex_modulus);
+                    }
+
+                    heongpu::Plaintext<heongpu::Scheme::BFV> P2(context);
+                    encoder.encode(P2, message);
+
+                    heongpu::Plaintext<heongpu::Scheme::BFV> P2_prepared(
+                        context);
+                    operators.transform_to_ntt(P2, P2_prepared);
+                    row.push_back(P2_prepared);
+                }
+
+                heongpu::HEDatabaseScanner<heongpu::Scheme::BFV>::save_row(
+                    database, column_count, row);
+            }
+
+            // A row that does not match the header is rejected before any of
+            // it is written.
+            std::vector<heongpu::Plaintext<heongpu::Scheme::BFV>> short_row;
+            EXPECT_THROW(
+                heongpu::HEDatabaseScanner<heongpu::Scheme::BFV>::save_row(
+                    database, column_count, short_row),
+                std::invalid_argument);
+        }
+
+        heongpu::HEDatabaseScanner<heongpu::Scheme::BFV> scanner(
+            context, filename, chunk_row_count);
+        EXPECT_EQ(scanner.row_count(), row_count);
+        EXPECT_EQ(scanner.column_count(), column_count);
+
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::BFV>> results;
+        scanner.scan(query, results);
+        ASSERT_EQ(static_cast<int>(results.size()), row_count);
+
+        for (int r = 0; r < row_count; r++)
+        {
+            heongpu::Plaintext<heongpu::Scheme::BFV> P3(context);
+            decryptor.decrypt(P3, results[r]);
+
+            std::vector<uint64_t> result;
+            encoder.decode(result, P3);
+
+            EXPECT_EQ(std::equal(result.begin(), result.end(),
+                                 expected[r].begin()),
+                      true);
+        }
+
+        std::remove(filename.c_str());
+    }
+
+    cudaDeviceSynchronize();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
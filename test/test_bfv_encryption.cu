@@ -284,6 +284,77 @@ TEST(HEonGPU, BFV_Encryption_Decryption)
     cudaDeviceSynchronize();
 }
 
+TEST(HEonGPU, BFV_Batch_Encryption_Decryption)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 8192;
+        int plain_modulus = 1032193;
+        heongpu::HEContext<heongpu::Scheme::BFV> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({54, 54, 54}, {55});
+        context.set_plain_modulus(plain_modulus);
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::BFV> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::BFV> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::BFV> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::BFV> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::BFV> encryptor(context,
+                                                             public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::BFV> decryptor(context,
+                                                             secret_key);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<uint64_t> dis(0, plain_modulus - 1);
+        const int batch_size = 5;
+
+        std::vector<std::vector<uint64_t>> messages(
+            batch_size, std::vector<uint64_t>(poly_modulus_degree, 0ULL));
+        std::vector<heongpu::Plaintext<heongpu::Scheme::BFV>> plaintexts;
+        for (int j = 0; j < batch_size; j++)
+        {
+            for (int i = 0; i < poly_modulus_degree; i++)
+            {
+                messages[j][i] = dis(gen);
+            }
+
+            heongpu::Plaintext<heongpu::Scheme::BFV> P1(context);
+            encoder.encode(P1, messages[j]);
+            plaintexts.push_back(P1);
+        }
+
+        // One ciphertext is already allocated and is reused.
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::BFV>> ciphertexts;
+        ciphertexts.push_back(
+            heongpu::Ciphertext<heongpu::Scheme::BFV>(context));
+        encryptor.encrypt(ciphertexts, plaintexts);
+        ASSERT_EQ(static_cast<int>(ciphertexts.size()), batch_size);
+
+        for (int j = 0; j < batch_size; j++)
+        {
+            heongpu::Plaintext<heongpu::Scheme::BFV> P2(context);
+            decryptor.decrypt(P2, ciphertexts[j]);
+
+            std::vector<uint64_t> gpu_result;
+            encoder.decode(gpu_result, P2);
+
+            cudaDeviceSynchronize();
+
+            EXPECT_EQ(messages[j], gpu_result);
+        }
+    }
+
+    cudaDeviceSynchronize();
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,229 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+#include <sstream>
+
+template <typename T> std::string serialized(const T& object)
+{
+    std::stringstream stream;
+    object.save(stream);
+    return stream.str();
+}
+
+TEST(HEonGPU, BFV_Multiparty_Streaming_Tree_Batched)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 8192;
+        int plain_modulus = 1032193;
+        heongpu::HEContext<heongpu::Scheme::BFV> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({60, 60, 60}, {60});
+        context.set_plain_modulus(plain_modulus);
+        context.generate();
+
+        const int party_count = 5;
+        const int cipher_count = 4;
+
+        heongpu::RNGSeed common_seed;
+        std::vector<int> shift_value = {1};
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::BFV> keygen(context);
+
+        std::vector<heongpu::Secretkey<heongpu::Scheme::BFV>> secret_keys;
+        std::vector<heongpu::MultipartyPublickey<heongpu::Scheme::BFV>>
+            public_key_pieces;
+        std::vector<heongpu::MultipartyRelinkey<heongpu::Scheme::BFV>>
+            relin_key_pieces_stage1;
+        std::vector<heongpu::MultipartyGaloiskey<heongpu::Scheme::BFV>>
+            galois_key_pieces;
+        for (int i = 0; i < party_count; i++)
+        {
+            heongpu::Secretkey<heongpu::Scheme::BFV> secret_key(context);
+            keygen.generate_secret_key(secret_key);
+
+            heongpu::MultipartyPublickey<heongpu::Scheme::BFV> public_key(
+                context, common_seed);
+            keygen.generate_multi_party_public_key_piece(public_key,
+                                                         secret_key);
+
+            heongpu::MultipartyRelinkey<heongpu::Scheme::BFV> relin_key(
+                context, common_seed);
+            keygen.generate_multi_party_relin_key_piece(relin_key, secret_key);
+
+            heongpu::MultipartyGaloiskey<heongpu::Scheme::BFV> galois_key(
+                context, shift_value, common_seed);
+            keygen.generate_multi_party_galios_key_piece(galois_key,
+                                                         secret_key);
+
+            secret_keys.push_back(secret_key);
+            public_key_pieces.push_back(public_key);
+            relin_key_pieces_stage1.push_back(relin_key);
+            galois_key_pieces.push_back(galois_key);
+        }
+
+        // Tree reduction over all pieces and streaming aggregation give the
+        // same keys.
+        heongpu::Publickey<heongpu::Scheme::BFV> tree_public_key(context);
+        keygen.generate_multi_party_public_key(public_key_pieces,
+                                               tree_public_key);
+
+        heongpu::MultipartyRelinkey<heongpu::Scheme::BFV>
+            tree_relin_key_stage1(context, common_seed);
+        keygen.generate_multi_party_relin_key(relin_key_pieces_stage1,
+                                              tree_relin_key_stage1);
+
+        heongpu::Galoiskey<heongpu::Scheme::BFV> tree_galois_key(context,
+                                                                 shift_value);
+        keygen.generate_multi_party_galois_key(galois_key_pieces,
+                                               tree_galois_key);
+
+        heongpu::Publickey<heongpu::Scheme::BFV> public_key(context);
+        heongpu::MultipartyRelinkey<heongpu::Scheme::BFV> relin_key_stage1(
+            context, common_seed);
+        heongpu::Galoiskey<heongpu::Scheme::BFV> galois_key(context,
+                                                            shift_value);
+        for (int i = 0; i < party_count; i++)
+        {
+            keygen.accumulate_multi_party_public_key(public_key_pieces[i],
+                                                     public_key, i == 0);
+            keygen.accumulate_multi_party_relin_key(
+                relin_key_pieces_stage1[i], relin_key_stage1, i == 0);
+            keygen.accumulate_multi_party_galois_key(galois_key_pieces[i],
+                                                     galois_key, i == 0);
+        }
+
+        EXPECT_EQ(serialized(tree_public_key), serialized(public_key));
+        EXPECT_EQ(serialized(tree_relin_key_stage1),
+                  serialized(relin_key_stage1));
+        EXPECT_EQ(serialized(tree_galois_key), serialized(galois_key));
+
+        std::vector<heongpu::MultipartyRelinkey<heongpu::Scheme::BFV>>
+            relin_key_pieces_stage2;
+        for (int i = 0; i < party_count; i++)
+        {
+            heongpu::MultipartyRelinkey<heongpu::Scheme::BFV> relin_key(
+                context, common_seed);
+            keygen.generate_multi_party_relin_key_piece(
+                relin_key_stage1, relin_key, secret_keys[i]);
+            relin_key_pieces_stage2.push_back(relin_key);
+        }
+
+        heongpu::Relinkey<heongpu::Scheme::BFV> tree_relin_key(context);
+        keygen.generate_multi_party_relin_key(
+            relin_key_pieces_stage2, relin_key_stage1, tree_relin_key);
+
+        heongpu::Relinkey<heongpu::Scheme::BFV> relin_key(context);
+        for (int i = 0; i < party_count; i++)
+        {
+            keygen.accumulate_multi_party_relin_key(relin_key_pieces_stage2[i],
+                                                    relin_key_stage1, relin_key,
+                                                    i == 0);
+        }
+
+        EXPECT_EQ(serialized(tree_relin_key), serialized(relin_key));
+
+        // Batched partial decryption and fusion of the evaluated ciphertexts.
+        heongpu::HEEncoder<heongpu::Scheme::BFV> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::BFV> encryptor(context,
+                                                             public_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::BFV> operators(context,
+                                                                      encoder);
+
+        size_t row_size = poly_modulus_degree / 2;
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<uint64_t> dis(0, plain_modulus - 1);
+
+        std::vector<std::vector<uint64_t>> expected(cipher_count);
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::BFV>> ciphertexts;
+        for (int j = 0; j < cipher_count; j++)
+        {
+            std::vector<uint64_t> message(poly_modulus_degree);
+            for (size_t k = 0; k < poly_modulus_degree; k++)
+            {
+                message[k] = dis(gen);
+            }
+
+            expected[j].resize(poly_modulus_degree);
+            for (size_t k = 0; k < row_size; k++)
+            {
+                size_t index = (k + 1) % row_size;
+                expected[j][k] = (message[index] * message[index]) %
+                                 static_cast<uint64_t>(plain_modulus);
+                expected[j][k + row_size] =
+                    (message[index + row_size] * message[index + row_size]) %
+                    static_cast<uint64_t>(plain_modulus);
+            }
+
+            heongpu::Plaintext<heongpu::Scheme::BFV> P1(context);
+            encoder.encode(P1, message);
+
+            heongpu::Ciphertext<heongpu::Scheme::BFV> C1(context);
+            encryptor.encrypt(C1, P1);
+
+            operators.multiply_inplace(C1, C1);
+            operators.relinearize_inplace(C1, relin_key);
+
+            heongpu::Ciphertext<heongpu::Scheme::BFV> C2(context);
+            operators.rotate_rows(C1, C2, galois_key, 1);
+
+            ciphertexts.push_back(C2);
+        }
+
+        std::vector<std::vector<heongpu::Ciphertext<heongpu::Scheme::BFV>>>
+            partial_ciphertexts(party_count);
+        for (int i = 0; i < party_count; i++)
+        {
+            heongpu::HEDecryptor<heongpu::Scheme::BFV> decryptor(
+                context, secret_keys[i]);
+            decryptor.multi_party_decrypt_partial(
+                ciphertexts, secret_keys[i], partial_ciphertexts[i]);
+        }
+
+        heongpu::HEDecryptor<heongpu::Scheme::BFV> decryptor(context,
+                                                             secret_keys[0]);
+
+        std::vector<heongpu::Plaintext<heongpu::Scheme::BFV>> plaintexts;
+        decryptor.multi_party_decrypt_fusion(partial_ciphertexts, plaintexts);
+        ASSERT_EQ(static_cast<int>(plaintexts.size()), cipher_count);
+
+        for (int j = 0; j < cipher_count; j++)
+        {
+            std::vector<uint64_t> result;
+            encoder.decode(result, plaintexts[j]);
+            cudaDeviceSynchronize();
+            EXPECT_EQ(expected[j], result);
+
+            // Streaming fusion folds the same shares one by one.
+            heongpu::Ciphertext<heongpu::Scheme::BFV> accumulated(context);
+            for (int i = 0; i < party_count; i++)
+            {
+                decryptor.multi_party_decrypt_accumulate(
+                    partial_ciphertexts[i][j], accumulated, i == 0);
+            }
+
+            heongpu::Plaintext<heongpu::Scheme::BFV> P2(context);
+            decryptor.multi_party_decrypt_fusion(accumulated, P2);
+
+            std::vector<uint64_t> streaming_result;
+            encoder.decode(streaming_result, P2);
+            cudaDeviceSynchronize();
+            EXPECT_EQ(result, streaming_result);
+        }
+    }
+
+    cudaDeviceSynchronize();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
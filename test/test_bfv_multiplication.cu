@@ -5,6 +5,7 @@
 
 #include "heongpu.cuh"
 #include <gtest/gtest.h>
+#include <sstream>
 
 TEST(HEonGPU, BFV_Ciphertext_Ciphertext_Multiplication_with_Relinearization)
 {
@@ -805,6 +806,236 @@ TEST(HEonGPU, BFV_Ciphertext_Plaintext_Multiplication)
     cudaDeviceSynchronize();
 }
 
+TEST(HEonGPU, BFV_Ciphertext_Prepared_Plaintext_Multiplication)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 8192;
+        int plain_modulus = 1032193;
+        heongpu::HEContext<heongpu::Scheme::BFV> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({54, 54, 54}, {55});
+        context.set_plain_modulus(plain_modulus);
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::BFV> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::BFV> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::BFV> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::BFV> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::BFV> encryptor(context,
+                                                             public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::BFV> decryptor(context,
+                                                             secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::BFV> operators(context,
+                                                                      encoder);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<uint64_t> dis(0, plain_modulus - 1);
+        std::vector<uint64_t> message1(poly_modulus_degree, 0ULL);
+        std::vector<uint64_t> message2(poly_modulus_degree, 0ULL);
+        for (int i = 0; i < poly_modulus_degree; i++)
+        {
+            message1[i] = dis(gen);
+            message2[i] = dis(gen);
+        }
+
+        Modulus64 plaintex_modulus(plain_modulus);
+        std::vector<uint64_t> message_multiplication_result(poly_modulus_degree,
+                                                            0ULL);
+        for (int i = 0; i < poly_modulus_degree; i++)
+        {
+            Data64 input1 = message1[i];
+            Data64 input2 = message2[i];
+            message_multiplication_result[i] =
+                OPERATOR64::mult(input1, input2, plaintex_modulus);
+        }
+
+        heongpu::Plaintext<heongpu::Scheme::BFV> P1(context);
+        encoder.encode(P1, message1);
+
+        heongpu::Plaintext<heongpu::Scheme::BFV> P2(context);
+        encoder.encode(P2, message2);
+
+        // Prepare once, round trip through the serializer, then reuse.
+        heongpu::Plaintext<heongpu::Scheme::BFV> P2_prepared(context);
+        operators.transform_to_ntt(P2, P2_prepared);
+
+        std::stringstream plain_stream;
+        P2_prepared.save(plain_stream);
+        heongpu::Plaintext<heongpu::Scheme::BFV> P2_loaded;
+        P2_loaded.load(plain_stream);
+
+        heongpu::Ciphertext<heongpu::Scheme::BFV> C1(context);
+        encryptor.encrypt(C1, P1);
+
+        // Coefficient domain ciphertext with a prepared plaintext.
+        heongpu::Ciphertext<heongpu::Scheme::BFV> C2(context);
+        operators.multiply_plain(C1, P2_loaded, C2);
+
+        // NTT domain ciphertext with prepared and encoded plaintexts.
+        heongpu::Ciphertext<heongpu::Scheme::BFV> C1_ntt(context);
+        operators.transform_to_ntt(C1, C1_ntt);
+
+        heongpu::Ciphertext<heongpu::Scheme::BFV> C3(context);
+        operators.multiply_plain(C1_ntt, P2_loaded, C3);
+        operators.transform_from_ntt_inplace(C3);
+
+        heongpu::Ciphertext<heongpu::Scheme::BFV> C4(context);
+        operators.multiply_plain(C1_ntt, P2, C4);
+        operators.transform_from_ntt_inplace(C4);
+
+        for (heongpu::Ciphertext<heongpu::Scheme::BFV>* result :
+             {&C2, &C3, &C4})
+        {
+            heongpu::Plaintext<heongpu::Scheme::BFV> P3(context);
+            decryptor.decrypt(P3, *result);
+
+            std::vector<uint64_t> gpu_multiplication_result;
+            encoder.decode(gpu_multiplication_result, P3);
+
+            cudaDeviceSynchronize();
+
+            EXPECT_EQ(std::equal(message_multiplication_result.begin(),
+                                 message_multiplication_result.end(),
+                                 gpu_multiplication_result.begin()),
+                      true);
+        }
+    }
+
+    cudaDeviceSynchronize();
+}
+
+TEST(HEonGPU, BFV_Lazy_Domain_Plaintext_Multiplication_Chain)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 8192;
+        int plain_modulus = 1032193;
+        heongpu::HEContext<heongpu::Scheme::BFV> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({54, 54, 54}, {55});
+        context.set_plain_modulus(plain_modulus);
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::BFV> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::BFV> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::BFV> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::BFV> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::BFV> encryptor(context,
+                                                             public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::BFV> decryptor(context,
+                                                             secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::BFV> operators(context,
+                                                                      encoder);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<uint64_t> dis(0, plain_modulus - 1);
+        std::vector<uint64_t> message1(poly_modulus_degree, 0ULL);
+        std::vector<uint64_t> message2(poly_modulus_degree, 0ULL);
+        std::vector<uint64_t> message3(poly_modulus_degree, 0ULL);
+        for (int i = 0; i < poly_modulus_degree; i++)
+        {
+            message1[i] = dis(gen);
+            message2[i] = dis(gen);
+            message3[i] = dis(gen);
+        }
+
+        // m1 * m2 + m1 * m3, then + m1.
+        Modulus64 plaintex_modulus(plain_modulus);
+        std::vector<uint64_t> message_chain_result(poly_modulus_degree, 0ULL);
+        std::vector<uint64_t> message_final_result(poly_modulus_degree, 0ULL);
+        for (int i = 0; i < poly_modulus_degree; i++)
+        {
+            Data64 input1 = message1[i];
+            Data64 input2 = message2[i];
+            Data64 input3 = message3[i];
+            Data64 product1 =
+                OPERATOR64::mult(input1, input2, plaintex_modulus);
+            Data64 product2 =
+                OPERATOR64::mult(input1, input3, plaintex_modulus);
+            Data64 sum = OPERATOR64::add(product1, product2, plaintex_modulus);
+            message_chain_result[i] = sum;
+            message_final_result[i] =
+                OPERATOR64::add(sum, input1, plaintex_modulus);
+        }
+
+        heongpu::Plaintext<heongpu::Scheme::BFV> P1(context);
+        encoder.encode(P1, message1);
+
+        heongpu::Plaintext<heongpu::Scheme::BFV> P2(context);
+        encoder.encode(P2, message2);
+        operators.transform_to_ntt_inplace(P2);
+
+        heongpu::Plaintext<heongpu::Scheme::BFV> P3(context);
+        encoder.encode(P3, message3);
+        operators.transform_to_ntt_inplace(P3);
+
+        heongpu::Ciphertext<heongpu::Scheme::BFV> C1(context);
+        encryptor.encrypt(C1, P1);
+
+        operators.set_lazy_domain(true);
+        operators.reset_domain_statistics();
+
+        // C1 is moved to the NTT domain once and every product stays there.
+        heongpu::Ciphertext<heongpu::Scheme::BFV> C2(context);
+        operators.multiply_plain(C1, P2, C2);
+
+        heongpu::Ciphertext<heongpu::Scheme::BFV> C3(context);
+        operators.multiply_plain(C1, P3, C3);
+
+        operators.add_inplace(C2, C3);
+
+        EXPECT_EQ(C1.in_ntt_domain(), true);
+        EXPECT_EQ(C2.in_ntt_domain(), true);
+        EXPECT_EQ(operators.domain_statistics().forward_transforms, 1u);
+        EXPECT_EQ(operators.domain_statistics().inverse_transforms, 0u);
+
+        heongpu::Plaintext<heongpu::Scheme::BFV> P4(context);
+        decryptor.decrypt(P4, C2);
+        std::vector<uint64_t> gpu_chain_result;
+        encoder.decode(gpu_chain_result, P4);
+        cudaDeviceSynchronize();
+
+        EXPECT_EQ(std::equal(message_chain_result.begin(),
+                             message_chain_result.end(),
+                             gpu_chain_result.begin()),
+                  true);
+
+        // Plaintext addition needs the coefficient domain.
+        operators.add_plain_inplace(C2, P1);
+
+        EXPECT_EQ(C2.in_ntt_domain(), false);
+        EXPECT_EQ(operators.domain_statistics().inverse_transforms, 1u);
+
+        heongpu::Plaintext<heongpu::Scheme::BFV> P5(context);
+        decryptor.decrypt(P5, C2);
+        std::vector<uint64_t> gpu_final_result;
+        encoder.decode(gpu_final_result, P5);
+        cudaDeviceSynchronize();
+
+        EXPECT_EQ(std::equal(message_final_result.begin(),
+                             message_final_result.end(),
+                             gpu_final_result.begin()),
+                  true);
+    }
+
+    cudaDeviceSynchronize();
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -430,6 +430,115 @@ TEST(HEonGPU, BFV_Ciphertext_Rotation_Keyswitching_Method_I)
     cudaDeviceSynchronize();
 }
 
+TEST(HEonGPU, BFV_Ciphertext_Expand_Keyswitching_Method_I)
+{
+    cudaSetDevice(0);
+
+    {
+        size_t poly_modulus_degree = 4096;
+        int plain_modulus = 1032193;
+        heongpu::HEContext<heongpu::Scheme::BFV> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({40, 40}, {40});
+        context.set_plain_modulus(plain_modulus);
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::BFV> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::BFV> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::BFV> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::BFV> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::BFV> encryptor(context,
+                                                             public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::BFV> decryptor(context,
+                                                             secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::BFV> operators(context,
+                                                                      encoder);
+
+        const int output_count = 6;
+        std::vector<uint32_t> galois_elts =
+            operators.expand_galois_elements(output_count);
+        EXPECT_EQ(static_cast<int>(galois_elts.size()), 3);
+
+        heongpu::Galoiskey<heongpu::Scheme::BFV> galois_key(context,
+                                                            galois_elts);
+        keygen.generate_galois_key(galois_key, secret_key);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<uint64_t> dis(0, plain_modulus - 1);
+        std::vector<uint64_t> message1(poly_modulus_degree, 0ULL);
+        for (int i = 0; i < poly_modulus_degree; i++)
+        {
+            message1[i] = dis(gen);
+        }
+
+        heongpu::Plaintext<heongpu::Scheme::BFV> P1(context);
+        encoder.encode(P1, message1);
+
+        heongpu::Ciphertext<heongpu::Scheme::BFV> C1(context);
+        encryptor.encrypt(C1, P1);
+
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::BFV>> expanded;
+        operators.expand(C1, expanded, galois_key, output_count);
+        ASSERT_EQ(static_cast<int>(expanded.size()), output_count);
+
+        // Reference: the same expansion tree, one ciphertext at a time.
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::BFV>> reference = {
+            C1};
+        for (int level = 0; level < static_cast<int>(galois_elts.size());
+             level++)
+        {
+            int level_size = 1 << level;
+            std::vector<heongpu::Ciphertext<heongpu::Scheme::BFV>> next(
+                2 * level_size);
+            for (int b = 0; b < level_size; b++)
+            {
+                heongpu::Ciphertext<heongpu::Scheme::BFV> C2(context);
+                operators.multiply_power_of_X(
+                    reference[b], C2, (2 * poly_modulus_degree) - level_size);
+
+                heongpu::Ciphertext<heongpu::Scheme::BFV> C3(context);
+                operators.apply_galois(reference[b], C3, galois_key,
+                                       galois_elts[level]);
+                heongpu::Ciphertext<heongpu::Scheme::BFV> C4(context);
+                operators.apply_galois(C2, C4, galois_key, galois_elts[level]);
+
+                operators.add(reference[b], C3, next[b]);
+                operators.add(C2, C4, next[b + level_size]);
+            }
+            reference = std::move(next);
+        }
+
+        for (int i = 0; i < output_count; i++)
+        {
+            heongpu::Plaintext<heongpu::Scheme::BFV> P2(context);
+            decryptor.decrypt(P2, expanded[i]);
+            std::vector<uint64_t> expand_result;
+            encoder.decode(expand_result, P2);
+
+            heongpu::Plaintext<heongpu::Scheme::BFV> P3(context);
+            decryptor.decrypt(P3, reference[i]);
+            std::vector<uint64_t> reference_result;
+            encoder.decode(reference_result, P3);
+
+            cudaDeviceSynchronize();
+
+            EXPECT_EQ(std::equal(reference_result.begin(),
+                                 reference_result.end(),
+                                 expand_result.begin()),
+                      true);
+        }
+    }
+
+    cudaDeviceSynchronize();
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
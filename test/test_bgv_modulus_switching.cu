@@ -0,0 +1,423 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST(HEonGPU, BGV_Modulus_Switching)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 8192;
+        int plain_modulus = 65537;
+        heongpu::HEContext<heongpu::Scheme::BGV> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({60, 50, 50, 50}, {60});
+        context.set_plain_modulus(plain_modulus);
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::BGV> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::BGV> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::BGV> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::Relinkey<heongpu::Scheme::BGV> relin_key(context);
+        keygen.generate_relin_key(relin_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::BGV> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::BGV> encryptor(context,
+                                                             public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::BGV> decryptor(context,
+                                                             secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::BGV> operators(context,
+                                                                      encoder);
+        // Switch explicitly to control the level of every operand.
+        operators.set_auto_mod_switch(false);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<uint64_t> dis(0, plain_modulus - 1);
+        std::vector<uint64_t> message1(poly_modulus_degree, 0ULL);
+        std::vector<uint64_t> message2(poly_modulus_degree, 0ULL);
+        std::vector<uint64_t> message3(poly_modulus_degree, 0ULL);
+        for (int i = 0; i < poly_modulus_degree; i++)
+        {
+            message1[i] = dis(gen);
+            message2[i] = dis(gen);
+            message3[i] = dis(gen);
+        }
+
+        Modulus64 plaintex_modulus(plain_modulus);
+        std::vector<uint64_t> message_multiplication_result(poly_modulus_degree,
+                                                            0ULL);
+        std::vector<uint64_t> message_mul_add_result(poly_modulus_degree,
+                                                     0ULL);
+        for (int i = 0; i < poly_modulus_degree; i++)
+        {
+            message_multiplication_result[i] =
+                OPERATOR64::mult(message1[i], message2[i], plaintex_modulus);
+            message_mul_add_result[i] =
+                OPERATOR64::add(message_multiplication_result[i], message3[i],
+                                plaintex_modulus);
+        }
+
+        heongpu::Plaintext<heongpu::Scheme::BGV> P1(context);
+        encoder.encode(P1, message1);
+
+        heongpu::Plaintext<heongpu::Scheme::BGV> P2(context);
+        encoder.encode(P2, message2);
+
+        heongpu::Plaintext<heongpu::Scheme::BGV> P3(context);
+        encoder.encode(P3, message3);
+
+        heongpu::Ciphertext<heongpu::Scheme::BGV> C1(context);
+        encryptor.encrypt(C1, P1);
+
+        heongpu::Ciphertext<heongpu::Scheme::BGV> C2(context);
+        encryptor.encrypt(C2, P2);
+
+        heongpu::Ciphertext<heongpu::Scheme::BGV> C3(context);
+        encryptor.encrypt(C3, P3);
+
+        // Multiply at the top level, then drop one prime.
+        heongpu::Ciphertext<heongpu::Scheme::BGV> C4(context);
+        operators.multiply(C1, C2, C4);
+        operators.relinearize_inplace(C4, relin_key);
+        operators.mod_switch_to_next_inplace(C4);
+
+        EXPECT_EQ(C4.depth(), 1);
+
+        heongpu::Plaintext<heongpu::Scheme::BGV> P4(context);
+        decryptor.decrypt(P4, C4);
+
+        std::vector<uint64_t> gpu_multiplication_result;
+        encoder.decode(gpu_multiplication_result, P4);
+
+        cudaDeviceSynchronize();
+
+        EXPECT_EQ(std::equal(message_multiplication_result.begin(),
+                             message_multiplication_result.end(),
+                             gpu_multiplication_result.begin()),
+                  true);
+
+        // Multiply at a lower level, where the correction factor of the
+        // product differs from the one of a freshly switched ciphertext.
+        operators.mod_switch_to_next_inplace(C1);
+        operators.mod_switch_to_next_inplace(C2);
+        operators.mod_switch_to_next_inplace(C3);
+
+        operators.multiply_inplace(C1, C2);
+        operators.relinearize_inplace(C1, relin_key);
+
+        EXPECT_NE(C1.correction_factor(), C3.correction_factor());
+
+        operators.add_inplace(C1, C3);
+        operators.mod_switch_to_next_inplace(C1);
+
+        EXPECT_EQ(C1.depth(), 2);
+
+        heongpu::Plaintext<heongpu::Scheme::BGV> P5(context);
+        decryptor.decrypt(P5, C1);
+
+        std::vector<uint64_t> gpu_mul_add_result;
+        encoder.decode(gpu_mul_add_result, P5);
+
+        cudaDeviceSynchronize();
+
+        EXPECT_EQ(std::equal(message_mul_add_result.begin(),
+                             message_mul_add_result.end(),
+                             gpu_mul_add_result.begin()),
+                  true);
+
+        operators.mod_switch_to_next_inplace(C1);
+        EXPECT_THROW(operators.mod_switch_to_next_inplace(C1),
+                     std::logic_error);
+    }
+
+    cudaDeviceSynchronize();
+
+    {
+        size_t poly_modulus_degree = 8192;
+        int plain_modulus = 65537;
+        heongpu::HEContext<heongpu::Scheme::BGV> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({60, 50, 50}, {60});
+        context.set_plain_modulus(plain_modulus);
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::BGV> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::BGV> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::BGV> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::BGV> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::BGV> encryptor(context,
+                                                             public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::BGV> decryptor(context,
+                                                             secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::BGV> operators(context,
+                                                                      encoder);
+
+        heongpu::Galoiskey<heongpu::Scheme::BGV> galois_key(context);
+        keygen.generate_galois_key(galois_key, secret_key);
+
+        // 7 has no key of its own and is composed of several rotations.
+        std::vector<int> shift_index = {-5, 7, 64};
+
+        for (size_t j = 0; j < shift_index.size(); j++)
+        {
+            std::random_device rd;
+            std::mt19937 gen(rd());
+            std::uniform_int_distribution<uint64_t> dis(0, plain_modulus - 1);
+            std::vector<uint64_t> message1(poly_modulus_degree, 0ULL);
+            for (int i = 0; i < poly_modulus_degree; i++)
+            {
+                message1[i] = dis(gen);
+            }
+
+            int shift_count = shift_index[j];
+            size_t row_size = poly_modulus_degree / 2;
+            std::vector<uint64_t> message_rotation_result(poly_modulus_degree,
+                                                          0ULL);
+            for (int i = 0; i < row_size; i++)
+            {
+                int index = ((i + shift_count) < 0)
+                                ? ((i + shift_count) + row_size)
+                                : ((i + shift_count) % row_size);
+                message_rotation_result[i] = message1[index];
+                message_rotation_result[i + row_size] =
+                    message1[index + row_size];
+            }
+
+            heongpu::Plaintext<heongpu::Scheme::BGV> P1(context);
+            encoder.encode(P1, message1);
+
+            heongpu::Ciphertext<heongpu::Scheme::BGV> C1(context);
+            encryptor.encrypt(C1, P1);
+
+            // Rotate below the top level.
+            operators.mod_switch_to_next_inplace(C1);
+            operators.rotate_rows(C1, C1, galois_key, shift_count);
+
+            heongpu::Plaintext<heongpu::Scheme::BGV> P3(context);
+            decryptor.decrypt(P3, C1);
+
+            std::vector<uint64_t> gpu_rotation_result;
+            encoder.decode(gpu_rotation_result, P3);
+
+            cudaDeviceSynchronize();
+
+            EXPECT_EQ(std::equal(message_rotation_result.begin(),
+                                 message_rotation_result.end(),
+                                 gpu_rotation_result.begin()),
+                      true);
+        }
+    }
+
+    cudaDeviceSynchronize();
+
+    {
+        heongpu::HEContext<heongpu::Scheme::BGV> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_II,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(8192);
+        context.set_coeff_modulus_bit_sizes({60, 50, 50}, {60});
+        context.set_plain_modulus(65537);
+
+        EXPECT_THROW(context.generate(), std::invalid_argument);
+    }
+
+    cudaDeviceSynchronize();
+}
+
+TEST(HEonGPU, BGV_Auto_Modulus_Switching)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 8192;
+        int plain_modulus = 65537;
+        heongpu::HEContext<heongpu::Scheme::BGV> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({60, 50, 50}, {60});
+        context.set_plain_modulus(plain_modulus);
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::BGV> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::BGV> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::BGV> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::Relinkey<heongpu::Scheme::BGV> relin_key(context);
+        keygen.generate_relin_key(relin_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::BGV> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::BGV> encryptor(context,
+                                                             public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::BGV> decryptor(context,
+                                                             secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::BGV> operators(context,
+                                                                      encoder);
+
+        EXPECT_EQ(operators.auto_mod_switch(), true);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<uint64_t> dis(0, plain_modulus - 1);
+        std::vector<uint64_t> message1(poly_modulus_degree, 0ULL);
+        std::vector<uint64_t> message2(poly_modulus_degree, 0ULL);
+        for (int i = 0; i < poly_modulus_degree; i++)
+        {
+            message1[i] = dis(gen);
+            message2[i] = dis(gen);
+        }
+
+        Modulus64 plaintex_modulus(plain_modulus);
+        std::vector<uint64_t> message_product(poly_modulus_degree, 0ULL);
+        std::vector<uint64_t> message_square(poly_modulus_degree, 0ULL);
+        for (int i = 0; i < poly_modulus_degree; i++)
+        {
+            message_product[i] =
+                OPERATOR64::mult(message1[i], message2[i], plaintex_modulus);
+            message_square[i] = OPERATOR64::mult(
+                message_product[i], message_product[i], plaintex_modulus);
+        }
+
+        heongpu::Plaintext<heongpu::Scheme::BGV> P1(context);
+        encoder.encode(P1, message1);
+
+        heongpu::Plaintext<heongpu::Scheme::BGV> P2(context);
+        encoder.encode(P2, message2);
+
+        heongpu::Ciphertext<heongpu::Scheme::BGV> C1(context);
+        encryptor.encrypt(C1, P1);
+
+        heongpu::Ciphertext<heongpu::Scheme::BGV> C2(context);
+        encryptor.encrypt(C2, P2);
+
+        // The product is switched before relinearization.
+        heongpu::Ciphertext<heongpu::Scheme::BGV> C3(context);
+        operators.multiply(C1, C2, C3);
+        EXPECT_EQ(C3.depth(), 1);
+        operators.relinearize_inplace(C3, relin_key);
+
+        heongpu::Plaintext<heongpu::Scheme::BGV> P3(context);
+        decryptor.decrypt(P3, C3);
+
+        std::vector<uint64_t> gpu_product;
+        encoder.decode(gpu_product, P3);
+
+        cudaDeviceSynchronize();
+
+        EXPECT_EQ(std::equal(message_product.begin(), message_product.end(),
+                             gpu_product.begin()),
+                  true);
+
+        operators.multiply_inplace(C3, C3);
+        EXPECT_EQ(C3.depth(), 2);
+        operators.relinearize_inplace(C3, relin_key);
+
+        heongpu::Plaintext<heongpu::Scheme::BGV> P4(context);
+        decryptor.decrypt(P4, C3);
+
+        std::vector<uint64_t> gpu_square;
+        encoder.decode(gpu_square, P4);
+
+        cudaDeviceSynchronize();
+
+        EXPECT_EQ(std::equal(message_square.begin(), message_square.end(),
+                             gpu_square.begin()),
+                  true);
+
+        // At the last level the product stays where it is.
+        heongpu::Ciphertext<heongpu::Scheme::BGV> C4(context);
+        operators.multiply(C3, C3, C4);
+        EXPECT_EQ(C4.depth(), 2);
+    }
+
+    cudaDeviceSynchronize();
+}
+
+TEST(HEonGPU, BGV_Serialization_Scheme_Checks)
+{
+    cudaSetDevice(0);
+    {
+        heongpu::HEContext<heongpu::Scheme::BGV> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(8192);
+        context.set_coeff_modulus_bit_sizes({60, 50, 50}, {60});
+        context.set_plain_modulus(65537);
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::BGV> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::BGV> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::BGV> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        std::stringstream secret_key_stream;
+        secret_key.save(secret_key_stream);
+        std::stringstream public_key_stream;
+        public_key.save(public_key_stream);
+
+        // BGV streams load into BGV objects only.
+        heongpu::Secretkey<heongpu::Scheme::BFV> bfv_secret_key;
+        EXPECT_THROW(bfv_secret_key.load(secret_key_stream),
+                     std::runtime_error);
+        heongpu::Publickey<heongpu::Scheme::BFV> bfv_public_key;
+        EXPECT_THROW(bfv_public_key.load(public_key_stream),
+                     std::runtime_error);
+
+        secret_key_stream.clear();
+        secret_key_stream.seekg(0);
+        heongpu::Secretkey<heongpu::Scheme::BGV> loaded_secret_key;
+        loaded_secret_key.load(secret_key_stream);
+
+        public_key_stream.clear();
+        public_key_stream.seekg(0);
+        heongpu::Publickey<heongpu::Scheme::BGV> loaded_public_key;
+        loaded_public_key.load(public_key_stream);
+
+        heongpu::HEContext<heongpu::Scheme::BFV> bfv_context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        bfv_context.set_poly_modulus_degree(8192);
+        bfv_context.set_coeff_modulus_bit_sizes({60, 50, 50}, {60});
+        bfv_context.set_plain_modulus(65537);
+        bfv_context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::BFV> bfv_keygen(bfv_context);
+        heongpu::Secretkey<heongpu::Scheme::BFV> bfv_key(bfv_context);
+        bfv_keygen.generate_secret_key(bfv_key);
+
+        std::stringstream bfv_stream;
+        bfv_key.save(bfv_stream);
+
+        heongpu::Secretkey<heongpu::Scheme::BGV> bgv_key;
+        EXPECT_THROW(bgv_key.load(bfv_stream), std::runtime_error);
+    }
+
+    cudaDeviceSynchronize();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
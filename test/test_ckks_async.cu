@@ -0,0 +1,165 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <random>
+
+template <typename T>
+bool fix_point_equal(T input1, T input2, T epsilon = static_cast<T>(1e-4))
+{
+    return std::fabs(input1 - input2) < epsilon;
+}
+
+TEST(HEonGPU, CKKS_Async_Pipeline)
+{
+    cudaSetDevice(0);
+
+    {
+        size_t poly_modulus_degree = 8192;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({40, 30, 30}, {40});
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::Relinkey<heongpu::Scheme::CKKS> relin_key(context);
+        keygen.generate_relin_key(relin_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(context,
+                                                                       encoder);
+
+        cudaDeviceSynchronize();
+
+        const int row_size = poly_modulus_degree / 2;
+        double scale = pow(2.0, 30);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<> dis(0.0, 1.0);
+
+        // Two requests in flight, each on its own stream.
+        constexpr int request_count = 2;
+        cudaStream_t streams[request_count];
+        std::vector<heongpu::HostVector<double>> messages(request_count);
+        std::vector<heongpu::HostVector<double>> results(request_count);
+        std::vector<std::vector<double>> serialized(request_count);
+        std::vector<std::future<void>> sent;
+        std::atomic<int> callback_count(0);
+
+        for (int r = 0; r < request_count; r++)
+        {
+            cudaStreamCreate(&streams[r]);
+            messages[r].resize(row_size);
+            for (int i = 0; i < row_size; i++)
+            {
+                messages[r][i] = dis(gen);
+            }
+        }
+
+        for (int r = 0; r < request_count; r++)
+        {
+            heongpu::ExecutionOptions options =
+                heongpu::ExecutionOptions().set_stream(streams[r]);
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context, options);
+            encoder.encode_async(P1, messages[r], scale, options);
+
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C1(context, options);
+            heongpu::Completion evaluated = heongpu::launch_async(
+                options,
+                [&]()
+                {
+                    encryptor.encrypt(C1, P1, options);
+                    operators.multiply_inplace(C1, C1, options);
+                    operators.relinearize_inplace(C1, relin_key, options);
+                    operators.rescale_inplace(C1, options);
+                });
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context, options);
+            decryptor.decrypt(P2, C1, options);
+            heongpu::Completion decoded =
+                encoder.decode_async(results[r], P2, options);
+
+            sent.push_back(decoded.then(
+                [&, r]()
+                {
+                    serialized[r].assign(results[r].begin(), results[r].end());
+                    callback_count++;
+                }));
+
+            EXPECT_NO_THROW(evaluated.ready());
+        }
+
+        for (int r = 0; r < request_count; r++)
+        {
+            sent[r].get();
+
+            ASSERT_EQ(static_cast<int>(serialized[r].size()), row_size);
+            bool check = true;
+            for (int i = 0; i < row_size; i++)
+            {
+                double expected = messages[r][i] * messages[r][i];
+                check = check && fix_point_equal(expected, serialized[r][i],
+                                                 static_cast<double>(1e-2));
+            }
+            EXPECT_EQ(check, true);
+        }
+        EXPECT_EQ(callback_count.load(), request_count);
+
+        // Continuations see exceptions of their callbacks through the future.
+        heongpu::Completion done = heongpu::Completion::record(streams[0]);
+        std::future<void> failed =
+            done.then([]() { throw std::runtime_error("failed"); });
+        EXPECT_THROW(failed.get(), std::runtime_error);
+        EXPECT_EQ(done.ready(), true);
+
+        // Host copies of a ciphertext are valid once the handle is ready.
+        heongpu::ExecutionOptions options =
+            heongpu::ExecutionOptions().set_stream(streams[1]);
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P3(context, options);
+        encoder.encode(P3, messages[1], scale, options);
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C3(context, options);
+        encryptor.encrypt(C3, P3, options);
+
+        heongpu::Completion stored = C3.store_in_host_async(streams[1]);
+        stored.wait();
+        EXPECT_EQ(stored.ready(), true);
+        EXPECT_EQ(C3.is_on_device(), false);
+
+        // A default handle is already complete.
+        heongpu::Completion empty;
+        EXPECT_EQ(empty.ready(), true);
+        EXPECT_NO_THROW(empty.wait_on(streams[0]));
+
+        for (int r = 0; r < request_count; r++)
+        {
+            cudaStreamSynchronize(streams[r]);
+            cudaStreamDestroy(streams[r]);
+        }
+    }
+
+    cudaDeviceSynchronize();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
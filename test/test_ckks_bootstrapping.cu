@@ -0,0 +1,486 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+
+template <typename T>
+bool fix_point_equal(T input1, T input2, T epsilon = static_cast<T>(1e-2))
+{
+    return std::fabs(input1 - input2) < epsilon;
+}
+
+bool fix_point_array_check(const std::vector<Complex64>& array1,
+                           const std::vector<Complex64>& array2,
+                           double epsilon = 1e-2)
+{
+    if (array1.size() != array2.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < array1.size(); ++i)
+    {
+        if (!fix_point_equal(array1[i].real(), array2[i].real(), epsilon) ||
+            !fix_point_equal(array1[i].imag(), array2[i].imag(), epsilon))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Serializes the ciphertext and loads it into a fresh one, so the slot count
+// has to survive the stream for bootstrapping to accept the result.
+heongpu::Ciphertext<heongpu::Scheme::CKKS>
+round_trip(heongpu::Ciphertext<heongpu::Scheme::CKKS>& cipher,
+           heongpu::HEContext<heongpu::Scheme::CKKS>& context)
+{
+    std::stringstream stream;
+    cipher.save(stream);
+
+    heongpu::Ciphertext<heongpu::Scheme::CKKS> loaded(context);
+    loaded.load(stream);
+    return loaded;
+}
+
+TEST(HEonGPU, CKKS_Sparse_Regular_Bootstrapping)
+{
+    cudaSetDevice(0);
+
+    {
+        size_t poly_modulus_degree = 4096;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_II,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes(
+            {60, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+             50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50},
+            {60, 60, 60});
+        context.generate();
+
+        double scale = pow(2.0, 50);
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context, 16);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::Relinkey<heongpu::Scheme::CKKS> relin_key(context);
+        keygen.generate_relin_key(relin_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(
+            context, encoder);
+
+        const int slot_count = 64;
+        heongpu::BootstrappingConfig boot_config(3, 3, 11, true, slot_count);
+        operators.generate_bootstrapping_params(scale, boot_config);
+
+        std::vector<int> key_index = operators.bootstrapping_key_indexs();
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key(context,
+                                                             key_index);
+        keygen.generate_galois_key(galois_key, secret_key);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<double> dis(-0.5, 0.5);
+        std::vector<Complex64> message(slot_count);
+        for (int i = 0; i < slot_count; i++)
+        {
+            message[i] = Complex64(dis(gen), dis(gen));
+        }
+
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+        encoder.encode(P1, message, scale, slot_count);
+
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C1(context);
+        encryptor.encrypt(C1, P1);
+        EXPECT_EQ(C1.slot_count(), slot_count);
+
+        for (int i = 0; i < 31 - 1; i++)
+        {
+            operators.mod_drop_inplace(C1);
+        }
+
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C2 =
+            round_trip(C1, context);
+        EXPECT_EQ(C2.slot_count(), slot_count);
+
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> cipher_boot =
+            operators.regular_bootstrapping(C2, galois_key, relin_key);
+        EXPECT_EQ(cipher_boot.slot_count(), slot_count);
+
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context);
+        decryptor.decrypt(P2, cipher_boot);
+
+        std::vector<Complex64> gpu_result;
+        encoder.decode(gpu_result, P2);
+
+        cudaDeviceSynchronize();
+
+        EXPECT_EQ(fix_point_array_check(message, gpu_result), true);
+    }
+
+    cudaDeviceSynchronize();
+}
+
+TEST(HEonGPU, CKKS_Sparse_Slim_Bootstrapping)
+{
+    cudaSetDevice(0);
+
+    {
+        size_t poly_modulus_degree = 4096;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_II,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes(
+            {60, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+             50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50},
+            {60, 60, 60});
+        context.generate();
+
+        double scale = pow(2.0, 50);
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context, 16);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::Relinkey<heongpu::Scheme::CKKS> relin_key(context);
+        keygen.generate_relin_key(relin_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(
+            context, encoder);
+
+        const int slot_count = 64;
+        int StoC_piece = 3;
+        heongpu::BootstrappingConfig boot_config(3, StoC_piece, 7, true,
+                                                 slot_count);
+        operators.generate_bootstrapping_params(scale, boot_config);
+
+        std::vector<int> key_index = operators.bootstrapping_key_indexs();
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key(context,
+                                                             key_index);
+        keygen.generate_galois_key(galois_key, secret_key);
+
+        // Slim bootstrapping takes real messages.
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<double> dis(-0.5, 0.5);
+        std::vector<double> message(slot_count);
+        std::vector<Complex64> expected(slot_count);
+        for (int i = 0; i < slot_count; i++)
+        {
+            message[i] = dis(gen);
+            expected[i] = Complex64(message[i], 0.0);
+        }
+
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+        encoder.encode(P1, message, scale, slot_count);
+
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C1(context);
+        encryptor.encrypt(C1, P1);
+
+        for (int i = 0; i < (28 - StoC_piece); i++)
+        {
+            operators.mod_drop_inplace(C1);
+        }
+
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C2 =
+            round_trip(C1, context);
+        EXPECT_EQ(C2.slot_count(), slot_count);
+
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> cipher_boot =
+            operators.slim_bootstrapping(C2, galois_key, relin_key);
+        EXPECT_EQ(cipher_boot.slot_count(), slot_count);
+
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context);
+        decryptor.decrypt(P2, cipher_boot);
+
+        std::vector<Complex64> gpu_result;
+        encoder.decode(gpu_result, P2);
+
+        cudaDeviceSynchronize();
+
+        EXPECT_EQ(fix_point_array_check(expected, gpu_result), true);
+    }
+
+    cudaDeviceSynchronize();
+}
+
+// Encrypts real messages and drops them to the given number of remaining
+// primes, where bootstrapping expects its input.
+std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>>
+encrypt_real(const std::vector<std::vector<double>>& messages, double scale,
+             int remaining_primes, int Q_size,
+             heongpu::HEContext<heongpu::Scheme::CKKS>& context,
+             heongpu::HEEncoder<heongpu::Scheme::CKKS>& encoder,
+             heongpu::HEEncryptor<heongpu::Scheme::CKKS>& encryptor,
+             heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS>& operators)
+{
+    std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> ciphers;
+    for (const std::vector<double>& message : messages)
+    {
+        heongpu::Plaintext<heongpu::Scheme::CKKS> plain(context);
+        encoder.encode(plain, message, scale);
+
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> cipher(context);
+        encryptor.encrypt(cipher, plain);
+
+        for (int i = 0; i < Q_size - remaining_primes; i++)
+        {
+            operators.mod_drop_inplace(cipher);
+        }
+
+        ciphers.push_back(std::move(cipher));
+    }
+
+    return ciphers;
+}
+
+// Decrypts each output and compares it with the real message; the imaginary
+// parts have to vanish for the pair to have been separated.
+bool check_real(
+    std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>>& ciphers,
+    const std::vector<std::vector<double>>& messages,
+    heongpu::HEContext<heongpu::Scheme::CKKS>& context,
+    heongpu::HEEncoder<heongpu::Scheme::CKKS>& encoder,
+    heongpu::HEDecryptor<heongpu::Scheme::CKKS>& decryptor)
+{
+    if (ciphers.size() != messages.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < ciphers.size(); i++)
+    {
+        if (ciphers[i].depth() != ciphers[0].depth())
+        {
+            return false;
+        }
+
+        heongpu::Plaintext<heongpu::Scheme::CKKS> plain(context);
+        decryptor.decrypt(plain, ciphers[i]);
+
+        std::vector<Complex64> gpu_result;
+        encoder.decode(gpu_result, plain);
+
+        std::vector<Complex64> expected(messages[i].size());
+        for (size_t j = 0; j < messages[i].size(); j++)
+        {
+            expected[j] = Complex64(messages[i][j], 0.0);
+        }
+
+        if (!fix_point_array_check(expected, gpu_result))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::vector<std::vector<double>> random_real_messages(int count,
+                                                      int slot_count)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<double> dis(-0.5, 0.5);
+
+    std::vector<std::vector<double>> messages(count,
+                                              std::vector<double>(slot_count));
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < slot_count; j++)
+        {
+            messages[i][j] = dis(gen);
+        }
+    }
+
+    return messages;
+}
+
+TEST(HEonGPU, CKKS_Real_Pair_Bootstrapping)
+{
+    cudaSetDevice(0);
+
+    {
+        size_t poly_modulus_degree = 4096;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_II,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes(
+            {60, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+             50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50},
+            {60, 60, 60});
+        context.generate();
+        const int Q_size = 31;
+
+        double scale = pow(2.0, 50);
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context, 16);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::Relinkey<heongpu::Scheme::CKKS> relin_key(context);
+        keygen.generate_relin_key(relin_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(
+            context, encoder);
+
+        heongpu::BootstrappingConfig boot_config(3, 3, 11, true);
+        operators.generate_bootstrapping_params(scale, boot_config);
+
+        std::vector<int> key_index = operators.bootstrapping_key_indexs();
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key(context,
+                                                             key_index);
+        keygen.generate_galois_key(galois_key, secret_key);
+
+        const int slot_count = poly_modulus_degree / 2;
+
+        // Two ciphertexts packed into one bootstrapping.
+        std::vector<std::vector<double>> pair_messages =
+            random_real_messages(2, slot_count);
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> pair_inputs =
+            encrypt_real(pair_messages, scale, 1, Q_size, context, encoder,
+                         encryptor, operators);
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> pair_outputs(
+            2);
+        operators.regular_bootstrapping_real(
+            pair_inputs[0], pair_inputs[1], pair_outputs[0], pair_outputs[1],
+            galois_key, relin_key);
+
+        EXPECT_EQ(check_real(pair_outputs, pair_messages, context, encoder,
+                             decryptor),
+                  true);
+
+        // An odd count leaves the last ciphertext to be bootstrapped alone.
+        std::vector<std::vector<double>> batch_messages =
+            random_real_messages(3, slot_count);
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> batch_inputs =
+            encrypt_real(batch_messages, scale, 1, Q_size, context, encoder,
+                         encryptor, operators);
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> batch_outputs;
+        operators.regular_bootstrapping_real(batch_inputs, batch_outputs,
+                                             galois_key, relin_key);
+
+        EXPECT_EQ(batch_outputs[2].depth(), pair_outputs[0].depth());
+        EXPECT_EQ(check_real(batch_outputs, batch_messages, context, encoder,
+                             decryptor),
+                  true);
+    }
+
+    cudaDeviceSynchronize();
+
+    {
+        size_t poly_modulus_degree = 4096;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_II,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes(
+            {60, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+             50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50},
+            {60, 60, 60});
+        context.generate();
+        const int Q_size = 29;
+
+        double scale = pow(2.0, 50);
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context, 16);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::Relinkey<heongpu::Scheme::CKKS> relin_key(context);
+        keygen.generate_relin_key(relin_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(
+            context, encoder);
+
+        int StoC_piece = 3;
+        heongpu::BootstrappingConfig boot_config(3, StoC_piece, 7, true);
+        operators.generate_bootstrapping_params(scale, boot_config);
+
+        std::vector<int> key_index = operators.bootstrapping_key_indexs();
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key(context,
+                                                             key_index);
+        keygen.generate_galois_key(galois_key, secret_key);
+
+        const int slot_count = poly_modulus_degree / 2;
+
+        std::vector<std::vector<double>> pair_messages =
+            random_real_messages(2, slot_count);
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> pair_inputs =
+            encrypt_real(pair_messages, scale, 1 + StoC_piece, Q_size,
+                         context, encoder, encryptor, operators);
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> pair_outputs(
+            2);
+        operators.slim_bootstrapping_real(pair_inputs[0], pair_inputs[1],
+                                          pair_outputs[0], pair_outputs[1],
+                                          galois_key, relin_key);
+
+        EXPECT_EQ(check_real(pair_outputs, pair_messages, context, encoder,
+                             decryptor),
+                  true);
+
+        std::vector<std::vector<double>> batch_messages =
+            random_real_messages(3, slot_count);
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> batch_inputs =
+            encrypt_real(batch_messages, scale, 1 + StoC_piece, Q_size,
+                         context, encoder, encryptor, operators);
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> batch_outputs;
+        operators.slim_bootstrapping_real(batch_inputs, batch_outputs,
+                                          galois_key, relin_key);
+
+        EXPECT_EQ(batch_outputs[2].depth(), pair_outputs[0].depth());
+        EXPECT_EQ(check_real(batch_outputs, batch_messages, context, encoder,
+                             decryptor),
+                  true);
+    }
+
+    cudaDeviceSynchronize();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
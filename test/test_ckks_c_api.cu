@@ -0,0 +1,342 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "ciphertext_c_api.h"
+#include "context_c_api.h"
+#include "decryptor_c_api.h"
+#include "encoder_c_api.h"
+#include "encryptor_c_api.h"
+#include "evaluationkey_c_api.h"
+#include "keygenerator_c_api.h"
+#include "operator_c_api.h"
+#include "plaintext_c_api.h"
+#include "publickey_c_api.h"
+#include "secretkey_c_api.h"
+#include "serializer_c_api.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+bool fix_point_array_check(const std::vector<double>& array1,
+                           const std::vector<double>& array2,
+                           double epsilon = 1e-3)
+{
+    if (array1.size() != array2.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < array1.size(); ++i)
+    {
+        if (std::fabs(array1[i] - array2[i]) >= epsilon)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+class CKKS_C_API : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        cudaSetDevice(0);
+
+        context = HEonGPU_CKKS_Context_Create(C_KEYSWITCHING_METHOD_I,
+                                              C_SEC_LEVEL_TYPE_NONE);
+        ASSERT_NE(context, nullptr);
+        HEonGPU_CKKS_Context_SetPolyModulusDegree(context,
+                                                  poly_modulus_degree);
+        const int log_q[] = {40, 30, 30};
+        const int log_p[] = {40};
+        ASSERT_EQ(
+            HEonGPU_CKKS_Context_SetCoeffModulusBitSizes(context, log_q, 3,
+                                                         log_p, 1),
+            0);
+        ASSERT_EQ(HEonGPU_CKKS_Context_Generate(context), 0);
+
+        keygen = HEonGPU_CKKS_KeyGenerator_Create(context);
+        secret_key = HEonGPU_CKKS_SecretKey_Create(context);
+        ASSERT_EQ(HEonGPU_CKKS_KeyGenerator_GenerateSecretKey(
+                      keygen, secret_key, nullptr),
+                  0);
+        public_key = HEonGPU_CKKS_PublicKey_Create(context);
+        ASSERT_EQ(HEonGPU_CKKS_KeyGenerator_GeneratePublicKey(
+                      keygen, public_key, secret_key, nullptr),
+                  0);
+        relin_key = HEonGPU_CKKS_RelinKey_Create(context, true);
+        ASSERT_EQ(HEonGPU_CKKS_KeyGenerator_GenerateRelinKey(
+                      keygen, relin_key, secret_key, nullptr),
+                  0);
+
+        encoder = HEonGPU_CKKS_Encoder_Create(context);
+        encryptor =
+            HEonGPU_CKKS_Encryptor_Create_With_PublicKey(context, public_key);
+        decryptor = HEonGPU_CKKS_Decryptor_Create(context, secret_key);
+        operators = HEonGPU_CKKS_ArithmeticOperator_Create(context, encoder);
+    }
+
+    void TearDown() override
+    {
+        HEonGPU_CKKS_ArithmeticOperator_Delete(operators);
+        HEonGPU_CKKS_Decryptor_Delete(decryptor);
+        HEonGPU_CKKS_Encryptor_Delete(encryptor);
+        HEonGPU_CKKS_Encoder_Delete(encoder);
+        HEonGPU_CKKS_RelinKey_Delete(relin_key);
+        HEonGPU_CKKS_PublicKey_Delete(public_key);
+        HEonGPU_CKKS_SecretKey_Delete(secret_key);
+        HEonGPU_CKKS_KeyGenerator_Delete(keygen);
+        HEonGPU_CKKS_Context_Delete(context);
+        cudaDeviceSynchronize();
+    }
+
+    std::vector<double> random_message()
+    {
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<double> dis(0.0, 1.0);
+        std::vector<double> message(slot_count);
+        for (int i = 0; i < slot_count; i++)
+        {
+            message[i] = dis(gen);
+        }
+        return message;
+    }
+
+    std::vector<double> decrypt(HE_CKKS_Ciphertext* cipher)
+    {
+        HE_CKKS_Plaintext* plain =
+            HEonGPU_CKKS_Plaintext_Create(context, nullptr);
+        EXPECT_EQ(HEonGPU_CKKS_Decryptor_Decrypt(decryptor, plain, cipher,
+                                                 nullptr),
+                  0);
+
+        std::vector<double> result(slot_count);
+        EXPECT_EQ(HEonGPU_CKKS_Encoder_Decode_Double(
+                      encoder, plain, result.data(), result.size(), nullptr),
+                  slot_count);
+        HEonGPU_CKKS_Plaintext_Delete(plain);
+
+        return result;
+    }
+
+    const size_t poly_modulus_degree = 4096;
+    const int slot_count = 2048;
+    const double scale = pow(2.0, 30);
+
+    HE_CKKS_Context* context = nullptr;
+    HE_CKKS_KeyGenerator* keygen = nullptr;
+    HE_CKKS_SecretKey* secret_key = nullptr;
+    HE_CKKS_PublicKey* public_key = nullptr;
+    HE_CKKS_RelinKey* relin_key = nullptr;
+    HE_CKKS_Encoder* encoder = nullptr;
+    HE_CKKS_Encryptor* encryptor = nullptr;
+    HE_CKKS_Decryptor* decryptor = nullptr;
+    HE_CKKS_ArithmeticOperator* operators = nullptr;
+};
+
+TEST_F(CKKS_C_API, Batched_Encryption_And_Operations)
+{
+    const size_t count = 3;
+
+    std::vector<std::vector<double>> messages;
+    std::vector<HE_CKKS_Plaintext*> plaintexts;
+    std::vector<HE_CKKS_Ciphertext*> ciphertexts;
+    std::vector<HE_CKKS_Ciphertext*> rotated_inputs;
+    std::vector<HE_CKKS_Ciphertext*> sums;
+    std::vector<HE_CKKS_Ciphertext*> products;
+    for (size_t i = 0; i < count; i++)
+    {
+        messages.push_back(random_message());
+
+        HE_CKKS_Plaintext* plain =
+            HEonGPU_CKKS_Plaintext_Create(context, nullptr);
+        ASSERT_EQ(HEonGPU_CKKS_Encoder_Encode_Double(
+                      encoder, plain, messages[i].data(), messages[i].size(),
+                      scale, nullptr),
+                  0);
+        plaintexts.push_back(plain);
+
+        ciphertexts.push_back(HEonGPU_CKKS_Ciphertext_Create(context, nullptr));
+        sums.push_back(HEonGPU_CKKS_Ciphertext_Create(context, nullptr));
+        products.push_back(HEonGPU_CKKS_Ciphertext_Create(context, nullptr));
+    }
+
+    ASSERT_EQ(HEonGPU_CKKS_Encryptor_Encrypt_Many(
+                  encryptor, ciphertexts.data(), plaintexts.data(), count,
+                  nullptr),
+              0);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        EXPECT_EQ(fix_point_array_check(messages[i], decrypt(ciphertexts[i])),
+                  true);
+        rotated_inputs.push_back(ciphertexts[(i + 1) % count]);
+    }
+
+    ASSERT_EQ(HEonGPU_CKKS_ArithmeticOperator_Add_Many(
+                  operators, ciphertexts.data(), rotated_inputs.data(),
+                  sums.data(), count, nullptr),
+              0);
+
+    ASSERT_EQ(HEonGPU_CKKS_ArithmeticOperator_Multiply_Many(
+                  operators, ciphertexts.data(), rotated_inputs.data(),
+                  products.data(), count, nullptr),
+              0);
+    ASSERT_EQ(HEonGPU_CKKS_ArithmeticOperator_Relinearize_Inplace_Many(
+                  operators, products.data(), count, relin_key, nullptr),
+              0);
+    ASSERT_EQ(HEonGPU_CKKS_ArithmeticOperator_Rescale_Inplace_Many(
+                  operators, products.data(), count, nullptr),
+              0);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const std::vector<double>& other = messages[(i + 1) % count];
+        std::vector<double> expected_sum(slot_count);
+        std::vector<double> expected_product(slot_count);
+        for (int j = 0; j < slot_count; j++)
+        {
+            expected_sum[j] = messages[i][j] + other[j];
+            expected_product[j] = messages[i][j] * other[j];
+        }
+
+        EXPECT_EQ(fix_point_array_check(expected_sum, decrypt(sums[i])),
+                  true);
+        EXPECT_EQ(
+            fix_point_array_check(expected_product, decrypt(products[i])),
+            true);
+    }
+
+    // A null element is rejected before any work is done.
+    HE_CKKS_Ciphertext* null_outputs[] = {sums[0], nullptr, sums[2]};
+    EXPECT_EQ(HEonGPU_CKKS_ArithmeticOperator_Add_Many(
+                  operators, ciphertexts.data(), rotated_inputs.data(),
+                  null_outputs, count, nullptr),
+              -1);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        HEonGPU_CKKS_Plaintext_Delete(plaintexts[i]);
+        HEonGPU_CKKS_Ciphertext_Delete(ciphertexts[i]);
+        HEonGPU_CKKS_Ciphertext_Delete(sums[i]);
+        HEonGPU_CKKS_Ciphertext_Delete(products[i]);
+    }
+}
+
+TEST_F(CKKS_C_API, Serialization_Into_Caller_Buffers)
+{
+    std::vector<double> message1 = random_message();
+    std::vector<double> message2 = random_message();
+
+    HE_CKKS_Plaintext* plain = HEonGPU_CKKS_Plaintext_Create(context, nullptr);
+    ASSERT_EQ(HEonGPU_CKKS_Encoder_Encode_Double(encoder, plain,
+                                                 message1.data(),
+                                                 message1.size(), scale,
+                                                 nullptr),
+              0);
+    HE_CKKS_Ciphertext* cipher1 =
+        HEonGPU_CKKS_Ciphertext_Create(context, nullptr);
+    ASSERT_EQ(
+        HEonGPU_CKKS_Encryptor_Encrypt_To(encryptor, cipher1, plain, nullptr),
+        0);
+    HEonGPU_CKKS_Plaintext_Delete(plain);
+
+    plain = HEonGPU_CKKS_Plaintext_Create(context, nullptr);
+    ASSERT_EQ(HEonGPU_CKKS_Encoder_Encode_Double(encoder, plain,
+                                                 message2.data(),
+                                                 message2.size(), scale,
+                                                 nullptr),
+              0);
+    HE_CKKS_Ciphertext* cipher2 =
+        HEonGPU_CKKS_Ciphertext_Create(context, nullptr);
+    ASSERT_EQ(
+        HEonGPU_CKKS_Encryptor_Encrypt_To(encryptor, cipher2, plain, nullptr),
+        0);
+    HEonGPU_CKKS_Plaintext_Delete(plain);
+
+    // SaveSize matches what SaveInto and Save write.
+    size_t size = 0;
+    ASSERT_EQ(HEonGPU_CKKS_Ciphertext_SaveSize(cipher1, &size), 0);
+
+    unsigned char* saved = nullptr;
+    size_t saved_len = 0;
+    ASSERT_EQ(HEonGPU_CKKS_Ciphertext_Save(cipher1, &saved, &saved_len), 0);
+    EXPECT_EQ(saved_len, size);
+    HEonGPU_FreeSerializedData(saved);
+
+    std::vector<unsigned char> small_buffer(size - 1);
+    size_t written = 0;
+    EXPECT_EQ(HEonGPU_CKKS_Ciphertext_SaveInto(cipher1, small_buffer.data(),
+                                               small_buffer.size(), &written),
+              -4);
+    EXPECT_EQ(written, size);
+
+    std::vector<unsigned char> buffer(size);
+    ASSERT_EQ(HEonGPU_CKKS_Ciphertext_SaveInto(cipher1, buffer.data(),
+                                               buffer.size(), &written),
+              0);
+    EXPECT_EQ(written, size);
+
+    // Compression round trip through caller buffers.
+    std::vector<unsigned char> compressed(HEonGPU_CompressBound(size));
+    size_t compressed_len = 0;
+    ASSERT_EQ(HEonGPU_CompressDataInto(buffer.data(), buffer.size(),
+                                       compressed.data(), compressed.size(),
+                                       &compressed_len),
+              0);
+    std::vector<unsigned char> decompressed(size);
+    size_t decompressed_len = 0;
+    ASSERT_EQ(HEonGPU_DecompressDataInto(compressed.data(), compressed_len,
+                                         decompressed.data(),
+                                         decompressed.size(),
+                                         &decompressed_len),
+              0);
+    EXPECT_EQ(decompressed_len, size);
+    EXPECT_EQ(decompressed == buffer, true);
+
+    // Load into a fresh handle.
+    HE_CKKS_Ciphertext* loaded =
+        HEonGPU_CKKS_Ciphertext_Create(context, nullptr);
+    ASSERT_EQ(HEonGPU_CKKS_Ciphertext_LoadInto(loaded, decompressed.data(),
+                                               decompressed_len, nullptr),
+              0);
+    EXPECT_EQ(fix_point_array_check(message1, decrypt(loaded)), true);
+
+    // Reuse a populated handle: cipher2 is replaced by cipher1.
+    ASSERT_EQ(HEonGPU_CKKS_Ciphertext_LoadInto(cipher2, buffer.data(),
+                                               buffer.size(), nullptr),
+              0);
+    EXPECT_EQ(fix_point_array_check(message1, decrypt(cipher2)), true);
+
+    // And again, so a handle filled by LoadInto can be reloaded as well.
+    ASSERT_EQ(HEonGPU_CKKS_Ciphertext_LoadInto(loaded, buffer.data(),
+                                               buffer.size(), nullptr),
+              0);
+    EXPECT_EQ(fix_point_array_check(message1, decrypt(loaded)), true);
+
+    // Invalid input leaves the handle untouched.
+    EXPECT_EQ(HEonGPU_CKKS_Ciphertext_LoadInto(loaded, buffer.data(), 0,
+                                               nullptr),
+              -1);
+    std::vector<unsigned char> garbage(size, 0x07);
+    EXPECT_EQ(HEonGPU_CKKS_Ciphertext_LoadInto(loaded, garbage.data(),
+                                               garbage.size(), nullptr),
+              -3);
+    EXPECT_EQ(fix_point_array_check(message1, decrypt(loaded)), true);
+
+    HEonGPU_CKKS_Ciphertext_Delete(loaded);
+    HEonGPU_CKKS_Ciphertext_Delete(cipher2);
+    HEonGPU_CKKS_Ciphertext_Delete(cipher1);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
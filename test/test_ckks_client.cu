@@ -0,0 +1,206 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include "heongpu_client.h"
+#include <gtest/gtest.h>
+#include <sstream>
+
+template <typename T>
+bool fix_point_equal(T input1, T input2, T epsilon = static_cast<T>(1e-4))
+{
+    return std::fabs(input1 - input2) < epsilon;
+}
+
+template <typename T>
+bool fix_point_array_check(const std::vector<T>& array1,
+                           const std::vector<T>& array2,
+                           T epsilon = static_cast<T>(1e-4))
+{
+    if (array1.size() != array2.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < array1.size(); ++i)
+    {
+        if (!fix_point_equal(array1[i], array2[i], epsilon))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST(HEonGPU, CKKS_Client_Interoperability)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 8192;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({60, 30, 30, 30}, {60});
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::Relinkey<heongpu::Scheme::CKKS> relin_key(context);
+        keygen.generate_relin_key(relin_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(context,
+                                                                       encoder);
+
+        // Server -> client: context and keys.
+        std::stringstream context_stream;
+        context.save(context_stream);
+        heongpu::client::Context client_context;
+        client_context.load(context_stream);
+
+        std::stringstream secret_key_stream;
+        secret_key.save(secret_key_stream);
+        heongpu::client::Secretkey client_secret_key;
+        client_secret_key.load(secret_key_stream);
+
+        std::stringstream public_key_stream;
+        public_key.save(public_key_stream);
+        heongpu::client::Publickey client_public_key;
+        client_public_key.load(public_key_stream);
+
+        heongpu::client::Encoder client_encoder(client_context);
+        heongpu::client::Encryptor client_pk_encryptor(client_context,
+                                                       client_public_key);
+        heongpu::client::Encryptor client_sk_encryptor(client_context,
+                                                       client_secret_key);
+        heongpu::client::Decryptor client_decryptor(client_context,
+                                                    client_secret_key);
+
+        const int slot_count = poly_modulus_degree / 2;
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<double> dis(-4.0, 4.0);
+
+        std::vector<double> message1(slot_count);
+        std::vector<double> message2(slot_count);
+        std::vector<double> message_product(slot_count);
+        for (int i = 0; i < slot_count; i++)
+        {
+            message1[i] = dis(gen);
+            message2[i] = dis(gen);
+            message_product[i] = message1[i] * message2[i];
+        }
+
+        double scale = pow(2.0, 30);
+
+        // Client encoding decodes to the same values on the GPU.
+        heongpu::client::Plaintext client_plain(client_context);
+        client_encoder.encode(client_plain, message1, scale);
+
+        std::stringstream plain_stream;
+        client_plain.save(plain_stream);
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P1;
+        P1.load(plain_stream);
+
+        std::vector<double> gpu_decoded;
+        encoder.decode(gpu_decoded, P1);
+        cudaDeviceSynchronize();
+        EXPECT_EQ(fix_point_array_check(message1, gpu_decoded), true);
+
+        // A sparsely packed GPU ciphertext decodes to its slots on the client.
+        {
+            const int sparse_slot_count = 64;
+            std::vector<double> sparse_message(message1.begin(),
+                                               message1.begin() +
+                                                   sparse_slot_count);
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P_sparse(context);
+            encoder.encode(P_sparse, sparse_message, scale, sparse_slot_count);
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C_sparse(context);
+            encryptor.encrypt(C_sparse, P_sparse);
+
+            std::stringstream sparse_stream;
+            C_sparse.save(sparse_stream);
+            heongpu::client::Ciphertext client_sparse;
+            client_sparse.load(sparse_stream);
+            EXPECT_EQ(client_sparse.slot_count(), sparse_slot_count);
+
+            heongpu::client::Plaintext client_sparse_plain;
+            client_decryptor.decrypt(client_sparse_plain, client_sparse);
+            std::vector<double> client_sparse_message;
+            client_encoder.decode(client_sparse_message, client_sparse_plain);
+            EXPECT_EQ(fix_point_array_check(sparse_message,
+                                            client_sparse_message,
+                                            static_cast<double>(1e-2)),
+                      true);
+        }
+
+        // Client public-key and secret-key encryption, GPU evaluation, client
+        // decryption of the rescaled result.
+        for (heongpu::client::Encryptor* client_encryptor :
+             {&client_pk_encryptor, &client_sk_encryptor})
+        {
+            heongpu::client::Ciphertext client_cipher(client_context);
+            client_encryptor->encrypt(client_cipher, client_plain);
+
+            std::stringstream cipher_stream;
+            client_cipher.save(cipher_stream);
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C1;
+            C1.load(cipher_stream);
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context);
+            decryptor.decrypt(P2, C1);
+            std::vector<double> gpu_result;
+            encoder.decode(gpu_result, P2);
+            cudaDeviceSynchronize();
+            EXPECT_EQ(fix_point_array_check(message1, gpu_result,
+                                            static_cast<double>(1e-2)),
+                      true);
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P3(context);
+            encoder.encode(P3, message2, scale);
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C2(context);
+            encryptor.encrypt(C2, P3);
+
+            operators.multiply_inplace(C1, C2);
+            operators.relinearize_inplace(C1, relin_key);
+            operators.rescale_inplace(C1);
+
+            std::stringstream result_stream;
+            C1.save(result_stream);
+            heongpu::client::Ciphertext client_result;
+            client_result.load(result_stream);
+            EXPECT_EQ(client_result.depth(), 1);
+
+            heongpu::client::Plaintext client_result_plain;
+            client_decryptor.decrypt(client_result_plain, client_result);
+            std::vector<double> client_result_message;
+            client_encoder.decode(client_result_message, client_result_plain);
+            EXPECT_EQ(fix_point_array_check(message_product,
+                                            client_result_message,
+                                            static_cast<double>(1e-1)),
+                      true);
+        }
+    }
+
+    cudaDeviceSynchronize();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,166 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+#include <random>
+
+template <typename T>
+bool fix_point_equal(T input1, T input2, T epsilon = static_cast<T>(1e-4))
+{
+    return std::fabs(input1 - input2) < epsilon;
+}
+
+TEST(HEonGPU, CKKS_Constant_Cache)
+{
+    cudaSetDevice(0);
+
+    {
+        size_t poly_modulus_degree = 8192;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({60, 40, 40, 40}, {60});
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(context,
+                                                                       encoder);
+
+        const int row_size = poly_modulus_degree / 2;
+        double scale = pow(2.0, 40);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<> dis(-1.0, 1.0);
+
+        std::vector<double> message(row_size);
+        std::vector<double> mask(row_size);
+        for (int i = 0; i < row_size; i++)
+        {
+            message[i] = dis(gen);
+            mask[i] = (i % 3 == 0) ? 1.0 : 0.0;
+        }
+
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+        encoder.encode(P1, message, scale);
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C1(context);
+        encryptor.encrypt(C1, P1);
+
+        heongpu::ConstantCache<heongpu::Scheme::CKKS>& cache =
+            operators.constant_cache();
+
+        // The same constant at the same level is encoded once.
+        for (int repeat = 0; repeat < 2; repeat++)
+        {
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C2(context);
+            operators.multiply_constant(C1, 0.75, C2);
+            operators.rescale_inplace(C2);
+            operators.add_constant_inplace(C2, -0.25);
+            EXPECT_EQ(C2.depth(), 1);
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context);
+            decryptor.decrypt(P2, C2);
+            std::vector<double> result;
+            encoder.decode(result, P2);
+
+            bool check = true;
+            for (int i = 0; i < row_size; i++)
+            {
+                check = check && fix_point_equal(message[i] * 0.75 - 0.25,
+                                                 result[i], 1e-3);
+            }
+            EXPECT_EQ(check, true);
+        }
+        EXPECT_EQ(cache.size(), 2u);
+        EXPECT_EQ(cache.misses(), 2u);
+        EXPECT_EQ(cache.hits(), 2u);
+
+        // Entries hold only the limbs of their level.
+        std::size_t trimmed_size = cache.memory_size();
+        EXPECT_EQ(trimmed_size,
+                  (4u + 3u) * poly_modulus_degree * sizeof(Data64));
+
+        // User masks are looked up by id.
+        for (int repeat = 0; repeat < 2; repeat++)
+        {
+            heongpu::ConstantCache<heongpu::Scheme::CKKS>::Entry encoded_mask =
+                operators.encoded_mask(7, mask, C1.depth(), scale);
+            EXPECT_EQ(encoded_mask->depth(), 0);
+
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C3(context);
+            operators.multiply_plain(C1, *encoded_mask, C3);
+            operators.rescale_inplace(C3);
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P3(context);
+            decryptor.decrypt(P3, C3);
+            std::vector<double> result;
+            encoder.decode(result, P3);
+
+            bool check = true;
+            for (int i = 0; i < row_size; i++)
+            {
+                check = check &&
+                        fix_point_equal(message[i] * mask[i], result[i], 1e-3);
+            }
+            EXPECT_EQ(check, true);
+        }
+        EXPECT_EQ(cache.size(), 3u);
+        EXPECT_EQ(cache.hits(), 3u);
+
+        cache.erase_mask(7);
+        EXPECT_EQ(cache.size(), 2u);
+        EXPECT_EQ(cache.memory_size(), trimmed_size);
+
+        // Shrinking the capacity evicts the least recently used entries, and
+        // entries still held stay valid.
+        heongpu::ConstantCache<heongpu::Scheme::CKKS>::Entry held =
+            operators.encoded_constant(0.75, 0, scale);
+        cache.set_capacity(0);
+        EXPECT_EQ(cache.size(), 0u);
+        EXPECT_EQ(cache.memory_size(), 0u);
+        EXPECT_EQ(held->depth(), 0);
+
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C4(context);
+        operators.add_plain(C1, *held, C4);
+        EXPECT_EQ(cache.size(), 0u);
+
+        // Constants precomputed by the operators are taken from their cache.
+        heongpu::HELogicOperator<heongpu::Scheme::CKKS> logic(context, encoder,
+                                                              scale);
+        heongpu::ConstantCache<heongpu::Scheme::CKKS>& logic_cache =
+            logic.constant_cache();
+        EXPECT_EQ(logic_cache.size(), 1u);
+        EXPECT_EQ(logic_cache.misses(), 1u);
+        logic.encoded_constant(1.0, 0, scale);
+        EXPECT_EQ(logic_cache.size(), 1u);
+        EXPECT_EQ(logic_cache.hits(), 1u);
+
+        EXPECT_THROW(operators.encoded_mask(8, mask, 4, scale),
+                     std::invalid_argument);
+        EXPECT_THROW(operators.encoded_constant(1.0, 0, 0.0),
+                     std::invalid_argument);
+    }
+
+    cudaDeviceSynchronize();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -275,6 +275,116 @@ TEST(HEonGPU, CKKS_Encoding_Decoding)
     cudaDeviceSynchronize();
 }
 
+TEST(HEonGPU, CKKS_Sparse_Encoding_Arithmetic)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 8192;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({60, 40, 40}, {60});
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::Relinkey<heongpu::Scheme::CKKS> relin_key(context);
+        keygen.generate_relin_key(relin_key, secret_key);
+
+        std::vector<int> shift_value = {1};
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key(context,
+                                                             shift_value);
+        keygen.generate_galois_key(galois_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(context,
+                                                                       encoder);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<double> dis(-2.0, 2.0);
+        double scale = pow(2.0, 40);
+
+        // 1, 64 and the full n / 2 slots all round-trip through the encoder.
+        const int full_slot_count = poly_modulus_degree / 2;
+        for (int slot_count : {1, 64, full_slot_count})
+        {
+            std::vector<double> message(slot_count);
+            for (int i = 0; i < slot_count; i++)
+            {
+                message[i] = dis(gen);
+            }
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+            encoder.encode(P1, message, scale, slot_count);
+            EXPECT_EQ(P1.slot_count(), slot_count);
+
+            std::vector<double> result;
+            encoder.decode(result, P1);
+            cudaDeviceSynchronize();
+
+            EXPECT_EQ(fix_point_array_check(message, result), true);
+        }
+
+        // Rotations act inside each block of slot_count slots, so a sparse
+        // ciphertext rotates cyclically over its own slots.
+        const int slot_count = 64;
+        std::vector<double> message1(slot_count);
+        std::vector<double> message2(slot_count);
+        std::vector<double> expected(slot_count);
+        for (int i = 0; i < slot_count; i++)
+        {
+            message1[i] = dis(gen);
+            message2[i] = dis(gen);
+        }
+        for (int i = 0; i < slot_count; i++)
+        {
+            int j = (i + 1) % slot_count;
+            expected[i] = message1[j] * message2[j];
+        }
+
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+        encoder.encode(P1, message1, scale, slot_count);
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context);
+        encoder.encode(P2, message2, scale, slot_count);
+
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C1(context);
+        encryptor.encrypt(C1, P1);
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C2(context);
+        encryptor.encrypt(C2, P2);
+        EXPECT_EQ(C1.slot_count(), slot_count);
+
+        operators.multiply_inplace(C1, C2);
+        operators.relinearize_inplace(C1, relin_key);
+        operators.rescale_inplace(C1);
+        operators.rotate_rows_inplace(C1, galois_key, 1);
+        EXPECT_EQ(C1.slot_count(), slot_count);
+
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P3(context);
+        decryptor.decrypt(P3, C1);
+
+        std::vector<double> result;
+        encoder.decode(result, P3);
+        cudaDeviceSynchronize();
+
+        EXPECT_EQ(fix_point_array_check(expected, result,
+                                        static_cast<double>(1e-2)),
+                  true);
+    }
+
+    cudaDeviceSynchronize();
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
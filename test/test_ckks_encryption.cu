@@ -5,6 +5,7 @@
 
 #include "heongpu.cuh"
 #include <gtest/gtest.h>
+#include <thread>
 
 template <typename T>
 bool fix_point_equal(T input1, T input2, T epsilon = static_cast<T>(1e-4))
@@ -305,6 +306,169 @@ TEST(HEonGPU, CKKS_Encryption_Decryption)
     cudaDeviceSynchronize();
 }
 
+TEST(HEonGPU, CKKS_Batch_Encryption_Decryption)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 8192;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({40, 30, 30, 30, 30}, {40});
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<> dis(0.0, 1.0);
+        const int row_size = poly_modulus_degree / 2;
+        const int batch_size = 5;
+        double scale = pow(2.0, 30);
+
+        std::vector<std::vector<double>> messages(
+            batch_size, std::vector<double>(row_size, 0));
+        std::vector<heongpu::Plaintext<heongpu::Scheme::CKKS>> plaintexts;
+        for (int j = 0; j < batch_size; j++)
+        {
+            for (int i = 0; i < row_size; i++)
+            {
+                messages[j][i] = dis(gen);
+            }
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+            encoder.encode(P1, messages[j], scale);
+            plaintexts.push_back(P1);
+        }
+
+        // One ciphertext is already allocated and is reused.
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> ciphertexts;
+        ciphertexts.push_back(heongpu::Ciphertext<heongpu::Scheme::CKKS>(
+            context));
+        encryptor.encrypt(ciphertexts, plaintexts);
+        ASSERT_EQ(static_cast<int>(ciphertexts.size()), batch_size);
+
+        for (int j = 0; j < batch_size; j++)
+        {
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context);
+            decryptor.decrypt(P2, ciphertexts[j]);
+
+            std::vector<double> gpu_result;
+            encoder.decode(gpu_result, P2);
+
+            cudaDeviceSynchronize();
+
+            EXPECT_EQ(fix_point_array_check(messages[j], gpu_result), true);
+        }
+    }
+
+    cudaDeviceSynchronize();
+}
+
+TEST(HEonGPU, CKKS_Multithreaded_Encryption)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 4096;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({40, 30, 30}, {40});
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<> dis(0.0, 1.0);
+        const int row_size = poly_modulus_degree / 2;
+        const int thread_count = 4;
+        double scale = pow(2.0, 30);
+
+        std::vector<std::vector<double>> messages(
+            thread_count, std::vector<double>(row_size, 0));
+        std::vector<heongpu::Plaintext<heongpu::Scheme::CKKS>> plaintexts;
+        for (int j = 0; j < thread_count; j++)
+        {
+            for (int i = 0; i < row_size; i++)
+            {
+                messages[j][i] = dis(gen);
+            }
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+            encoder.encode(P1, messages[j], scale);
+            plaintexts.push_back(P1);
+        }
+        cudaDeviceSynchronize();
+
+        // Every worker thread encrypts with its own DRBG on its own stream.
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> ciphertexts(
+            thread_count);
+        std::vector<std::thread> workers;
+        for (int j = 0; j < thread_count; j++)
+        {
+            workers.emplace_back(
+                [&, j]()
+                {
+                    cudaSetDevice(0);
+                    cudaStream_t stream;
+                    cudaStreamCreate(&stream);
+
+                    encryptor.encrypt(
+                        ciphertexts[j], plaintexts[j],
+                        heongpu::ExecutionOptions().set_stream(stream));
+
+                    cudaStreamSynchronize(stream);
+                    cudaStreamDestroy(stream);
+                });
+        }
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        for (int j = 0; j < thread_count; j++)
+        {
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context);
+            decryptor.decrypt(P2, ciphertexts[j]);
+
+            std::vector<double> gpu_result;
+            encoder.decode(gpu_result, P2);
+
+            cudaDeviceSynchronize();
+
+            EXPECT_EQ(fix_point_array_check(messages[j], gpu_result), true);
+        }
+    }
+
+    cudaDeviceSynchronize();
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,218 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+
+template <typename T>
+bool fix_point_equal(T input1, T input2, T epsilon = static_cast<T>(1e-4))
+{
+    return std::fabs(input1 - input2) < epsilon;
+}
+
+template <typename T>
+bool fix_point_array_check(const std::vector<T>& array1,
+                           const std::vector<T>& array2,
+                           T epsilon = static_cast<T>(1e-4))
+{
+    if (array1.size() != array2.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < array1.size(); ++i)
+    {
+        if (!fix_point_equal(array1[i], array2[i], epsilon))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST(HEonGPU, CKKS_Graph_Maintenance_Placement)
+{
+    cudaSetDevice(0);
+
+    {
+        size_t poly_modulus_degree = 8192;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({40, 30, 30, 30, 30}, {40});
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::Relinkey<heongpu::Scheme::CKKS> relin_key(context);
+        keygen.generate_relin_key(relin_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(context,
+                                                                       encoder);
+
+        double scale = pow(2.0, 30);
+        heongpu::HEGraph<heongpu::Scheme::CKKS> graph(context, encoder, scale);
+
+        int a = graph.input();
+        int b = graph.input();
+        int c = graph.input();
+        int d = graph.input();
+
+        // Repeated subexpressions are shared.
+        int ab = graph.multiply(a, b);
+        EXPECT_EQ(graph.multiply(b, a), ab);
+
+        // Sum of products: one relinearization and one rescale.
+        int sum = graph.add(ab, graph.multiply(c, d));
+        int out1 = graph.add(sum, graph.constant(0.5));
+
+        // Rotations and constant multiplications are merged.
+        int rotated = graph.rotate(graph.rotate(a, 1), 2);
+        int out2 = graph.multiply(
+            graph.multiply(rotated, graph.constant(2.0)), graph.constant(3.0));
+
+        // a is mod-dropped once to meet out1.
+        int out3 = graph.multiply(out1, a);
+
+        int out4 = graph.sub(a, graph.constant(1.0));
+
+        graph.output(out1);
+        graph.output(out2);
+        graph.output(out3);
+        graph.output(out4);
+        graph.compile();
+
+        heongpu::GraphStatistics statistics = graph.statistics();
+        EXPECT_EQ(statistics.relinearizations, 2);
+        EXPECT_EQ(statistics.rescales, 3);
+        EXPECT_EQ(statistics.mod_drops, 1);
+        EXPECT_EQ(statistics.bootstraps, 0);
+        EXPECT_EQ(statistics.fused_nodes, 4);
+        EXPECT_EQ(graph.bootstrapping_required(), false);
+
+        std::vector<int> steps = graph.rotation_steps();
+        EXPECT_EQ(steps, std::vector<int>({3}));
+
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key(context, steps);
+        keygen.generate_galois_key(galois_key, secret_key);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<> dis(0.0, 1.0);
+        const int row_size = poly_modulus_degree / 2;
+
+        std::vector<std::vector<double>> messages(
+            4, std::vector<double>(row_size, 0));
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> inputs;
+        for (int j = 0; j < 4; j++)
+        {
+            for (int i = 0; i < row_size; i++)
+            {
+                messages[j][i] = dis(gen);
+            }
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+            encoder.encode(P1, messages[j], scale);
+
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C1(context);
+            encryptor.encrypt(C1, P1);
+            inputs.push_back(C1);
+        }
+
+        std::vector<std::vector<double>> expected(
+            4, std::vector<double>(row_size, 0));
+        for (int i = 0; i < row_size; i++)
+        {
+            double x1 = messages[0][i];
+            double x2 = messages[1][i];
+            double x3 = messages[2][i];
+            double x4 = messages[3][i];
+
+            expected[0][i] = x1 * x2 + x3 * x4 + 0.5;
+            expected[1][i] = 6.0 * messages[0][(i + 3) % row_size];
+            expected[2][i] = expected[0][i] * x1;
+            expected[3][i] = x1 - 1.0;
+        }
+
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> outputs;
+        graph.execute(operators, inputs, outputs, relin_key, galois_key);
+        ASSERT_EQ(static_cast<int>(outputs.size()), 4);
+
+        for (int j = 0; j < 4; j++)
+        {
+            EXPECT_EQ(outputs[j].rescale_required(), false);
+            EXPECT_EQ(outputs[j].relinearization_required(), false);
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context);
+            decryptor.decrypt(P2, outputs[j]);
+
+            std::vector<double> gpu_result;
+            encoder.decode(gpu_result, P2);
+
+            cudaDeviceSynchronize();
+
+            EXPECT_EQ(fix_point_array_check(expected[j], gpu_result,
+                                            static_cast<double>(1e-2)),
+                      true);
+        }
+    }
+
+    cudaDeviceSynchronize();
+}
+
+TEST(HEonGPU, CKKS_Graph_Level_Exhaustion)
+{
+    cudaSetDevice(0);
+
+    {
+        size_t poly_modulus_degree = 4096;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({40, 30, 30}, {40});
+        context.generate();
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+
+        double scale = pow(2.0, 30);
+        heongpu::HEGraph<heongpu::Scheme::CKKS> graph(context, encoder, scale);
+
+        // Two levels: x^4 fits, x^8 does not.
+        int x = graph.input();
+        int x2 = graph.multiply(x, x);
+        int x4 = graph.multiply(x2, x2);
+        graph.output(x4);
+        EXPECT_NO_THROW(graph.compile());
+
+        graph.output(graph.multiply(x4, x4));
+        EXPECT_THROW(graph.compile(), std::logic_error);
+
+        // Constant expressions are folded and need no levels.
+        int folded = graph.multiply(graph.constant(2.0), graph.constant(0.5));
+        EXPECT_EQ(graph.multiply(x, folded), x);
+        EXPECT_THROW(graph.output(folded), std::invalid_argument);
+    }
+
+    cudaDeviceSynchronize();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,200 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+
+template <typename T>
+bool fix_point_equal(T input1, T input2, T epsilon = static_cast<T>(1e-4))
+{
+    return std::fabs(input1 - input2) < epsilon;
+}
+
+TEST(HEonGPU, CKKS_Limb32_Keyswitching)
+{
+    cudaSetDevice(0);
+
+    {
+        size_t poly_modulus_degree = 4096;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({31, 30, 30}, {31});
+        context.set_key_limb_type(heongpu::limb_type::LIMB32);
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::Relinkey<heongpu::Scheme::CKKS> relin_key(context);
+        keygen.generate_relin_key(relin_key, secret_key);
+        EXPECT_EQ(relin_key.get_limb_type(), heongpu::limb_type::LIMB32);
+
+        std::vector<int> shift_key_index = {-3, 7};
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key(context,
+                                                             shift_key_index);
+        keygen.generate_galois_key(
+            galois_key, secret_key,
+            heongpu::ExecutionOptions().set_storage_type(
+                heongpu::storage_type::HOST));
+        EXPECT_EQ(galois_key.get_limb_type(), heongpu::limb_type::LIMB32);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(context,
+                                                                       encoder);
+
+        const int row_size = poly_modulus_degree / 2;
+        double scale = pow(2.0, 30);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<> dis(0.0, 1.0);
+
+        std::vector<double> message(row_size);
+        for (int i = 0; i < row_size; i++)
+        {
+            message[i] = dis(gen);
+        }
+
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+        encoder.encode(P1, message, scale);
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C1(context);
+        encryptor.encrypt(C1, P1);
+
+        // Relinearization with a key stored in 32-bit limbs.
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C2(context);
+        operators.multiply(C1, C1, C2);
+        operators.relinearize_inplace(C2, relin_key);
+        operators.rescale_inplace(C2);
+
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context);
+        decryptor.decrypt(P2, C2);
+        std::vector<double> result;
+        encoder.decode(result, P2);
+
+        bool check = true;
+        for (int i = 0; i < row_size; i++)
+        {
+            check = check &&
+                    fix_point_equal(message[i] * message[i], result[i], 1e-2);
+        }
+        EXPECT_EQ(check, true);
+
+        // Rotations with a host resident key stored in 32-bit limbs.
+        for (int shift : shift_key_index)
+        {
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C3(context);
+            operators.rotate_rows(C1, C3, galois_key, shift);
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P3(context);
+            decryptor.decrypt(P3, C3);
+            encoder.decode(result, P3);
+
+            check = true;
+            for (int i = 0; i < row_size; i++)
+            {
+                int index = (i + shift + row_size) % row_size;
+                check = check && fix_point_equal(message[index], result[i],
+                                                 static_cast<double>(1e-2));
+            }
+            EXPECT_EQ(check, true);
+        }
+
+        // Serialized keys keep their limb type and are half the size of
+        // 64-bit keys.
+        heongpu::HEContext<heongpu::Scheme::CKKS> context64(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context64.set_poly_modulus_degree(poly_modulus_degree);
+        context64.set_coeff_modulus_bit_sizes({31, 30, 30}, {31});
+        context64.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen64(context64);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key64(context64);
+        keygen64.generate_secret_key(secret_key64);
+        heongpu::Relinkey<heongpu::Scheme::CKKS> relin_key64(context64);
+        keygen64.generate_relin_key(relin_key64, secret_key64);
+        EXPECT_EQ(relin_key64.get_limb_type(), heongpu::limb_type::LIMB64);
+
+        std::stringstream stream32;
+        std::stringstream stream64;
+        relin_key.save(stream32);
+        relin_key64.save(stream64);
+        std::size_t limb_count = 2 * 3 * 4 * poly_modulus_degree;
+        EXPECT_EQ(stream64.str().size() - stream32.str().size(),
+                  limb_count * sizeof(Data32));
+
+        heongpu::Relinkey<heongpu::Scheme::CKKS> loaded_key;
+        loaded_key.load(stream32);
+        EXPECT_EQ(loaded_key.get_limb_type(), heongpu::limb_type::LIMB32);
+
+        // Streams written before versioning start with the scheme and carry
+        // no limb type; they load as 64-bit keys.
+        std::string legacy = stream64.str().substr(
+            heongpu::serialformat::header_size - sizeof(heongpu::scheme_type));
+        std::size_t limb_offset =
+            sizeof(heongpu::scheme_type) + sizeof(heongpu::keyswitching_type) +
+            6 * sizeof(int) + sizeof(heongpu::storage_type);
+        legacy.erase(limb_offset, sizeof(heongpu::limb_type));
+
+        std::stringstream legacy_stream(legacy);
+        heongpu::Relinkey<heongpu::Scheme::CKKS> legacy_key;
+        legacy_key.load(legacy_stream);
+        EXPECT_EQ(legacy_key.get_limb_type(), heongpu::limb_type::LIMB64);
+
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C4(context);
+        operators.multiply(C1, C1, C4);
+        operators.relinearize_inplace(C4, loaded_key);
+        operators.rescale_inplace(C4);
+
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P4(context);
+        decryptor.decrypt(P4, C4);
+        encoder.decode(result, P4);
+
+        check = true;
+        for (int i = 0; i < row_size; i++)
+        {
+            check = check &&
+                    fix_point_equal(message[i] * message[i], result[i], 1e-2);
+        }
+        EXPECT_EQ(check, true);
+
+        // 32-bit limbs need small moduli and key switching method I.
+        heongpu::HEContext<heongpu::Scheme::CKKS> large_context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        large_context.set_poly_modulus_degree(poly_modulus_degree);
+        large_context.set_coeff_modulus_bit_sizes({40, 30, 30}, {40});
+        large_context.set_key_limb_type(heongpu::limb_type::LIMB32);
+        EXPECT_THROW(large_context.generate(), std::invalid_argument);
+
+        heongpu::HEContext<heongpu::Scheme::CKKS> method2_context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_II,
+            heongpu::sec_level_type::none);
+        method2_context.set_poly_modulus_degree(poly_modulus_degree);
+        method2_context.set_coeff_modulus_bit_sizes({31, 30, 30}, {31});
+        method2_context.set_key_limb_type(heongpu::limb_type::LIMB32);
+        EXPECT_THROW(method2_context.generate(), std::invalid_argument);
+    }
+
+    cudaDeviceSynchronize();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,147 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+#include <random>
+
+TEST(HEonGPU, CKKS_LWE_Packing_Extraction)
+{
+    cudaSetDevice(0);
+
+    {
+        heongpu::HEContext<heongpu::Scheme::TFHE> lwe_context(
+            heongpu::tfhe_parameter_set::LWE512_K1,
+            heongpu::tfhe_decomposition_profile::THROUGHPUT);
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::TFHE> lwe_keygen(lwe_context);
+        heongpu::Secretkey<heongpu::Scheme::TFHE> lwe_secret_key(lwe_context);
+        lwe_keygen.generate_secret_key(lwe_secret_key);
+
+        heongpu::HEEncryptor<heongpu::Scheme::TFHE> lwe_encryptor(
+            lwe_context, lwe_secret_key);
+        heongpu::HEDecryptor<heongpu::Scheme::TFHE> lwe_decryptor(
+            lwe_context, lwe_secret_key);
+
+        size_t poly_modulus_degree = 4096;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({60, 40, 40}, {60});
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Packingkey<heongpu::Scheme::CKKS> packing_key(context,
+                                                               lwe_context);
+        keygen.generate_packing_key(packing_key, secret_key, lwe_secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(context,
+                                                                       encoder);
+
+        std::vector<uint32_t> galois_elts =
+            operators.lwe_packing_galois_elements();
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key(context,
+                                                             galois_elts);
+        keygen.generate_galois_key(galois_key, secret_key);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<int> dis(0, 1);
+
+        // A power of two, and a count that leaves empty subtrees.
+        for (int count : {32, 37})
+        {
+            std::vector<bool> input(count), inverted(count);
+            for (int i = 0; i < count; i++)
+            {
+                input[i] = dis(gen);
+                inverted[i] = !input[i];
+            }
+
+            heongpu::Ciphertext<heongpu::Scheme::TFHE> lwe_input(lwe_context);
+            lwe_encryptor.encrypt(lwe_input, input);
+
+            for (int depth : {0, 1})
+            {
+                heongpu::Ciphertext<heongpu::Scheme::CKKS> packed(context);
+                operators.pack_lwe_ciphertexts(lwe_input, packed, packing_key,
+                                               galois_key, depth);
+                EXPECT_EQ(packed.depth(), depth);
+
+                heongpu::Ciphertext<heongpu::Scheme::TFHE> lwe_output(
+                    lwe_context);
+                operators.extract_lwe_ciphertexts(packed, lwe_output,
+                                                  packing_key, count);
+
+                std::vector<bool> decrypted;
+                lwe_decryptor.decrypt(lwe_output, decrypted);
+                EXPECT_EQ(decrypted, input);
+
+                // Negation flips the sign of every boolean on the torus.
+                operators.negate_inplace(packed);
+                operators.extract_lwe_ciphertexts(packed, lwe_output,
+                                                  packing_key, count);
+
+                lwe_decryptor.decrypt(lwe_output, decrypted);
+                EXPECT_EQ(decrypted, inverted);
+            }
+        }
+    }
+
+    cudaDeviceSynchronize();
+}
+
+TEST(HEonGPU, CKKS_LWE_Packing_Validation)
+{
+    cudaSetDevice(0);
+
+    {
+        heongpu::HEContext<heongpu::Scheme::TFHE> lwe_context(
+            heongpu::tfhe_parameter_set::LWE512_K1,
+            heongpu::tfhe_decomposition_profile::THROUGHPUT);
+
+        size_t poly_modulus_degree = 4096;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({60, 40, 40}, {60});
+        context.generate();
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(context,
+                                                                       encoder);
+
+        std::vector<uint32_t> galois_elts =
+            operators.lwe_packing_galois_elements();
+        EXPECT_EQ(galois_elts.size(), 12u);
+        EXPECT_EQ(galois_elts.front(), 3u);
+        EXPECT_EQ(galois_elts.back(), 4097u);
+
+        heongpu::Packingkey<heongpu::Scheme::CKKS> packing_key(context,
+                                                               lwe_context);
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key(context,
+                                                             galois_elts);
+
+        heongpu::Ciphertext<heongpu::Scheme::TFHE> lwe_input(lwe_context);
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> packed(context);
+        EXPECT_THROW(operators.pack_lwe_ciphertexts(lwe_input, packed,
+                                                    packing_key, galois_key),
+                     std::invalid_argument);
+    }
+
+    cudaDeviceSynchronize();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
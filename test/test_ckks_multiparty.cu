@@ -0,0 +1,251 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+#include <sstream>
+
+template <typename T>
+bool fix_point_equal(T input1, T input2, T epsilon = static_cast<T>(1e-4))
+{
+    return std::fabs(input1 - input2) < epsilon;
+}
+
+template <typename T>
+bool fix_point_array_check(const std::vector<T>& array1,
+                           const std::vector<T>& array2,
+                           T epsilon = static_cast<T>(1e-4))
+{
+    if (array1.size() != array2.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < array1.size(); ++i)
+    {
+        if (!fix_point_equal(array1[i], array2[i], epsilon))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T> std::string serialized(const T& object)
+{
+    std::stringstream stream;
+    object.save(stream);
+    return stream.str();
+}
+
+TEST(HEonGPU, CKKS_Multiparty_Streaming_Tree_Batched)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 8192;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({60, 40, 40}, {60});
+        context.generate();
+
+        const int party_count = 5;
+        const int cipher_count = 4;
+        double scale = pow(2.0, 40);
+
+        heongpu::RNGSeed common_seed;
+        std::vector<int> shift_value = {1};
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+
+        std::vector<heongpu::Secretkey<heongpu::Scheme::CKKS>> secret_keys;
+        std::vector<heongpu::MultipartyPublickey<heongpu::Scheme::CKKS>>
+            public_key_pieces;
+        std::vector<heongpu::MultipartyRelinkey<heongpu::Scheme::CKKS>>
+            relin_key_pieces_stage1;
+        std::vector<heongpu::MultipartyGaloiskey<heongpu::Scheme::CKKS>>
+            galois_key_pieces;
+        for (int i = 0; i < party_count; i++)
+        {
+            heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+            keygen.generate_secret_key(secret_key);
+
+            heongpu::MultipartyPublickey<heongpu::Scheme::CKKS> public_key(
+                context, common_seed);
+            keygen.generate_multi_party_public_key_piece(public_key,
+                                                         secret_key);
+
+            heongpu::MultipartyRelinkey<heongpu::Scheme::CKKS> relin_key(
+                context, common_seed);
+            keygen.generate_multi_party_relin_key_piece(relin_key, secret_key);
+
+            heongpu::MultipartyGaloiskey<heongpu::Scheme::CKKS> galois_key(
+                context, shift_value, common_seed);
+            keygen.generate_multi_party_galios_key_piece(galois_key,
+                                                         secret_key);
+
+            secret_keys.push_back(secret_key);
+            public_key_pieces.push_back(public_key);
+            relin_key_pieces_stage1.push_back(relin_key);
+            galois_key_pieces.push_back(galois_key);
+        }
+
+        // Tree reduction over all pieces and streaming aggregation give the
+        // same keys.
+        heongpu::Publickey<heongpu::Scheme::CKKS> tree_public_key(context);
+        keygen.generate_multi_party_public_key(public_key_pieces,
+                                               tree_public_key);
+
+        heongpu::MultipartyRelinkey<heongpu::Scheme::CKKS>
+            tree_relin_key_stage1(context, common_seed);
+        keygen.generate_multi_party_relin_key(relin_key_pieces_stage1,
+                                              tree_relin_key_stage1);
+
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> tree_galois_key(context,
+                                                                  shift_value);
+        keygen.generate_multi_party_galois_key(galois_key_pieces,
+                                               tree_galois_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        heongpu::MultipartyRelinkey<heongpu::Scheme::CKKS> relin_key_stage1(
+            context, common_seed);
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key(context,
+                                                             shift_value);
+        for (int i = 0; i < party_count; i++)
+        {
+            keygen.accumulate_multi_party_public_key(public_key_pieces[i],
+                                                     public_key, i == 0);
+            keygen.accumulate_multi_party_relin_key(
+                relin_key_pieces_stage1[i], relin_key_stage1, i == 0);
+            keygen.accumulate_multi_party_galois_key(galois_key_pieces[i],
+                                                     galois_key, i == 0);
+        }
+
+        EXPECT_EQ(serialized(tree_public_key), serialized(public_key));
+        EXPECT_EQ(serialized(tree_relin_key_stage1),
+                  serialized(relin_key_stage1));
+        EXPECT_EQ(serialized(tree_galois_key), serialized(galois_key));
+
+        std::vector<heongpu::MultipartyRelinkey<heongpu::Scheme::CKKS>>
+            relin_key_pieces_stage2;
+        for (int i = 0; i < party_count; i++)
+        {
+            heongpu::MultipartyRelinkey<heongpu::Scheme::CKKS> relin_key(
+                context, common_seed);
+            keygen.generate_multi_party_relin_key_piece(
+                relin_key_stage1, relin_key, secret_keys[i]);
+            relin_key_pieces_stage2.push_back(relin_key);
+        }
+
+        heongpu::Relinkey<heongpu::Scheme::CKKS> tree_relin_key(context);
+        keygen.generate_multi_party_relin_key(
+            relin_key_pieces_stage2, relin_key_stage1, tree_relin_key);
+
+        heongpu::Relinkey<heongpu::Scheme::CKKS> relin_key(context);
+        for (int i = 0; i < party_count; i++)
+        {
+            keygen.accumulate_multi_party_relin_key(relin_key_pieces_stage2[i],
+                                                    relin_key_stage1, relin_key,
+                                                    i == 0);
+        }
+
+        EXPECT_EQ(serialized(tree_relin_key), serialized(relin_key));
+
+        // Batched partial decryption and fusion of the evaluated ciphertexts.
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(context,
+                                                                       encoder);
+
+        const int slot_count = poly_modulus_degree / 2;
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<double> dis(-4.0, 4.0);
+
+        std::vector<std::vector<double>> expected(cipher_count);
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> ciphertexts;
+        for (int j = 0; j < cipher_count; j++)
+        {
+            std::vector<double> message(slot_count);
+            for (int k = 0; k < slot_count; k++)
+            {
+                message[k] = dis(gen);
+            }
+
+            expected[j].resize(slot_count);
+            for (int k = 0; k < slot_count; k++)
+            {
+                double value = message[(k + 1) % slot_count];
+                expected[j][k] = value * value;
+            }
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+            encoder.encode(P1, message, scale);
+
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C1(context);
+            encryptor.encrypt(C1, P1);
+
+            operators.multiply_inplace(C1, C1);
+            operators.relinearize_inplace(C1, relin_key);
+            operators.rescale_inplace(C1);
+
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C2(context);
+            operators.rotate_rows(C1, C2, galois_key, 1);
+
+            ciphertexts.push_back(C2);
+        }
+
+        std::vector<std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>>>
+            partial_ciphertexts(party_count);
+        for (int i = 0; i < party_count; i++)
+        {
+            heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(
+                context, secret_keys[i]);
+            decryptor.multi_party_decrypt_partial(
+                ciphertexts, secret_keys[i], partial_ciphertexts[i]);
+        }
+
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_keys[0]);
+
+        std::vector<heongpu::Plaintext<heongpu::Scheme::CKKS>> plaintexts;
+        decryptor.multi_party_decrypt_fusion(partial_ciphertexts, plaintexts);
+        ASSERT_EQ(static_cast<int>(plaintexts.size()), cipher_count);
+
+        for (int j = 0; j < cipher_count; j++)
+        {
+            std::vector<double> result;
+            encoder.decode(result, plaintexts[j]);
+            cudaDeviceSynchronize();
+            EXPECT_EQ(fix_point_array_check(expected[j], result,
+                                            static_cast<double>(1e-2)),
+                      true);
+
+            // Streaming fusion folds the same shares one by one.
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context);
+            for (int i = 0; i < party_count; i++)
+            {
+                decryptor.multi_party_decrypt_accumulate(
+                    partial_ciphertexts[i][j], P2, i == 0);
+            }
+
+            std::vector<double> streaming_result;
+            encoder.decode(streaming_result, P2);
+            cudaDeviceSynchronize();
+            EXPECT_EQ(fix_point_array_check(result, streaming_result), true);
+        }
+    }
+
+    cudaDeviceSynchronize();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
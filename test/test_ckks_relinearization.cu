@@ -825,6 +825,109 @@ TEST(HEonGPU, CKKS_Relinearization_Keyswitching_Method_II)
     cudaDeviceSynchronize();
 }
 
+TEST(HEonGPU, CKKS_Relinearization_With_Level_Trimmed_Keys)
+{
+    cudaSetDevice(0);
+    for (auto method : {heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+                        heongpu::keyswitching_type::KEYSWITCHING_METHOD_II})
+    {
+        size_t poly_modulus_degree = 8192;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            method, heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        std::vector<int> p_bit_sizes = {40};
+        if (method == heongpu::keyswitching_type::KEYSWITCHING_METHOD_II)
+        {
+            p_bit_sizes.push_back(40);
+        }
+        context.set_coeff_modulus_bit_sizes({40, 30, 30, 30, 30}, p_bit_sizes);
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        // Only usable for ciphertexts with at most 2 Q primes left.
+        const int max_level = 1;
+        heongpu::Relinkey<heongpu::Scheme::CKKS> trimmed_key(context);
+        keygen.generate_relin_key(trimmed_key, secret_key, max_level);
+
+        // The trimmed key has to survive a serialization round trip.
+        std::stringstream key_stream;
+        trimmed_key.save(key_stream);
+        heongpu::Relinkey<heongpu::Scheme::CKKS> relin_key;
+        relin_key.load(key_stream);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(context,
+                                                                       encoder);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<> dis(0.0, 1.0);
+        const int row_size = poly_modulus_degree / 2;
+        std::vector<double> message1(row_size, 0);
+        std::vector<double> message2(row_size, 0);
+        std::vector<double> message_multiplication_result(row_size, 0);
+        for (int i = 0; i < row_size; i++)
+        {
+            message1[i] = dis(gen);
+            message2[i] = dis(gen);
+            message_multiplication_result[i] = message1[i] * message2[i];
+        }
+
+        double scale = pow(2.0, 30);
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+        encoder.encode(P1, message1, scale);
+
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context);
+        encoder.encode(P2, message2, scale);
+
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C1(context);
+        encryptor.encrypt(C1, P1);
+
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C2(context);
+        encryptor.encrypt(C2, P2);
+
+        // A ciphertext at the top level needs blocks the key does not have.
+        heongpu::Ciphertext<heongpu::Scheme::CKKS> C3(context);
+        operators.multiply(C1, C2, C3);
+        EXPECT_THROW(operators.relinearize_inplace(C3, relin_key),
+                     std::invalid_argument);
+
+        for (int i = 0; i < 3; i++)
+        {
+            operators.mod_drop_inplace(C1);
+            operators.mod_drop_inplace(C2);
+        }
+
+        operators.multiply_inplace(C1, C2);
+        operators.relinearize_inplace(C1, relin_key);
+        operators.rescale_inplace(C1);
+
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P3(context);
+        decryptor.decrypt(P3, C1);
+
+        std::vector<double> gpu_result;
+        encoder.decode(gpu_result, P3);
+
+        cudaDeviceSynchronize();
+
+        EXPECT_EQ(
+            fix_point_array_check(message_multiplication_result, gpu_result),
+            true);
+    }
+
+    cudaDeviceSynchronize();
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,181 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+
+template <typename T>
+bool fix_point_equal(T input1, T input2, T epsilon = static_cast<T>(1e-4))
+{
+    return std::fabs(input1 - input2) < epsilon;
+}
+
+template <typename T>
+bool fix_point_array_check(const std::vector<T>& array1,
+                           const std::vector<T>& array2,
+                           T epsilon = static_cast<T>(1e-4))
+{
+    if (array1.size() != array2.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < array1.size(); ++i)
+    {
+        if (!fix_point_equal(array1[i], array2[i], epsilon))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST(HEonGPU, CKKS_Repack_Unpack)
+{
+    cudaSetDevice(0);
+
+    {
+        size_t poly_modulus_degree = 8192;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({40, 30, 30, 30}, {40});
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(context,
+                                                                       encoder);
+
+        const int row_size = poly_modulus_degree / 2;
+        std::vector<heongpu::SlotRange> ranges = {
+            {0, 1000}, {100, 3000}, {2000, 500}, {1024, 2000}, {2500, 1500}};
+
+        // First-fit decreasing: 3000 and 1000 share one ciphertext, 2000,
+        // 1500 and 500 the other.
+        std::vector<heongpu::RepackPlacement> layout =
+            heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS>::plan_repack(
+                ranges, row_size);
+        ASSERT_EQ(layout.size(), ranges.size());
+        std::vector<int> expected_outputs = {0, 0, 1, 1, 1};
+        std::vector<int> expected_offsets = {3000, 0, 3500, 0, 2000};
+        for (int i = 0; i < static_cast<int>(layout.size()); i++)
+        {
+            EXPECT_EQ(layout[i].output, expected_outputs[i]);
+            EXPECT_EQ(layout[i].target_offset, expected_offsets[i]);
+        }
+
+        std::vector<int> steps = heongpu::HEArithmeticOperator<
+            heongpu::Scheme::CKKS>::repack_rotation_steps(layout, row_size);
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key(context, steps);
+        keygen.generate_galois_key(galois_key, secret_key);
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<> dis(0.0, 1.0);
+
+        double scale = pow(2.0, 30);
+        std::vector<std::vector<double>> messages(
+            ranges.size(), std::vector<double>(row_size, 0));
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> inputs;
+        for (int j = 0; j < static_cast<int>(ranges.size()); j++)
+        {
+            // Slots outside the occupied range hold garbage that repack has
+            // to clear.
+            for (int i = 0; i < row_size; i++)
+            {
+                messages[j][i] = dis(gen);
+            }
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+            encoder.encode(P1, messages[j], scale);
+
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C1(context);
+            encryptor.encrypt(C1, P1);
+            inputs.push_back(C1);
+        }
+
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> packed;
+        operators.repack(inputs, layout, packed, galois_key);
+        ASSERT_EQ(static_cast<int>(packed.size()), 2);
+
+        std::vector<std::vector<double>> expected_packed(
+            packed.size(), std::vector<double>(row_size, 0));
+        for (int j = 0; j < static_cast<int>(layout.size()); j++)
+        {
+            for (int i = 0; i < layout[j].source.length; i++)
+            {
+                expected_packed[layout[j].output][layout[j].target_offset + i] =
+                    messages[j][layout[j].source.offset + i];
+            }
+        }
+
+        for (int j = 0; j < static_cast<int>(packed.size()); j++)
+        {
+            EXPECT_EQ(packed[j].depth(), 1);
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context);
+            decryptor.decrypt(P2, packed[j]);
+
+            std::vector<double> gpu_result;
+            encoder.decode(gpu_result, P2);
+
+            EXPECT_EQ(fix_point_array_check(expected_packed[j], gpu_result,
+                                            static_cast<double>(1e-2)),
+                      true);
+        }
+
+        std::vector<heongpu::Ciphertext<heongpu::Scheme::CKKS>> outputs;
+        operators.unpack(packed, layout, outputs, galois_key);
+        ASSERT_EQ(outputs.size(), ranges.size());
+
+        for (int j = 0; j < static_cast<int>(outputs.size()); j++)
+        {
+            std::vector<double> expected(row_size, 0);
+            for (int i = 0; i < ranges[j].length; i++)
+            {
+                expected[ranges[j].offset + i] =
+                    messages[j][ranges[j].offset + i];
+            }
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P3(context);
+            decryptor.decrypt(P3, outputs[j]);
+
+            std::vector<double> gpu_result;
+            encoder.decode(gpu_result, P3);
+
+            EXPECT_EQ(fix_point_array_check(expected, gpu_result,
+                                            static_cast<double>(1e-2)),
+                      true);
+        }
+
+        // Ranges have to fit in the slots.
+        std::vector<heongpu::SlotRange> overflowing_ranges = {{4000, 200}};
+        EXPECT_THROW(
+            heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS>::plan_repack(
+                overflowing_ranges, row_size),
+            std::invalid_argument);
+    }
+
+    cudaDeviceSynchronize();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -5,6 +5,7 @@
 
 #include "heongpu.cuh"
 #include <gtest/gtest.h>
+#include <sstream>
 
 template <typename T>
 bool fix_point_equal(T input1, T input2, T epsilon = static_cast<T>(1e-4))
@@ -511,6 +512,87 @@ TEST(HEonGPU, CKKS_Ciphertext_Rotation_Keyswitching_Method_I_Part_I)
     cudaDeviceSynchronize();
 }
 
+TEST(HEonGPU, CKKS_Galois_Key_Streaming_Generation)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 4096;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({40, 30, 30}, {40});
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(context,
+                                                                       encoder);
+
+        // The key is written to the stream batch by batch and loaded back.
+        std::vector<int> shift_key_index = {-5, -2, 31};
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key_description(
+            context, shift_key_index);
+        std::stringstream stream;
+        keygen.generate_galois_key(galois_key_description, secret_key, stream);
+
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key;
+        galois_key.load(stream);
+
+        const int row_size = poly_modulus_degree / 2;
+        std::vector<double> message1(row_size, 0);
+        for (int i = 0; i < row_size; i++)
+        {
+            message1[i] = i;
+        }
+
+        double scale = pow(2.0, 30);
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+        encoder.encode(P1, message1, scale);
+
+        for (int shift_count : shift_key_index)
+        {
+            std::vector<double> message_rotation_result(row_size, 0);
+            for (int i = 0; i < row_size; i++)
+            {
+                int index = ((i + shift_count) < 0)
+                                ? ((i + shift_count) + row_size)
+                                : ((i + shift_count) % row_size);
+                message_rotation_result[i] = message1[index];
+            }
+
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C1(context);
+            encryptor.encrypt(C1, P1);
+
+            operators.rotate_rows(C1, C1, galois_key, shift_count);
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P3(context);
+            decryptor.decrypt(P3, C1);
+
+            std::vector<double> gpu_result;
+            encoder.decode(gpu_result, P3);
+
+            cudaDeviceSynchronize();
+
+            EXPECT_EQ(fix_point_array_check(message_rotation_result, gpu_result,
+                                            static_cast<double>(1e-1)),
+                      true);
+        }
+    }
+
+    cudaDeviceSynchronize();
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
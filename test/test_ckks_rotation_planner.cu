@@ -0,0 +1,239 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+
+template <typename T>
+bool fix_point_equal(T input1, T input2, T epsilon = static_cast<T>(1e-4))
+{
+    return std::fabs(input1 - input2) < epsilon;
+}
+
+template <typename T>
+bool fix_point_array_check(const std::vector<T>& array1,
+                           const std::vector<T>& array2,
+                           T epsilon = static_cast<T>(1e-4))
+{
+    if (array1.size() != array2.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < array1.size(); ++i)
+    {
+        if (!fix_point_equal(array1[i], array2[i], epsilon))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int rotation_sum(const std::vector<int>& steps, int slot_count)
+{
+    int sum = 0;
+    for (int step : steps)
+    {
+        sum = (sum + step) % slot_count;
+    }
+    return (sum < 0) ? (sum + slot_count) : sum;
+}
+
+TEST(HEonGPU, Rotation_Planner_Signed_Digit_Decomposition)
+{
+    EXPECT_EQ(heongpu::naf_decomposition(255), std::vector<int>({-1, 256}));
+    EXPECT_EQ(heongpu::naf_decomposition(-255), std::vector<int>({1, -256}));
+    EXPECT_EQ(heongpu::naf_decomposition(64), std::vector<int>({64}));
+    EXPECT_TRUE(heongpu::naf_decomposition(0).empty());
+
+    for (int value = -1000; value <= 1000; value++)
+    {
+        int sum = 0;
+        for (int digit : heongpu::naf_decomposition(value))
+        {
+            sum += digit;
+        }
+        EXPECT_EQ(sum, value);
+    }
+}
+
+TEST(HEonGPU, Rotation_Planner_Step_Planning)
+{
+    const int slot_count = 2048;
+    std::vector<int> power_of_two_keys;
+    for (int i = 0; i < MAX_SHIFT; i++)
+    {
+        power_of_two_keys.push_back(1 << i);
+        power_of_two_keys.push_back(-(1 << i));
+    }
+
+    // Binary decomposition needs 8 key-switches for 255.
+    std::vector<int> steps =
+        heongpu::plan_rotation_steps(255, power_of_two_keys, slot_count);
+    EXPECT_EQ(steps.size(), 3);
+    EXPECT_EQ(rotation_sum(steps, slot_count), 255);
+
+    // Rotations are cyclic in the slot count.
+    steps = heongpu::plan_rotation_steps(slot_count - 1, power_of_two_keys,
+                                         slot_count);
+    EXPECT_EQ(steps, std::vector<int>({-1}));
+
+    // Composite keys are reused.
+    steps = heongpu::plan_rotation_steps(97, {1, 2, 4, 96}, slot_count);
+    EXPECT_EQ(steps.size(), 2);
+    EXPECT_EQ(rotation_sum(steps, slot_count), 97);
+
+    EXPECT_TRUE(
+        heongpu::plan_rotation_steps(slot_count, power_of_two_keys, slot_count)
+            .empty());
+    EXPECT_THROW(heongpu::plan_rotation_steps(3, {2, 4}, slot_count),
+                 std::logic_error);
+}
+
+TEST(HEonGPU, Rotation_Planner_Plan_Cache)
+{
+    const int slot_count = 2048;
+    std::vector<int> power_of_two_keys;
+    for (int i = 0; i < MAX_SHIFT; i++)
+    {
+        power_of_two_keys.push_back(1 << i);
+        power_of_two_keys.push_back(-(1 << i));
+    }
+
+    heongpu::RotationPlanCache cache;
+    std::vector<int> steps = cache.plan(255, power_of_two_keys, slot_count);
+    EXPECT_EQ(steps,
+              heongpu::plan_rotation_steps(255, power_of_two_keys, slot_count));
+
+    // Cyclic representatives of a rotation share one cached plan.
+    EXPECT_EQ(cache.plan(255 - slot_count, power_of_two_keys, slot_count),
+              steps);
+    EXPECT_EQ(cache.plan(255, power_of_two_keys, slot_count), steps);
+
+    EXPECT_TRUE(cache.plan(slot_count, power_of_two_keys, slot_count).empty());
+    EXPECT_THROW(cache.plan(3, {2, 4}, slot_count), std::logic_error);
+}
+
+TEST(HEonGPU, Rotation_Planner_Key_Selection)
+{
+    const int slot_count = 2048;
+
+    std::vector<int> keys =
+        heongpu::select_rotation_keys({3, 5, 3, -7}, slot_count, 8);
+    EXPECT_EQ(keys.size(), 3);
+
+    std::vector<int> workload = {1,  3,  5,   7,   9,   11,
+                                 13, 15, 255, 255, 255, -100};
+    keys = heongpu::select_rotation_keys(workload, slot_count, 6);
+    EXPECT_LE(keys.size(), 6);
+    EXPECT_LE(heongpu::plan_rotation_steps(255, keys, slot_count).size(), 2);
+    for (int rotation : workload)
+    {
+        std::vector<int> steps =
+            heongpu::plan_rotation_steps(rotation, keys, slot_count);
+        EXPECT_EQ(rotation_sum(steps, slot_count),
+                  rotation_sum({rotation}, slot_count));
+    }
+
+    EXPECT_THROW(heongpu::select_rotation_keys(workload, slot_count, 0),
+                 std::invalid_argument);
+}
+
+TEST(HEonGPU, CKKS_Ciphertext_Rotation_With_Planned_Galois_Keys)
+{
+    cudaSetDevice(0);
+    {
+        size_t poly_modulus_degree = 8192;
+        heongpu::HEContext<heongpu::Scheme::CKKS> context(
+            heongpu::keyswitching_type::KEYSWITCHING_METHOD_I,
+            heongpu::sec_level_type::none);
+        context.set_poly_modulus_degree(poly_modulus_degree);
+        context.set_coeff_modulus_bit_sizes({40, 30, 30, 30, 30}, {40});
+        context.generate();
+
+        heongpu::HEKeyGenerator<heongpu::Scheme::CKKS> keygen(context);
+        heongpu::Secretkey<heongpu::Scheme::CKKS> secret_key(context);
+        keygen.generate_secret_key(secret_key);
+
+        heongpu::Publickey<heongpu::Scheme::CKKS> public_key(context);
+        keygen.generate_public_key(public_key, secret_key);
+
+        heongpu::HEEncoder<heongpu::Scheme::CKKS> encoder(context);
+        heongpu::HEEncryptor<heongpu::Scheme::CKKS> encryptor(context,
+                                                              public_key);
+        heongpu::HEDecryptor<heongpu::Scheme::CKKS> decryptor(context,
+                                                              secret_key);
+        heongpu::HEArithmeticOperator<heongpu::Scheme::CKKS> operators(context,
+                                                                       encoder);
+
+        // 4 rotation keys + conjugation key, so some rotations are composed.
+        std::vector<int> workload = {3, 17, 255, 255, -100, 1000};
+        size_t key_size =
+            2 * 5 * 6 * poly_modulus_degree * sizeof(Data64); // Q=5, Q'=6
+        heongpu::Galoiskey<heongpu::Scheme::CKKS> galois_key(
+            context, workload, 5 * key_size);
+        keygen.generate_galois_key(galois_key, secret_key);
+
+        const int row_size = poly_modulus_degree / 2;
+        std::vector<double> message1(row_size, 0);
+        for (int i = 0; i < row_size; i++)
+        {
+            message1[i] = i;
+        }
+
+        double scale = pow(2.0, 30);
+        heongpu::Plaintext<heongpu::Scheme::CKKS> P1(context);
+        encoder.encode(P1, message1, scale);
+
+        for (int shift_count : workload)
+        {
+            std::vector<double> message_rotation_result(row_size, 0);
+            for (int i = 0; i < row_size; i++)
+            {
+                int index = (((i + shift_count) % row_size) + row_size) %
+                            row_size;
+                message_rotation_result[i] = message1[index];
+            }
+
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C1(context);
+            encryptor.encrypt(C1, P1);
+
+            heongpu::Ciphertext<heongpu::Scheme::CKKS> C2(context);
+            operators.rotate_rows(C1, C2, galois_key, shift_count);
+
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P2(context);
+            decryptor.decrypt(P2, C2);
+
+            std::vector<double> gpu_result;
+            encoder.decode(gpu_result, P2);
+
+            // The input ciphertext must be left untouched.
+            heongpu::Plaintext<heongpu::Scheme::CKKS> P3(context);
+            decryptor.decrypt(P3, C1);
+
+            std::vector<double> gpu_input;
+            encoder.decode(gpu_input, P3);
+
+            cudaDeviceSynchronize();
+
+            EXPECT_EQ(fix_point_array_check(message_rotation_result, gpu_result,
+                                            static_cast<double>(1e-1)),
+                      true);
+            EXPECT_EQ(fix_point_array_check(message1, gpu_input,
+                                            static_cast<double>(1e-1)),
+                      true);
+        }
+    }
+
+    cudaDeviceSynchronize();
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
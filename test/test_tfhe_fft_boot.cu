@@ -0,0 +1,127 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+#include <random>
+
+constexpr auto Scheme = heongpu::Scheme::TFHE;
+
+TEST(HEonGPU, TFHE_Host_FFT_Multiplication)
+{
+    const int N = 1024;
+    heongpu::TorusFFT fft(N);
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<uint32_t> torus_dis;
+    std::uniform_int_distribution<int32_t> digit_dis(-512, 511);
+
+    // Torus polynomial times gadget digits, as in the external product.
+    std::vector<int32_t> input1(N), input2(N);
+    for (int i = 0; i < N; i++)
+    {
+        input1[i] = static_cast<int32_t>(torus_dis(gen));
+        input2[i] = digit_dis(gen);
+    }
+
+    std::vector<uint32_t> expected(N, 0);
+    for (int i = 0; i < N; i++)
+    {
+        for (int j = 0; j < N; j++)
+        {
+            uint32_t product = static_cast<uint32_t>(input1[i]) *
+                               static_cast<uint32_t>(input2[j]);
+            if ((i + j) < N)
+            {
+                expected[i + j] += product;
+            }
+            else
+            {
+                expected[i + j - N] -= product;
+            }
+        }
+    }
+
+    std::vector<int32_t> result = fft.multiply(input1, input2);
+    for (int i = 0; i < N; i++)
+    {
+        EXPECT_EQ(static_cast<uint32_t>(result[i]), expected[i]);
+    }
+
+    std::vector<std::complex<double>> transformed;
+    std::vector<int32_t> recovered;
+    fft.forward(input1, transformed);
+    fft.inverse(transformed, recovered);
+    EXPECT_EQ(recovered, input1);
+}
+
+TEST(HEonGPU, TFHE_FFT_Gate_Boots)
+{
+    cudaSetDevice(0);
+    heongpu::HEContext<Scheme> context(
+        heongpu::tfhe_parameter_set::LWE512_K1,
+        heongpu::tfhe_decomposition_profile::THROUGHPUT,
+        heongpu::tfhe_blind_rotation_type::FFT);
+
+    heongpu::HEKeyGenerator<Scheme> keygen(context);
+    heongpu::Secretkey<Scheme> secret_key(context);
+    keygen.generate_secret_key(secret_key);
+
+    heongpu::Bootstrappingkey<Scheme> boot_key(context);
+    keygen.generate_bootstrapping_key(boot_key, secret_key);
+    EXPECT_EQ(boot_key.blind_rotation_type(),
+              heongpu::tfhe_blind_rotation_type::FFT);
+
+    heongpu::HEEncryptor<Scheme> encryptor(context, secret_key);
+    heongpu::HEDecryptor<Scheme> decryptor(context, secret_key);
+    heongpu::HELogicOperator<Scheme> logic(context);
+
+    constexpr size_t size = 64;
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<int> dis(0, 1);
+
+    std::vector<bool> input1(size), input2(size), control(size);
+    std::vector<bool> expected_nand(size), expected_xor(size),
+        expected_mux(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        input1[i] = dis(gen);
+        input2[i] = dis(gen);
+        control[i] = dis(gen);
+        expected_nand[i] = !(input1[i] & input2[i]);
+        expected_xor[i] = input1[i] ^ input2[i];
+        expected_mux[i] = control[i] ? input1[i] : input2[i];
+    }
+
+    heongpu::Ciphertext<Scheme> ct1(context);
+    heongpu::Ciphertext<Scheme> ct2(context);
+    heongpu::Ciphertext<Scheme> ct3(context);
+    encryptor.encrypt(ct1, input1);
+    encryptor.encrypt(ct2, input2);
+    encryptor.encrypt(ct3, control);
+
+    heongpu::Ciphertext<Scheme> result(context);
+    std::vector<bool> decrypted;
+
+    logic.NAND(ct1, ct2, result, boot_key);
+    decryptor.decrypt(result, decrypted);
+    EXPECT_EQ(decrypted, expected_nand);
+
+    logic.XOR(ct1, ct2, result, boot_key);
+    decryptor.decrypt(result, decrypted);
+    EXPECT_EQ(decrypted, expected_xor);
+
+    logic.MUX(ct1, ct2, ct3, result, boot_key);
+    decryptor.decrypt(result, decrypted);
+    EXPECT_EQ(decrypted, expected_mux);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
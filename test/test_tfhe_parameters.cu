@@ -0,0 +1,190 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+
+constexpr auto Scheme = heongpu::Scheme::TFHE;
+
+// Runs NAND, XOR and MUX under a built-in parameter set; MUX takes the
+// three-input path.
+void check_parameter_set_gates(heongpu::tfhe_parameter_set parameter_set,
+                               heongpu::tfhe_decomposition_profile profile,
+                               int expected_n)
+{
+    heongpu::HEContext<Scheme> context(parameter_set, profile);
+
+    heongpu::TFHEParameters parameters = context.get_parameters();
+    EXPECT_EQ(parameters.n, expected_n);
+    EXPECT_EQ(parameters.k, 2);
+    EXPECT_EQ(context.get_sec_level(), heongpu::sec_level_type::none);
+    EXPECT_EQ(context.get_decomposition_profile(), profile);
+
+    heongpu::HEKeyGenerator<Scheme> keygen(context);
+    heongpu::Secretkey<Scheme> secret_key(context);
+    keygen.generate_secret_key(secret_key);
+
+    heongpu::Bootstrappingkey<Scheme> boot_key(context);
+    keygen.generate_bootstrapping_key(boot_key, secret_key);
+
+    heongpu::HEEncryptor<Scheme> encryptor(context, secret_key);
+    heongpu::HEDecryptor<Scheme> decryptor(context, secret_key);
+    heongpu::HELogicOperator<Scheme> logic(context);
+
+    constexpr size_t size = 32;
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<int> dis(0, 1);
+
+    std::vector<bool> input1(size), input2(size), control(size);
+    std::vector<bool> expected_nand(size), expected_xor(size),
+        expected_mux(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        input1[i] = dis(gen);
+        input2[i] = dis(gen);
+        control[i] = dis(gen);
+        expected_nand[i] = !(input1[i] & input2[i]);
+        expected_xor[i] = input1[i] ^ input2[i];
+        expected_mux[i] = control[i] ? input1[i] : input2[i];
+    }
+
+    heongpu::Ciphertext<Scheme> ct1(context);
+    heongpu::Ciphertext<Scheme> ct2(context);
+    heongpu::Ciphertext<Scheme> ct3(context);
+    encryptor.encrypt(ct1, input1);
+    encryptor.encrypt(ct2, input2);
+    encryptor.encrypt(ct3, control);
+
+    heongpu::Ciphertext<Scheme> result(context);
+    std::vector<bool> decrypted;
+
+    logic.NAND(ct1, ct2, result, boot_key);
+    decryptor.decrypt(result, decrypted);
+    EXPECT_EQ(decrypted, expected_nand);
+
+    logic.XOR(ct1, ct2, result, boot_key);
+    decryptor.decrypt(result, decrypted);
+    EXPECT_EQ(decrypted, expected_xor);
+
+    logic.MUX(ct1, ct2, ct3, result, boot_key);
+    decryptor.decrypt(result, decrypted);
+    EXPECT_EQ(decrypted, expected_mux);
+}
+
+TEST(HEonGPU, TFHE_Parameter_Sets)
+{
+    cudaSetDevice(0);
+
+    check_parameter_set_gates(heongpu::tfhe_parameter_set::LWE768_K2,
+                              heongpu::tfhe_decomposition_profile::THROUGHPUT,
+                              768);
+
+    // n = 1024 is the largest dimension the key switching kernel accepts.
+    check_parameter_set_gates(heongpu::tfhe_parameter_set::LWE1024_K2,
+                              heongpu::tfhe_decomposition_profile::BALANCED,
+                              1024);
+}
+
+TEST(HEonGPU, TFHE_Parameter_Validation_And_Serialization)
+{
+    cudaSetDevice(0);
+
+    heongpu::TFHEParameters parameters =
+        heongpu::HEContext<Scheme>::get_parameter_set(
+            heongpu::tfhe_parameter_set::LWE1024_K2,
+            heongpu::tfhe_decomposition_profile::BALANCED);
+    EXPECT_EQ(parameters.n, 1024);
+    EXPECT_EQ(parameters.sec_level, heongpu::sec_level_type::none);
+
+    heongpu::TFHEParameters invalid = parameters;
+    invalid.N = 2048;
+    EXPECT_THROW(heongpu::HEContext<Scheme> context(invalid),
+                 std::invalid_argument);
+
+    invalid = parameters;
+    invalid.bk_l = 5;
+    invalid.bk_bg_bit = 7;
+    EXPECT_THROW(heongpu::HEContext<Scheme> context(invalid),
+                 std::invalid_argument);
+
+    EXPECT_THROW(heongpu::HEContext<Scheme>::get_parameter_set(
+                     static_cast<heongpu::tfhe_parameter_set>(0),
+                     heongpu::tfhe_decomposition_profile::BALANCED),
+                 std::invalid_argument);
+
+    heongpu::HEContext<Scheme> context(parameters);
+    EXPECT_EQ(context.get_decomposition_profile(),
+              heongpu::tfhe_decomposition_profile::NONE);
+
+    std::stringstream stream;
+    context.save(stream);
+
+    // The default context keeps the label of the original parameters.
+    heongpu::HEContext<Scheme> loaded;
+    EXPECT_EQ(loaded.get_sec_level(), heongpu::sec_level_type::sec128);
+    EXPECT_EQ(loaded.get_parameters().n, 512);
+
+    loaded.load(stream);
+
+    heongpu::TFHEParameters loaded_parameters = loaded.get_parameters();
+    EXPECT_EQ(loaded.get_sec_level(), heongpu::sec_level_type::none);
+    EXPECT_EQ(loaded_parameters.n, parameters.n);
+    EXPECT_EQ(loaded_parameters.k, parameters.k);
+    EXPECT_EQ(loaded_parameters.bk_l, parameters.bk_l);
+    EXPECT_EQ(loaded_parameters.bk_bg_bit, parameters.bk_bg_bit);
+    EXPECT_EQ(loaded_parameters.ks_base_bit, parameters.ks_base_bit);
+    EXPECT_EQ(loaded_parameters.ks_length, parameters.ks_length);
+    EXPECT_EQ(loaded_parameters.bk_stdev, parameters.bk_stdev);
+    EXPECT_EQ(loaded.get_blind_rotation_type(),
+              heongpu::tfhe_blind_rotation_type::NTT);
+
+    heongpu::HEContext<Scheme> fft_context(
+        heongpu::tfhe_parameter_set::LWE512_K1,
+        heongpu::tfhe_decomposition_profile::THROUGHPUT,
+        heongpu::tfhe_blind_rotation_type::FFT);
+
+    std::stringstream fft_stream;
+    fft_context.save(fft_stream);
+    loaded.load(fft_stream);
+    EXPECT_EQ(loaded.get_blind_rotation_type(),
+              heongpu::tfhe_blind_rotation_type::FFT);
+    EXPECT_EQ(loaded.get_decomposition_profile(),
+              heongpu::tfhe_decomposition_profile::THROUGHPUT);
+
+    // Streams written before versioning end without the blind rotation type.
+    std::stringstream legacy_stream;
+    heongpu::scheme_type scheme = heongpu::scheme_type::tfhe;
+    heongpu::tfhe_decomposition_profile profile =
+        heongpu::tfhe_decomposition_profile::NONE;
+    legacy_stream.write((char*) &scheme, sizeof(scheme));
+    legacy_stream.write((char*) &profile, sizeof(profile));
+    legacy_stream.write((char*) &parameters.sec_level,
+                        sizeof(parameters.sec_level));
+    for (int value : {parameters.n, parameters.N, parameters.k,
+                      parameters.bk_l, parameters.bk_bg_bit,
+                      parameters.ks_base_bit, parameters.ks_length})
+    {
+        legacy_stream.write((char*) &value, sizeof(value));
+    }
+    for (double value :
+         {parameters.ks_stdev, parameters.bk_stdev, parameters.max_stdev})
+    {
+        legacy_stream.write((char*) &value, sizeof(value));
+    }
+
+    loaded.load(legacy_stream);
+    EXPECT_EQ(loaded.get_blind_rotation_type(),
+              heongpu::tfhe_blind_rotation_type::NTT);
+    EXPECT_EQ(loaded.get_parameters().n, parameters.n);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,95 @@
+// Copyright 2024-2025 Alişah Özcan
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+// Developer: Alişah Özcan
+
+#include "heongpu.cuh"
+#include <gtest/gtest.h>
+#include <random>
+
+constexpr auto Scheme = heongpu::Scheme::TFHE;
+
+TEST(HEonGPU, TFHE_Programmable_Bootstrapping)
+{
+    cudaSetDevice(0);
+    heongpu::HEContext<Scheme> context;
+
+    heongpu::HEKeyGenerator<Scheme> keygen(context);
+    heongpu::Secretkey<Scheme> secret_key(context);
+    keygen.generate_secret_key(secret_key);
+
+    heongpu::Bootstrappingkey<Scheme> boot_key(context);
+    keygen.generate_bootstrapping_key(boot_key, secret_key);
+
+    heongpu::HEEncryptor<Scheme> encryptor(context, secret_key);
+    heongpu::HEDecryptor<Scheme> decryptor(context, secret_key);
+    heongpu::HELogicOperator<Scheme> logic(context);
+
+    // 2-bit messages.
+    constexpr uint32_t message_modulus = 4;
+    constexpr size_t size = 64;
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<uint32_t> dis(0, message_modulus - 1);
+
+    std::vector<uint32_t> messages(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        messages[i] = dis(gen);
+    }
+
+    heongpu::Ciphertext<Scheme> ct(context);
+    encryptor.encrypt(ct, messages, message_modulus);
+
+    // f(m) = m^2 + 1 mod 4
+    std::vector<uint32_t> square_plus_one = {1, 2, 1, 2};
+    // g(m) = 3 - m
+    std::vector<uint32_t> negate = {3, 2, 1, 0};
+    // h(m) = m > 1
+    std::vector<uint32_t> greater_than_one = {0, 0, 1, 1};
+
+    heongpu::Ciphertext<Scheme> result(context);
+    logic.programmable_bootstrapping(ct, result, square_plus_one, boot_key);
+
+    std::vector<uint32_t> decrypted;
+    decryptor.decrypt(result, decrypted, message_modulus);
+    for (size_t i = 0; i < size; ++i)
+    {
+        EXPECT_EQ(decrypted[i], square_plus_one[messages[i]]);
+    }
+
+    // Outputs are in the input message space, so bootstrappings compose.
+    heongpu::Ciphertext<Scheme> result2(context);
+    logic.programmable_bootstrapping(result, result2, negate, boot_key);
+    decryptor.decrypt(result2, decrypted, message_modulus);
+    for (size_t i = 0; i < size; ++i)
+    {
+        EXPECT_EQ(decrypted[i], negate[square_plus_one[messages[i]]]);
+    }
+
+    std::vector<std::vector<uint32_t>> luts = {square_plus_one, negate,
+                                               greater_than_one};
+    std::vector<heongpu::Ciphertext<Scheme>> results;
+    logic.multi_value_bootstrapping(ct, results, luts, boot_key);
+    ASSERT_EQ(results.size(), luts.size());
+
+    for (size_t j = 0; j < luts.size(); ++j)
+    {
+        decryptor.decrypt(results[j], decrypted, message_modulus);
+        for (size_t i = 0; i < size; ++i)
+        {
+            EXPECT_EQ(decrypted[i], luts[j][messages[i]]);
+        }
+    }
+
+    std::vector<uint32_t> invalid_lut = {0, 1, 2};
+    EXPECT_THROW(
+        logic.programmable_bootstrapping(ct, result, invalid_lut, boot_key),
+        std::invalid_argument);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}